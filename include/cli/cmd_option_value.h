@@ -24,6 +24,7 @@
 #include "std/smart_ptr.h"
 
 #include <common/string_oprs.h>
+#include <string/number_conv.h>
 
 namespace util {
     namespace cli {
@@ -33,8 +34,15 @@ namespace util {
 
             struct string2any {
 
+                // 0: 其他类型, 1: 整数, 2: 浮点数(long double精度更高，仍然走stringstream)
                 template <typename Tt>
-                static UTIL_FORCEINLINE Tt conv(const std::string &s, Tt *) {
+                struct number_kind
+                    : public std::integral_constant<int, std::is_integral<Tt>::value
+                                                             ? 1
+                                                             : ((std::is_floating_point<Tt>::value && sizeof(Tt) <= sizeof(double)) ? 2 : 0)> {};
+
+                template <typename Tt>
+                static UTIL_FORCEINLINE Tt conv_number(const std::string &s, Tt *, std::integral_constant<int, 0>) {
                     Tt ret;
                     std::stringstream ss;
                     ss.str(s);
@@ -42,6 +50,40 @@ namespace util {
                     return ret;
                 }
 
+                template <typename Tt>
+                static UTIL_FORCEINLINE Tt conv_number(const std::string &s, Tt *, std::integral_constant<int, 1>) {
+                    return util::string::to_int<Tt>(s.c_str());
+                }
+
+                template <typename Tt>
+                static inline Tt conv_number(const std::string &s, Tt *, std::integral_constant<int, 2>) {
+                    // 和stringstream一样跳过前面的空白字符，不能转换时返回0
+                    size_t start = 0;
+                    while (start < s.size() && (' ' == s[start] || '\t' == s[start] || '\r' == s[start] || '\n' == s[start])) {
+                        ++start;
+                    }
+
+                    double ret = 0.0;
+                    util::string::parse_double(ret, s.c_str() + start, s.size() - start);
+                    return static_cast<Tt>(ret);
+                }
+
+                static inline float conv_number(const std::string &s, float *, std::integral_constant<int, 2>) {
+                    size_t start = 0;
+                    while (start < s.size() && (' ' == s[start] || '\t' == s[start] || '\r' == s[start] || '\n' == s[start])) {
+                        ++start;
+                    }
+
+                    float ret = 0.0f;
+                    util::string::parse_float(ret, s.c_str() + start, s.size() - start);
+                    return ret;
+                }
+
+                template <typename Tt>
+                static UTIL_FORCEINLINE Tt conv(const std::string &s, Tt *) {
+                    return conv_number(s, reinterpret_cast<Tt *>(NULL), std::integral_constant<int, number_kind<Tt>::value>());
+                }
+
                 static UTIL_FORCEINLINE const std::string &conv(const std::string &s, std::string *) { return s; }
 
                 // static const char *conv(const std::string &s, const char **) { return s.c_str(); }
@@ -52,16 +94,9 @@ namespace util {
                     return static_cast<unsigned char>(s.empty() ? 0 : s[0]);
                 }
 
-                static UTIL_FORCEINLINE int16_t conv(const std::string &s, int16_t *) { return util::string::to_int<int16_t>(s.c_str()); }
-
-                static UTIL_FORCEINLINE uint16_t conv(const std::string &s, uint16_t *) { return util::string::to_int<int16_t>(s.c_str()); }
-
-                static UTIL_FORCEINLINE int32_t conv(const std::string &s, int32_t *) { return util::string::to_int<int32_t>(s.c_str()); }
-
-                static UTIL_FORCEINLINE uint32_t conv(const std::string &s, uint32_t *) { return util::string::to_int<uint32_t>(s.c_str()); }
-
-                static UTIL_FORCEINLINE int64_t conv(const std::string &s, int64_t *) { return util::string::to_int<int64_t>(s.c_str()); }
-                static UTIL_FORCEINLINE uint64_t conv(const std::string &s, uint64_t *) { return util::string::to_int<uint64_t>(s.c_str()); }
+                static UTIL_FORCEINLINE signed char conv(const std::string &s, signed char *) {
+                    return static_cast<signed char>(s.empty() ? 0 : s[0]);
+                }
 
                 static UTIL_FORCEINLINE bool conv(const std::string &s, bool *) { return !s.empty() && "0" != s; }
             };
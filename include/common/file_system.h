@@ -19,12 +19,14 @@
 
 #include <climits>
 #include <cstdio>
+#include <functional>
 #include <list>
 #include <string>
 #include <vector>
 
 #include <config/atframe_utils_build_feature.h>
 #include <config/compile_optimize.h>
+#include <design_pattern/noncopyable.h>
 #include <std/explicit_declare.h>
 
 #if defined(__CYGWIN__) // Windows Cygwin
@@ -114,6 +116,142 @@ namespace util {
             };
         };
 
+        struct mmap_opt_t {
+            enum type {
+                EN_MOT_NORMAL     = 0x00, // 默认的预读策略
+                EN_MOT_SEQUENTIAL = 0x01, // 顺序读取，加大预读
+                EN_MOT_RANDOM     = 0x02, // 随机读取，关闭预读
+                EN_MOT_WILLNEED   = 0x04, // 马上会用到，提前加载到页缓存
+                EN_MOT_HUGEPAGE   = 0x08, // 尽量按大页对齐并使用透明大页(仅Linux)
+            };
+        };
+
+        /**
+         * @brief 只读的内存映射文件，析构时自动解除映射
+         * @note 映射失败(比如/proc下的虚拟文件)时，get_file_content会把内容读到内部的缓冲区，data()和size()的用法不变
+         */
+        class mapped_file {
+            UTIL_DESIGN_PATTERN_NOCOPYABLE(mapped_file)
+
+        public:
+            LIBATFRAME_UTILS_API mapped_file();
+            LIBATFRAME_UTILS_API ~mapped_file();
+
+#if defined(UTIL_CONFIG_COMPILER_CXX_RVALUE_REFERENCES) && UTIL_CONFIG_COMPILER_CXX_RVALUE_REFERENCES
+            LIBATFRAME_UTILS_API mapped_file(mapped_file &&other);
+            LIBATFRAME_UTILS_API mapped_file &operator=(mapped_file &&other);
+#endif
+
+            /**
+             * @brief 映射文件
+             * @param file_path [IN] 文件路径
+             * @param options [IN] mmap_opt_t 的组合
+             * @param offset [IN] 开始位置，不需要按页对齐
+             * @param length [IN] 映射的长度，0表示到文件末尾
+             * @return 成功返回0，错误返回错误码(不同平台错误码不同)
+             */
+            LIBATFRAME_UTILS_API int open(const char *file_path, int options = mmap_opt_t::EN_MOT_NORMAL, size_t offset = 0,
+                                          size_t length = 0);
+
+            LIBATFRAME_UTILS_API void close();
+
+            /**
+             * @brief 修改访问模式的提示
+             * @param options [IN] mmap_opt_t 的组合
+             * @param offset [IN] 相对于data()的位置
+             * @param length [IN] 长度，0表示到末尾
+             */
+            LIBATFRAME_UTILS_API void advise(int options, size_t offset = 0, size_t length = 0);
+
+            LIBATFRAME_UTILS_API void swap(mapped_file &other);
+
+            inline const char *data() const { return data_; }
+            inline size_t      size() const { return size_; }
+            inline bool        empty() const { return 0 == size_; }
+            inline bool        is_mapped() const { return NULL != map_base_; }
+            inline std::string to_string() const { return std::string(data_, size_); }
+
+        private:
+            friend class file_system;
+
+            const char *data_;
+            size_t      size_;
+            void *      map_base_; // 按页对齐的起始地址
+            size_t      map_size_;
+            std::string buffer_; // 无法映射时的缓冲区
+#ifdef UTIL_FS_WINDOWS_API
+            void *map_handle_;
+#endif
+        };
+
+        /**
+         * @brief 分块读取的回调
+         * @return 返回false时停止读取
+         */
+        typedef std::function<bool(const char *data, size_t sz)> chunk_callback_t;
+
+        struct dir_entry_t {
+            const char *name; // 只在下一次调用next前有效
+            size_t      name_len;
+            int         type; // dir_opt_t 中的类型(EN_DOT_TDIR、EN_DOT_TREG等)，无法识别时为0
+        };
+
+        /**
+         * @brief 逐项读取目录的迭代器，直接使用目录项中的类型，只有文件系统不支持时才会stat
+         * @note Linux下使用getdents64批量读取目录项
+         */
+        class dir_iterator {
+            UTIL_DESIGN_PATTERN_NOCOPYABLE(dir_iterator)
+
+        public:
+            LIBATFRAME_UTILS_API dir_iterator();
+            LIBATFRAME_UTILS_API ~dir_iterator();
+
+            /**
+             * @brief 打开目录
+             * @param dir_path [IN] 目录路径
+             * @return 成功返回0，错误返回错误码(不同平台错误码不同)
+             */
+            LIBATFRAME_UTILS_API int open(const char *dir_path);
+
+            /**
+             * @brief 读取下一项，包括.和..
+             * @param out [OUT] 目录项
+             * @return 读到时返回true，结束或出错时返回false，出错时get_error()不为0
+             */
+            LIBATFRAME_UTILS_API bool next(dir_entry_t &out);
+
+            LIBATFRAME_UTILS_API void close();
+
+            inline int get_error() const { return error_; }
+
+        private:
+#if defined(UTIL_FS_WINDOWS_API)
+            void *handle_;
+            void *find_data_;
+            bool  has_pending_;
+#elif defined(__linux__)
+            int               fd_;
+            std::vector<char> buffer_;
+            size_t            buffer_offset_;
+            size_t            buffer_length_;
+#else
+            void *dir_;
+#endif
+            int error_;
+        };
+
+        /**
+         * @brief 目录项的过滤器
+         * @return 返回false时跳过这一项，跳过的目录不会递归扫描
+         */
+        typedef std::function<bool(const std::string &parent_dir, const dir_entry_t &entry)> dir_filter_t;
+
+        /**
+         * @brief 目录扫描的回调
+         */
+        typedef std::function<void(const std::string &path, int type)> dir_callback_t;
+
     public:
         /**
          * @brief 获取文件内容
@@ -124,6 +262,46 @@ namespace util {
          */
         static LIBATFRAME_UTILS_API bool get_file_content(std::string &out, const char *file_path, bool is_binary = false);
 
+        /**
+         * @brief 获取文件内容，优先使用内存映射，不复制数据
+         * @param out [OUT] 输出的文件视图
+         * @param file_path [IN] 文件路径
+         * @param options [IN] mmap_opt_t 的组合
+         * @return 成功返回true
+         */
+        static LIBATFRAME_UTILS_API bool get_file_content(mapped_file &out, const char *file_path,
+                                                          int options = mmap_opt_t::EN_MOT_SEQUENTIAL);
+
+        /**
+         * @brief 分块读取文件，适用于不需要一次性放进内存的大文件
+         * @param file_path [IN] 文件路径
+         * @param fn [IN] 每块数据的回调，数据只在回调内有效
+         * @param chunk_size [IN] 每块的最大长度
+         * @return 读完或被回调中止返回true，打开或读取失败返回false
+         */
+        static LIBATFRAME_UTILS_API bool read_file_chunks(const char *file_path, const chunk_callback_t &fn, size_t chunk_size = 65536);
+
+        /**
+         * @brief 复制文件，Linux下优先使用copy_file_range/sendfile在内核中复制
+         * @param from [IN] 源文件路径
+         * @param to [IN] 目标文件路径，已存在时会被覆盖
+         * @return 成功返回0，错误返回错误码(不同平台错误码不同)
+         */
+        static LIBATFRAME_UTILS_API int copy_file(const char *from, const char *to);
+
+#ifdef UTIL_FS_POSIX_API
+        /**
+         * @brief 把文件内容发送到文件描述符(通常是socket)，Linux下使用sendfile
+         * @param out_fd [IN] 目标文件描述符
+         * @param file_path [IN] 文件路径
+         * @param offset [IN] 文件中的开始位置
+         * @param length [IN] 发送的长度，0表示到文件末尾
+         * @param sent [OUT] 已发送的长度，非阻塞的描述符返回EAGAIN时可以从offset + sent继续发送
+         * @return 成功返回0，错误返回errno
+         */
+        static LIBATFRAME_UTILS_API int send_file(int out_fd, const char *file_path, size_t offset, size_t length, size_t &sent);
+#endif
+
         /**
          * @brief 获取文件内容
          * @param out [OUT] 输出变量
@@ -210,6 +388,19 @@ namespace util {
         static LIBATFRAME_UTILS_API int scan_dir(const char *dir_path, std::list<std::string> &out,
                                                  int options = dir_opt_t::EN_DOT_DAFAULT);
 
+        /**
+         * @brief 遍历目录，规则和scan_dir一致，递归时可以把子目录分给多个线程并行扫描
+         * @param dir_path 目录路径
+         * @param fn 每个符合条件的路径的回调，多个线程时会在不同的线程中并发调用
+         * @param options 扫描选项
+         * @param thread_count 线程数，0表示CPU核数，1表示只在当前线程中扫描
+         * @param filter 目录项的过滤器，可以为空
+         * @return 成功返回0，错误返回错误码(不同平台错误码不同)，子目录打开失败时会跳过
+         */
+        static LIBATFRAME_UTILS_API int walk_dir(const char *dir_path, const dir_callback_t &fn,
+                                                 int options = dir_opt_t::EN_DOT_DAFAULT | dir_opt_t::EN_DOT_RECU, size_t thread_count = 1,
+                                                 const dir_filter_t &filter = dir_filter_t());
+
         /**
          * @brief 判断是否是绝对路径
          * @param dir_path 目录路径
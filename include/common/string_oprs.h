@@ -8,7 +8,8 @@
  * @date 2015.11.24
  *
  * @history
- *
+ *     2026.10.17: 整数转字符串使用两位数字表，字符串转整数使用SWAR一次处理8个数字
+ *     2026.10.17: 16进制转换、大小写转换和忽略大小写比较增加SIMD实现(运行时选择)
  *
  */
 
@@ -62,6 +63,20 @@
 #define UTIL_STRFUNC_VSNPRINTF(buffer, bufsz, fmt, arg) vsnprintf(buffer, static_cast<int>(bufsz), fmt, arg)
 #endif
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>
+#endif
+
+// 小端平台上使用SWAR(一次处理8个字节)解析数字
+#ifndef UTIL_STRFUNC_SWAR_LITTLE_ENDIAN
+#if (defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || \
+    defined(_M_X64) || defined(_M_IX86) || defined(_M_ARM64) || defined(__x86_64__) || defined(__i386__)
+#define UTIL_STRFUNC_SWAR_LITTLE_ENDIAN 1
+#else
+#define UTIL_STRFUNC_SWAR_LITTLE_ENDIAN 0
+#endif
+#endif
+
 namespace util {
     namespace string {
         /**
@@ -188,30 +203,149 @@ namespace util {
             reverse<TCH, TCH *>(begin, reinterpret_cast<TCH *>(static_cast<intptr_t>(end_any)));
         }
 
-        template <typename T>
-        LIBATFRAME_UTILS_API_HEAD_ONLY size_t int2str_unsigned(char *str, size_t strsz, T in) {
-            if (0 == strsz) {
-                return 0;
+        namespace detail {
+            /**
+             * @brief 00-99的两位数字表，一次输出两位
+             */
+            LIBATFRAME_UTILS_API_HEAD_ONLY inline const char *int2str_digit_pairs() {
+                static const char ret[201] = "0001020304050607080910111213141516171819"
+                                             "2021222324252627282930313233343536373839"
+                                             "4041424344454647484950515253545556575859"
+                                             "6061626364656667686970717273747576777879"
+                                             "8081828384858687888990919293949596979899";
+                return ret;
             }
 
-            if (0 == in) {
-                *str = '0';
-                return 1;
+            /**
+             * @brief 从后往前输出十进制数字
+             * @param end 输出的结束位置，调用方保证前面有足够的空间
+             * @param in 输入的数字
+             */
+            template <typename T>
+            LIBATFRAME_UTILS_API_HEAD_ONLY inline void int2str_write_backward(char *end, T in) {
+                const char *pairs = int2str_digit_pairs();
+                while (in >= 100) {
+                    size_t idx = static_cast<size_t>(in % 100) * 2;
+                    in /= 100;
+                    end -= 2;
+                    end[0] = pairs[idx];
+                    end[1] = pairs[idx + 1];
+                }
+
+                if (in < 10) {
+                    *(--end) = static_cast<char>('0' + in);
+                } else {
+                    size_t idx = static_cast<size_t>(in) * 2;
+                    end -= 2;
+                    end[0] = pairs[idx];
+                    end[1] = pairs[idx + 1];
+                }
+            }
+
+            /**
+             * @brief 8个连续的字节(小端加载)是否都是数字
+             */
+            LIBATFRAME_UTILS_API_HEAD_ONLY inline bool str2int_is_eight_digits(uint64_t val) {
+                return 0 == (((val + 0x4646464646464646ULL) | (val - 0x3030303030303030ULL)) & 0x8080808080808080ULL);
             }
 
-            size_t ret = 0;
-            while (ret < strsz && in > 0) {
-                str[ret] = (in % 10) + '0';
+            /**
+             * @brief 8个数字(小端加载)转整数
+             */
+            LIBATFRAME_UTILS_API_HEAD_ONLY inline uint32_t str2int_parse_eight_digits(uint64_t val) {
+                val -= 0x3030303030303030ULL;
+                val = (val * 10) + (val >> 8);
+                val = (((val & 0x000000FF000000FFULL) * 0x000F424000000064ULL) +
+                       (((val >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >>
+                      32;
+                return static_cast<uint32_t>(val);
+            }
 
-                in /= 10;
-                ++ret;
+            LIBATFRAME_UTILS_API_HEAD_ONLY inline uint64_t str2int_load_u64(const char *str) {
+                uint64_t ret;
+                memcpy(&ret, str, sizeof(ret));
+                return ret;
             }
 
-            if (in > 0 && ret >= strsz) {
+            /**
+             * @brief 转换已知都是数字的字符串，溢出时按2^64取模
+             * @param str 字符串
+             * @param sz 数字个数
+             */
+            LIBATFRAME_UTILS_API_HEAD_ONLY inline uint64_t str2int_parse_digits(const char *str, size_t sz) {
+                uint64_t ret = 0;
+#if UTIL_STRFUNC_SWAR_LITTLE_ENDIAN
+                while (sz >= 8) {
+                    ret = ret * 100000000ULL + str2int_parse_eight_digits(str2int_load_u64(str));
+                    str += 8;
+                    sz -= 8;
+                }
+#endif
+                while (sz > 0) {
+                    ret = ret * 10 + static_cast<uint64_t>(*str - '0');
+                    ++str;
+                    --sz;
+                }
+                return ret;
+            }
+        } // namespace detail
+
+        /**
+         * @brief 十进制数字的位数
+         * @param in 输入的数字
+         * @return 位数(0的位数是1)
+         */
+        LIBATFRAME_UTILS_API_HEAD_ONLY inline size_t count_digits(uint64_t in) {
+            static const uint64_t zero_or_powers_of_10[] = {0ULL,
+                                                            10ULL,
+                                                            100ULL,
+                                                            1000ULL,
+                                                            10000ULL,
+                                                            100000ULL,
+                                                            1000000ULL,
+                                                            10000000ULL,
+                                                            100000000ULL,
+                                                            1000000000ULL,
+                                                            10000000000ULL,
+                                                            100000000000ULL,
+                                                            1000000000000ULL,
+                                                            10000000000000ULL,
+                                                            100000000000000ULL,
+                                                            1000000000000000ULL,
+                                                            10000000000000000ULL,
+                                                            100000000000000000ULL,
+                                                            1000000000000000000ULL,
+                                                            10000000000000000000ULL};
+
+            // log10(x) ~= log2(x) * 1233 / 4096
+#if defined(__GNUC__) || defined(__clang__)
+            size_t bits = 64 - static_cast<size_t>(__builtin_clzll(in | 1));
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+            unsigned long highest_bit;
+            _BitScanReverse64(&highest_bit, in | 1);
+            size_t bits = static_cast<size_t>(highest_bit) + 1;
+#else
+            size_t   bits = 1;
+            uint64_t left = in >> 1;
+            while (left) {
+                ++bits;
+                left >>= 1;
+            }
+#endif
+            size_t t = (bits * 1233) >> 12;
+            return t - (in < zero_or_powers_of_10[t] ? 1 : 0) + 1;
+        }
+
+        template <typename T>
+        LIBATFRAME_UTILS_API_HEAD_ONLY size_t int2str_unsigned(char *str, size_t strsz, T in) {
+            size_t ret = count_digits(static_cast<uint64_t>(in));
+            if (ret > strsz) {
                 return 0;
             }
 
-            reverse(str, str + ret);
+            // 32位以内的数字用32位除法
+            typedef typename std::conditional<sizeof(T) <= sizeof(uint32_t), uint32_t, uint64_t>::type calc_type;
+            detail::int2str_write_backward(str + ret, static_cast<calc_type>(in));
             return ret;
         }
 
@@ -222,8 +356,9 @@ namespace util {
             }
 
             if (in < 0) {
+                typedef typename std::make_unsigned<T>::type unsigned_type;
                 *str       = '-';
-                size_t ret = int2str_unsigned(str + 1, strsz - 1, static_cast<typename std::make_unsigned<T>::type>(-in));
+                size_t ret = int2str_unsigned(str + 1, strsz - 1, static_cast<unsigned_type>(0 - static_cast<unsigned_type>(in)));
                 if (0 == ret) {
                     return 0;
                 }
@@ -305,10 +440,11 @@ namespace util {
                     out += str[i] - '0';
                 }
             } else { // dec
-                for (size_t i = 0; str[i] >= '0' && str[i] <= '9'; ++i) {
-                    out *= 10;
-                    out += str[i] - '0';
+                size_t len = 0;
+                while (str[len] >= '0' && str[len] <= '9') {
+                    ++len;
                 }
+                out = static_cast<T>(detail::str2int_parse_digits(str, len));
             }
 
             if (is_negative) {
@@ -444,6 +580,92 @@ namespace util {
             }
         }
 
+        /**
+         * @brief 字符转16进制表示(按CPU特性选择AVX2/SSSE3/NEON实现)
+         * @param src 输入的buffer
+         * @param ss 输入的buffer长度
+         * @param out 输出buffer(长度至少为ss*2)
+         * @param upper_case 是否大写
+         */
+        LIBATFRAME_UTILS_API void dumphex(const void *src, size_t ss, char *out, bool upper_case = false);
+
+        /**
+         * @brief 字符转16进制表示(按CPU特性选择AVX2/SSSE3/NEON实现)
+         * @param src 输入的buffer
+         * @param ss 输入的buffer长度
+         * @param out 输出缓冲区
+         * @param upper_case 是否大写
+         */
+        LIBATFRAME_UTILS_API void dumphex(const void *src, size_t ss, std::ostream &out, bool upper_case = false);
+
+        /**
+         * @brief 16进制表示转字符
+         * @param dst 输出buffer
+         * @param dlen 输出buffer长度
+         * @param olen 缓冲区不足时输出需要的长度，有非法字符时输出已转换的长度，否则输出转换后的长度
+         * @param src 16进制字符串(不区分大小写)
+         * @param slen 16进制字符串长度
+         * @return 成功返回0，缓冲区不足返回-1，长度不是偶数或者有非法字符返回-2
+         */
+        LIBATFRAME_UTILS_API int hex_decode(void *dst, size_t dlen, size_t *olen, const char *src, size_t slen);
+
+        /**
+         * @brief 字符转8进制表示，可打印字符的连续区间使用SIMD查找并整块复制
+         * @param src 输入的buffer
+         * @param ss 输入的buffer长度
+         * @param out 输出buffer
+         * @param os 输出buffer长度，回传输出缓冲区使用的长度
+         */
+        LIBATFRAME_UTILS_API void serialization(const void *src, size_t ss, char *out, size_t &os);
+
+        /**
+         * @brief 字符转8进制表示，可打印字符的连续区间使用SIMD查找并整块复制
+         * @param src 输入的buffer
+         * @param ss 输入的buffer长度
+         * @param out 输出缓冲区
+         */
+        LIBATFRAME_UTILS_API void serialization(const void *src, size_t ss, std::ostream &out);
+
+        /**
+         * @brief 批量转小写(仅ASCII)
+         * @param dst 输出buffer(长度至少为sz)，可以和src相同
+         * @param src 输入的buffer
+         * @param sz 输入的buffer长度
+         */
+        LIBATFRAME_UTILS_API void tolower(char *dst, const char *src, size_t sz);
+
+        /**
+         * @brief 批量转大写(仅ASCII)
+         * @param dst 输出buffer(长度至少为sz)，可以和src相同
+         * @param src 输入的buffer
+         * @param sz 输入的buffer长度
+         */
+        LIBATFRAME_UTILS_API void toupper(char *dst, const char *src, size_t sz);
+
+        /**
+         * @brief 忽略大小写(仅ASCII)比较固定长度的数据，不会在\0处停止
+         * @param l 左边的数据
+         * @param r 右边的数据
+         * @param sz 比较的长度
+         * @return 按转小写后的无符号字节比较，l<r返回负数，l==r返回0，l>r返回正数
+         */
+        LIBATFRAME_UTILS_API int case_compare(const char *l, const char *r, size_t sz);
+
+        /**
+         * @brief 忽略大小写(仅ASCII)按字典序比较
+         * @param l 左边的数据
+         * @param lsz 左边的数据长度
+         * @param r 右边的数据
+         * @param rsz 右边的数据长度
+         * @return l<r返回负数，l==r返回0，l>r返回正数
+         */
+        LIBATFRAME_UTILS_API int case_compare(const char *l, size_t lsz, const char *r, size_t rsz);
+
+        /**
+         * @brief 忽略大小写(仅ASCII)判断是否相等
+         */
+        LIBATFRAME_UTILS_API bool case_equal(const char *l, size_t lsz, const char *r, size_t rsz);
+
         /**
          * @brief 提取版本号
          * @param v 版本号字符串(a.b.c.d...)
@@ -0,0 +1,230 @@
+﻿/**
+ * @file dense_state_machine.h
+ * @brief 适用于连续的小范围枚举状态的有限状态机，使用稠密的转移表
+ * Licensed under the MIT licenses.
+ *
+ * @note 状态机定义(允许的转移和回调)和状态分离，定义只读并且可以被所有实例共享，每个实例只保存当前状态
+ *
+ * @version 1.0
+ * @author owent
+ * @date 2026.10.18
+ *
+ */
+
+#ifndef UTIL_DS_DENSE_STATE_MACHINE_H
+#define UTIL_DS_DENSE_STATE_MACHINE_H
+
+#pragma once
+
+#include <bitset>
+#include <cstddef>
+#include <functional>
+#include <stdint.h>
+#include <vector>
+
+#include <config/compiler_features.h>
+
+#include "std/smart_ptr.h"
+
+#include <config/atframe_utils_build_feature.h>
+
+namespace util {
+    namespace ds {
+        /**
+         * @brief 稠密状态机的定义，包含允许的转移和所有回调
+         * @note 状态的取值必须是[0, STATE_COUNT)。
+         *       转移表是STATE_COUNT*STATE_COUNT的位图，回调按(离开状态、进入状态、转移)分槽连续存放在一个数组里，
+         *       切换状态时只有一次位图检查和几次数组下标访问。
+         * @note 初始化完成后请只通过const引用或者std::shared_ptr<const ...>使用，切换状态时不会修改定义
+         */
+        template <typename T, size_t STATE_COUNT, typename... TParams>
+        class LIBATFRAME_UTILS_API_HEAD_ONLY dense_state_machine_definition {
+        public:
+            UTIL_CONFIG_STATIC_ASSERT(STATE_COUNT > 0 && STATE_COUNT <= 256);
+
+            typedef T                                                     key_type;
+            typedef std::function<void(key_type, key_type, TParams...)>   value_type;
+            typedef std::shared_ptr<dense_state_machine_definition>       ptr_t;
+            typedef std::shared_ptr<const dense_state_machine_definition> const_ptr_t;
+
+            struct transition_t {
+                key_type from;
+                key_type to;
+            };
+
+            enum {
+                STATE_SIZE = STATE_COUNT,
+                SLOT_LEAVE = 0,
+                SLOT_ENTER = STATE_COUNT,
+                SLOT_PAIRS = STATE_COUNT * 2,
+                SLOT_COUNT = STATE_COUNT * 2 + STATE_COUNT * STATE_COUNT,
+            };
+
+        public:
+            dense_state_machine_definition() {
+                for (size_t i = 0; i <= static_cast<size_t>(SLOT_COUNT); ++i) {
+                    offsets_[i] = 0;
+                }
+            }
+
+            static inline UTIL_CONFIG_CONSTEXPR bool is_valid_state(key_type k) {
+                return static_cast<int64_t>(k) >= 0 && static_cast<int64_t>(k) < static_cast<int64_t>(STATE_COUNT);
+            }
+
+            /**
+             * @brief 检查转移列表里的状态是否都在范围内，可以在static_assert里使用
+             * @param ls 转移列表，必须是constexpr数组
+             */
+            template <size_t N>
+            static inline UTIL_CONFIG_CONSTEXPR bool validate_transitions(const transition_t (&ls)[N], size_t start = 0) {
+                return start >= N || (is_valid_state(ls[start].from) && is_valid_state(ls[start].to) && validate_transitions(ls, start + 1));
+            }
+
+            /**
+             * @brief 允许从from切换到to
+             * @return 状态超出范围时返回false
+             */
+            bool add_transition(key_type from, key_type to) {
+                if (!is_valid_state(from) || !is_valid_state(to)) {
+                    return false;
+                }
+
+                allowed_.set(pair_index(from, to));
+                return true;
+            }
+
+            /**
+             * @brief 批量添加允许的转移
+             * @return 添加成功的数量
+             */
+            template <size_t N>
+            size_t add_transitions(const transition_t (&ls)[N]) {
+                size_t ret = 0;
+                for (size_t i = 0; i < N; ++i) {
+                    if (add_transition(ls[i].from, ls[i].to)) {
+                        ++ret;
+                    }
+                }
+                return ret;
+            }
+
+            /**
+             * @brief 添加转移回调，同时允许从from切换到to，和finite_state_machine::add_listener一致
+             */
+            bool add_listener(key_type from, key_type to, value_type fn) {
+                if (!add_transition(from, to)) {
+                    return false;
+                }
+
+                insert_listener(SLOT_PAIRS + pair_index(from, to), fn);
+                return true;
+            }
+
+            bool add_enter_listener(key_type k, value_type fn) {
+                if (!is_valid_state(k)) {
+                    return false;
+                }
+
+                insert_listener(SLOT_ENTER + static_cast<size_t>(k), fn);
+                return true;
+            }
+
+            bool add_leave_listener(key_type k, value_type fn) {
+                if (!is_valid_state(k)) {
+                    return false;
+                }
+
+                insert_listener(SLOT_LEAVE + static_cast<size_t>(k), fn);
+                return true;
+            }
+
+            /**
+             * @brief 是否允许从from切换到to
+             */
+            inline bool test(key_type from, key_type to) const {
+                return is_valid_state(from) && is_valid_state(to) && allowed_[pair_index(from, to)];
+            }
+
+            /**
+             * @brief 切换状态，依次触发离开状态、进入状态和转移的回调，最后修改状态
+             * @param state 要修改的状态
+             * @param to 目标状态
+             * @return 不允许切换时返回false
+             */
+            bool switch_state(key_type &state, key_type to, TParams... params) const {
+                if (!test(state, to)) {
+                    return false;
+                }
+
+                key_type from = state;
+                invoke(SLOT_LEAVE + static_cast<size_t>(from), from, to, params...);
+                invoke(SLOT_ENTER + static_cast<size_t>(to), from, to, params...);
+                invoke(SLOT_PAIRS + pair_index(from, to), from, to, params...);
+
+                state = to;
+                return true;
+            }
+
+            inline size_t get_listener_count() const { return listeners_.size(); }
+
+            inline bool empty() const { return allowed_.none() && listeners_.empty(); }
+
+        private:
+            static inline size_t pair_index(key_type from, key_type to) { return static_cast<size_t>(from) * STATE_COUNT + static_cast<size_t>(to); }
+
+            void insert_listener(size_t slot, const value_type &fn) {
+                if (!fn) {
+                    return;
+                }
+
+                // 插入到槽的末尾，后面的槽整体后移
+                listeners_.insert(listeners_.begin() + static_cast<ptrdiff_t>(offsets_[slot + 1]), fn);
+                for (size_t i = slot + 1; i <= static_cast<size_t>(SLOT_COUNT); ++i) {
+                    ++offsets_[i];
+                }
+            }
+
+            inline void invoke(size_t slot, key_type from, key_type to, TParams... params) const {
+                for (uint32_t i = offsets_[slot]; i < offsets_[slot + 1]; ++i) {
+                    listeners_[i](from, to, params...);
+                }
+            }
+
+        private:
+            std::bitset<STATE_COUNT * STATE_COUNT> allowed_;
+            std::vector<value_type>                listeners_;               // 按槽连续存放的回调
+            uint32_t                               offsets_[SLOT_COUNT + 1]; // 槽i的回调是listeners_[offsets_[i], offsets_[i + 1])
+        };
+
+        /**
+         * @brief 稠密状态机的实例，只保存当前状态，sizeof和状态类型一样
+         * @note 所有操作都需要传入共享的定义
+         */
+        template <typename T, size_t STATE_COUNT, typename... TParams>
+        class LIBATFRAME_UTILS_API_HEAD_ONLY dense_state_machine {
+        public:
+            typedef T                                                          key_type;
+            typedef dense_state_machine_definition<T, STATE_COUNT, TParams...> definition_type;
+
+        public:
+            dense_state_machine() : state_(static_cast<key_type>(0)) {}
+            explicit dense_state_machine(key_type init_state) : state_(init_state) {}
+
+            inline key_type get_state() const { return state_; }
+
+            inline bool test(const definition_type &def, key_type t) const { return def.test(state_, t); }
+
+            inline bool set_state(const definition_type &def, key_type t, TParams... params) { return def.switch_state(state_, t, params...); }
+
+            /**
+             * @brief 直接修改状态，不检查转移也不触发回调，一般用于从存档恢复
+             */
+            inline void reset_state(key_type t) { state_ = t; }
+
+        private:
+            key_type state_;
+        };
+    } // namespace ds
+} // namespace util
+
+#endif // UTIL_DS_DENSE_STATE_MACHINE_H
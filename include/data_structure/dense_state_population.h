@@ -0,0 +1,326 @@
+﻿/**
+ * @file dense_state_population.h
+ * @brief 批量推进大量实体的状态机，状态按列(SoA)存放
+ * Licensed under the MIT licenses.
+ *
+ * @note 使用和dense_state_machine_definition一样的注册接口，回调按(from, to)分组后批量触发，
+ *       回调参数里带上这一组实体的下标
+ *
+ * @version 1.0
+ * @author owent
+ * @date 2026.10.18
+ *
+ */
+
+#ifndef UTIL_DS_DENSE_STATE_POPULATION_H
+#define UTIL_DS_DENSE_STATE_POPULATION_H
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <stdint.h>
+#include <type_traits>
+#include <vector>
+
+#include "data_structure/dense_state_machine.h"
+
+#include <config/atframe_utils_build_feature.h>
+
+namespace util {
+    namespace ds {
+        /**
+         * @brief 状态机群体，每个实体只占用一个状态列里的元素(STATE_COUNT<=256时是1字节)
+         * @note 回调类型是 void(from, to, const size_t *indexes, size_t count, TParams...)，
+         *       同一组(from, to)的所有实体只触发一次，step和transit_all的indexes按升序排列，apply的indexes和传入的顺序一致。
+         *       离开、进入、转移回调的顺序和单个状态机一致，每组的回调触发完以后才修改这一组实体的状态。
+         * @note 设置了执行器以后，扫描状态列会分成多段并行执行，回调总是在调用线程按(from, to)的顺序触发，结果和串行一致。
+         *       回调里不能再调用批量接口。
+         */
+        template <typename T, size_t STATE_COUNT, typename... TParams>
+        class LIBATFRAME_UTILS_API_HEAD_ONLY dense_state_population {
+        public:
+            typedef T                                                                                   key_type;
+            typedef typename std::conditional<STATE_COUNT <= 256, uint8_t, uint16_t>::type              state_type;
+            typedef dense_state_machine_definition<T, STATE_COUNT, const size_t *, size_t, TParams...> definition_type;
+            typedef typename definition_type::value_type                                                value_type;
+            typedef typename definition_type::const_ptr_t                                               definition_ptr_t;
+
+            /**
+             * @brief 并行执行器，需要调用fn(0)到fn(partition_count - 1)，全部完成后才能返回，可以对接外部的线程池
+             */
+            typedef std::function<void(size_t partition_count, const std::function<void(size_t)> &fn)> executor_fn_t;
+
+        public:
+            explicit dense_state_population(const definition_ptr_t &def) : definition_(def), partition_count_(1) {}
+
+            inline const definition_type &get_definition() const { return *definition_; }
+
+            /**
+             * @brief 设置并行执行器
+             * @param fn 执行器，为空时串行执行
+             * @param partition_count 分段数量
+             */
+            void set_executor(const executor_fn_t &fn, size_t partition_count) {
+                executor_        = fn;
+                partition_count_ = (fn && partition_count > 1) ? partition_count : 1;
+            }
+
+            /**
+             * @brief 添加实体
+             * @return 实体的下标
+             */
+            size_t add(key_type init_state = static_cast<key_type>(0)) {
+                states_.push_back(static_cast<state_type>(init_state));
+                return states_.size() - 1;
+            }
+
+            inline void resize(size_t sz, key_type init_state = static_cast<key_type>(0)) { states_.resize(sz, static_cast<state_type>(init_state)); }
+            inline void reserve(size_t sz) { states_.reserve(sz); }
+            inline void clear() { states_.clear(); }
+
+            inline size_t            size() const { return states_.size(); }
+            inline bool              empty() const { return states_.empty(); }
+            inline const state_type *data() const { return states_.empty() ? NULL : &states_[0]; }
+
+            inline key_type get_state(size_t idx) const { return static_cast<key_type>(states_[idx]); }
+
+            /**
+             * @brief 直接修改状态，不检查转移也不触发回调，一般用于从存档恢复
+             */
+            inline void reset_state(size_t idx, key_type t) { states_[idx] = static_cast<state_type>(t); }
+
+            /**
+             * @brief 处于状态s的实体数量
+             */
+            size_t count(key_type s) const {
+                return static_cast<size_t>(std::count(states_.begin(), states_.end(), static_cast<state_type>(s)));
+            }
+
+            /**
+             * @brief 切换单个实体的状态
+             */
+            bool set_state(size_t idx, key_type to, TParams... params) {
+                if (idx >= states_.size()) {
+                    return false;
+                }
+
+                key_type from = static_cast<key_type>(states_[idx]);
+                if (!definition_->switch_state(from, to, &idx, 1, params...)) {
+                    return false;
+                }
+
+                states_[idx] = static_cast<state_type>(to);
+                return true;
+            }
+
+            /**
+             * @brief 把指定的实体切换到同一个状态，不允许切换的实体会被跳过
+             * @param indexes 实体下标，不能重复
+             * @param count 实体数量
+             * @param to 目标状态
+             * @return 切换成功的实体数量
+             */
+            size_t apply(const size_t *indexes, size_t count, key_type to, TParams... params) {
+                prepare_partitions(1);
+                partition_t &out = partitions_[0];
+                for (size_t i = 0; i < count; ++i) {
+                    size_t idx = indexes[i];
+                    if (idx >= states_.size()) {
+                        continue;
+                    }
+
+                    key_type from = static_cast<key_type>(states_[idx]);
+                    if (definition_->test(from, to)) {
+                        out.push(pair_key(from, to), idx);
+                    }
+                }
+
+                return flush(params...);
+            }
+
+            /**
+             * @brief 把所有处于from的实体切换到to
+             * @return 切换成功的实体数量
+             */
+            size_t transit_all(key_type from, key_type to, TParams... params) {
+                if (!definition_->test(from, to)) {
+                    return 0;
+                }
+
+                const state_type  from_state = static_cast<state_type>(from);
+                const size_t      key        = pair_key(from, to);
+                const state_type *states     = data();
+                scan_partitions([states, from_state, key](size_t begin, size_t end, partition_t &out) {
+                    for (size_t i = begin; i < end; ++i) {
+                        if (from_state == states[i]) {
+                            out.push(key, i);
+                        }
+                    }
+                });
+
+                return flush(params...);
+            }
+
+            /**
+             * @brief 按照每个实体的目标状态批量切换
+             * @param next_states 每个实体的目标状态，长度必须和size()一样，和当前状态一样或者不允许切换的实体会被跳过
+             * @return 切换成功的实体数量
+             */
+            size_t step(const state_type *next_states, TParams... params) {
+                const state_type *     states = data();
+                const definition_type *def    = definition_.get();
+                scan_partitions([states, next_states, def](size_t begin, size_t end, partition_t &out) {
+                    size_t i = begin;
+                    while (i < end) {
+                        // 一般只有少量实体需要切换，每次比较一块，全部相同时直接跳过
+                        if (i + STEP_BLOCK_SIZE <= end && 0 == memcmp(states + i, next_states + i, sizeof(state_type) * STEP_BLOCK_SIZE)) {
+                            i += STEP_BLOCK_SIZE;
+                            continue;
+                        }
+
+                        size_t block_end = i + STEP_BLOCK_SIZE < end ? i + STEP_BLOCK_SIZE : end;
+                        for (; i < block_end; ++i) {
+                            if (states[i] != next_states[i]) {
+                                key_type from = static_cast<key_type>(states[i]);
+                                key_type to   = static_cast<key_type>(next_states[i]);
+                                if (def->test(from, to)) {
+                                    out.push(pair_key(from, to), i);
+                                }
+                            }
+                        }
+                    }
+                });
+
+                return flush(params...);
+            }
+
+        private:
+            enum {
+                STEP_BLOCK_SIZE = 8,
+            };
+
+            // 每段扫描的结果，按(from, to)分桶，清空时保留容量
+            struct partition_t {
+                std::vector<std::vector<size_t> > buckets; // 下标是 from * STATE_COUNT + to
+                std::vector<size_t>               touched; // 非空的桶
+
+                inline void push(size_t key, size_t index) {
+                    std::vector<size_t> &bucket = buckets[key];
+                    if (bucket.empty()) {
+                        touched.push_back(key);
+                    }
+                    bucket.push_back(index);
+                }
+
+                void reset() {
+                    if (buckets.empty()) {
+                        buckets.resize(STATE_COUNT * STATE_COUNT);
+                    }
+
+                    for (size_t i = 0; i < touched.size(); ++i) {
+                        buckets[touched[i]].clear();
+                    }
+                    touched.clear();
+                }
+            };
+
+            static inline size_t pair_key(key_type from, key_type to) { return static_cast<size_t>(from) * STATE_COUNT + static_cast<size_t>(to); }
+
+            void prepare_partitions(size_t partition_count) {
+                if (partitions_.size() < partition_count) {
+                    partitions_.resize(partition_count);
+                }
+
+                for (size_t i = 0; i < partitions_.size(); ++i) {
+                    partitions_[i].reset();
+                }
+            }
+
+            // 把状态列分成连续的几段扫描，每段输出到自己的桶里，合并后的顺序和串行扫描一样
+            template <typename TFn>
+            void scan_partitions(TFn fn) {
+                size_t total           = states_.size();
+                size_t partition_count = partition_count_;
+                if (partition_count > total) {
+                    partition_count = total > 0 ? total : 1;
+                }
+                prepare_partitions(partition_count);
+
+                if (partition_count <= 1 || !executor_) {
+                    fn(0, total, partitions_[0]);
+                    return;
+                }
+
+                std::vector<partition_t> &partitions = partitions_;
+                executor_(partition_count, [&fn, &partitions, total, partition_count](size_t p) {
+                    if (p < partition_count) {
+                        fn(total * p / partition_count, total * (p + 1) / partition_count, partitions[p]);
+                    }
+                });
+            }
+
+            // 按(from, to)的顺序分组触发回调，只有一段有数据时直接使用这一段的桶
+            size_t flush(TParams... params) {
+                touched_.clear();
+                for (size_t p = 0; p < partitions_.size(); ++p) {
+                    touched_.insert(touched_.end(), partitions_[p].touched.begin(), partitions_[p].touched.end());
+                }
+                std::sort(touched_.begin(), touched_.end());
+                touched_.erase(std::unique(touched_.begin(), touched_.end()), touched_.end());
+
+                size_t ret = 0;
+                for (size_t i = 0; i < touched_.size(); ++i) {
+                    size_t                     key    = touched_[i];
+                    const std::vector<size_t> *bucket = NULL;
+                    for (size_t p = 0; p < partitions_.size(); ++p) {
+                        const std::vector<size_t> &part = partitions_[p].buckets[key];
+                        if (part.empty()) {
+                            continue;
+                        }
+
+                        if (NULL == bucket) {
+                            bucket = &part;
+                            continue;
+                        }
+
+                        if (bucket != &merged_) {
+                            merged_.assign(bucket->begin(), bucket->end());
+                            bucket = &merged_;
+                        }
+                        merged_.insert(merged_.end(), part.begin(), part.end());
+                    }
+
+                    if (NULL == bucket) {
+                        continue;
+                    }
+
+                    key_type from = static_cast<key_type>(key / STATE_COUNT);
+                    key_type to   = static_cast<key_type>(key % STATE_COUNT);
+                    definition_->switch_state(from, to, &(*bucket)[0], bucket->size(), params...);
+
+                    const state_type to_state = static_cast<state_type>(to);
+                    for (size_t j = 0; j < bucket->size(); ++j) {
+                        states_[(*bucket)[j]] = to_state;
+                    }
+                    ret += bucket->size();
+                }
+
+                return ret;
+            }
+
+        private:
+            definition_ptr_t         definition_;
+            std::vector<state_type>  states_;
+            executor_fn_t            executor_;
+            size_t                   partition_count_;
+            std::vector<partition_t> partitions_;
+            std::vector<size_t>      touched_; // 所有段里非空的桶
+            std::vector<size_t>      merged_;  // 多段的桶合并后的结果
+        };
+    } // namespace ds
+} // namespace util
+
+#endif // UTIL_DS_DENSE_STATE_POPULATION_H
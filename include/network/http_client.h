@@ -0,0 +1,131 @@
+﻿/**
+ * @file http_client.h
+ * @brief http client using multiple libuv threads
+ * Licensed under the MIT licenses.
+ *
+ * @version 1.0
+ * @author owent
+ * @date 2026.10.18
+ *
+ * @history
+ *
+ */
+
+#ifndef UTILS_NETWORK_HTTP_CLIENT_H
+#define UTILS_NETWORK_HTTP_CLIENT_H
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "network/http_request.h"
+
+#if defined(NETWORK_EVPOLL_ENABLE_LIBUV) && defined(NETWORK_ENABLE_CURL)
+#if NETWORK_ENABLE_CURL && NETWORK_EVPOLL_ENABLE_LIBUV
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+
+namespace util {
+    namespace network {
+
+        /**
+         * http client which owns several worker threads, each of them runs a libuv loop and a curl_m_bind_t.
+         * requests are dispatched to workers, and on_success/on_error/on_complete are called in the caller's loop.
+         */
+        class http_client : public ::util::design_pattern::noncopyable {
+        public:
+            typedef std::shared_ptr<http_client> ptr_t;
+
+            struct LIBATFRAME_UTILS_API dispatch_mode_t {
+                enum type {
+                    EN_DM_HOST_HASH = 0, // requests to the same host run in the same worker, so connections can be reused
+                    EN_DM_LEAST_LOADED,  // requests run in the worker with the least pending requests
+                };
+            };
+
+            struct LIBATFRAME_UTILS_API options_t {
+                size_t                thread_count;          /** 0 means the number of CPU cores **/
+                dispatch_mode_t::type dispatch_mode;
+                long                  max_host_connections;  /** per worker, 0 means no limit **/
+                long                  max_total_connections; /** per worker, 0 means no limit **/
+                http_metrics::ptr_t   metrics;               /** shared by all workers, empty means disabled **/
+
+                options_t();
+            };
+
+            /**
+             * @brief setup a request, it's called in the worker thread before the request starts
+             * @note on_success/on_error/on_complete set here are called in the caller's loop,
+             *       other callbacks such as on_progress, on_header and on_write are called in the worker thread
+             */
+            typedef std::function<void(http_request &)> setup_fn_t;
+
+            struct worker_t;
+
+        public:
+            LIBATFRAME_UTILS_API http_client();
+            LIBATFRAME_UTILS_API ~http_client();
+
+            /**
+             * @brief start worker threads
+             * @param caller_loop the loop where results are delivered, this and start_request must be called in its thread
+             * @return 0 or error code
+             */
+            LIBATFRAME_UTILS_API int init(uv_loop_t *caller_loop, const options_t &options = options_t());
+
+            /**
+             * @brief stop all running requests and wait for worker threads
+             * @note results not delivered yet are delivered before it returns, pending requests not started are dropped
+             */
+            LIBATFRAME_UTILS_API void close();
+
+            /**
+             * @brief start a http request in one of the workers
+             * @param url url
+             * @param method http method
+             * @param setup setup the request in the worker thread, such as post data, headers and callbacks
+             * @return 0 or error code
+             */
+            LIBATFRAME_UTILS_API int start_request(const std::string &url, http_request::method_t::type method, setup_fn_t setup);
+
+            inline size_t get_worker_count() const { return workers_.size(); }
+
+            /**
+             * @brief get the number of requests which are started but not delivered yet
+             */
+            inline size_t get_running_count() const { return running_count_; }
+
+            /**
+             * @brief get the number of requests dispatched to a worker but not delivered yet
+             */
+            LIBATFRAME_UTILS_API size_t get_worker_pending_count(size_t idx) const;
+
+            /**
+             * @brief select a worker for a url
+             */
+            LIBATFRAME_UTILS_API size_t select_worker(const std::string &url);
+
+        private:
+            static void ev_callback_on_deliver(uv_async_t *handle);
+            static void ev_callback_on_caller_closed(uv_handle_t *handle);
+
+            void deliver();
+
+        private:
+            uv_loop_t *             caller_loop_;
+            uv_async_t *            caller_async_;
+            options_t               options_;
+            std::vector<worker_t *> workers_;
+            size_t                  running_count_;
+            size_t                  round_robin_;
+            bool                    closing_;
+        };
+    } // namespace network
+} // namespace util
+
+#endif
+#endif
+#endif
+
+#endif
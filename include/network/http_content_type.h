@@ -96,6 +96,53 @@ namespace util {
 
             LIBATFRAME_UTILS_API int make_content_type(char *dst, size_t dst_sz, easy_type et, const char *parameter_key[],
                                                        const char *parameter_value[], size_t parameter_sz);
+
+            struct LIBATFRAME_UTILS_API extension_entry_t {
+                const char *extension; // 小写，不包含'.'
+                size_t      extension_len;
+                const char *mime_type;
+            };
+
+            /**
+             * @brief 根据扩展名获取MIME类型，不区分大小写，不会分配内存
+             * @param ext 扩展名，可以包含开头的'.'
+             * @param ext_sz 扩展名长度，0表示当作字符串
+             * @return MIME类型，未知的扩展名返回NULL
+             */
+            LIBATFRAME_UTILS_API const char *get_mime_type_by_extension(const char *ext, size_t ext_sz = 0);
+
+            /**
+             * @brief 根据文件路径获取MIME类型，使用最后一个'.'后的扩展名
+             * @param path 文件路径或URL路径
+             * @param path_sz 路径长度，0表示当作字符串
+             * @param default_type 未知的扩展名时返回的类型
+             * @return MIME类型
+             */
+            LIBATFRAME_UTILS_API const char *get_mime_type_by_path(const char *path, size_t path_sz = 0,
+                                                                   const char *default_type = "application/octet-stream");
+
+            /**
+             * @brief 根据MIME类型获取首选的扩展名，不区分大小写，忽略';'后的参数
+             * @return 不包含'.'的扩展名，未知的类型返回NULL
+             */
+            LIBATFRAME_UTILS_API const char *get_extension_by_mime_type(const char *mime_type, size_t mime_type_sz = 0);
+
+            /**
+             * @brief 是否是文本类型(text/开头的类型，以及json、xml、javascript等)，文本类型需要在Content-Type中指定charset
+             */
+            LIBATFRAME_UTILS_API bool is_text_mime_type(const char *mime_type, size_t mime_type_sz = 0);
+
+            /**
+             * @brief 根据BOM和内容检测字符集，只需要传入开头的一部分数据
+             * @return "utf-8"、"utf-16le"、"utf-16be"、"utf-32le"、"utf-32be"、"us-ascii"，二进制数据或无法识别的编码返回NULL
+             */
+            LIBATFRAME_UTILS_API const char *sniff_charset(const void *data, size_t sz);
+
+            /**
+             * @brief 获取扩展名表，按扩展名排序
+             * @param sz 表的长度
+             */
+            LIBATFRAME_UTILS_API const extension_entry_t *get_extension_table(size_t &sz);
         }; // namespace http_content_type
         struct LIBATFRAME_UTILS_API http_request_content_type_t {
             enum type {
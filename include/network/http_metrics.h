@@ -0,0 +1,189 @@
+﻿/**
+ * @file http_metrics.h
+ * @brief latency histograms and phase timing of http requests
+ *
+ * @version 1.0
+ * @author owent
+ * @date 2026.10.18
+ *
+ */
+
+#ifndef UTILS_NETWORK_HTTP_METRICS_H
+#define UTILS_NETWORK_HTTP_METRICS_H
+
+#pragma once
+
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "design_pattern/noncopyable.h"
+#include "lock/atomic_int_type.h"
+#include "lock/spin_rw_lock.h"
+#include "log/log_wrapper.h"
+#include "std/smart_ptr.h"
+
+#include "config/atframe_utils_build_feature.h"
+
+namespace util {
+    namespace network {
+
+        /**
+         * lock-free log-linear histogram like HdrHistogram, values are kept with relative error <= 1/SUB_BUCKET_COUNT
+         */
+        class http_histogram : public ::util::design_pattern::noncopyable {
+        public:
+            enum {
+                SUB_BUCKET_BITS  = 4,
+                SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS,
+                MAX_VALUE_BITS   = 36, // about 19 hours in microseconds, larger values are recorded as the max bucket
+                BUCKET_COUNT     = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT,
+            };
+
+            struct LIBATFRAME_UTILS_API snapshot_t {
+                std::vector<uint64_t> counts;
+                uint64_t              count;
+                uint64_t              sum;
+                uint64_t              min;
+                uint64_t              max;
+
+                snapshot_t();
+
+                /**
+                 * @brief get value at percentile
+                 * @param percentile 0.0-1.0
+                 * @return the highest value equivalent to the bucket, 0 if it's empty
+                 */
+                uint64_t percentile(double percentile) const;
+
+                double mean() const;
+
+                void merge(const snapshot_t &other);
+            };
+
+        public:
+            LIBATFRAME_UTILS_API http_histogram();
+
+            LIBATFRAME_UTILS_API void record(uint64_t value);
+
+            /**
+             * @brief copy all counters, it can be called while other threads are recording
+             */
+            LIBATFRAME_UTILS_API void snapshot(snapshot_t &out) const;
+
+            LIBATFRAME_UTILS_API static size_t   get_bucket_index(uint64_t value);
+            LIBATFRAME_UTILS_API static uint64_t get_bucket_lowest_value(size_t idx);
+            LIBATFRAME_UTILS_API static uint64_t get_bucket_highest_value(size_t idx);
+
+        private:
+            ::util::lock::atomic_int_type<uint64_t> counts_[BUCKET_COUNT];
+            ::util::lock::atomic_int_type<uint64_t> count_;
+            ::util::lock::atomic_int_type<uint64_t> sum_;
+            ::util::lock::atomic_int_type<uint64_t> min_;
+            ::util::lock::atomic_int_type<uint64_t> max_;
+        };
+
+        /**
+         * @brief timing of a finished http request, durations are in microseconds
+         */
+        struct LIBATFRAME_UTILS_API http_request_timing_t {
+            uint64_t dns_us;     /** name resolving **/
+            uint64_t connect_us; /** TCP connect after name resolved **/
+            uint64_t tls_us;     /** TLS handshake after connected **/
+            uint64_t ttfb_us;    /** time to first byte, from the start **/
+            uint64_t total_us;   /** from the start to the end **/
+
+            uint64_t upload_bytes;
+            uint64_t download_bytes;
+
+            int  response_code;
+            int  error_code;     /** libcurl error code, 0 means no error **/
+            bool new_connection; /** false if an existing connection is reused, dns/connect/tls are 0 then **/
+        };
+
+        /**
+         * @brief aggregated timing of http requests by host and status code group, it's safe to record from multiple threads
+         */
+        class http_metrics : public ::util::design_pattern::noncopyable {
+        public:
+            typedef std::shared_ptr<http_metrics> ptr_t;
+
+            struct LIBATFRAME_UTILS_API phase_t {
+                enum type {
+                    EN_HMP_DNS = 0,
+                    EN_HMP_CONNECT,
+                    EN_HMP_TLS,
+                    EN_HMP_TTFB,
+                    EN_HMP_TOTAL,
+                    EN_HMP_MAX,
+                };
+            };
+
+            enum {
+                STATUS_GROUP_COUNT = 6, // 0 means no response, 1-5 means 1XX-5XX
+            };
+
+            struct LIBATFRAME_UTILS_API snapshot_entry_t {
+                std::string                host;
+                int                        status_group;
+                uint64_t                   request_count;
+                uint64_t                   error_count;
+                uint64_t                   upload_bytes;
+                uint64_t                   download_bytes;
+                http_histogram::snapshot_t phases[phase_t::EN_HMP_MAX];
+            };
+            typedef std::vector<snapshot_entry_t> snapshot_t;
+
+        public:
+            LIBATFRAME_UTILS_API http_metrics();
+            LIBATFRAME_UTILS_API ~http_metrics();
+
+            /**
+             * @param host host[:port]
+             * @param timing timing of a finished request
+             */
+            LIBATFRAME_UTILS_API void record(const std::string &host, const http_request_timing_t &timing);
+
+            /**
+             * @brief get all hosts and status code groups which have requests
+             */
+            LIBATFRAME_UTILS_API void snapshot(snapshot_t &out) const;
+
+            /**
+             * @brief write count, bytes and p50/p90/p99/max of every phase into log, one line for each host and status code group
+             */
+            LIBATFRAME_UTILS_API void dump_to_log(::util::log::log_wrapper &logger,
+                                                  ::util::log::log_wrapper::level_t::type level = ::util::log::log_wrapper::level_t::LOG_LW_INFO) const;
+
+            LIBATFRAME_UTILS_API static const char *get_phase_name(phase_t::type phase);
+
+        private:
+            struct group_t {
+                http_histogram                          phases[phase_t::EN_HMP_MAX];
+                ::util::lock::atomic_int_type<uint64_t> request_count;
+                ::util::lock::atomic_int_type<uint64_t> error_count;
+                ::util::lock::atomic_int_type<uint64_t> upload_bytes;
+                ::util::lock::atomic_int_type<uint64_t> download_bytes;
+
+                group_t();
+            };
+
+            struct host_t {
+                group_t *groups[STATUS_GROUP_COUNT]; // created when used, protected by lock_
+
+                host_t();
+                ~host_t();
+            };
+
+            static void record_group(group_t &group, const http_request_timing_t &timing);
+
+        private:
+            mutable ::util::lock::spin_rw_lock        lock_;
+            std::unordered_map<std::string, host_t *> hosts_;
+        };
+    } // namespace network
+} // namespace util
+
+#endif
@@ -20,9 +20,13 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <vector>
 
 
 #include "design_pattern/noncopyable.h"
+#include "network/http_metrics.h"
+#include "network/http_request_source.h"
+#include "network/http_response_sink.h"
 #include "std/functional.h"
 #include "std/smart_ptr.h"
 #include "string/tquerystring.h"
@@ -106,6 +110,7 @@ namespace util {
                     EN_SCT_UNSUPPORTED_MEDIA_TYPE        = 415,
                     EN_SCT_REQUEST_RANGE_NOT_SATISFIABLE = 416,
                     EN_SCT_EXPECTATION_FAILED            = 417,
+                    EN_SCT_TOO_MANY_REQUESTS             = 429,
                     EN_SCT_NOT_IMPLEMENTED               = 501,
                     EN_SCT_BAD_GATEWAY                   = 502,
                     EN_SCT_SERVICE_UNAVAILABLE           = 503,
@@ -120,14 +125,44 @@ namespace util {
                     EN_FT_RUNNING           = 0x02,
                     EN_FT_CLEANING          = 0x04,
                     EN_FT_STOPING           = 0x08,
+                    EN_FT_RESPONSE_RESERVED = 0x10,
                 };
             };
 
+            struct LIBATFRAME_UTILS_API curl_handle_stats_t {
+                size_t   created_count;        /** easy handles created by curl_easy_init **/
+                size_t   reused_count;         /** easy handles taken from the pool **/
+                size_t   request_count;        /** finished transfers **/
+                size_t   new_connection_count; /** finished transfers which opened at least one new connection **/
+                uint64_t connect_time_us;      /** total TCP connect time of transfers which opened new connections **/
+                uint64_t appconnect_time_us;   /** total time until TLS handshake done of transfers which opened new connections **/
+            };
+
+            /**
+             * @brief easy handles and caches shared by all requests of a curl_m_bind_t
+             * @note DNS cache, TLS sessions and connections are shared by a CURLSH without lock functions,
+             *       so all requests using it must run in the thread of the event loop
+             */
+            struct curl_handle_pool_t {
+                CURLSH *            curl_share;
+                std::vector<CURL *> free_handles;
+                size_t              max_free_handles;
+                curl_handle_stats_t stats;
+                http_metrics::ptr_t metrics;
+
+                LIBATFRAME_UTILS_API curl_handle_pool_t();
+                LIBATFRAME_UTILS_API ~curl_handle_pool_t();
+            };
+            typedef std::shared_ptr<curl_handle_pool_t> curl_handle_pool_ptr_t;
+
             struct curl_m_bind_t {
                 uv_loop_t *ev_loop;
                 CURLM *    curl_multi;
                 uv_timer_t ev_timeout;
 
+                // requests hold it too, so it's safe to release a request after destroy_curl_multi
+                curl_handle_pool_ptr_t handle_pool;
+
                 LIBATFRAME_UTILS_API           curl_m_bind_t();
                 std::shared_ptr<curl_m_bind_t> self_holder;
             };
@@ -170,12 +205,46 @@ namespace util {
 
             LIBATFRAME_UTILS_API static int get_status_code_group(int code);
 
+            /**
+             * @brief get host and port of a url, userinfo is excluded
+             * @return host[:port]
+             */
+            LIBATFRAME_UTILS_API static std::string get_url_host(const std::string &url);
+
             LIBATFRAME_UTILS_API http_request(curl_m_bind_t *curl_multi);
             LIBATFRAME_UTILS_API ~http_request();
 
             static LIBATFRAME_UTILS_API int create_curl_multi(uv_loop_t *evloop, std::shared_ptr<curl_m_bind_t> &manager);
             static LIBATFRAME_UTILS_API int destroy_curl_multi(std::shared_ptr<curl_m_bind_t> &manager);
 
+            /**
+             * @brief limit connections of a curl_m_bind_t, requests over the limit are queued by libcurl
+             * @param max_host_connections max connections to a single host, 0 means no limit
+             * @param max_total_connections max connections in total, 0 means no limit
+             * @return 0 or error code
+             */
+            static LIBATFRAME_UTILS_API int set_curl_multi_connection_limit(curl_m_bind_t *manager, long max_host_connections,
+                                                                            long max_total_connections);
+
+            /**
+             * @brief set how many released easy handles can be kept for reuse, default is 64
+             */
+            static LIBATFRAME_UTILS_API void set_curl_multi_max_free_handles(curl_m_bind_t *manager, size_t v);
+
+            /**
+             * @brief get metrics of handle reuse and connection reuse
+             * @note handle reuse ratio = reused_count / (created_count + reused_count),
+             *       connection reuse ratio = 1 - new_connection_count / request_count
+             * @return stats, NULL if the manager is invalid
+             */
+            static LIBATFRAME_UTILS_API const curl_handle_stats_t *get_curl_multi_stats(const curl_m_bind_t *manager);
+
+            /**
+             * @brief set where to aggregate timing of all requests of a curl_m_bind_t, it can be shared by several managers
+             * @param metrics metrics, pass empty pointer to disable it
+             */
+            static LIBATFRAME_UTILS_API void set_curl_multi_metrics(curl_m_bind_t *manager, const http_metrics::ptr_t &metrics);
+
             /**
              * @brief start a http request
              * @param wait if true, waiting for request finished
@@ -198,11 +267,50 @@ namespace util {
 
             LIBATFRAME_UTILS_API int get_error_code() const;
 
+            /**
+             * @brief get phase timing and byte counts, available after the request finished
+             */
+            LIBATFRAME_UTILS_API const http_request_timing_t &get_timing() const;
+
             LIBATFRAME_UTILS_API const char *get_error_msg() const;
 
+            /**
+             * @brief compatibility adapter, response data is copied into the stream when it's called
+             * @note only available when using the default http_buffer_chain, use get_response_buffer() or a custom sink instead
+             */
             LIBATFRAME_UTILS_API std::stringstream &get_response_stream();
             LIBATFRAME_UTILS_API const std::stringstream &get_response_stream() const;
 
+            /**
+             * @brief set where to put the response body, it must be called before start()
+             * @param sink response sink, pass empty pointer to reset to the default http_buffer_chain
+             */
+            LIBATFRAME_UTILS_API void set_response_sink(const http_response_sink::ptr_t &sink);
+            LIBATFRAME_UTILS_API const http_response_sink::ptr_t &get_response_sink() const;
+
+            /**
+             * @brief get response body buffer
+             * @return the default http_buffer_chain or the custom sink if it's a http_buffer_chain, NULL if it's not
+             */
+            LIBATFRAME_UTILS_API http_buffer_chain *get_response_buffer();
+            LIBATFRAME_UTILS_API const http_buffer_chain *get_response_buffer() const;
+
+            /**
+             * @brief set a streaming request body, it must be called before start()
+             * @note it takes precedence over post_data() and form fields, only POST and PUT are supported.
+             *       http_request_source::read_result_t::EN_RR_PAUSE is only available when not waiting in start()
+             * @param source request body source, pass empty pointer to disable it
+             */
+            LIBATFRAME_UTILS_API void set_request_source(const http_request_source::ptr_t &source);
+            LIBATFRAME_UTILS_API const http_request_source::ptr_t &get_request_source() const;
+
+            /**
+             * @brief continue to read the request source after it returned http_request_source::read_result_t::EN_RR_PAUSE
+             * @note it must be called in the thread of the event loop
+             * @return 0 or error code
+             */
+            LIBATFRAME_UTILS_API int resume_upload();
+
             LIBATFRAME_UTILS_API int add_form_file(const std::string &fieldname, const char *filename);
 
             LIBATFRAME_UTILS_API int add_form_file(const std::string &fieldname, const char *filename, const char *content_type,
@@ -307,13 +415,24 @@ namespace util {
 
             LIBATFRAME_UTILS_API void finish_req_rsp();
 
+            LIBATFRAME_UTILS_API void setup_request_source(method_t::type method);
+
+            LIBATFRAME_UTILS_API void collect_timing();
+
             LIBATFRAME_UTILS_API CURL *mutable_request();
 
             LIBATFRAME_UTILS_API void build_http_form(method_t::type method);
 
+            LIBATFRAME_UTILS_API void reserve_response(size_t total_size);
+
+            LIBATFRAME_UTILS_API void sync_response_stream() const;
+
             static LIBATFRAME_UTILS_API curl_poll_context_t *malloc_poll(http_request *req, curl_socket_t sockfd);
             static LIBATFRAME_UTILS_API void                 free_poll(curl_poll_context_t *);
 
+            static LIBATFRAME_UTILS_API CURL *alloc_easy_handle(curl_handle_pool_t *pool);
+            static LIBATFRAME_UTILS_API void  free_easy_handle(curl_handle_pool_t *pool, CURL *handle);
+
             static LIBATFRAME_UTILS_API void check_multi_info(CURLM *curl_handle);
 
             static LIBATFRAME_UTILS_API void ev_callback_on_timer_closed(uv_handle_t *handle);
@@ -333,6 +452,7 @@ namespace util {
                                                                       double ulnow);
 #endif
             static LIBATFRAME_UTILS_API size_t curl_callback_on_read(char *buffer, size_t size, size_t nitems, void *instream);
+            static LIBATFRAME_UTILS_API int    curl_callback_on_seek(void *userp, curl_off_t offset, int origin);
             static LIBATFRAME_UTILS_API size_t curl_callback_on_header(char *buffer, size_t size, size_t nitems, void *userdata);
             static LIBATFRAME_UTILS_API int    curl_callback_on_verbose(CURL *handle, curl_infotype type, char *data, size_t size,
                                                                         void *userptr);
@@ -342,18 +462,24 @@ namespace util {
             time_t timeout_ms_;
 
             // curl resource
-            curl_m_bind_t *bind_m_;
-            CURL *         request_;
-            int            flags_;
+            curl_m_bind_t *        bind_m_;
+            curl_handle_pool_ptr_t handle_pool_;
+            CURL *                 request_;
+            int                    flags_;
 
             // data and resource
-            std::string       url_;
-            std::string       post_data_;
-            std::stringstream response_;
-            mutable int       response_code_;
-            int               last_error_code_;
-            void *            priv_data_;
-            std::string       useragent_;
+            std::string               url_;
+            std::string                post_data_;
+            http_request_source::ptr_t request_source_;
+            http_response_sink::ptr_t  response_sink_;
+            http_buffer_chain *       response_buffer_; // response_sink_ if it's a http_buffer_chain
+            mutable std::stringstream response_stream_; // data for get_response_stream()
+            mutable size_t            response_stream_synced_;
+            mutable int               response_code_;
+            int                       last_error_code_;
+            http_request_timing_t     timing_;
+            void *                    priv_data_;
+            std::string               useragent_;
 
             typedef struct {
                 curl_httppost *    begin;
@@ -0,0 +1,218 @@
+﻿/**
+ * @file http_request_policy.h
+ * @brief retries, hedged requests, circuit breaker and budget for http_request
+ *
+ * @version 1.0
+ * @author owent
+ * @date 2026.10.18
+ *
+ */
+
+#ifndef UTILS_NETWORK_HTTP_REQUEST_POLICY_H
+#define UTILS_NETWORK_HTTP_REQUEST_POLICY_H
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "network/http_request.h"
+#include "random/random_generator.h"
+
+#if defined(NETWORK_EVPOLL_ENABLE_LIBUV) && defined(NETWORK_ENABLE_CURL)
+#if NETWORK_ENABLE_CURL && NETWORK_EVPOLL_ENABLE_LIBUV
+
+namespace util {
+    namespace network {
+
+        /**
+         * policy layer of http_request, it must be used in the thread of the event loop of the curl_m_bind_t
+         *  - retry with exponential backoff and jitter
+         *  - hedged request after the latency percentile of the host, the first response wins and the others are stopped
+         *  - circuit breaker for each host
+         *  - budget of retries and hedged requests, to avoid retry storm
+         */
+        class http_request_policy : public ::util::design_pattern::noncopyable {
+        public:
+            typedef std::shared_ptr<http_request_policy> ptr_t;
+
+            struct LIBATFRAME_UTILS_API error_code_t {
+                enum type {
+                    EN_ERR_SUCCESS        = 0,
+                    EN_ERR_PARAM          = -1,
+                    EN_ERR_CIRCUIT_OPEN   = -2,
+                    EN_ERR_CREATE_REQUEST = -3,
+                };
+            };
+
+            struct LIBATFRAME_UTILS_API circuit_state_t {
+                enum type {
+                    EN_CS_CLOSED = 0,
+                    EN_CS_OPEN,
+                    EN_CS_HALF_OPEN,
+                };
+            };
+
+            struct LIBATFRAME_UTILS_API options_t {
+                // retry
+                size_t max_retries;          /** default: 2 **/
+                time_t retry_base_delay_ms;  /** default: 50 **/
+                time_t retry_max_delay_ms;   /** default: 2000 **/
+                bool   retry_non_idempotent; /** default: false, POST is retried only when no response is received **/
+
+                // hedged request
+                bool   enable_hedge;           /** default: false **/
+                double hedge_percentile;       /** default: 0.95 **/
+                size_t hedge_min_samples;      /** default: 16, use hedge_default_delay_ms before enough samples **/
+                time_t hedge_min_delay_ms;     /** default: 5 **/
+                time_t hedge_default_delay_ms; /** default: 0, 0 means do not hedge before enough samples **/
+
+                // circuit breaker
+                size_t breaker_failure_threshold; /** default: 5, consecutive failures to open the circuit, 0 to disable **/
+                time_t breaker_open_ms;           /** default: 5000, then a probe request is allowed **/
+
+                // budget of retries and hedged requests
+                double budget_ratio;      /** default: 0.2, tokens added by every request **/
+                double budget_max_tokens; /** default: 10 **/
+
+                options_t();
+            };
+
+            struct LIBATFRAME_UTILS_API stats_t {
+                size_t request_count;          /** requests started by start_request **/
+                size_t attempt_count;          /** http_request started, including retries and hedged requests **/
+                size_t success_count;
+                size_t failure_count;
+                size_t retry_count;
+                size_t hedge_count;
+                size_t hedge_win_count;        /** the hedged request responds first **/
+                size_t budget_exhausted_count; /** retries or hedged requests skipped because of budget **/
+                size_t circuit_open_count;
+                size_t circuit_rejected_count;
+            };
+
+            /**
+             * @brief setup a request, it's called for every attempt
+             * @note on_success/on_error/on_complete set here are only called once with the final attempt
+             */
+            typedef std::function<void(http_request &)> setup_fn_t;
+
+            /**
+             * @brief check if an attempt failed, default is a libcurl error, HTTP 5XX or 429
+             */
+            typedef std::function<bool(const http_request &)> check_failure_fn_t;
+
+        public:
+            LIBATFRAME_UTILS_API http_request_policy(http_request::curl_m_bind_t *bind, const options_t &options = options_t());
+
+            /**
+             * @brief requests still running are stopped and the callbacks will not be called
+             */
+            LIBATFRAME_UTILS_API ~http_request_policy();
+
+            /**
+             * @brief start a http request with policy
+             * @return 0 or error code, callbacks will not be called if it failed
+             */
+            LIBATFRAME_UTILS_API int start_request(const std::string &url, http_request::method_t::type method, setup_fn_t setup);
+
+            inline const options_t &get_options() const { return options_; }
+            inline const stats_t &  get_stats() const { return stats_; }
+
+            LIBATFRAME_UTILS_API void set_check_failure(check_failure_fn_t fn);
+
+            /**
+             * @brief get the number of requests started by start_request but not finished
+             */
+            LIBATFRAME_UTILS_API size_t get_running_count() const;
+
+            /**
+             * @param host host[:port], @see http_request::get_url_host
+             */
+            LIBATFRAME_UTILS_API circuit_state_t::type get_circuit_state(const std::string &host) const;
+
+            /**
+             * @brief get latency percentile of successful attempts of a host
+             * @param host host[:port], @see http_request::get_url_host
+             * @return latency in milliseconds, -1 if there is no sample
+             */
+            LIBATFRAME_UTILS_API time_t get_latency_percentile(const std::string &host, double percentile) const;
+
+        private:
+            struct host_state_t {
+                std::vector<uint32_t> latency_samples; // ring buffer of recent latencies in milliseconds
+                size_t                latency_next;
+                size_t                consecutive_failures;
+                circuit_state_t::type circuit_state;
+                uint64_t              circuit_open_until;
+                bool                  probe_running;
+
+                host_state_t();
+            };
+
+            struct attempt_t {
+                http_request::ptr_t request;
+                uint64_t            start_time;
+                bool                is_hedge;
+            };
+
+            struct operation_t {
+                http_request_policy *        owner;
+                std::string                  url;
+                std::string                  host;
+                http_request::method_t::type method;
+                setup_fn_t                   setup;
+
+                std::vector<attempt_t> attempts;
+                http_request::ptr_t    last_failed;
+                uv_timer_t *           timer;
+                bool                   timer_for_hedge;
+                size_t                 retry_times;
+                bool                   has_callbacks;
+                bool                   finished;
+
+                http_request::on_success_fn_t  on_success;
+                http_request::on_error_fn_t    on_error;
+                http_request::on_complete_fn_t on_complete;
+            };
+
+            int  start_attempt(operation_t *op, bool is_hedge);
+            void on_attempt_complete(operation_t *op, http_request &req);
+            void finish_operation(operation_t *op, http_request &req, bool is_hedge);
+            void release_operation(operation_t *op);
+            void schedule_hedge(operation_t *op);
+
+            bool is_failed(const http_request &req) const;
+            bool is_idempotent(http_request::method_t::type method) const;
+
+            bool   circuit_allow(host_state_t &host, uint64_t now);
+            void   circuit_report(host_state_t &host, bool success, uint64_t now);
+            bool   budget_withdraw();
+            time_t get_hedge_delay(const host_state_t &host) const;
+            time_t get_retry_delay(size_t retry_times);
+
+            static time_t get_percentile(const host_state_t &host, double percentile);
+
+            static void ev_callback_on_timer(uv_timer_t *handle);
+            static void ev_callback_on_timer_closed(uv_handle_t *handle);
+
+        private:
+            http_request::curl_m_bind_t *                 bind_m_;
+            options_t                                     options_;
+            stats_t                                       stats_;
+            check_failure_fn_t                            check_failure_fn_;
+            double                                        budget_tokens_;
+            std::unordered_map<std::string, host_state_t> hosts_;
+            std::unordered_set<operation_t *>             operations_;
+            ::util::random::xoshiro256_starstar           random_;
+        };
+    } // namespace network
+} // namespace util
+
+#endif
+#endif
+
+#endif
@@ -0,0 +1,208 @@
+﻿/**
+ * @file http_request_source.h
+ * @brief streaming body sources of http request, the body is read when sending and never kept in memory as a whole
+ * Licensed under the MIT licenses.
+ *
+ * @version 1.0
+ * @author owent
+ * @date 2026.10.18
+ *
+ * @history
+ *
+ */
+
+#ifndef UTILS_NETWORK_HTTP_REQUEST_SOURCE_H
+#define UTILS_NETWORK_HTTP_REQUEST_SOURCE_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "common/file_system.h"
+#include "design_pattern/noncopyable.h"
+#include "std/functional.h"
+#include "std/smart_ptr.h"
+
+#include "config/atframe_utils_build_feature.h"
+
+#if defined(NETWORK_ENABLE_ZLIB) && NETWORK_ENABLE_ZLIB
+#include <zlib.h>
+#endif
+
+namespace util {
+    namespace network {
+        /**
+         * @brief body source of a request
+         */
+        class http_request_source : public ::util::design_pattern::noncopyable {
+        public:
+            typedef std::shared_ptr<http_request_source> ptr_t;
+
+            struct LIBATFRAME_UTILS_API read_result_t {
+                enum type {
+                    EN_RR_ABORT = 0x10000000, // abort the transfer
+                    EN_RR_PAUSE = 0x10000001, // no data now, call http_request::resume_upload() when there is more
+                };
+            };
+
+        public:
+            LIBATFRAME_UTILS_API virtual ~http_request_source();
+
+            /**
+             * @brief total size of the body
+             * @return -1 if it's unknown, chunked transfer encoding will be used then
+             */
+            LIBATFRAME_UTILS_API virtual int64_t size() const;
+
+            /**
+             * @brief read data into buffer
+             * @return length of data, 0 means the end, or one of read_result_t
+             */
+            virtual size_t read(char *buffer, size_t sz) = 0;
+
+            /**
+             * @brief restart from the beginning, libcurl need it to send the body again after a redirect or an authentication
+             * @return true if it's supported
+             */
+            LIBATFRAME_UTILS_API virtual bool rewind();
+
+            /**
+             * @brief value of Content-Encoding, NULL if it's not encoded
+             */
+            LIBATFRAME_UTILS_API virtual const char *content_encoding() const;
+        };
+
+        /**
+         * @brief read body from a file, the file can be mapped into memory to avoid copying into user space buffer twice
+         */
+        class http_file_source : public http_request_source {
+        public:
+            typedef std::shared_ptr<http_file_source> ptr_t;
+
+        public:
+            LIBATFRAME_UTILS_API http_file_source();
+            LIBATFRAME_UTILS_API virtual ~http_file_source();
+
+            /**
+             * @brief open file
+             * @param path file path
+             * @param use_mmap map the whole file into memory, fallback to read if failed
+             * @return 0 or error code
+             */
+            LIBATFRAME_UTILS_API int open(const char *path, bool use_mmap = false);
+
+            LIBATFRAME_UTILS_API void close();
+
+            inline bool is_open() const { return NULL != file_ || mapped_.is_mapped(); }
+            inline bool is_mapped() const { return mapped_.is_mapped(); }
+
+            LIBATFRAME_UTILS_API virtual int64_t size() const;
+            LIBATFRAME_UTILS_API virtual size_t  read(char *buffer, size_t sz);
+            LIBATFRAME_UTILS_API virtual bool    rewind();
+
+        private:
+            FILE *                           file_;
+            ::util::file_system::mapped_file mapped_;
+            int64_t                          file_size_;
+            int64_t                          offset_;
+        };
+
+        /**
+         * @brief body generated by a callback
+         */
+        class http_generator_source : public http_request_source {
+        public:
+            typedef std::shared_ptr<http_generator_source> ptr_t;
+
+            /**
+             * @brief generate data into buffer
+             * @return length of data, 0 means the end, or one of read_result_t
+             */
+            typedef std::function<size_t(char *buffer, size_t sz)> generator_fn_t;
+
+            /**
+             * @brief restart from the beginning
+             * @return true if it's supported
+             */
+            typedef std::function<bool()> rewind_fn_t;
+
+        public:
+            /**
+             * @param fn generator
+             * @param total_size total size, -1 means unknown
+             * @param rewind_fn callback to restart, empty means not supported
+             */
+            LIBATFRAME_UTILS_API http_generator_source(generator_fn_t fn, int64_t total_size = -1, rewind_fn_t rewind_fn = rewind_fn_t());
+            LIBATFRAME_UTILS_API virtual ~http_generator_source();
+
+            LIBATFRAME_UTILS_API virtual int64_t size() const;
+            LIBATFRAME_UTILS_API virtual size_t  read(char *buffer, size_t sz);
+            LIBATFRAME_UTILS_API virtual bool    rewind();
+
+        private:
+            generator_fn_t fn_;
+            rewind_fn_t    rewind_fn_;
+            int64_t        total_size_;
+        };
+
+#if defined(NETWORK_ENABLE_ZLIB) && NETWORK_ENABLE_ZLIB
+        /**
+         * @brief compress another source on the fly, only a fixed size buffer is used no matter how large the body is
+         * @note the size is always unknown so chunked transfer encoding will be used
+         */
+        class http_compress_source : public http_request_source {
+        public:
+            typedef std::shared_ptr<http_compress_source> ptr_t;
+
+            struct LIBATFRAME_UTILS_API codec_t {
+                enum type {
+                    EN_CC_GZIP = 0,
+                    EN_CC_DEFLATE, // zlib format, which is what the "deflate" content coding means
+                };
+            };
+
+            enum {
+                INPUT_BUFFER_SIZE = 16384,
+            };
+
+        public:
+            /**
+             * @param upstream source of the uncompressed data
+             * @param codec codec
+             * @param level compression level, 1-9, -1 means default
+             */
+            LIBATFRAME_UTILS_API http_compress_source(const http_request_source::ptr_t &upstream, codec_t::type codec = codec_t::EN_CC_GZIP,
+                                                      int level = -1);
+            LIBATFRAME_UTILS_API virtual ~http_compress_source();
+
+            LIBATFRAME_UTILS_API virtual size_t      read(char *buffer, size_t sz);
+            LIBATFRAME_UTILS_API virtual bool        rewind();
+            LIBATFRAME_UTILS_API virtual const char *content_encoding() const;
+
+            inline uint64_t get_input_size() const { return input_size_; }
+            inline uint64_t get_output_size() const { return output_size_; }
+
+        private:
+            bool reset_stream();
+
+        private:
+            http_request_source::ptr_t upstream_;
+            codec_t::type              codec_;
+            int                        level_;
+            z_stream                   stream_;
+            bool                       stream_inited_;
+            bool                       upstream_eof_;
+            bool                       finished_;
+            std::vector<char>          input_;
+            uint64_t                   input_size_;
+            uint64_t                   output_size_;
+        };
+#endif
+    } // namespace network
+} // namespace util
+
+#endif
@@ -0,0 +1,177 @@
+﻿/**
+ * @file http_response_sink.h
+ * @brief HTTP响应数据的接收器，包括分段缓冲区和直接写文件
+ * Licensed under the MIT licenses.
+ *
+ * @version 1.0
+ * @author owent
+ * @date 2026.10.17
+ *
+ * @history
+ *
+ */
+
+#ifndef UTILS_NETWORK_HTTP_RESPONSE_SINK_H
+#define UTILS_NETWORK_HTTP_RESPONSE_SINK_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "design_pattern/noncopyable.h"
+#include "std/smart_ptr.h"
+
+#include "config/atframe_utils_build_feature.h"
+
+namespace util {
+    namespace network {
+        /**
+         * @brief 响应数据的接收器接口
+         */
+        class http_response_sink : public ::util::design_pattern::noncopyable {
+        public:
+            typedef std::shared_ptr<http_response_sink> ptr_t;
+
+        public:
+            LIBATFRAME_UTILS_API virtual ~http_response_sink();
+
+            /**
+             * @brief 收到第一段数据前调用，传入预计的总长度(来自Content-Length)，可以用于预先分配
+             * @param total_size 预计的总长度，未知时不会调用
+             */
+            LIBATFRAME_UTILS_API virtual void reserve(size_t total_size);
+
+            /**
+             * @brief 写入数据
+             * @return 写入的长度，小于sz时会中断传输
+             */
+            virtual size_t write(const char *data, size_t sz) = 0;
+
+            /**
+             * @brief 传输结束(包括失败)时调用
+             */
+            LIBATFRAME_UTILS_API virtual void finish();
+        };
+
+        /**
+         * @brief 分段的缓冲区，默认的接收器
+         * @note 数据按段保存，写入时不会移动已有的数据。普通的段大小和libcurl每次回调的最大长度一致，
+         *       释放后放回全局的缓存池，预先分配(reserve)的大段直接释放
+         */
+        class http_buffer_chain : public http_response_sink {
+        public:
+            typedef std::shared_ptr<http_buffer_chain> ptr_t;
+
+            enum {
+                SEGMENT_SIZE = 16384, // CURL_MAX_WRITE_SIZE
+            };
+
+            struct span_t {
+                const char *data;
+                size_t      size;
+            };
+
+        public:
+            LIBATFRAME_UTILS_API http_buffer_chain();
+            LIBATFRAME_UTILS_API virtual ~http_buffer_chain();
+
+            /**
+             * @brief 预先分配至少能放下 total_size 字节的空间(包括已有的数据)
+             */
+            LIBATFRAME_UTILS_API virtual void reserve(size_t total_size);
+
+            LIBATFRAME_UTILS_API virtual size_t write(const char *data, size_t sz);
+
+            inline size_t size() const { return total_size_; }
+            inline bool   empty() const { return 0 == total_size_; }
+
+            inline size_t segment_count() const { return segments_.size(); }
+
+            /**
+             * @brief 获取一段数据，只在下一次修改前有效
+             */
+            LIBATFRAME_UTILS_API span_t segment(size_t idx) const;
+
+            /**
+             * @brief 从offset开始复制最多dlen字节
+             * @return 复制的长度
+             */
+            LIBATFRAME_UTILS_API size_t copy_to(char *dst, size_t dlen, size_t offset = 0) const;
+
+            LIBATFRAME_UTILS_API void        append_to(std::string &out) const;
+            LIBATFRAME_UTILS_API std::string to_string() const;
+
+            /**
+             * @brief 合并成一个连续的段，只有一段时不会复制
+             * @return 全部的数据
+             */
+            LIBATFRAME_UTILS_API span_t linearize();
+
+            /**
+             * @brief 清空数据，普通的段放回缓存池
+             */
+            LIBATFRAME_UTILS_API void clear();
+
+            /**
+             * @brief 全局缓存池中空闲的段数量
+             */
+            LIBATFRAME_UTILS_API static size_t get_pool_cached_count();
+
+            /**
+             * @brief 设置全局缓存池最多缓存的段数量，默认256(4MB)
+             */
+            LIBATFRAME_UTILS_API static void set_pool_max_cached_count(size_t v);
+
+        private:
+            struct segment_t {
+                char * data;
+                size_t size;
+                size_t capacity;
+            };
+
+            void push_segment(size_t capacity);
+
+        private:
+            std::vector<segment_t> segments_;
+            size_t                 total_size_;
+        };
+
+        /**
+         * @brief 直接把响应数据写入文件
+         */
+        class http_file_sink : public http_response_sink {
+        public:
+            typedef std::shared_ptr<http_file_sink> ptr_t;
+
+        public:
+            LIBATFRAME_UTILS_API http_file_sink();
+            LIBATFRAME_UTILS_API virtual ~http_file_sink();
+
+            /**
+             * @brief 打开文件
+             * @param path 文件路径
+             * @param append 是否追加到文件末尾
+             * @return 成功返回0，失败返回错误码
+             */
+            LIBATFRAME_UTILS_API int open(const char *path, bool append = false);
+
+            LIBATFRAME_UTILS_API void close();
+
+            inline bool   is_open() const { return NULL != file_; }
+            inline size_t size() const { return written_size_; }
+
+            LIBATFRAME_UTILS_API virtual size_t write(const char *data, size_t sz);
+
+            LIBATFRAME_UTILS_API virtual void finish();
+
+        private:
+            FILE * file_;
+            size_t written_size_;
+        };
+    } // namespace network
+} // namespace util
+
+#endif
@@ -0,0 +1,271 @@
+﻿/**
+ * @file http_server.h
+ * @brief lightweight non-blocking HTTP/1.1 server on libuv, for health check, metrics and admin commands
+ * Licensed under the MIT licenses.
+ *
+ * @version 1.0
+ * @author owent
+ * @date 2026.10.18
+ *
+ * @history
+ *
+ */
+
+#ifndef UTILS_NETWORK_HTTP_SERVER_H
+#define UTILS_NETWORK_HTTP_SERVER_H
+
+#pragma once
+
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cli/cmd_option.h"
+#include "design_pattern/noncopyable.h"
+#include "std/functional.h"
+#include "std/smart_ptr.h"
+
+#include "config/atframe_utils_build_feature.h"
+
+#if defined(NETWORK_EVPOLL_ENABLE_LIBUV) && NETWORK_EVPOLL_ENABLE_LIBUV
+#include <uv.h>
+#endif
+
+namespace util {
+    namespace network {
+        struct LIBATFRAME_UTILS_API http_server_request {
+            typedef std::vector<std::pair<std::string, std::string> > header_list_t;
+
+            std::string   method;
+            std::string   target; // raw request target, path and query
+            std::string   path;   // decoded path
+            std::string   query;  // raw query string without '?'
+            int           version_minor;
+            header_list_t headers;
+            std::string   body;
+            bool          keep_alive;
+
+            http_server_request();
+
+            void reset();
+
+            /**
+             * @brief find header, case insensitive
+             * @return NULL if not found
+             */
+            const std::string *get_header(const char *name) const;
+        };
+
+        struct LIBATFRAME_UTILS_API http_server_response {
+            typedef std::vector<std::pair<std::string, std::string> > header_list_t;
+
+            int           status;
+            std::string   content_type;
+            header_list_t headers; // extra headers, Content-Length and Connection are always generated
+            std::string   body;
+
+            http_server_response();
+
+            void reset();
+
+            static const char *get_reason_phrase(int status);
+        };
+
+        /**
+         * @brief incremental HTTP/1.x request parser, data can be fed in pieces of any size
+         * @note chunked request body is not supported
+         */
+        class http_server_parser {
+        public:
+            struct LIBATFRAME_UTILS_API state_t {
+                enum type {
+                    EN_HSPS_REQUEST_LINE = 0,
+                    EN_HSPS_HEADERS,
+                    EN_HSPS_BODY,
+                    EN_HSPS_DONE,
+                    EN_HSPS_ERROR,
+                };
+            };
+
+        public:
+            LIBATFRAME_UTILS_API http_server_parser(size_t max_header_size = 8192, size_t max_body_size = 1048576);
+
+            /**
+             * @brief parse data, stop at the end of a request so that pipelined requests are left for the next round
+             * @return length of consumed data
+             */
+            LIBATFRAME_UTILS_API size_t parse(const char *data, size_t sz);
+
+            /**
+             * @brief reset to parse the next request
+             */
+            LIBATFRAME_UTILS_API void reset();
+
+            LIBATFRAME_UTILS_API void set_limits(size_t max_header_size, size_t max_body_size);
+
+            inline state_t::type get_state() const { return state_; }
+            inline bool          is_done() const { return state_t::EN_HSPS_DONE == state_; }
+            inline bool          has_error() const { return state_t::EN_HSPS_ERROR == state_; }
+
+            /**
+             * @brief the status code to response when has_error(), 400, 413, 431 or 501
+             */
+            inline int get_error_status() const { return error_status_; }
+
+            inline http_server_request &      get_request() { return request_; }
+            inline const http_server_request &get_request() const { return request_; }
+
+        private:
+            bool parse_request_line(const char *line, size_t sz);
+            bool parse_header_line(const char *line, size_t sz);
+            bool finish_headers();
+            void set_error(int status);
+
+        private:
+            state_t::type       state_;
+            int                 error_status_;
+            size_t              max_header_size_;
+            size_t              max_body_size_;
+            size_t              header_size_;
+            size_t              body_remain_;
+            std::string         line_; // incomplete line
+            http_server_request request_;
+        };
+
+#if defined(NETWORK_EVPOLL_ENABLE_LIBUV) && NETWORK_EVPOLL_ENABLE_LIBUV
+        /**
+         * @brief HTTP/1.1 server running on a libuv loop without any thread
+         * @note all connections are preallocated, handlers are called synchronously in the loop.
+         *       After close(), run the loop until is_closed() to release all handles,
+         *       it's also safe to destroy it before that and the handles will be released by the loop later.
+         */
+        class http_server : public ::util::design_pattern::noncopyable {
+        public:
+            typedef std::shared_ptr<http_server>                                                ptr_t;
+            typedef std::function<void(const http_server_request &, http_server_response &)> handler_fn_t;
+            typedef std::shared_ptr< ::util::cli::cmd_option>                                  command_router_ptr_t;
+
+            struct LIBATFRAME_UTILS_API options_t {
+                size_t   max_connections;       /** preallocated connections, more connections are closed immediately **/
+                size_t   max_header_size;       /** 431 if the request line and headers are larger than it **/
+                size_t   max_body_size;         /** 413 if the request body is larger than it **/
+                uint64_t keep_alive_timeout_ms; /** idle connections are closed after it **/
+                int      backlog;
+
+                options_t();
+            };
+
+            struct LIBATFRAME_UTILS_API stats_t {
+                uint64_t accepted_count;
+                uint64_t rejected_count; /** connections closed because the pool is full **/
+                uint64_t request_count;
+                uint64_t error_count; /** bad requests **/
+                size_t   active_connections;
+
+                stats_t();
+            };
+
+            /**
+             * @brief data passed to commands of set_command_route() as ext_param
+             */
+            struct LIBATFRAME_UTILS_API command_context_t {
+                const http_server_request *request;
+                http_server_response *     response;
+                bool                       handled;
+            };
+
+            struct connection_t;
+
+        public:
+            LIBATFRAME_UTILS_API http_server();
+            LIBATFRAME_UTILS_API ~http_server();
+
+            /**
+             * @brief start listening
+             * @param loop libuv loop
+             * @param ip ip address to bind, IPv4 or IPv6
+             * @param port port to bind, 0 means any free port
+             * @return 0 or error code of libuv
+             */
+            LIBATFRAME_UTILS_API int listen(uv_loop_t *loop, const char *ip, int port, const options_t &options = options_t());
+
+            /**
+             * @brief stop listening and close all connections
+             */
+            LIBATFRAME_UTILS_API void close();
+
+            /**
+             * @brief if all handles are released after close()
+             */
+            LIBATFRAME_UTILS_API bool is_closed() const;
+
+            /**
+             * @brief get the port actually bound, -1 if not listening
+             */
+            LIBATFRAME_UTILS_API int get_port() const;
+
+            /**
+             * @brief set handler of a path
+             * @param path exact path, or a prefix if it ends with '/'. The longest prefix wins.
+             */
+            LIBATFRAME_UTILS_API void set_route(const std::string &path, handler_fn_t fn);
+
+            /**
+             * @brief dispatch requests under a path prefix into commands
+             * @note "/admin/reload/all?x=1" with prefix "/admin/" runs "reload" with the parameter "all". Handlers can use
+             *       get_command_context() to access the request and write the response, 404 if no handler calls it.
+             */
+            LIBATFRAME_UTILS_API void set_command_route(const std::string &prefix, const command_router_ptr_t &router);
+
+            /**
+             * @brief handler when no route matches, 404 by default
+             */
+            LIBATFRAME_UTILS_API void set_default_handler(handler_fn_t fn);
+
+            inline const stats_t &get_stats() const { return stats_; }
+
+            /**
+             * @brief get context in commands of set_command_route(), and mark the request as handled
+             * @return NULL if the command is not called by http_server
+             */
+            LIBATFRAME_UTILS_API static command_context_t *get_command_context(::util::cli::callback_param params);
+
+        private:
+            void dispatch(const http_server_request &req, http_server_response &rsp);
+
+            static void on_connection(uv_stream_t *server, int status);
+            static void on_tcp_closed(uv_handle_t *handle);
+            static void on_alloc(uv_handle_t *handle, size_t suggested_size, uv_buf_t *buf);
+            static void on_read(uv_stream_t *stream, ssize_t nread, const uv_buf_t *buf);
+            static void on_write(uv_write_t *req, int status);
+            static void on_timeout(uv_timer_t *timer);
+            static void on_connection_closed(uv_handle_t *handle);
+
+            void process_input(connection_t *conn);
+            void send_response(connection_t *conn, const http_server_request &req, http_server_response &rsp, bool keep_alive);
+            void close_connection(connection_t *conn);
+            void release_connection(connection_t *conn);
+
+        private:
+            uv_loop_t *  loop_;
+            uv_tcp_t *   listener_; // heap allocated, so it can be released after this is destroyed
+            options_t    options_;
+            stats_t      stats_;
+            int          port_;
+            bool         closing_;
+
+            std::vector<connection_t *> connections_; // all preallocated connections
+            std::vector<connection_t *> free_connections_;
+
+            std::unordered_map<std::string, handler_fn_t>   exact_routes_;
+            std::vector<std::pair<std::string, handler_fn_t> > prefix_routes_; // sorted by length, longest first
+            handler_fn_t                                    default_handler_;
+        };
+#endif
+    } // namespace network
+} // namespace util
+
+#endif
@@ -22,6 +22,7 @@
 #include <set>
 #include <vector>
 
+#include "ac_automation_compiled.h"
 #include "utf8_char_t.h"
 
 #include <config/atframe_utils_build_feature.h>
@@ -110,6 +111,14 @@ namespace util {
 
                 inline bool operator[](CH c) const { return test(c); }
 
+                void get_all(std::vector<CH> &out) const {
+                    for (size_t i = 0; i < sizeof(skip_code_) * 8; ++i) {
+                        if (0 != (skip_code_[i / 8] & (1 << (i % 8)))) {
+                            out.push_back(static_cast<CH>(i));
+                        }
+                    }
+                }
+
                 template <typename OCH, typename OTCTT>
                 LIBATFRAME_UTILS_API_HEAD_ONLY friend std::basic_ostream<OCH, OTCTT> &operator<<(std::basic_ostream<OCH, OTCTT> &os,
                                                                                                  const self_t &                  self) {
@@ -142,6 +151,8 @@ namespace util {
 
                 inline bool operator[](CH c) const { return test(c); }
 
+                void get_all(std::vector<CH> &out) const { out.insert(out.end(), skip_code_.begin(), skip_code_.end()); }
+
                 template <typename OCH, typename OTCTT>
                 LIBATFRAME_UTILS_API_HEAD_ONLY friend std::basic_ostream<OCH, OTCTT> &operator<<(std::basic_ostream<OCH, OTCTT> &os,
                                                                                                  const self_t &                  self) {
@@ -179,6 +190,20 @@ namespace util {
 
             LIBATFRAME_UTILS_API_HEAD_ONLY size_t actrie_get_length(const utf8_char_t &c) { return c.length(); }
 
+            template <typename CH>
+            LIBATFRAME_UTILS_API_HEAD_ONLY std::string actrie_to_string(const CH &c) {
+                return std::string(1, static_cast<char>(c));
+            }
+
+            LIBATFRAME_UTILS_API_HEAD_ONLY inline std::string actrie_to_string(const utf8_char_t &c) { return std::string(c.data, c.length()); }
+
+            template <typename CH>
+            LIBATFRAME_UTILS_API_HEAD_ONLY bool actrie_is_utf8(const CH *) {
+                return false;
+            }
+
+            LIBATFRAME_UTILS_API_HEAD_ONLY inline bool actrie_is_utf8(const utf8_char_t *) { return true; }
+
             template <typename CH = char>
             class LIBATFRAME_UTILS_API_HEAD_ONLY actrie {
             public:
@@ -666,7 +691,7 @@ namespace util {
 
                 if (is_no_case_) {
                     string_t res = keyword;
-                    std::transform(res.begin(), res.end(), res.begin(), util::string::tolower<char>);
+                    util::string::tolower(&res[0], keyword.data(), keyword.size());
                     storage_[0]->insert(storage_, res.c_str(), res.size(), keyword);
                 } else {
                     storage_[0]->insert(storage_, keyword.c_str(), keyword.size(), keyword);
@@ -687,7 +712,7 @@ namespace util {
                 string_t        nocase;
                 if (is_no_case_) {
                     nocase = content;
-                    std::transform(nocase.begin(), nocase.end(), nocase.begin(), util::string::tolower<char>);
+                    util::string::tolower(&nocase[0], content.data(), content.size());
                     conv_content = &nocase;
                 }
 
@@ -752,6 +777,33 @@ namespace util {
              */
             bool is_nocase() const { return is_no_case_; }
 
+            /**
+             * 编译成只读的平坦结构(双数组+失败指针)，用于大量关键字的高频匹配
+             * @note 编译结果不引用当前对象，之后修改关键字或跳过字符不影响已编译的结果
+             * @note 匹配语义见 ac_automation_compiled
+             * @return 编译后的AC自动机，失败返回空指针
+             */
+            ac_automation_compiled::ptr_t compile() const {
+                std::vector<std::string> keywords;
+                for (size_t i = 0; i < storage_.size(); ++i) {
+                    if (storage_[i]->is_leaf()) {
+                        keywords.push_back(storage_[i]->get_leaf());
+                    }
+                }
+
+                ac_automation_compiled::option_t opts;
+                opts.nocase = is_no_case_;
+                opts.utf8   = detail::actrie_is_utf8(static_cast<const char_t *>(NULL));
+
+                std::vector<char_t> skip_chars;
+                skip_charset_.get_all(skip_chars);
+                for (size_t i = 0; i < skip_chars.size(); ++i) {
+                    opts.skip_chars.push_back(detail::actrie_to_string(skip_chars[i]));
+                }
+
+                return ac_automation_compiled::create(keywords, opts);
+            }
+
             /**
              * 导出AC自动机的关系图（dot格式）
              * @param os 输出流
@@ -0,0 +1,130 @@
+﻿/**
+ * @file ac_automation_batch.h
+ * @brief 编译后的AC自动机的批量多线程匹配
+ * Licensed under the MIT licenses.
+ *
+ * @version 1.0
+ * @author owent
+ * @date 2026.10.17
+ *
+ * @history
+ *
+ */
+
+#ifndef UTIL_STRING_AC_AUTOMATION_BATCH_H
+#define UTIL_STRING_AC_AUTOMATION_BATCH_H
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <config/atframe_utils_build_feature.h>
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "std/atomic.h"
+#endif
+
+#include "ac_automation_compiled.h"
+
+namespace util {
+    namespace string {
+        /**
+         * @brief 批量匹配器，用固定的工作线程池并行匹配一批目标串
+         * @note 目标串按块(chunk)分配给工作线程，调用线程也参与匹配。每个线程使用自己的结果缓冲区，
+         *       全部完成后按输入顺序合并，所以结果和逐个调用 ac_automation_compiled::match 完全一致。
+         *       缓冲区在多次调用之间复用，预热后匹配过程中不再分配内存。
+         * @note 同一个匹配器同时只能执行一个批量匹配，并发调用会被串行化
+         */
+        class ac_automation_batch_matcher {
+        public:
+            typedef ac_automation_compiled::match_t    match_t;
+            typedef ac_automation_compiled::value_type value_type;
+
+            struct result_t {
+                value_type          matches; // 所有目标串的匹配结果
+                std::vector<size_t> offsets; // 第i个目标串的结果为 matches[offsets[i], offsets[i + 1])
+            };
+
+        public:
+            /**
+             * @brief 构造
+             * @param thread_count 参与匹配的线程数(包含调用线程)，0表示使用硬件线程数
+             * @param chunk_size 每次分配给一个线程的目标串数量，0表示使用默认值
+             */
+            LIBATFRAME_UTILS_API explicit ac_automation_batch_matcher(size_t thread_count = 0, size_t chunk_size = 0);
+            LIBATFRAME_UTILS_API ~ac_automation_batch_matcher();
+
+            /**
+             * @brief 批量匹配
+             * @param ac 编译后的自动机
+             * @param contents 目标串数组
+             * @param count 目标串数量
+             * @param out 输出匹配结果(会被清空)
+             * @return 所有目标串匹配到的数量
+             */
+            LIBATFRAME_UTILS_API size_t match(const ac_automation_compiled &ac, const std::string *contents, size_t count, result_t &out);
+
+            /**
+             * @brief 批量匹配
+             * @param ac 编译后的自动机
+             * @param contents 目标串列表
+             * @param out 输出匹配结果(会被清空)
+             * @return 所有目标串匹配到的数量
+             */
+            LIBATFRAME_UTILS_API size_t match(const ac_automation_compiled &ac, const std::vector<std::string> &contents, result_t &out);
+
+            /**
+             * @brief 参与匹配的线程数(包含调用线程)
+             */
+            LIBATFRAME_UTILS_API size_t thread_count() const;
+
+        private:
+            ac_automation_batch_matcher(const ac_automation_batch_matcher &);
+            ac_automation_batch_matcher &operator=(const ac_automation_batch_matcher &);
+
+            struct chunk_t {
+                size_t worker;       // 处理这个块的线程下标
+                size_t scratch_from; // 结果在线程缓冲区中的起始位置
+            };
+
+            void run_chunks(size_t worker);
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            void worker_main(size_t worker);
+#endif
+
+        private:
+            size_t                  chunk_size_;
+            std::vector<value_type> scratch_; // 每个线程的结果缓冲区
+            std::vector<chunk_t>    chunks_;
+
+            // 当前任务
+            const ac_automation_compiled *job_ac_;
+            const std::string *           job_contents_;
+            size_t                        job_count_;
+            size_t *                      job_offsets_;
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            std::vector<std::thread> threads_;
+            std::mutex               match_lock_;
+            std::mutex               job_lock_;
+            std::condition_variable  job_start_;
+            std::condition_variable  job_done_;
+            size_t                   job_seq_;
+            size_t                   job_pending_;
+            bool                     stop_;
+            std::atomic<size_t>      next_chunk_;
+#else
+            size_t next_chunk_;
+#endif
+        };
+    } // namespace string
+} // namespace util
+
+#endif
@@ -0,0 +1,251 @@
+﻿/**
+ * @file ac_automation_compiled.h
+ * @brief 编译后的AC自动机(平坦数组存储的双数组trie + 失败指针)
+ * Licensed under the MIT licenses.
+ *
+ * @version 1.0
+ * @author owent
+ * @date 2026.10.17
+ *
+ * @history
+ *     2026.10.17: 所有数据存放在一块位置无关的镜像中，支持导出镜像文件和以只读mmap方式加载
+ *     2026.10.17: 增加前置过滤(SIMD查找可能的关键字起始字节 + 前3字节bloom过滤)，快速跳过不含关键字的区域
+ *
+ */
+
+#ifndef UTIL_STRING_AC_AUTOMATION_COMPILED_H
+#define UTIL_STRING_AC_AUTOMATION_COMPILED_H
+
+#pragma once
+
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "std/smart_ptr.h"
+
+#include <config/atframe_utils_build_feature.h>
+
+namespace util {
+    namespace string {
+        /**
+         * @brief 编译后的只读AC自动机
+         * @note 按字节匹配，状态转移存储在双数组(base/check)中，字符按字节等价类压缩，
+         *       忽略大小写和可跳过字符在编译期折叠进字节映射表，匹配时不再需要复制或转换输入。
+         * @note 匹配语义: 从左往右，关键字一结束就立即输出(同一结束位置取最长的关键字)，输出后从下一个字节重新开始匹配，
+         *       所以结果互不重叠。和 ac_automation::match 的区别在于，后者只有在字典树路径上遇到叶子节点或者失配时才会检查后缀关键字。
+         * @note 所有数据都存放在一块位置无关(只使用偏移)的镜像中，镜像可以导出到文件，
+         *       然后被多个进程以只读mmap的方式直接加载和匹配，共享物理页，加载不需要重建。
+         *       镜像使用本机字节序，带版本号和crc32校验。
+         * @note 处于根节点时会先做前置过滤: 用SIMD(SSSE3/NEON)按16字节一批查找根节点可以转移的字节，
+         *       没有可跳过字符时再用关键字前3字节的bloom过滤，直接跳过不可能是关键字开始的位置。
+         */
+        class ac_automation_compiled {
+        public:
+            typedef std::shared_ptr<ac_automation_compiled> ptr_t;
+
+            enum {
+                INVALID_STATE = 0xFFFFFFFFU,
+            };
+
+            enum {
+                IMAGE_VERSION = 2,
+            };
+
+            struct option_t {
+                bool                     nocase;     // 忽略大小写(仅ASCII)
+                bool                     utf8;       // 可跳过字符按utf8字符处理
+                std::vector<std::string> skip_chars; // 可跳过字符，每个元素是一个字符(utf8模式下可以是多字节字符)
+                bool                     prefilter;  // 启用前置过滤，默认开启
+
+                LIBATFRAME_UTILS_API option_t();
+            };
+
+            struct match_t {
+                size_t   start;
+                size_t   length;
+                uint32_t keyword_index;
+            };
+            typedef std::vector<match_t> value_type;
+
+        private:
+            struct protect_constructor_helper {};
+
+        public:
+            LIBATFRAME_UTILS_API ac_automation_compiled(protect_constructor_helper);
+            LIBATFRAME_UTILS_API ~ac_automation_compiled();
+
+            /**
+             * @brief 编译关键字列表
+             * @param keywords 关键字列表，空字符串会被忽略，重复的关键字以最后一个为准
+             * @param opts 编译选项
+             * @return 编译后的自动机，失败返回空指针
+             */
+            static LIBATFRAME_UTILS_API ptr_t create(const std::vector<std::string> &keywords, const option_t &opts);
+
+            /**
+             * @brief 从内存中的镜像加载
+             * @param data 镜像地址，不复制时必须4字节对齐，并且在返回的对象销毁前保持有效
+             * @param sz 镜像长度
+             * @param copy 是否复制镜像数据
+             * @param verify 是否校验checksum和所有状态的转移范围(O(n))，不校验时只检查文件头(O(1))
+             * @return 加载成功返回自动机，失败返回空指针
+             */
+            static LIBATFRAME_UTILS_API ptr_t load_image(const void *data, size_t sz, bool copy, bool verify);
+
+            /**
+             * @brief 以只读共享mmap的方式加载镜像文件
+             * @param file_path 镜像文件路径
+             * @param verify 是否校验checksum和所有状态的转移范围(O(n))，不校验时只检查文件头(O(1))
+             * @return 加载成功返回自动机，失败返回空指针
+             * @note 不支持mmap的平台会退化为读入内存
+             */
+            static LIBATFRAME_UTILS_API ptr_t mmap_image(const char *file_path, bool verify);
+
+            /**
+             * @brief 导出镜像
+             * @param out 输出
+             */
+            LIBATFRAME_UTILS_API void dump_image(std::string &out) const;
+
+            /**
+             * @brief 导出镜像到文件
+             * @param file_path 文件路径
+             * @return 成功返回true
+             */
+            LIBATFRAME_UTILS_API bool save_image(const char *file_path) const;
+
+            /**
+             * @brief 匹配目标串
+             * @param content 目标串
+             * @param sz 目标串长度
+             * @param out 输出匹配结果(追加到末尾)
+             * @return 本次匹配到的数量
+             */
+            LIBATFRAME_UTILS_API size_t match(const char *content, size_t sz, value_type &out) const;
+
+            /**
+             * @brief 匹配目标串，返回匹配结果
+             * @param content 目标串
+             * @return 匹配结果
+             */
+            LIBATFRAME_UTILS_API value_type match(const std::string &content) const;
+
+            /**
+             * @brief 目标串中是否包含任意关键字
+             * @param content 目标串
+             * @param sz 目标串长度
+             * @return 包含关键字返回true
+             */
+            LIBATFRAME_UTILS_API bool contains(const char *content, size_t sz) const;
+
+            /**
+             * @brief 获取关键字
+             * @param idx 关键字下标(match_t::keyword_index)
+             * @param len 输出关键字长度
+             * @return 关键字起始地址，下标无效时返回NULL
+             */
+            LIBATFRAME_UTILS_API const char *get_keyword(uint32_t idx, size_t &len) const;
+
+            /**
+             * @brief 获取关键字
+             * @param idx 关键字下标(match_t::keyword_index)
+             * @return 关键字
+             */
+            LIBATFRAME_UTILS_API std::string get_keyword(uint32_t idx) const;
+
+            /**
+             * @brief 关键字数量
+             */
+            LIBATFRAME_UTILS_API size_t keyword_size() const;
+
+            /**
+             * @brief 状态数组(双数组)的长度
+             */
+            LIBATFRAME_UTILS_API size_t state_size() const;
+
+            /**
+             * @brief 占用的内存(字节)，mmap加载时不包含映射的镜像
+             */
+            LIBATFRAME_UTILS_API size_t memory_usage() const;
+
+            /**
+             * @brief 镜像大小(字节)
+             */
+            LIBATFRAME_UTILS_API size_t image_size() const;
+
+            /**
+             * @brief 是否是mmap加载的镜像
+             */
+            inline bool is_mapped() const { return NULL != mapped_addr_; }
+
+            inline bool is_nocase() const { return nocase_; }
+            inline bool is_utf8() const { return utf8_; }
+
+        private:
+            /**
+             * @brief 从状态s按字节类型cls转移(不走失败指针)
+             * @return 失败返回INVALID_STATE
+             */
+            inline uint32_t go(uint32_t s, uint32_t cls) const {
+                uint32_t t = base_[s] + cls;
+                if (t < state_count_ && check_[t] == s) {
+                    return t;
+                }
+                return INVALID_STATE;
+            }
+
+            bool bind_image(const void *data, size_t sz, bool verify);
+
+            size_t skip_clean(const unsigned char *p, size_t i, size_t sz) const;
+            bool   is_multibyte_skip(uint32_t s, const unsigned char *p, size_t left, size_t &skip_len) const;
+            size_t find_start(uint32_t keyword_index, const unsigned char *content, size_t end) const;
+
+            template <typename TFN>
+            void walk(const char *content, size_t sz, TFN &fn) const;
+
+        private:
+            const unsigned char *image_;
+            size_t               image_size_;
+
+            // 字节信息: 低24位为字节等价类(0表示不出现在任何关键字中), 最高位表示可跳过
+            const uint32_t *byte_info_;
+            const uint32_t *base_;
+            const uint32_t *check_;
+            const uint32_t *fail_;
+            const uint32_t *output_; // 状态结束时输出的关键字下标+1，0表示没有输出
+            const uint32_t *keyword_offset_; // keyword_count_+1 个元素
+            const char *    keyword_data_;
+            const uint32_t *multibyte_skip_offset_; // 多字节可跳过字符(已排序), multibyte_skip_count_+1 个元素
+            const char *    multibyte_skip_data_;
+
+            uint32_t state_count_;
+            uint32_t class_count_;
+            uint32_t keyword_count_;
+            uint32_t multibyte_skip_count_;
+
+            const unsigned char *start_flags_;  // 256字节，根节点可转移/短关键字起始标记
+            const unsigned char *prefix_bloom_; // 关键字前3字节的bloom过滤
+            unsigned char        scan_table_[32];
+
+            bool nocase_;
+            bool utf8_;
+            bool prefilter_;
+            bool prefix_bloom_enabled_;
+
+            // 自己持有的镜像(8字节对齐)
+            std::vector<uint64_t> owned_image_;
+
+            // mmap的镜像
+            void * mapped_addr_;
+            size_t mapped_size_;
+#if defined(_WIN32) && !defined(__CYGWIN__)
+            void *mapped_file_;
+            void *mapped_handle_;
+#endif
+        };
+    } // namespace string
+} // namespace util
+
+#endif
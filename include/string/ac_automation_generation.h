@@ -0,0 +1,168 @@
+﻿/**
+ * @file ac_automation_generation.h
+ * @brief 编译后的AC自动机的多版本管理，支持后台增量更新关键字
+ * Licensed under the MIT licenses.
+ *
+ * @version 1.0
+ * @author owent
+ * @date 2026.10.17
+ *
+ * @history
+ *
+ */
+
+#ifndef UTIL_STRING_AC_AUTOMATION_GENERATION_H
+#define UTIL_STRING_AC_AUTOMATION_GENERATION_H
+
+#pragma once
+
+#include <cstddef>
+#include <set>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include <config/atframe_utils_build_feature.h>
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+#include "lock/spin_lock.h"
+#include "std/smart_ptr.h"
+
+#include "ac_automation_compiled.h"
+
+namespace util {
+    namespace string {
+        /**
+         * @brief 编译后的AC自动机的版本管理
+         * @note 关键字的增加和删除只修改待编译的关键字集合，然后在后台编译出新的一代(generation)只读自动机，
+         *       编译完成后原子地替换当前版本。读取方通过 get() 拿到当前版本的引用后直接匹配，
+         *       不会被编译过程阻塞，旧版本在最后一个引用释放后销毁。
+         * @note 同一时间只有一个编译过程，编译期间的多次 build_async() 会合并成一次
+         */
+        class ac_automation_generation_manager {
+        public:
+            struct generation_t {
+                uint64_t                      id;            // 版本号，从1开始
+                ac_automation_compiled::ptr_t automation;    // 编译后的自动机
+                size_t                        keyword_count; // 关键字数量
+                size_t                        memory_usage;  // 这一代占用的内存(字节)
+                int64_t                       build_time_us; // 编译耗时(微秒)
+            };
+            typedef std::shared_ptr<const generation_t> generation_ptr_t;
+
+            struct stats_t {
+                uint64_t generation;          // 当前版本号，0表示还没有编译过
+                size_t   keyword_count;       // 当前版本的关键字数量
+                size_t   state_count;         // 当前版本的状态数组长度
+                size_t   memory_usage;        // 当前版本占用的内存(字节)
+                size_t   pending_keywords;    // 待编译的关键字数量
+                bool     dirty;               // 待编译的关键字集合是否和当前版本不一致
+                uint64_t build_count;         // 编译成功次数
+                uint64_t build_failed_count;  // 编译失败次数
+                int64_t  last_build_time_us;  // 最近一次编译耗时(微秒)
+                int64_t  max_build_time_us;   // 最大编译耗时(微秒)
+                int64_t  total_build_time_us; // 总编译耗时(微秒)
+            };
+
+        public:
+            LIBATFRAME_UTILS_API explicit ac_automation_generation_manager(const ac_automation_compiled::option_t &opts);
+            LIBATFRAME_UTILS_API ~ac_automation_generation_manager();
+
+            /**
+             * @brief 增加关键字，下一次编译后生效
+             * @return 关键字集合有变化返回true
+             */
+            LIBATFRAME_UTILS_API bool add_keyword(const std::string &keyword);
+
+            /**
+             * @brief 删除关键字，下一次编译后生效
+             * @return 关键字集合有变化返回true
+             */
+            LIBATFRAME_UTILS_API bool remove_keyword(const std::string &keyword);
+
+            /**
+             * @brief 批量增加和删除关键字，下一次编译后生效
+             * @param add_keywords 增加的关键字
+             * @param remove_keywords 删除的关键字(在增加之后执行)
+             * @return 关键字集合变化的数量
+             */
+            LIBATFRAME_UTILS_API size_t update_keywords(const std::vector<std::string> &add_keywords,
+                                                        const std::vector<std::string> &remove_keywords);
+
+            /**
+             * @brief 替换全部关键字，下一次编译后生效
+             */
+            LIBATFRAME_UTILS_API void reset_keywords(const std::vector<std::string> &keywords);
+
+            /**
+             * @brief 在当前线程编译新版本并替换，关键字集合没有变化时不会重新编译
+             * @return 成功或没有变化返回true，编译失败返回false(保留原来的版本)
+             */
+            LIBATFRAME_UTILS_API bool build();
+
+            /**
+             * @brief 在后台线程编译新版本并替换，立即返回
+             * @note 禁用多线程(LOCK_DISABLE_MT)时在当前线程编译
+             */
+            LIBATFRAME_UTILS_API void build_async();
+
+            /**
+             * @brief 等待所有已经提交的后台编译完成
+             */
+            LIBATFRAME_UTILS_API void wait_async();
+
+            /**
+             * @brief 获取当前版本，可以在任意线程调用，不会被编译过程阻塞
+             * @return 当前版本，还没有编译过时返回空指针
+             */
+            LIBATFRAME_UTILS_API generation_ptr_t get() const;
+
+            /**
+             * @brief 获取统计数据
+             */
+            LIBATFRAME_UTILS_API stats_t get_stats() const;
+
+        private:
+            ac_automation_generation_manager(const ac_automation_generation_manager &);
+            ac_automation_generation_manager &operator=(const ac_automation_generation_manager &);
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            void async_main();
+#endif
+
+        private:
+            ac_automation_compiled::option_t options_;
+
+            // 待编译的关键字集合和修改序号
+            std::set<std::string> keywords_;
+            uint64_t              keywords_revision_;
+            uint64_t              built_revision_;
+
+            // 当前版本，只在复制和替换指针时加锁
+            mutable ::util::lock::spin_lock current_lock_;
+            generation_ptr_t                current_;
+
+            stats_t stats_;
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            mutable std::mutex keywords_lock_;
+            std::mutex         build_lock_;
+
+            std::mutex              async_lock_;
+            std::condition_variable async_cond_;
+            std::condition_variable async_idle_;
+            std::thread             async_thread_;
+            bool                    async_requested_;
+            bool                    async_running_;
+            bool                    async_stop_;
+#endif
+        };
+    } // namespace string
+} // namespace util
+
+#endif
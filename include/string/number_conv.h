@@ -0,0 +1,183 @@
+﻿/**
+ * @file number_conv.h
+ * @brief 数字和字符串的快速转换
+ * Licensed under the MIT licenses.
+ *
+ * @version 1.0
+ * @author owent
+ * @date 2026.10.17
+ *
+ * @history
+ *
+ */
+
+#ifndef UTIL_STRING_NUMBER_CONV_H
+#define UTIL_STRING_NUMBER_CONV_H
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+
+#include <common/string_oprs.h>
+
+#include <config/atframe_utils_build_feature.h>
+
+namespace util {
+    namespace string {
+        enum number_conv_error_t {
+            EN_NUMBER_CONV_SUCCESS      = 0,
+            EN_NUMBER_CONV_INVALID      = -1, // 没有可以转换的数字
+            EN_NUMBER_CONV_OUT_OF_RANGE = -2, // 超出输出类型的范围
+        };
+
+        enum {
+            NUMBER_CONV_INT_BUFFER_SIZE    = 24, // 整数转字符串需要的缓冲区长度(含结尾的\0)
+            NUMBER_CONV_DOUBLE_BUFFER_SIZE = 32, // 浮点数转字符串需要的缓冲区长度(含结尾的\0)
+        };
+
+        /**
+         * @brief 严格的十进制字符串转整数
+         * @param out 输出的整数，失败时不修改
+         * @param str 被转换的字符串
+         * @param sz 字符串长度
+         * @param used 输出使用的字符数，可以为NULL
+         * @return 成功返回EN_NUMBER_CONV_SUCCESS，没有数字返回EN_NUMBER_CONV_INVALID，超出范围返回EN_NUMBER_CONV_OUT_OF_RANGE
+         * @note 格式: [+-]?[0-9]+ , 和 str2int 不同，不支持十六进制和八进制，会检查溢出，并且不要求字符串以\0结尾
+         * @note 小端平台上每次处理8个数字(SWAR)
+         */
+        template <typename T>
+        LIBATFRAME_UTILS_API_HEAD_ONLY int parse_int(T &out, const char *str, size_t sz, size_t *used = NULL) {
+            typedef typename std::remove_cv<T>::type                 value_type;
+            typedef typename std::make_unsigned<value_type>::type unsigned_type;
+
+            const char *p   = str;
+            const char *end = str + sz;
+
+            bool is_negative = false;
+            if (p < end && ('-' == *p || '+' == *p)) {
+                is_negative = '-' == *p;
+                ++p;
+            }
+
+            const char *digits_begin = p;
+            while (p < end && '0' == *p) {
+                ++p;
+            }
+
+            const char *significant_begin = p;
+#if UTIL_STRFUNC_SWAR_LITTLE_ENDIAN
+            while (end - p >= 8 && detail::str2int_is_eight_digits(detail::str2int_load_u64(p))) {
+                p += 8;
+            }
+#endif
+            while (p < end && *p >= '0' && *p <= '9') {
+                ++p;
+            }
+
+            if (p == digits_begin) {
+                if (NULL != used) {
+                    *used = 0;
+                }
+                return EN_NUMBER_CONV_INVALID;
+            }
+
+            if (NULL != used) {
+                *used = static_cast<size_t>(p - str);
+            }
+
+            // 18446744073709551615 有20位，20位的数字只有1开头并且结果不小于10^19时才没有溢出
+            size_t   significant_len = static_cast<size_t>(p - significant_begin);
+            uint64_t value           = detail::str2int_parse_digits(significant_begin, significant_len);
+            if (significant_len > 20 ||
+                (20 == significant_len && ('1' != *significant_begin || value < 10000000000000000000ULL))) {
+                return EN_NUMBER_CONV_OUT_OF_RANGE;
+            }
+
+            uint64_t max_positive = static_cast<uint64_t>((std::numeric_limits<value_type>::max)());
+            if (is_negative) {
+                uint64_t max_negative = std::numeric_limits<value_type>::is_signed ? max_positive + 1 : 0;
+                if (value > max_negative) {
+                    return EN_NUMBER_CONV_OUT_OF_RANGE;
+                }
+
+                out = static_cast<value_type>(static_cast<unsigned_type>(0) - static_cast<unsigned_type>(value));
+            } else {
+                if (value > max_positive) {
+                    return EN_NUMBER_CONV_OUT_OF_RANGE;
+                }
+
+                out = static_cast<value_type>(value);
+            }
+
+            return EN_NUMBER_CONV_SUCCESS;
+        }
+
+        /**
+         * @brief 浮点数转字符串(可以精确还原的十进制表示，绝大多数情况下是最短的)
+         * @param str 输出的字符串缓冲区
+         * @param strsz 字符串缓冲区长度，NUMBER_CONV_DOUBLE_BUFFER_SIZE 总是足够
+         * @param in 输入的浮点数
+         * @return 返回输出的数据长度，缓冲区不足时返回0。缓冲区有剩余时会在末尾补\0
+         * @note 使用Grisu2算法生成数字，输出总是可以被 parse_double/strtod 精确还原，
+         *       但是不保证最短，极少数情况下会比最短的表示多一位有效数字
+         * @note 输出格式和 ECMAScript 的 Number.prototype.toString 一致: 1e21以下的整数直接输出，
+         *       10^-7到10^21之间用小数表示，其他用科学计数法(1.5e+21, 1e-7)。特殊值输出 nan/inf/-inf
+         */
+        LIBATFRAME_UTILS_API size_t double2str(char *str, size_t strsz, double in);
+
+        /**
+         * @brief 单精度浮点数转字符串(可以精确还原的十进制表示，绝大多数情况下是最短的)
+         * @see double2str
+         */
+        LIBATFRAME_UTILS_API size_t float2str(char *str, size_t strsz, float in);
+
+        /**
+         * @brief 字符串转浮点数
+         * @param out 输出的浮点数，失败时不修改。超出范围时输出inf/-inf
+         * @param str 被转换的字符串
+         * @param sz 字符串长度
+         * @param used 输出使用的字符数，可以为NULL
+         * @return 成功返回EN_NUMBER_CONV_SUCCESS，没有数字返回EN_NUMBER_CONV_INVALID，超出范围返回EN_NUMBER_CONV_OUT_OF_RANGE
+         * @note 格式: [+-]?([0-9]+[.]?[0-9]*|[.][0-9]+)([eE][+-]?[0-9]+)? 或者(不区分大小写) inf, infinity, nan
+         * @note 不会跳过前面的空白字符，不依赖locale，不要求字符串以\0结尾
+         * @note 先走Clinger快速路径，然后是Eisel-Lemire算法，有效数字超过19位并且无法确定舍入时才退化到strtod
+         */
+        LIBATFRAME_UTILS_API int parse_double(double &out, const char *str, size_t sz, size_t *used = NULL);
+
+        /**
+         * @brief 字符串转单精度浮点数
+         * @see parse_double
+         */
+        LIBATFRAME_UTILS_API int parse_float(float &out, const char *str, size_t sz, size_t *used = NULL);
+
+        /**
+         * @brief 数字转字符串，追加到输出的末尾
+         * @param out 输出
+         * @param in 输入的数字
+         */
+        template <typename T>
+        LIBATFRAME_UTILS_API_HEAD_ONLY inline void append_number(std::string &out, const T &in) {
+            char   buffer[NUMBER_CONV_INT_BUFFER_SIZE];
+            size_t len = int2str(buffer, sizeof(buffer), in);
+            out.append(buffer, len);
+        }
+
+        LIBATFRAME_UTILS_API_HEAD_ONLY inline void append_number(std::string &out, const double &in) {
+            char   buffer[NUMBER_CONV_DOUBLE_BUFFER_SIZE];
+            size_t len = double2str(buffer, sizeof(buffer), in);
+            out.append(buffer, len);
+        }
+
+        LIBATFRAME_UTILS_API_HEAD_ONLY inline void append_number(std::string &out, const float &in) {
+            char   buffer[NUMBER_CONV_DOUBLE_BUFFER_SIZE];
+            size_t len = float2str(buffer, sizeof(buffer), in);
+            out.append(buffer, len);
+        }
+    } // namespace string
+} // namespace util
+
+#endif
@@ -0,0 +1,181 @@
+﻿/**
+ * @file string_pool.h
+ * @brief 线程安全的字符串驻留池，相同内容的字符串只保存一份
+ * Licensed under the MIT licenses.
+ *
+ * @version 1.0
+ * @author owent
+ * @date 2026.10.17
+ *
+ * @history
+ *
+ */
+
+#ifndef UTIL_STRING_STRING_POOL_H
+#define UTIL_STRING_STRING_POOL_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include <config/atframe_utils_build_feature.h>
+
+#include "lock/spin_lock.h"
+
+namespace util {
+    namespace string {
+        class string_pool;
+
+        /**
+         * @brief 驻留字符串的句柄
+         * @note 只有一个指针大小，可以直接复制。指向的数据在所属的 string_pool 销毁前一直有效并且不会被修改
+         * @note 同一个池里内容相同的字符串指针也相同，所以比较相等只需要比较指针，哈希值在驻留时已经算好
+         * @note 默认构造的句柄表示空字符串，空字符串的id是0
+         */
+        class LIBATFRAME_UTILS_API_HEAD_ONLY interned_string {
+        public:
+            // 放在字符数据前面的头部
+            struct header_t {
+                uint64_t hash;
+                uint32_t id;
+                uint32_t size;
+            };
+
+        public:
+            interned_string() : data_(NULL) {}
+
+            inline const char *c_str() const { return NULL == data_ ? "" : data_; }
+            inline const char *data() const { return c_str(); }
+            inline size_t      size() const { return NULL == data_ ? 0 : header()->size; }
+            inline size_t      length() const { return size(); }
+            inline bool        empty() const { return NULL == data_; }
+
+            /**
+             * @brief 池内唯一的id，可以用 string_pool::get 取回句柄
+             */
+            inline uint32_t id() const { return NULL == data_ ? 0 : header()->id; }
+            inline uint64_t hash() const { return NULL == data_ ? 0 : header()->hash; }
+
+            inline std::string to_string() const { return std::string(c_str(), size()); }
+
+            friend inline bool operator==(const interned_string &l, const interned_string &r) { return l.data_ == r.data_; }
+            friend inline bool operator!=(const interned_string &l, const interned_string &r) { return l.data_ != r.data_; }
+
+            // 按id排序，同一个池里的顺序是确定的(驻留的先后顺序)，不是字典序
+            friend inline bool operator<(const interned_string &l, const interned_string &r) { return l.id() < r.id(); }
+
+            template <typename CH, typename CHT>
+            friend std::basic_ostream<CH, CHT> &operator<<(std::basic_ostream<CH, CHT> &os, const interned_string &self) {
+                os.write(self.c_str(), static_cast<std::streamsize>(self.size()));
+                return os;
+            }
+
+        private:
+            friend class string_pool;
+            explicit interned_string(const char *d) : data_(d) {}
+
+            inline const header_t *header() const { return reinterpret_cast<const header_t *>(data_) - 1; }
+
+        private:
+            const char *data_;
+        };
+
+        /**
+         * @brief 字符串驻留池
+         * @note 按哈希值分成多个分片，每个分片有独立的自旋锁、开放寻址的哈希表和连续分配的内存块，
+         *       驻留时不会为每个字符串单独分配内存，查找时不需要构造 std::string
+         * @note 字符串只增不删，池销毁时统一释放
+         */
+        class string_pool {
+        public:
+            enum {
+                SHARD_BITS  = 4,
+                SHARD_COUNT = 1 << SHARD_BITS,
+            };
+
+            struct stats_t {
+                size_t count;        // 字符串数量(不含空字符串)
+                size_t data_bytes;   // 字符串数据的总长度
+                size_t memory_usage; // 占用的内存(字节)，包括内存块和哈希表
+            };
+
+        public:
+            LIBATFRAME_UTILS_API string_pool();
+            LIBATFRAME_UTILS_API ~string_pool();
+
+            /**
+             * @brief 全局的字符串池
+             */
+            LIBATFRAME_UTILS_API static string_pool &instance();
+
+            /**
+             * @brief 驻留字符串，已经存在时返回已有的句柄
+             * @param str 字符串
+             * @param sz 字符串长度
+             * @return 句柄，空字符串返回默认构造的句柄
+             */
+            LIBATFRAME_UTILS_API interned_string intern(const char *str, size_t sz);
+
+            inline interned_string intern(const char *str) { return intern(str, NULL == str ? 0 : strlen(str)); }
+            inline interned_string intern(const std::string &str) { return intern(str.data(), str.size()); }
+
+            /**
+             * @brief 查找已经驻留的字符串，不存在时不会插入
+             * @return 句柄，不存在时返回默认构造的句柄
+             */
+            LIBATFRAME_UTILS_API interned_string find(const char *str, size_t sz) const;
+
+            inline interned_string find(const std::string &str) const { return find(str.data(), str.size()); }
+
+            /**
+             * @brief 按id获取句柄
+             * @return 句柄，id不存在时返回默认构造的句柄
+             */
+            LIBATFRAME_UTILS_API interned_string get(uint32_t id) const;
+
+            /**
+             * @brief 获取统计数据
+             */
+            LIBATFRAME_UTILS_API stats_t get_stats() const;
+
+        private:
+            string_pool(const string_pool &);
+            string_pool &operator=(const string_pool &);
+
+            struct shard_t {
+                mutable ::util::lock::spin_lock lock;
+                std::vector<const char *>       table;    // 开放寻址的哈希表，长度是2的幂
+                std::vector<const char *>       by_index; // 按分片内序号保存，用于按id查找
+                std::vector<char *>             blocks;   // 分配的内存块
+                char *                          cursor;   // 当前内存块的可用位置
+                size_t                          remain;   // 当前内存块的剩余长度
+                size_t                          data_bytes;
+                size_t                          block_bytes;
+
+                shard_t() : cursor(NULL), remain(0), data_bytes(0), block_bytes(0) {}
+            };
+
+            static uint64_t hash_of(const char *str, size_t sz);
+            static const char *lookup(const shard_t &shard, uint64_t hash, const char *str, size_t sz);
+            const char *       insert(shard_t &shard, uint32_t shard_index, uint64_t hash, const char *str, size_t sz);
+
+        private:
+            shard_t shards_[SHARD_COUNT];
+        };
+    } // namespace string
+} // namespace util
+
+namespace std {
+    template <>
+    struct hash< ::util::string::interned_string> {
+        size_t operator()(const ::util::string::interned_string &s) const { return static_cast<size_t>(s.hash()); }
+    };
+} // namespace std
+
+#endif
@@ -12,6 +12,9 @@
  *
  * @history
  *     2014.05.20 增加类似php的rawurlencode和urlencode函数
+ *     2026.10.17 增加零拷贝的只读解析器tquerystring_view
+ *     2026.10.17 URL编码和解码使用SIMD查找需要转义的字节，增加输出到缓冲区的接口
+ *     2026.10.17 数字和字符串的互转不再经过stringstream
  *
  */
 
@@ -21,13 +24,19 @@
 #pragma once
 
 #include <cstddef>
+#include <cstring>
+#include <limits>
 #include <map>
+#include <stdint.h>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "std/smart_ptr.h"
 
+#include "string/number_conv.h"
+
 #include <config/atframe_utils_build_feature.h>
 
 namespace util {
@@ -98,30 +107,128 @@ namespace util {
          */
         LIBATFRAME_UTILS_API std::string decode_url(const char *uri, std::size_t sz = 0);
 
+        /**
+         * @brief 以下函数和对应的返回std::string的版本规则相同，但是输出到调用者提供的缓冲区
+         * @note 不需要转义的连续字节使用SIMD(AVX2/SSSE3/NEON，运行时检测)一次判断16/32个字节，然后整块复制
+         * @param [out] dst     输出缓冲区，传NULL时只计算输出长度
+         * @param [in]  dlen    输出缓冲区长度，编码时不小于3*sz或解码时不小于sz时不会预先计算长度
+         * @param [out] olen    输出或需要的长度(不包含结尾的\0)，可以为NULL
+         * @param [in]  content 待编码或解码的内容
+         * @param [in]  sz      内容长度，和返回std::string的版本相同，0表示当作字符串(使用strlen计算长度)
+         * @return 成功返回0，缓冲区不足返回-1(不写入数据，*olen为需要的长度)
+         */
+        LIBATFRAME_UTILS_API int encode_uri(char *dst, std::size_t dlen, std::size_t *olen, const char *content, std::size_t sz);
+        LIBATFRAME_UTILS_API int decode_uri(char *dst, std::size_t dlen, std::size_t *olen, const char *uri, std::size_t sz);
+        LIBATFRAME_UTILS_API int encode_uri_component(char *dst, std::size_t dlen, std::size_t *olen, const char *content, std::size_t sz);
+        LIBATFRAME_UTILS_API int decode_uri_component(char *dst, std::size_t dlen, std::size_t *olen, const char *uri, std::size_t sz);
+        LIBATFRAME_UTILS_API int raw_encode_url(char *dst, std::size_t dlen, std::size_t *olen, const char *content, std::size_t sz);
+        LIBATFRAME_UTILS_API int raw_decode_url(char *dst, std::size_t dlen, std::size_t *olen, const char *uri, std::size_t sz);
+        LIBATFRAME_UTILS_API int encode_url(char *dst, std::size_t dlen, std::size_t *olen, const char *content, std::size_t sz);
+        LIBATFRAME_UTILS_API int decode_url(char *dst, std::size_t dlen, std::size_t *olen, const char *uri, std::size_t sz);
+
+        namespace detail {
+            // 0: 其他类型, 1: 整数, 2: 浮点数。字符、bool和long double保持stringstream的行为
+            template <typename T>
+            struct query_string_number_kind
+                : public std::integral_constant<
+                      int, (std::is_integral<T>::value && !std::is_same<T, bool>::value && !std::is_same<T, char>::value &&
+                            !std::is_same<T, signed char>::value && !std::is_same<T, unsigned char>::value)
+                               ? 1
+                               : ((std::is_floating_point<T>::value && sizeof(T) <= sizeof(double)) ? 2 : 0)> {};
+
+            LIBATFRAME_UTILS_API_HEAD_ONLY inline const char *query_string_skip_space(const char *str) {
+                while (str && (' ' == *str || '\t' == *str || '\r' == *str || '\n' == *str)) {
+                    ++str;
+                }
+                return str;
+            }
+
+            template <typename T>
+            LIBATFRAME_UTILS_API_HEAD_ONLY T query_string_to_any(const char *str, std::integral_constant<int, 0>) {
+                T                 ret;
+                std::stringstream ss;
+                ss << str;
+                ss >> ret;
+                return ret;
+            }
+
+            template <typename T>
+            LIBATFRAME_UTILS_API_HEAD_ONLY T query_string_to_any(const char *str, std::integral_constant<int, 1>) {
+                T ret = 0;
+                if (NULL == str) {
+                    return ret;
+                }
+
+                // 和stringstream一样，超出范围时取最大/最小值
+                str = query_string_skip_space(str);
+                if (::util::string::EN_NUMBER_CONV_OUT_OF_RANGE == ::util::string::parse_int(ret, str, strlen(str))) {
+                    ret = '-' == *str ? (std::numeric_limits<T>::min)() : (std::numeric_limits<T>::max)();
+                }
+                return ret;
+            }
+
+            LIBATFRAME_UTILS_API_HEAD_ONLY inline void query_string_parse_floating(float &out, const char *str) {
+                ::util::string::parse_float(out, str, strlen(str));
+            }
+
+            LIBATFRAME_UTILS_API_HEAD_ONLY inline void query_string_parse_floating(double &out, const char *str) {
+                ::util::string::parse_double(out, str, strlen(str));
+            }
+
+            template <typename T>
+            LIBATFRAME_UTILS_API_HEAD_ONLY T query_string_to_any(const char *str, std::integral_constant<int, 2>) {
+                typename std::conditional<sizeof(T) <= sizeof(float), float, double>::type ret = 0;
+                if (NULL != str) {
+                    query_string_parse_floating(ret, query_string_skip_space(str));
+                }
+                return static_cast<T>(ret);
+            }
+
+            template <typename T>
+            LIBATFRAME_UTILS_API_HEAD_ONLY std::string any_to_query_string(const T &val, std::integral_constant<int, 0>) {
+                std::stringstream ss;
+                ss << val;
+                return ss.str();
+            }
+
+            template <typename T>
+            LIBATFRAME_UTILS_API_HEAD_ONLY std::string any_to_query_string(const T &val, std::integral_constant<int, 1>) {
+                std::string ret;
+                ::util::string::append_number(ret, val);
+                return ret;
+            }
+
+            template <typename T>
+            LIBATFRAME_UTILS_API_HEAD_ONLY std::string any_to_query_string(const T &val, std::integral_constant<int, 2>) {
+                std::string ret;
+                ::util::string::append_number(ret, static_cast<typename std::conditional<sizeof(T) <= sizeof(float), float, double>::type>(val));
+                return ret;
+            }
+        } // namespace detail
+
         /**
          * @brief 字符串转换为任意类型
          * @param [in] str     字符串表示的数据内容
          * @return 任意类型
+         * @note 整数和浮点数使用 util::string::parse_int/parse_double 转换，不经过stringstream
          */
         template <typename T>
         LIBATFRAME_UTILS_API_HEAD_ONLY T query_string_to_any(const char *str) {
-            T                 ret;
-            std::stringstream ss;
-            ss << str;
-            ss >> ret;
-            return ret;
+            typedef typename std::remove_cv<T>::type value_type;
+            return detail::query_string_to_any<value_type>(str,
+                                                           std::integral_constant<int, detail::query_string_number_kind<value_type>::value>());
         }
 
         /**
          * @brief 任意类型转换为字符串
          * @param [in] val     任意类型数据
          * @return 对应的字符串
+         * @note 整数和浮点数使用 util::string::int2str/double2str 转换，浮点数输出可以精确还原的表示(绝大多数情况下是最短的)
          */
         template <typename T>
         LIBATFRAME_UTILS_API_HEAD_ONLY std::string any_to_query_string(const T &val) {
-            std::stringstream ss;
-            ss << val;
-            return ss.str();
+            typedef typename std::remove_cv<T>::type value_type;
+            return detail::any_to_query_string(val, std::integral_constant<int, detail::query_string_number_kind<value_type>::value>());
         }
     } // namespace uri
 
@@ -533,6 +640,170 @@ namespace util {
          */
         LIBATFRAME_UTILS_API types::item_object::ptr_type create_object();
     };
+
+    /**
+     * @brief 只读的零拷贝Querystring解析器
+     * @note 解析结果直接引用输入数据，只有包含%转义的key和value才会解码到内部缓冲区，
+     *       所有节点和子节点分别存放在连续数组中，Object的子节点按key排序后二分查找。
+     *       内部缓冲区在多次解析之间复用，适合每个线程或每个请求复用一个实例。
+     * @note 输入数据必须在下一次decode/clear之前保持有效
+     * @note 结构规则和tquerystring相同: 最后一级为[]时解析为数组，其他的[key]解析为Object
+     */
+    class tquerystring_view {
+    public:
+        /**
+         * @brief 字符串引用
+         */
+        struct string_ref {
+            const char *data;
+            std::size_t size;
+
+            inline bool        empty() const { return 0 == size; }
+            inline std::string str() const { return std::string(data, size); }
+        };
+
+        /**
+         * @brief 数据节点，type为ITEM_TYPE_STRING、ITEM_TYPE_ARRAY或ITEM_TYPE_OBJECT
+         */
+        struct node_t {
+            types::ITEM_TYPE type;
+            string_ref       value;          // 字符串类型的值
+            uint32_t         children_begin; // 子节点在entries中的起始下标
+            uint32_t         children_size;  // 子节点数量
+        };
+
+        /**
+         * @brief 子节点，数组类型的key为空
+         */
+        struct entry_t {
+            string_ref key;
+            uint32_t   node;
+        };
+
+    public:
+        LIBATFRAME_UTILS_API tquerystring_view();
+
+        LIBATFRAME_UTILS_API tquerystring_view(const std::string &spliter);
+
+        /**
+         * @breif 解码数据，会清空之前的结果
+         * @param [in] content 数据指针，必须在下一次decode/clear之前保持有效
+         * @param [in] sz      数据长度
+         * @return 所有记录都解析成功返回true
+         */
+        LIBATFRAME_UTILS_API bool decode(const char *content, std::size_t sz = 0);
+
+        /**
+         * @breif 清空数据，保留内部缓冲区
+         */
+        LIBATFRAME_UTILS_API void clear();
+
+        /**
+         * @breif 设置数据分隔符
+         * @param [in] spliter 分割符，每个字符都是单独的分隔符
+         */
+        LIBATFRAME_UTILS_API void set_spliter(const std::string &spliter);
+
+        LIBATFRAME_UTILS_API bool empty() const;
+
+        /**
+         * @brief 根节点的数据数量
+         */
+        LIBATFRAME_UTILS_API std::size_t size() const;
+
+        /**
+         * @brief 根节点(Object类型)
+         */
+        LIBATFRAME_UTILS_API const node_t *root() const;
+
+        /**
+         * @breif 依据Key获取根节点下的数据
+         * @param [in] key Key
+         * @return 不存在返回NULL
+         */
+        LIBATFRAME_UTILS_API const node_t *get(const std::string &key) const;
+
+        /**
+         * @breif 依据Key获取Object节点下的数据
+         * @param [in] parent Object节点
+         * @param [in] key Key
+         * @param [in] key_sz Key长度
+         * @return 不存在或parent不是Object返回NULL
+         */
+        LIBATFRAME_UTILS_API const node_t *get(const node_t *parent, const char *key, std::size_t key_sz) const;
+
+        /**
+         * @breif 依据下标获取数组或Object节点下的数据
+         * @param [in] parent 数组或Object节点
+         * @param [in] index 下标，Object按key排序
+         * @return 不存在返回NULL
+         */
+        LIBATFRAME_UTILS_API const node_t *at(const node_t *parent, std::size_t index) const;
+
+        /**
+         * @breif 获取数组或Object节点下的子节点
+         * @param [in] parent 数组或Object节点
+         * @param [in] index 下标，Object按key排序
+         * @return 不存在返回NULL
+         */
+        LIBATFRAME_UTILS_API const entry_t *child(const node_t *parent, std::size_t index) const;
+
+        /**
+         * @breif 依据Key获取根节点下的数据的字符串值
+         * @param [in] key Key
+         * @return 数据内容的字符串表示，和item_object::get_string相同
+         */
+        LIBATFRAME_UTILS_API std::string get_string(const std::string &key) const;
+
+        /**
+         * @breif 依据Key获取根节点下的字符串数据，不复制
+         * @param [in] key Key
+         * @param [out] out 字符串值
+         * @return 存在并且是字符串类型返回true
+         */
+        LIBATFRAME_UTILS_API bool get_string(const std::string &key, string_ref &out) const;
+
+        /**
+         * @breif 节点的字符串表示，和item_impl::to_string相同
+         */
+        LIBATFRAME_UTILS_API std::string to_string(const node_t *node) const;
+
+    private:
+        struct record_t {
+            uint32_t   segment_begin;
+            uint32_t   segment_size;
+            string_ref value;
+        };
+
+        struct build_node_t {
+            uint32_t first_child;
+            uint32_t last_child;
+            uint32_t next_sibling;
+            uint32_t key_segment;
+            uint32_t parent;
+        };
+
+        string_ref decode_component(const char *content, std::size_t sz);
+        void       decode_record(const char *content, std::size_t sz);
+        uint32_t   find_or_create(uint32_t parent, uint32_t segment, types::ITEM_TYPE type);
+        uint32_t   append_child(uint32_t parent, uint32_t segment, types::ITEM_TYPE type);
+        bool       build_record(const record_t &record);
+        void       finish();
+        void       append_to_string(std::string &out, const node_t &node) const;
+
+    private:
+        bool spliter_map_[256];
+
+        std::vector<node_t>  nodes_;
+        std::vector<entry_t> entries_;
+
+        // 解析过程中的临时数据，多次解析之间复用
+        std::vector<char>         buffer_; // 解码后的数据，预留输入的长度，保证不会重新分配
+        std::vector<string_ref>   segments_;
+        std::vector<record_t>     records_;
+        std::vector<build_node_t> build_nodes_;
+        std::vector<uint32_t>     lookup_; // (父节点, key) => 子节点的开放寻址哈希表
+    };
 } // namespace util
 
 #endif
@@ -8,6 +8,7 @@
  * @date 2017.06.05
  *
  * @history
+ *   2026.10.17 增加UTF-8的批量校验、字符统计、转UTF-16/UTF-32和按字符边界截断，支持SSE/AVX2/NEON
  *
  */
 
@@ -153,6 +154,63 @@ namespace util {
                 return is;
             }
         };
+
+        /**
+         * @brief 检查UTF-8编码是否合法
+         * @param src 输入数据
+         * @param sz 输入数据长度
+         * @param error_pos 非法时输出第一个非法字符的起始位置，可以为NULL
+         * @return 合法返回true
+         * @note 不允许超长编码、代理区(U+D800-U+DFFF)、超过U+10FFFF的码点和不完整的字符
+         * @note 使用Keiser-Lemire查表算法，x86使用SSSE3/AVX2(运行时检测)，aarch64使用NEON，纯ASCII的块只检查边界
+         */
+        LIBATFRAME_UTILS_API bool utf8_validate(const char *src, size_t sz, size_t *error_pos = NULL);
+
+        /**
+         * @brief 统计UTF-8字符数(码点数)
+         * @param src 输入数据
+         * @param sz 输入数据长度
+         * @return 字符数
+         * @note 只统计不是后续字节(10xxxxxx)的字节数，不检查合法性，需要的话先调用 utf8_validate
+         */
+        LIBATFRAME_UTILS_API size_t utf8_count(const char *src, size_t sz);
+
+        /**
+         * @brief UTF-8转UTF-16(主机字节序，超过U+FFFF的码点输出代理对)
+         * @param dst 输出buffer，可以为NULL(此时dlen必须为0)
+         * @param dlen 输出buffer长度(uint16_t的个数)
+         * @param olen 缓冲区不足时输出需要的长度，有非法字符时输出已转换的长度，否则输出转换后的长度
+         * @param src UTF-8数据
+         * @param slen UTF-8数据长度
+         * @return 成功返回0，缓冲区不足返回-1，有非法字符返回-2
+         * @note 转换时会做和 utf8_validate 相同的检查，连续的ASCII字符使用SIMD直接扩展
+         */
+        LIBATFRAME_UTILS_API int utf8_to_utf16(uint16_t *dst, size_t dlen, size_t *olen, const char *src, size_t slen);
+
+        /**
+         * @brief UTF-8转UTF-32(主机字节序)
+         * @see utf8_to_utf16
+         */
+        LIBATFRAME_UTILS_API int utf8_to_utf32(uint32_t *dst, size_t dlen, size_t *olen, const char *src, size_t slen);
+
+        /**
+         * @brief 按字节数截断UTF-8字符串，不会截断半个字符
+         * @param src UTF-8数据
+         * @param sz UTF-8数据长度
+         * @param max_bytes 最大字节数
+         * @return 截断后的字节数
+         */
+        LIBATFRAME_UTILS_API size_t utf8_truncate(const char *src, size_t sz, size_t max_bytes);
+
+        /**
+         * @brief 按字符数截断UTF-8字符串
+         * @param src UTF-8数据
+         * @param sz UTF-8数据长度
+         * @param max_chars 最大字符数
+         * @return 截断后的字节数
+         * @note 字符数的统计方式和 utf8_count 相同
+         */
+        LIBATFRAME_UTILS_API size_t utf8_truncate_chars(const char *src, size_t sz, size_t max_chars);
     } // namespace string
 } // namespace util
 
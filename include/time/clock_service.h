@@ -0,0 +1,220 @@
+﻿/**
+ * @file clock_service.h
+ * @brief 多线程共享的缓存时钟，使用seqlock发布时间快照
+ * Licensed under the MIT licenses.
+ *
+ * @version 1.0
+ * @author owent
+ * @date 2026.10.18
+ *
+ * @history
+ *
+ */
+
+#ifndef UTIL_TIME_CLOCK_SERVICE_H
+#define UTIL_TIME_CLOCK_SERVICE_H
+
+#pragma once
+
+#include <cstddef>
+#include <ctime>
+#include <stdint.h>
+
+#include "std/chrono.h"
+
+#include <config/atframe_utils_build_feature.h>
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+#include "design_pattern/noncopyable.h"
+#include "lock/atomic_int_type.h"
+#include "lock/spin_lock.h"
+
+namespace util {
+    namespace time {
+        /**
+         * @brief 当前时间所在的日、周、月、年的边界，只在跨天或时区、全局偏移变化时重新计算
+         * @note 所有的边界都是当前时区(time_utility::get_zone_offset())下的0点，区间是左闭右开的
+         */
+        struct clock_calendar_t {
+            time_t zone_offset; // 计算时使用的时区偏移
+            time_t day_start;   // 今天0点
+            time_t day_end;     // 明天0点
+            time_t week_start;  // 本周日0点
+            time_t month_start; // 本月1日0点
+            time_t month_end;   // 下个月1日0点
+            time_t year_start;  // 今年1月1日0点
+            time_t year_end;    // 明年1月1日0点
+            int    year;        // 年份，比如2020
+            int    month;       // 月份，1-12
+            int    month_day;   // 本月第几天，1-31
+            int    year_day;    // 本年第几天，0-365
+            int    week_day;    // 周几，周日为0
+        };
+
+        /**
+         * @brief 时间快照，每次更新时一起计算好
+         */
+        struct clock_snapshot_t {
+            std::chrono::system_clock::time_point system_time;  // 系统时间(包含全局偏移)
+            int64_t                               monotonic_ns; // 单调时钟(steady_clock)，纳秒
+            time_t                                unix_seconds; // Unix时间戳
+            time_t                                usec;         // 微秒部分，[0, 1000000)
+            struct tm                             local_tm;     // 当前时区的时间描述
+            struct tm                             gmt_tm;       // UTC的时间描述
+            clock_calendar_t                      calendar;     // 当前时区的日历边界
+        };
+
+        /**
+         * @brief 缓存的时钟服务
+         * @note 写入方(update或后台的ticker线程)计算好完整的快照后通过seqlock发布，读取方不加锁，
+         *       只在读的过程中遇到写入时重试，所以任何线程都可以读到一致的时间
+         * @note x86下支持不变的TSC时，用TSC在两次更新之间插值得到更精确的时间(precise_*)，
+         *       TSC的频率在每次更新时用单调时钟校准，未校准前直接读系统时钟
+         */
+        class clock_service {
+            UTIL_DESIGN_PATTERN_NOCOPYABLE(clock_service)
+
+        public:
+            typedef std::chrono::system_clock::time_point raw_time_t;
+
+        public:
+            LIBATFRAME_UTILS_API clock_service();
+            LIBATFRAME_UTILS_API ~clock_service();
+
+            /**
+             * @brief 全局的时钟服务，time_utility使用这个实例
+             */
+            static LIBATFRAME_UTILS_API clock_service &global();
+
+            /**
+             * @brief 更新时间快照
+             * @param t 可以指定时间对象(不包含全局偏移)，为NULL时读取系统时间
+             */
+            LIBATFRAME_UTILS_API void update(const raw_time_t *t = NULL);
+
+            /**
+             * @brief 修改时区后重新计算快照中的时间描述和日历，不读取系统时间
+             */
+            LIBATFRAME_UTILS_API void refresh();
+
+            /**
+             * @brief 读取完整的时间快照
+             */
+            LIBATFRAME_UTILS_API void load(clock_snapshot_t &out) const;
+
+            /**
+             * @brief 只读取日历边界
+             */
+            LIBATFRAME_UTILS_API void load_calendar(clock_calendar_t &out) const;
+
+            /**
+             * @brief 最后一次更新的系统时间(包含全局偏移)
+             */
+            LIBATFRAME_UTILS_API raw_time_t now() const;
+
+            /**
+             * @brief 最后一次更新的Unix时间戳
+             */
+            LIBATFRAME_UTILS_API time_t get_now() const;
+
+            /**
+             * @brief 最后一次更新的时间的微秒部分
+             */
+            LIBATFRAME_UTILS_API time_t get_now_usec() const;
+
+            /**
+             * @brief 最后一次更新的单调时钟，纳秒
+             */
+            LIBATFRAME_UTILS_API int64_t get_monotonic_ns() const;
+
+            /**
+             * @brief 最后一次更新时当前时区今天0点的时间戳
+             */
+            LIBATFRAME_UTILS_API time_t get_day_start() const;
+
+            /**
+             * @brief 用TSC插值得到的当前单调时钟，纳秒，不支持TSC或未校准时读取系统时钟
+             */
+            LIBATFRAME_UTILS_API int64_t precise_monotonic_ns() const;
+
+            /**
+             * @brief 用TSC插值得到的当前系统时间(包含全局偏移)，不支持TSC或未校准时读取系统时钟
+             */
+            LIBATFRAME_UTILS_API raw_time_t precise_now() const;
+
+            /**
+             * @brief 设置时间的全局偏移(Debug功能)，会立即更新快照
+             */
+            LIBATFRAME_UTILS_API void set_offset(const std::chrono::system_clock::duration &offset);
+
+            LIBATFRAME_UTILS_API std::chrono::system_clock::duration get_offset() const;
+
+            /**
+             * @brief 启动后台更新的线程
+             * @param interval 更新间隔
+             * @return 启动成功返回true，已经启动或不支持多线程返回false
+             */
+            LIBATFRAME_UTILS_API bool start_ticker(std::chrono::microseconds interval = std::chrono::microseconds(1000));
+
+            /**
+             * @brief 停止后台更新的线程
+             */
+            LIBATFRAME_UTILS_API void stop_ticker();
+
+            LIBATFRAME_UTILS_API bool is_ticker_running() const;
+
+            /**
+             * @brief 是否可以使用TSC插值(x86且CPU支持不变的TSC)
+             */
+            static LIBATFRAME_UTILS_API bool is_tsc_available();
+
+            /**
+             * @brief TSC的频率是否已经校准
+             */
+            LIBATFRAME_UTILS_API bool is_tsc_calibrated() const;
+
+        private:
+            struct data_t {
+                clock_snapshot_t snapshot;
+                uint64_t         tsc;       // 更新时的TSC
+                uint64_t         tsc_mult;  // 每个TSC周期的纳秒数 << 32，0表示未校准
+                uint64_t         tsc_limit; // 超过这么多周期时插值会溢出，改为读取系统时钟
+            };
+
+            inline uint32_t read_begin() const;
+            inline bool     read_retry(uint32_t seq) const;
+
+            void publish(const raw_time_t &system_time, int64_t monotonic_ns, uint64_t tsc);
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            void ticker_main(std::chrono::microseconds interval);
+#endif
+
+        private:
+            ::util::lock::atomic_int_type<uint32_t> seq_;
+            data_t                                  data_;
+
+            // 写入方之间互斥，并保存上一次用于校准TSC的采样
+            ::util::lock::spin_lock             write_lock_;
+            std::chrono::system_clock::duration offset_;
+            time_t                              last_tm_seconds_;
+            time_t                              last_tm_zone_offset_;
+            uint64_t                            calibrate_tsc_;
+            int64_t                             calibrate_monotonic_ns_;
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            std::mutex                              ticker_lock_;
+            std::condition_variable                 ticker_cond_;
+            std::thread                             ticker_thread_;
+            ::util::lock::atomic_int_type<uint32_t> ticker_running_;
+#endif
+        };
+    } // namespace time
+} // namespace util
+
+#endif
@@ -0,0 +1,230 @@
+﻿/**
+ * @file cron_schedule.h
+ * @brief 周期性日程(类cron规则)，按下一次触发时间调度，每次tick的开销只和触发的日程数量相关
+ * Licensed under the MIT licenses.
+ *
+ * @version 1.0
+ * @author owent
+ * @date 2026.10.18
+ *
+ * @history
+ *
+ */
+
+#ifndef UTIL_TIME_CRON_SCHEDULE_H
+#define UTIL_TIME_CRON_SCHEDULE_H
+
+#pragma once
+
+#include <cstddef>
+#include <ctime>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "std/functional.h"
+
+#include <config/atframe_utils_build_feature.h>
+
+#include "design_pattern/noncopyable.h"
+
+namespace util {
+    namespace time {
+        /**
+         * @brief cron规则
+         * @note 支持5段(分 时 日 月 周)或6段(秒 分 时 日 月 周)的表达式，每段支持任意值(星号或问号)、范围(a-b)、
+         *       步长(a/n或a-b/n，也可以在星号后面加/n)和逗号分隔的列表，月份和周可以用英文缩写(JAN-DEC, SUN-SAT)，周日可以是0或7。
+         *       也支持 @yearly @monthly @weekly @daily @hourly 。
+         *       日和周都有限制时满足任意一个即可，和Vixie cron一致。
+         * @note 所有的计算都基于时区偏移(默认是time_utility::get_zone_offset())，不依赖系统时区和libc
+         */
+        class cron_rule {
+        public:
+            struct error_type_t {
+                enum type {
+                    EN_CRET_SUCCESS       = 0,  // 成功
+                    EN_CRET_INVALID_PARAM = -1, // 参数错误
+                    EN_CRET_FIELD_COUNT   = -2, // 段数错误
+                    EN_CRET_INVALID_VALUE = -3, // 值或格式错误
+                };
+            };
+
+        public:
+            LIBATFRAME_UTILS_API cron_rule();
+
+            /**
+             * @brief 解析cron表达式，失败时规则会被清空
+             * @param expr 表达式
+             * @return 0或错误码
+             */
+            LIBATFRAME_UTILS_API int parse(const char *expr);
+
+            /**
+             * @brief 每天的指定时间点，比如凌晨5点刷新: daily(5 * time_utility::HOUR_SECONDS)
+             * @param offset 距离0点的秒数，[0, 86400)
+             */
+            LIBATFRAME_UTILS_API static cron_rule daily(time_t offset);
+
+            /**
+             * @brief 每周的指定时间点
+             * @param week_day 周几，周日为0
+             * @param offset 距离0点的秒数，[0, 86400)
+             */
+            LIBATFRAME_UTILS_API static cron_rule weekly(int week_day, time_t offset);
+
+            /**
+             * @brief 每月的指定时间点
+             * @param month_day 几号，1-31，没有这一天的月份不触发
+             * @param offset 距离0点的秒数，[0, 86400)
+             */
+            LIBATFRAME_UTILS_API static cron_rule monthly(int month_day, time_t offset);
+
+            /**
+             * @brief 是否是空规则，空规则永远不会触发
+             */
+            inline bool empty() const { return 0 == seconds_ || 0 == minutes_ || 0 == hours_ || 0 == month_days_ || 0 == months_ || 0 == week_days_; }
+
+            /**
+             * @brief 判定时间点是否满足规则
+             * @param t 时间戳
+             * @param zone_offset 时区偏移，和time_utility::get_zone_offset()含义一样
+             */
+            LIBATFRAME_UTILS_API bool match(time_t t, time_t zone_offset) const;
+            LIBATFRAME_UTILS_API bool match(time_t t) const;
+
+            /**
+             * @brief 计算下一次触发时间
+             * @param after 从这个时间之后(不包含)开始查找
+             * @param zone_offset 时区偏移，和time_utility::get_zone_offset()含义一样
+             * @return 下一次触发的时间戳，400年内(一个完整的公历周期)都不会触发时返回0
+             */
+            LIBATFRAME_UTILS_API time_t next(time_t after, time_t zone_offset) const;
+            LIBATFRAME_UTILS_API time_t next(time_t after) const;
+
+        private:
+            bool match_day(int64_t days, unsigned month_day) const;
+            bool find_in_day(time_t from, time_t &out) const;
+
+        private:
+            uint64_t seconds_;    // bit 0-59
+            uint64_t minutes_;    // bit 0-59
+            uint32_t hours_;      // bit 0-23
+            uint32_t month_days_; // bit 1-31
+            uint32_t months_;     // bit 1-12
+            uint32_t week_days_;  // bit 0-6，周日为0
+            bool     any_month_day_;
+            bool     any_week_day_;
+        };
+
+        /**
+         * @brief 周期性日程调度器
+         * @note 所有日程按下一次触发时间放在最小堆里，每次tick只处理到期的日程，开销是O(触发数量 * log(日程数量))。
+         *       调用tick时会检查时区偏移(time_utility::get_zone_offset())，变化后会从当前时间开始重新计算所有日程的下一次触发时间。
+         *       tick传入的时间一般是time_utility::get_now()，已经包含了全局时间偏移；时间往回调整时也会重新计算，
+         *       往前跳跃时错过的多次触发会合并为一次。
+         * @note 非线程安全
+         */
+        class cron_scheduler {
+            UTIL_DESIGN_PATTERN_NOCOPYABLE(cron_scheduler)
+
+        public:
+            /**
+             * @brief 日程回调
+             * @param fire_time 规则的触发时间点
+             * @param id 日程id
+             */
+            typedef std::function<void(time_t fire_time, uint64_t id)> callback_fn_t;
+
+        public:
+            LIBATFRAME_UTILS_API cron_scheduler();
+            LIBATFRAME_UTILS_API ~cron_scheduler();
+
+            /**
+             * @brief 添加日程
+             * @param rule 规则
+             * @param fn 回调
+             * @param now 从这个时间之后开始触发，填0使用time_utility::get_now()
+             * @return 日程id，失败(规则为空或者永远不会触发)返回0
+             */
+            LIBATFRAME_UTILS_API uint64_t add(const cron_rule &rule, const callback_fn_t &fn, time_t now = 0);
+
+            /**
+             * @brief 解析cron表达式并添加日程
+             * @return 日程id，失败返回0
+             */
+            LIBATFRAME_UTILS_API uint64_t add(const char *expr, const callback_fn_t &fn, time_t now = 0);
+
+            /**
+             * @brief 移除日程，可以在回调中调用
+             * @return 日程存在时返回true
+             */
+            LIBATFRAME_UTILS_API bool remove(uint64_t id);
+
+            /**
+             * @brief 移除所有日程
+             */
+            LIBATFRAME_UTILS_API void clear();
+
+            /**
+             * @brief 触发所有到期的日程
+             * @param now 当前时间，填0使用time_utility::get_now()
+             * @return 触发的日程数量
+             */
+            LIBATFRAME_UTILS_API size_t tick(time_t now = 0);
+
+            /**
+             * @brief 重新计算所有日程的下一次触发时间
+             * @param now 当前时间，填0使用time_utility::get_now()
+             */
+            LIBATFRAME_UTILS_API void reset(time_t now = 0);
+
+            /**
+             * @brief 获取日程的下一次触发时间
+             * @return 下一次触发时间，日程不存在时返回0
+             */
+            LIBATFRAME_UTILS_API time_t get_next_fire_time(uint64_t id) const;
+
+            /**
+             * @brief 获取最早的下一次触发时间，可以用来决定定时器或者事件循环的超时
+             * @return 下一次触发时间，没有日程时返回0
+             */
+            LIBATFRAME_UTILS_API time_t get_next_fire_time() const;
+
+            inline size_t size() const { return entries_.size(); }
+            inline bool   empty() const { return entries_.empty(); }
+
+        private:
+            struct entry_t {
+                cron_rule     rule;
+                callback_fn_t fn;
+                time_t        next_fire_time;
+            };
+
+            struct heap_node_t {
+                time_t   next_fire_time;
+                uint64_t id;
+            };
+
+            struct heap_node_greater_t {
+                inline bool operator()(const heap_node_t &l, const heap_node_t &r) const {
+                    return l.next_fire_time != r.next_fire_time ? l.next_fire_time > r.next_fire_time : l.id > r.id;
+                }
+            };
+
+            void push_heap(time_t next_fire_time, uint64_t id);
+            void pop_stale();
+            void rebuild_heap();
+            void reset_all(time_t now);
+
+        private:
+            std::unordered_map<uint64_t, entry_t> entries_;
+            std::vector<heap_node_t>              heap_; // 被移除的日程在出堆时跳过，堆顶总是有效的
+            uint64_t                              id_alloc_;
+            time_t                                last_tick_;
+            time_t                                zone_offset_;
+        };
+    } // namespace time
+} // namespace util
+
+#endif // UTIL_TIME_CRON_SCHEDULE_H
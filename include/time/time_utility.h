@@ -83,7 +83,8 @@ namespace util {
              * @brief 获取当前时间的微秒部分
              * @note 为了减少系统调用，这里仅在update时更新缓存，并且使用偏移值进行计算，所以大部分情况下都会偏小一些。
              *       这里仅为能够容忍误差的时间相关的功能提供一个时间参考，如果需要使用精确时间，请使用系统调用
-             * @note update接口不加锁，所以一般情况下，返回值在[0, 1000000)之间，极端情况下（特别是多线程调用时）可能出现大于1000000
+             *       或 clock_service::global().precise_now()
+             * @note 时间通过 clock_service 的快照发布，多线程调用时也和get_now()一致，返回值在[0, 1000000)之间
              * @return 当前时间的微妙部分
              */
             static LIBATFRAME_UTILS_API time_t get_now_usec();
@@ -219,6 +220,24 @@ namespace util {
              */
             static LIBATFRAME_UTILS_API bool is_leap_year(int year);
 
+            /**
+             * @brief 公历日期转换为距离1970-01-01的天数，纯整数计算，不依赖系统时区和libc
+             * @param year 年份，比如2020
+             * @param month 月份，1-12
+             * @param day 日期，1-31
+             * @return 距离1970-01-01的天数，之前的日期返回负数
+             */
+            static LIBATFRAME_UTILS_API int64_t days_from_civil(int year, unsigned month, unsigned day);
+
+            /**
+             * @brief 距离1970-01-01的天数转换为公历日期，days_from_civil的逆运算
+             * @param days 距离1970-01-01的天数
+             * @param year 输出年份
+             * @param month 输出月份，1-12
+             * @param day 输出日期，1-31
+             */
+            static LIBATFRAME_UTILS_API void civil_from_days(int64_t days, int &year, unsigned &month, unsigned &day);
+
             /**
              * @brief 判定当前时区时间是否是同一个年
              * @return 同一月返回 true
@@ -296,20 +315,8 @@ namespace util {
             static LIBATFRAME_UTILS_API time_t get_month_start_time(time_t t = 0);
 
         private:
-            // 当前时间
-            static LIBATFRAME_UTILS_API raw_time_t now_;
-
-            // 当前时间(Unix时间戳)
-            static LIBATFRAME_UTILS_API time_t now_unix_;
-
-            // 当前时间(微妙，非精确)
-            static LIBATFRAME_UTILS_API time_t now_usec_;
-
             // 时区时间的人为偏移
             static LIBATFRAME_UTILS_API time_t custom_zone_offset_;
-
-            // 时间的全局偏移（Debug功能）
-            static LIBATFRAME_UTILS_API std::chrono::system_clock::duration global_now_offset_;
         };
     } // namespace time
 } // namespace util
@@ -79,6 +79,21 @@ if (ENABLE_NETWORK)
         message(STATUS "Curl support disabled")
     endif()
 
+    # zlib, used to compress request body on the fly
+    find_package(ZLIB)
+    if(ZLIB_FOUND)
+        message(STATUS "Zlib support enabled")
+        set(NETWORK_ENABLE_ZLIB 1)
+        include_directories(${ZLIB_INCLUDE_DIRS})
+        if (TARGET ZLIB::ZLIB)
+            list(APPEND ATFRAME_UTILS_NETWORK_LINK_NAME ZLIB::ZLIB)
+        else()
+            list(APPEND ATFRAME_UTILS_NETWORK_LINK_NAME ${ZLIB_LIBRARIES})
+        endif()
+    else()
+        message(STATUS "Zlib support disabled")
+    endif()
+
     if(Libuv_FOUND)
         if (TARGET unofficial::libuv::libuv)
             list(APPEND ATFRAME_UTILS_NETWORK_LINK_NAME unofficial::libuv::libuv)
@@ -14,16 +14,6 @@
 namespace util {
     namespace cli {
 
-        namespace detail {
-            static char tolower(char c) {
-                if (c >= 'A' && c <= 'Z') {
-                    return c - 'A' + 'a';
-                }
-
-                return c;
-            }
-        }
-
         LIBATFRAME_UTILS_API cmd_option_value::cmd_option_value(const char *str_data) : data_(str_data) {}
         LIBATFRAME_UTILS_API cmd_option_value::cmd_option_value(const char *begin, const char *end) { data_.assign(begin, end); }
         LIBATFRAME_UTILS_API cmd_option_value::cmd_option_value(const std::string& str_data) { data_ = str_data; }
@@ -76,13 +66,13 @@ namespace util {
         LIBATFRAME_UTILS_API uint64_t cmd_option_value::to_uint64() const { return to<uint64_t>(); }
 
         LIBATFRAME_UTILS_API bool cmd_option_value::to_logic_bool() const {
-            std::string lowercase_content = data_;
-            std::transform(lowercase_content.begin(), lowercase_content.end(), lowercase_content.begin(), detail::tolower);
-
-            if (lowercase_content.empty()) {
+            if (data_.empty()) {
                 return false;
             }
 
+            std::string lowercase_content = data_;
+            util::string::tolower(&lowercase_content[0], data_.data(), data_.size());
+
             if ("no" == lowercase_content || "false" == lowercase_content || "disabled" == lowercase_content ||
                 "disable" == lowercase_content || "0" == lowercase_content) {
                 return false;
@@ -6,11 +6,21 @@
 
 #include "common/compiler_message.h"
 #include "common/file_system.h"
+#include <cerrno>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <memory>
 #include <sstream>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
 
 
 #ifdef UTIL_FS_WINDOWS_API
@@ -37,9 +47,16 @@
 #include <dirent.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
 
+#if defined(__linux__)
+#include <sys/sendfile.h>
+#include <sys/syscall.h>
+#endif
+
 #define FUNC_ACCESS(x) access(x, F_OK)
 #define SAFE_STRTOK_S(...) strtok_r(__VA_ARGS__)
 #define FUNC_MKDIR(path, mode) ::mkdir(path, mode)
@@ -304,225 +321,938 @@ namespace util {
 #endif
     }
 
-    LIBATFRAME_UTILS_API int file_system::scan_dir(const char *dir_path, std::list<std::string> &out, int options) {
-        int         ret      = 0;
-        std::string base_dir = dir_path ? dir_path : "";
+    namespace detail {
+#if defined(__linux__)
+        // struct linux_dirent64, glibc只在2.30以后才提供getdents64
+        struct file_system_dirent64_t {
+            uint64_t       d_ino;
+            int64_t        d_off;
+            unsigned short d_reclen;
+            unsigned char  d_type;
+            char           d_name[1];
+        };
+#endif
 
-        // 转为绝对路径
-        if ((options & dir_opt_t::EN_DOT_ABSP) && false == is_abs_path(base_dir.c_str())) {
-            if (base_dir.empty()) {
-                base_dir = get_cwd();
-            } else {
-                base_dir = get_abs_path(base_dir.c_str());
+#ifndef UTIL_FS_WINDOWS_API
+        static int file_system_dir_entry_type(int dir_fd, const char *name, unsigned char d_type) {
+            switch (d_type) {
+            case DT_DIR:
+                return file_system::dir_opt_t::EN_DOT_TDIR;
+            case DT_REG:
+                return file_system::dir_opt_t::EN_DOT_TREG;
+            case DT_LNK:
+                return file_system::dir_opt_t::EN_DOT_TLNK;
+            case DT_SOCK:
+                return file_system::dir_opt_t::EN_DOT_TSOCK;
+            case DT_UNKNOWN:
+                break;
+            default:
+                return file_system::dir_opt_t::EN_DOT_TOTH;
             }
-        }
 
-#ifdef UTIL_FS_WINDOWS_API
+            // @see http://man7.org/linux/man-pages/man3/readdir.3.html
+            // some file system do not support d_type
+            struct stat child_stat;
+            memset(&child_stat, 0, sizeof(struct stat));
+            if (0 != fstatat(dir_fd, name, &child_stat, AT_SYMLINK_NOFOLLOW)) {
+                return 0;
+            }
 
-        if (!base_dir.empty()) {
-            base_dir += DIRECTORY_SEPARATOR;
+            if (S_ISDIR(child_stat.st_mode)) {
+                return file_system::dir_opt_t::EN_DOT_TDIR;
+            } else if (S_ISREG(child_stat.st_mode)) {
+                return file_system::dir_opt_t::EN_DOT_TREG;
+            } else if (S_ISLNK(child_stat.st_mode)) {
+                return file_system::dir_opt_t::EN_DOT_TLNK;
+            } else if (S_ISSOCK(child_stat.st_mode)) {
+                return file_system::dir_opt_t::EN_DOT_TSOCK;
+            }
+            return file_system::dir_opt_t::EN_DOT_TOTH;
         }
+#endif
 
-        _finddata_t child_node;
-        intptr_t    cache = _findfirst((base_dir + "*").c_str(), &child_node);
+        struct file_system_walk_context_t {
+            const file_system::dir_callback_t *fn;
+            const file_system::dir_filter_t *  filter;
+            bool                               parallel;
 
-        if (-1 == cache) {
-            return errno;
-        }
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            std::mutex                                  lock;
+            std::condition_variable                     cond;
+            std::vector<std::pair<std::string, int> > pending_dirs;
+            size_t                                      running;
+#endif
+        };
 
-        do {
+        static int file_system_walk_one(file_system_walk_context_t &ctx, const std::string &base_dir, int options) {
+            file_system::dir_iterator iter;
+            int                       ret = iter.open(base_dir.empty() ? "." : base_dir.c_str());
+            if (0 != ret) {
+                return ret;
+            }
 
+            // 所有的子项共享一个路径缓冲区
             std::string child_path;
-            child_path.reserve(MAX_PATH_LEN);
+            child_path.reserve(base_dir.size() + 64);
             child_path = base_dir;
-            child_path += child_node.name;
+            if (!child_path.empty() && '/' != *child_path.rbegin() && '\\' != *child_path.rbegin()) {
+                child_path += file_system::DIRECTORY_SEPARATOR;
+            }
+            size_t prefix_len = child_path.size();
 
-            int  accept  = 0;
-            bool is_link = false;
+            file_system::dir_entry_t entry;
+            while (iter.next(entry)) {
+                // 类型不符合则跳过
+                if (0 == (options & entry.type)) {
+                    continue;
+                }
 
-            // Windows 版本暂不支持软链接
-            if (_A_SUBDIR & child_node.attrib) {
-                accept = options & dir_opt_t::EN_DOT_TDIR;
-            } else if ((_A_NORMAL | _A_RDONLY | _A_HIDDEN | _A_SYSTEM | _A_ARCH) & child_node.attrib) {
-                accept = options & dir_opt_t::EN_DOT_TREG;
-            } else {
-                accept = options & dir_opt_t::EN_DOT_TOTH;
-            }
+                // 是否排除 . 和 ..
+                bool is_self = 0 == strcmp(".", entry.name) || 0 == strcmp("..", entry.name);
+                if (is_self && !(options & file_system::dir_opt_t::EN_DOT_SELF)) {
+                    continue;
+                }
 
-#ifdef _MSC_VER
-            USES_CONVERSION;
+                if (NULL != ctx.filter && *ctx.filter && !(*ctx.filter)(base_dir, entry)) {
+                    continue;
+                }
+
+                child_path.resize(prefix_len);
+                child_path.append(entry.name, entry.name_len);
+
+                if (!is_self) {
+                    // 递归扫描（软链接不扫描，防止死循环）
+                    if (file_system::dir_opt_t::EN_DOT_TDIR == entry.type && (options & file_system::dir_opt_t::EN_DOT_RECU)) {
+                        int child_options = options & (~file_system::dir_opt_t::EN_DOT_SELF);
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+                        if (ctx.parallel) {
+                            std::lock_guard<std::mutex> guard(ctx.lock);
+                            ctx.pending_dirs.push_back(std::make_pair(child_path, child_options));
+                            ctx.cond.notify_one();
+                            continue;
+                        }
 #endif
+                        file_system_walk_one(ctx, child_path, child_options);
+                        continue;
+                    }
 
-            DWORD flag = GetFileAttributes(VC_TEXT(child_path.c_str()));
-            if (FILE_ATTRIBUTE_REPARSE_POINT & flag) {
-                accept  = options & dir_opt_t::EN_DOT_TLNK;
-                is_link = true;
-            }
+                    // 解析软链接
+                    if (file_system::dir_opt_t::EN_DOT_TLNK == entry.type && (options & file_system::dir_opt_t::EN_DOT_RLNK)) {
+                        (*ctx.fn)(file_system::get_abs_path(child_path.c_str()), entry.type);
+                        continue;
+                    }
+                }
 
-            // 类型不符合则跳过
-            if (0 == accept) {
-                continue;
+                (*ctx.fn)(child_path, entry.type);
             }
 
-            // 是否排除 . 和 ..
-            if (0 == strcmp(".", child_node.name) || 0 == strcmp("..", child_node.name)) {
-                if (!(options & dir_opt_t::EN_DOT_SELF)) {
-                    continue;
-                }
-            } else {
+            return iter.get_error();
+        }
 
-                // 递归扫描（软链接不扫描，防止死循环）
-                if (!is_link && (_A_SUBDIR & child_node.attrib) && (options & dir_opt_t::EN_DOT_RECU)) {
-                    scan_dir(child_path.c_str(), out, options & (~dir_opt_t::EN_DOT_SELF));
-                    continue;
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+        static void file_system_walk_worker(file_system_walk_context_t *ctx) {
+            while (true) {
+                std::pair<std::string, int> dir;
+                {
+                    std::unique_lock<std::mutex> guard(ctx->lock);
+                    while (ctx->pending_dirs.empty() && ctx->running > 0) {
+                        ctx->cond.wait(guard);
+                    }
+
+                    // 没有正在扫描的目录，也就不会再有新的子目录了
+                    if (ctx->pending_dirs.empty()) {
+                        return;
+                    }
+
+                    dir.first.swap(ctx->pending_dirs.back().first);
+                    dir.second = ctx->pending_dirs.back().second;
+                    ctx->pending_dirs.pop_back();
+                    ++ctx->running;
                 }
 
-                // 解析软链接
-                if ((FILE_ATTRIBUTE_REPARSE_POINT & flag) && (options & dir_opt_t::EN_DOT_RLNK)) {
-                    child_path = get_abs_path(child_path.c_str());
+                file_system_walk_one(*ctx, dir.first, dir.second);
+
+                {
+                    std::lock_guard<std::mutex> guard(ctx->lock);
+                    --ctx->running;
+                    if (0 == ctx->running && ctx->pending_dirs.empty()) {
+                        ctx->cond.notify_all();
+                    }
                 }
             }
+        }
+#endif
+    } // namespace detail
 
-            // 普通追加目录
-            out.push_back(child_path);
-        } while ((ret = _findnext(cache, &child_node)) == 0);
+    LIBATFRAME_UTILS_API file_system::dir_iterator::dir_iterator()
+        :
+#if defined(UTIL_FS_WINDOWS_API)
+          handle_(INVALID_HANDLE_VALUE),
+          find_data_(NULL),
+          has_pending_(false),
+#elif defined(__linux__)
+          fd_(-1),
+          buffer_offset_(0),
+          buffer_length_(0),
+#else
+          dir_(NULL),
+#endif
+          error_(0) {
+    }
 
-        _findclose(cache);
+    LIBATFRAME_UTILS_API file_system::dir_iterator::~dir_iterator() { close(); }
 
-        if (ENOENT == errno) {
-            return 0;
+    LIBATFRAME_UTILS_API int file_system::dir_iterator::open(const char *dir_path) {
+        close();
+        error_ = 0;
+        if (NULL == dir_path) {
+            return error_ = EINVAL;
         }
+
+#if defined(UTIL_FS_WINDOWS_API)
+        std::string pattern = dir_path;
+        if (!pattern.empty() && '/' != *pattern.rbegin() && '\\' != *pattern.rbegin()) {
+            pattern += DIRECTORY_SEPARATOR;
+        }
+        pattern += '*';
+
+        WIN32_FIND_DATAA *find_data = new WIN32_FIND_DATAA();
+        handle_                     = FindFirstFileA(pattern.c_str(), find_data);
+        if (INVALID_HANDLE_VALUE == handle_) {
+            delete find_data;
+            return error_ = static_cast<int>(GetLastError());
+        }
+
+        find_data_   = find_data;
+        has_pending_ = true;
+#elif defined(__linux__)
+        int open_flags = O_RDONLY | O_DIRECTORY;
+#ifdef O_CLOEXEC
+        open_flags |= O_CLOEXEC;
+#endif
+        fd_ = ::open(dir_path, open_flags);
+        if (fd_ < 0) {
+            return error_ = errno;
+        }
+
+        buffer_.resize(32768);
+        buffer_offset_ = 0;
+        buffer_length_ = 0;
 #else
-        DIR *dir = NULL;
-        if (base_dir.empty()) {
-            dir = opendir(".");
-        } else {
-            dir = opendir(base_dir.c_str());
+        dir_ = opendir(dir_path);
+        if (NULL == dir_) {
+            return error_ = errno;
         }
-        if (NULL == dir) {
-            return errno;
+#endif
+
+        return 0;
+    }
+
+    LIBATFRAME_UTILS_API bool file_system::dir_iterator::next(dir_entry_t &out) {
+#if defined(UTIL_FS_WINDOWS_API)
+        if (INVALID_HANDLE_VALUE == handle_) {
+            return false;
         }
 
-        do {
-            struct dirent *child_node = readdir(dir);
-            if (NULL == child_node) {
-                break;
+        WIN32_FIND_DATAA *find_data = reinterpret_cast<WIN32_FIND_DATAA *>(find_data_);
+        if (!has_pending_) {
+            if (!FindNextFileA(handle_, find_data)) {
+                DWORD res = GetLastError();
+                if (ERROR_NO_MORE_FILES != res) {
+                    error_ = static_cast<int>(res);
+                }
+                return false;
             }
+        }
+        has_pending_ = false;
+
+        out.name     = find_data->cFileName;
+        out.name_len = strlen(find_data->cFileName);
+        if (FILE_ATTRIBUTE_REPARSE_POINT & find_data->dwFileAttributes) {
+            out.type = dir_opt_t::EN_DOT_TLNK;
+        } else if (FILE_ATTRIBUTE_DIRECTORY & find_data->dwFileAttributes) {
+            out.type = dir_opt_t::EN_DOT_TDIR;
+        } else if (FILE_ATTRIBUTE_DEVICE & find_data->dwFileAttributes) {
+            out.type = dir_opt_t::EN_DOT_TOTH;
+        } else {
+            out.type = dir_opt_t::EN_DOT_TREG;
+        }
+        return true;
+#elif defined(__linux__)
+        if (fd_ < 0) {
+            return false;
+        }
 
-            int accept = 0;
-            switch (child_node->d_type) {
-            case DT_DIR: {
-                accept = options & dir_opt_t::EN_DOT_TDIR;
-                break;
+        if (buffer_offset_ >= buffer_length_) {
+            long res = syscall(SYS_getdents64, fd_, &buffer_[0], buffer_.size());
+            if (res < 0) {
+                error_ = errno;
+                return false;
             }
-
-            case DT_REG: {
-                accept = options & dir_opt_t::EN_DOT_TREG;
-                break;
+            if (0 == res) {
+                return false;
             }
 
-            case DT_LNK: {
-                accept = options & dir_opt_t::EN_DOT_TLNK;
-                break;
+            buffer_offset_ = 0;
+            buffer_length_ = static_cast<size_t>(res);
+        }
+
+        const detail::file_system_dirent64_t *child_node = reinterpret_cast<const detail::file_system_dirent64_t *>(&buffer_[buffer_offset_]);
+        buffer_offset_ += child_node->d_reclen;
+
+        out.name     = child_node->d_name;
+        out.name_len = strlen(child_node->d_name);
+        out.type     = detail::file_system_dir_entry_type(fd_, child_node->d_name, child_node->d_type);
+        return true;
+#else
+        if (NULL == dir_) {
+            return false;
+        }
+
+        errno                     = 0;
+        struct dirent *child_node = readdir(reinterpret_cast<DIR *>(dir_));
+        if (NULL == child_node) {
+            error_ = errno;
+            return false;
+        }
+
+        out.name     = child_node->d_name;
+        out.name_len = strlen(child_node->d_name);
+        out.type     = detail::file_system_dir_entry_type(dirfd(reinterpret_cast<DIR *>(dir_)), child_node->d_name, child_node->d_type);
+        return true;
+#endif
+    }
+
+    LIBATFRAME_UTILS_API void file_system::dir_iterator::close() {
+#if defined(UTIL_FS_WINDOWS_API)
+        if (INVALID_HANDLE_VALUE != handle_) {
+            FindClose(handle_);
+            handle_ = INVALID_HANDLE_VALUE;
+        }
+
+        if (NULL != find_data_) {
+            delete reinterpret_cast<WIN32_FIND_DATAA *>(find_data_);
+            find_data_ = NULL;
+        }
+        has_pending_ = false;
+#elif defined(__linux__)
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+        buffer_offset_ = 0;
+        buffer_length_ = 0;
+#else
+        if (NULL != dir_) {
+            closedir(reinterpret_cast<DIR *>(dir_));
+            dir_ = NULL;
+        }
+#endif
+    }
+
+    LIBATFRAME_UTILS_API int file_system::scan_dir(const char *dir_path, std::list<std::string> &out, int options) {
+        return walk_dir(dir_path, [&out](const std::string &path, int) { out.push_back(path); }, options, 1);
+    }
+
+    LIBATFRAME_UTILS_API int file_system::walk_dir(const char *dir_path, const dir_callback_t &fn, int options, size_t thread_count,
+                                                   const dir_filter_t &filter) {
+        if (!fn) {
+            return EINVAL;
+        }
+
+        std::string base_dir = dir_path ? dir_path : "";
+
+        // 转为绝对路径
+        if ((options & dir_opt_t::EN_DOT_ABSP) && false == is_abs_path(base_dir.c_str())) {
+            if (base_dir.empty()) {
+                base_dir = get_cwd();
+            } else {
+                base_dir = get_abs_path(base_dir.c_str());
             }
+        }
 
-            case DT_SOCK: {
-                accept = options & dir_opt_t::EN_DOT_TSOCK;
-                break;
+        detail::file_system_walk_context_t ctx;
+        ctx.fn       = &fn;
+        ctx.filter   = &filter;
+        ctx.parallel = false;
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+        if (0 == thread_count) {
+            thread_count = std::thread::hardware_concurrency();
+        }
+
+        if (thread_count <= 1 || !(options & dir_opt_t::EN_DOT_RECU)) {
+            return detail::file_system_walk_one(ctx, base_dir, options);
+        }
+
+        // 当前线程扫描根目录，子目录放进队列里由所有线程一起扫描
+        ctx.parallel = true;
+        ctx.running  = 1;
+
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count - 1);
+        for (size_t i = 1; i < thread_count; ++i) {
+            threads.push_back(std::thread(detail::file_system_walk_worker, &ctx));
+        }
+
+        int ret = detail::file_system_walk_one(ctx, base_dir, options);
+        {
+            std::lock_guard<std::mutex> guard(ctx.lock);
+            --ctx.running;
+            if (ctx.pending_dirs.empty()) {
+                ctx.cond.notify_all();
             }
+        }
 
-            default: {
-                accept = options & dir_opt_t::EN_DOT_TOTH;
-                break;
+        detail::file_system_walk_worker(&ctx);
+        for (size_t i = 0; i < threads.size(); ++i) {
+            threads[i].join();
+        }
+
+        return ret;
+#else
+        COMPILER_UNUSED(thread_count);
+        return detail::file_system_walk_one(ctx, base_dir, options);
+#endif
+    }
+
+
+    LIBATFRAME_UTILS_API bool file_system::is_abs_path(const char *dir_path) {
+        if (NULL == dir_path) {
+            return false;
+        }
+
+        // NFS may has a path of "\\DOMAIN\PATH"
+        if (dir_path[0] == '/' || dir_path[0] == '\\') {
+            return true;
+        }
+
+#ifdef _WIN32
+        if (((dir_path[0] >= 'a' && dir_path[0] <= 'z') || (dir_path[0] >= 'A' && dir_path[0] <= 'Z')) && dir_path[1] == ':') {
+            return true;
+        }
+#endif
+
+        return false;
+    }
+
+    namespace detail {
+#ifdef UTIL_FS_WINDOWS_API
+        // MapViewOfFile的偏移需要按分配粒度对齐
+        static size_t file_system_map_granularity() {
+            SYSTEM_INFO si;
+            GetSystemInfo(&si);
+            return static_cast<size_t>(si.dwAllocationGranularity);
+        }
+#else
+        static size_t file_system_map_granularity() {
+            long ret = sysconf(_SC_PAGESIZE);
+            return ret > 0 ? static_cast<size_t>(ret) : 4096;
+        }
+
+        static void file_system_madvise(void *addr, size_t len, int options) {
+            if (options & file_system::mmap_opt_t::EN_MOT_SEQUENTIAL) {
+                madvise(addr, len, MADV_SEQUENTIAL);
+            } else if (options & file_system::mmap_opt_t::EN_MOT_RANDOM) {
+                madvise(addr, len, MADV_RANDOM);
+            } else {
+                madvise(addr, len, MADV_NORMAL);
             }
+
+            if (options & file_system::mmap_opt_t::EN_MOT_WILLNEED) {
+                madvise(addr, len, MADV_WILLNEED);
             }
 
-            // 类型不符合则跳过
-            if (DT_UNKNOWN != child_node->d_type && 0 == accept) {
-                continue;
+#if defined(MADV_HUGEPAGE)
+            if (options & file_system::mmap_opt_t::EN_MOT_HUGEPAGE) {
+                madvise(addr, len, MADV_HUGEPAGE);
             }
+#endif
+        }
 
-            std::string child_path;
-            child_path.reserve(MAX_PATH_LEN);
-            if (!base_dir.empty()) {
-                child_path += base_dir + DIRECTORY_SEPARATOR;
+        static void *file_system_mmap(int fd, size_t offset, size_t length, int options) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+            // 透明大页要求虚拟地址和文件偏移都按2MB对齐，先预留一段地址空间，再把文件映射到对齐的位置上
+            const size_t huge_page_size = 2 * 1024 * 1024;
+            if ((options & file_system::mmap_opt_t::EN_MOT_HUGEPAGE) && length >= huge_page_size && 0 == offset % huge_page_size) {
+                size_t page_size     = file_system_map_granularity();
+                size_t reserved_size = (length + huge_page_size + page_size - 1) / page_size * page_size;
+                void * reserved      = mmap(NULL, reserved_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (MAP_FAILED != reserved) {
+                    uintptr_t reserved_begin = reinterpret_cast<uintptr_t>(reserved);
+                    uintptr_t aligned_begin  = (reserved_begin + huge_page_size - 1) & ~static_cast<uintptr_t>(huge_page_size - 1);
+                    void *    ret            = mmap(reinterpret_cast<void *>(aligned_begin), length, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd,
+                                    static_cast<off_t>(offset));
+                    if (MAP_FAILED == ret) {
+                        munmap(reserved, reserved_size);
+                    } else {
+                        // 释放前后多余的部分
+                        uintptr_t tail_begin = aligned_begin + (length + page_size - 1) / page_size * page_size;
+                        uintptr_t tail_end   = reserved_begin + reserved_size;
+                        if (aligned_begin > reserved_begin) {
+                            munmap(reserved, aligned_begin - reserved_begin);
+                        }
+                        if (tail_end > tail_begin) {
+                            munmap(reinterpret_cast<void *>(tail_begin), tail_end - tail_begin);
+                        }
+                        return ret;
+                    }
+                }
             }
-            child_path += child_node->d_name;
+#else
+            COMPILER_UNUSED(options);
+#endif
+            return mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(offset));
+        }
 
-            // @see http://man7.org/linux/man-pages/man3/readdir.3.html
-            // some file system do not support d_type
-            if (DT_UNKNOWN == child_node->d_type && 0 == accept) {
-                struct stat child_stat;
-                memset(&child_stat, 0, sizeof(struct stat));
-                if (0 != lstat(child_path.c_str(), &child_stat)) {
-                    continue;
+        struct file_system_transfer_t {
+            enum type {
+                EN_FST_COPY_FILE_RANGE = 0x01,
+                EN_FST_SENDFILE        = 0x02,
+            };
+        };
+
+        /**
+         * @brief 在两个描述符之间复制数据，优先在内核中复制，不支持时回退到pread/write
+         * @note 从in_fd的offset开始读，写到out_fd的当前位置
+         */
+        static int file_system_transfer(int in_fd, int out_fd, size_t offset, size_t length, size_t &done, int methods) {
+            done = 0;
+
+#if defined(__linux__)
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+            if (methods & file_system_transfer_t::EN_FST_COPY_FILE_RANGE) {
+                while (done < length) {
+                    loff_t  off_in = static_cast<loff_t>(offset + done);
+                    ssize_t res    = copy_file_range(in_fd, &off_in, out_fd, NULL, length - done, 0);
+                    if (res > 0) {
+                        done += static_cast<size_t>(res);
+                        continue;
+                    }
+                    if (0 == res) {
+                        return 0;
+                    }
+                    if (EINTR == errno) {
+                        continue;
+                    }
+
+                    // 老的内核或跨文件系统时不支持
+                    if (0 == done && (ENOSYS == errno || EXDEV == errno || EINVAL == errno || EOPNOTSUPP == errno)) {
+                        break;
+                    }
+                    return errno;
                 }
 
-                if (S_ISDIR(child_stat.st_mode)) {
-                    accept = options & dir_opt_t::EN_DOT_TDIR;
-                } else if (S_ISREG(child_stat.st_mode)) {
-                    accept = options & dir_opt_t::EN_DOT_TREG;
-                } else if (S_ISLNK(child_stat.st_mode)) {
-                    accept = options & dir_opt_t::EN_DOT_TLNK;
-                } else if (S_ISSOCK(child_stat.st_mode)) {
-                    accept = options & dir_opt_t::EN_DOT_TSOCK;
-                } else {
-                    accept = options & dir_opt_t::EN_DOT_TOTH;
+                if (done > 0) {
+                    return 0;
                 }
             }
+#endif
+
+            if (methods & file_system_transfer_t::EN_FST_SENDFILE) {
+                while (done < length) {
+                    off_t   off_in = static_cast<off_t>(offset + done);
+                    ssize_t res    = sendfile(out_fd, in_fd, &off_in, length - done);
+                    if (res > 0) {
+                        done += static_cast<size_t>(res);
+                        continue;
+                    }
+                    if (0 == res) {
+                        return 0;
+                    }
+                    if (EINTR == errno) {
+                        continue;
+                    }
 
-            if (0 == accept) {
-                continue;
+                    if (0 == done && (ENOSYS == errno || EINVAL == errno)) {
+                        break;
+                    }
+                    return errno;
+                }
+
+                if (done > 0) {
+                    return 0;
+                }
             }
-            // 是否排除 . 和 ..
-            if (0 == strcmp(".", child_node->d_name) || 0 == strcmp("..", child_node->d_name)) {
-                if (!(options & dir_opt_t::EN_DOT_SELF)) {
-                    continue;
+#else
+            COMPILER_UNUSED(methods);
+#endif
+
+            std::vector<char> buffer(65536);
+            while (done < length) {
+                size_t want = length - done;
+                if (want > buffer.size()) {
+                    want = buffer.size();
                 }
-            } else {
-                // 递归扫描（软链接不扫描，防止死循环）
-                if (DT_DIR == child_node->d_type && (options & dir_opt_t::EN_DOT_RECU)) {
-                    scan_dir(child_path.c_str(), out, options & (~dir_opt_t::EN_DOT_SELF));
-                    continue;
+
+                ssize_t read_sz = pread(in_fd, &buffer[0], want, static_cast<off_t>(offset + done));
+                if (read_sz < 0) {
+                    if (EINTR == errno) {
+                        continue;
+                    }
+                    return errno;
+                }
+                if (0 == read_sz) {
+                    return 0;
                 }
 
-                // 解析软链接
-                if (DT_LNK == child_node->d_type && (options & dir_opt_t::EN_DOT_RLNK)) {
-                    child_path = get_abs_path(child_path.c_str());
+                size_t written = 0;
+                while (written < static_cast<size_t>(read_sz)) {
+                    ssize_t res = write(out_fd, &buffer[written], static_cast<size_t>(read_sz) - written);
+                    if (res < 0) {
+                        if (EINTR == errno) {
+                            continue;
+                        }
+                        done += written;
+                        return errno;
+                    }
+                    written += static_cast<size_t>(res);
                 }
+                done += written;
             }
 
-            // 普通追加目录
-            out.push_back(child_path);
-        } while (true);
+            return 0;
+        }
+#endif
+    } // namespace detail
 
-        closedir(dir);
+    LIBATFRAME_UTILS_API file_system::mapped_file::mapped_file()
+        : data_(NULL), size_(0), map_base_(NULL), map_size_(0)
+#ifdef UTIL_FS_WINDOWS_API
+          ,
+          map_handle_(NULL)
+#endif
+    {
+    }
 
+    LIBATFRAME_UTILS_API file_system::mapped_file::~mapped_file() { close(); }
+
+#if defined(UTIL_CONFIG_COMPILER_CXX_RVALUE_REFERENCES) && UTIL_CONFIG_COMPILER_CXX_RVALUE_REFERENCES
+    LIBATFRAME_UTILS_API file_system::mapped_file::mapped_file(mapped_file &&other)
+        : data_(NULL), size_(0), map_base_(NULL), map_size_(0)
+#ifdef UTIL_FS_WINDOWS_API
+          ,
+          map_handle_(NULL)
 #endif
+    {
+        swap(other);
+    }
 
-        return ret;
+    LIBATFRAME_UTILS_API file_system::mapped_file &file_system::mapped_file::operator=(mapped_file &&other) {
+        if (this != &other) {
+            close();
+            swap(other);
+        }
+        return *this;
     }
+#endif
 
+    LIBATFRAME_UTILS_API int file_system::mapped_file::open(const char *file_path, int options, size_t offset, size_t length) {
+        close();
+        if (NULL == file_path) {
+            return EINVAL;
+        }
 
-    LIBATFRAME_UTILS_API bool file_system::is_abs_path(const char *dir_path) {
-        if (NULL == dir_path) {
-            return false;
+#ifdef UTIL_FS_WINDOWS_API
+#ifdef _MSC_VER
+        USES_CONVERSION;
+#endif
+
+        DWORD flags = FILE_ATTRIBUTE_NORMAL;
+        if (options & mmap_opt_t::EN_MOT_SEQUENTIAL) {
+            flags = FILE_FLAG_SEQUENTIAL_SCAN;
+        } else if (options & mmap_opt_t::EN_MOT_RANDOM) {
+            flags = FILE_FLAG_RANDOM_ACCESS;
         }
 
-        // NFS may has a path of "\\DOMAIN\PATH"
-        if (dir_path[0] == '/' || dir_path[0] == '\\') {
-            return true;
+        HANDLE file = CreateFile(VC_TEXT(file_path), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, flags, NULL);
+        if (INVALID_HANDLE_VALUE == file) {
+            return static_cast<int>(GetLastError());
         }
 
-#ifdef _WIN32
-        if (((dir_path[0] >= 'a' && dir_path[0] <= 'z') || (dir_path[0] >= 'A' && dir_path[0] <= 'Z')) && dir_path[1] == ':') {
+        LARGE_INTEGER file_sz;
+        if (!GetFileSizeEx(file, &file_sz)) {
+            int res = static_cast<int>(GetLastError());
+            CloseHandle(file);
+            return res;
+        }
+        size_t total_size = static_cast<size_t>(file_sz.QuadPart);
+#else
+        int open_flags = O_RDONLY;
+#ifdef O_CLOEXEC
+        open_flags |= O_CLOEXEC;
+#endif
+        int fd = ::open(file_path, open_flags);
+        if (fd < 0) {
+            return errno;
+        }
+
+        struct stat st;
+        if (0 != fstat(fd, &st)) {
+            int res = errno;
+            ::close(fd);
+            return res;
+        }
+        size_t total_size = static_cast<size_t>(st.st_size);
+#endif
+
+        if (offset > total_size) {
+            offset = total_size;
+        }
+        if (0 == length || length > total_size - offset) {
+            length = total_size - offset;
+        }
+
+        // 空文件不能映射
+        if (0 == length) {
+#ifdef UTIL_FS_WINDOWS_API
+            CloseHandle(file);
+#else
+            ::close(fd);
+#endif
+            data_ = buffer_.c_str();
+            return 0;
+        }
+
+        size_t aligned_offset = offset - offset % detail::file_system_map_granularity();
+        size_t map_size       = length + (offset - aligned_offset);
+
+#ifdef UTIL_FS_WINDOWS_API
+        HANDLE mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        CloseHandle(file);
+        if (NULL == mapping) {
+            return static_cast<int>(GetLastError());
+        }
+
+        void *base = MapViewOfFile(mapping, FILE_MAP_READ, static_cast<DWORD>(static_cast<unsigned long long>(aligned_offset) >> 32),
+                                   static_cast<DWORD>(aligned_offset & 0xFFFFFFFF), map_size);
+        if (NULL == base) {
+            int res = static_cast<int>(GetLastError());
+            CloseHandle(mapping);
+            return res;
+        }
+        map_handle_ = mapping;
+#else
+        void *base = detail::file_system_mmap(fd, aligned_offset, map_size, options);
+        int   res  = errno;
+        ::close(fd);
+        if (MAP_FAILED == base) {
+            return res;
+        }
+#endif
+
+        map_base_ = base;
+        map_size_ = map_size;
+        data_     = reinterpret_cast<const char *>(base) + (offset - aligned_offset);
+        size_     = length;
+
+#ifndef UTIL_FS_WINDOWS_API
+        detail::file_system_madvise(map_base_, map_size_, options);
+#endif
+        return 0;
+    }
+
+    LIBATFRAME_UTILS_API void file_system::mapped_file::close() {
+        if (NULL != map_base_) {
+#ifdef UTIL_FS_WINDOWS_API
+            UnmapViewOfFile(map_base_);
+            CloseHandle(reinterpret_cast<HANDLE>(map_handle_));
+            map_handle_ = NULL;
+#else
+            munmap(map_base_, map_size_);
+#endif
+        }
+
+        data_     = NULL;
+        size_     = 0;
+        map_base_ = NULL;
+        map_size_ = 0;
+        buffer_.clear();
+    }
+
+    LIBATFRAME_UTILS_API void file_system::mapped_file::advise(EXPLICIT_UNUSED_ATTR int options, size_t offset, size_t length) {
+        if (NULL == map_base_ || offset >= size_) {
+            return;
+        }
+
+        if (0 == length || length > size_ - offset) {
+            length = size_ - offset;
+        }
+
+#ifndef UTIL_FS_WINDOWS_API
+        // madvise的地址需要按页对齐
+        const char *base  = reinterpret_cast<const char *>(map_base_);
+        size_t      begin = static_cast<size_t>(data_ - base) + offset;
+        size_t      end   = begin + length;
+        begin -= begin % detail::file_system_map_granularity();
+        detail::file_system_madvise(const_cast<char *>(base) + begin, end - begin, options);
+#endif
+    }
+
+    LIBATFRAME_UTILS_API void file_system::mapped_file::swap(mapped_file &other) {
+        // 没有映射时data_指向自己的buffer_，交换后需要重新指向
+        bool self_buffer  = NULL == map_base_ && NULL != data_;
+        bool other_buffer = NULL == other.map_base_ && NULL != other.data_;
+
+        using std::swap;
+        swap(data_, other.data_);
+        swap(size_, other.size_);
+        swap(map_base_, other.map_base_);
+        swap(map_size_, other.map_size_);
+        buffer_.swap(other.buffer_);
+#ifdef UTIL_FS_WINDOWS_API
+        swap(map_handle_, other.map_handle_);
+#endif
+
+        if (other_buffer) {
+            data_ = buffer_.c_str();
+        }
+        if (self_buffer) {
+            other.data_ = other.buffer_.c_str();
+        }
+    }
+
+    LIBATFRAME_UTILS_API bool file_system::get_file_content(mapped_file &out, const char *file_path, int options) {
+        if (0 == out.open(file_path, options) && !out.empty()) {
             return true;
         }
+
+        // 虚拟文件(比如/proc下的文件)拿不到长度或不能映射，只能按流来读
+        out.close();
+        if (!get_file_content(out.buffer_, file_path, true)) {
+            out.buffer_.clear();
+            return false;
+        }
+
+        out.data_ = out.buffer_.c_str();
+        out.size_ = out.buffer_.size();
+        return true;
+    }
+
+    LIBATFRAME_UTILS_API bool file_system::read_file_chunks(const char *file_path, const chunk_callback_t &fn, size_t chunk_size) {
+        if (NULL == file_path || !fn || 0 == chunk_size) {
+            return false;
+        }
+
+        FILE *f = NULL;
+        UTIL_FS_OPEN(error_code, f, file_path, "rb");
+        COMPILER_UNUSED(error_code);
+        if (NULL == f) {
+            return false;
+        }
+
+        // 已经有自己的缓冲区了，关闭stdio的缓冲减少一次复制
+        setvbuf(f, NULL, _IONBF, 0);
+#if defined(POSIX_FADV_SEQUENTIAL) && !defined(UTIL_FS_WINDOWS_API)
+        posix_fadvise(fileno(f), 0, 0, POSIX_FADV_SEQUENTIAL);
 #endif
 
-        return false;
+        std::vector<char> buffer(chunk_size);
+        bool              ret = true;
+        while (true) {
+            size_t read_sz = fread(&buffer[0], 1, chunk_size, f);
+            if (read_sz > 0 && !fn(&buffer[0], read_sz)) {
+                break;
+            }
+
+            if (read_sz < chunk_size) {
+                ret = 0 == ferror(f);
+                break;
+            }
+        }
+
+        fclose(f);
+        return ret;
     }
 
+    LIBATFRAME_UTILS_API int file_system::copy_file(const char *from, const char *to) {
+        if (NULL == from || NULL == to) {
+            return EINVAL;
+        }
+
+#ifdef UTIL_FS_WINDOWS_API
+#ifdef _MSC_VER
+        USES_CONVERSION;
+#endif
+
+        if (CopyFile(VC_TEXT(from), VC_TEXT(to), FALSE)) {
+            return 0;
+        }
+
+        return static_cast<int>(GetLastError());
+#else
+        int in_fd = ::open(from, O_RDONLY);
+        if (in_fd < 0) {
+            return errno;
+        }
+
+        struct stat st;
+        if (0 != fstat(in_fd, &st)) {
+            int res = errno;
+            ::close(in_fd);
+            return res;
+        }
+
+        int out_fd = ::open(to, O_WRONLY | O_CREAT | O_TRUNC, st.st_mode & (S_IRWXU | S_IRWXG | S_IRWXO));
+        if (out_fd < 0) {
+            int res = errno;
+            ::close(in_fd);
+            return res;
+        }
+
+        // 虚拟文件的长度是0，内核中复制会得到空文件，只能按流来读
+        size_t done = 0;
+        int    res;
+        if (S_ISREG(st.st_mode) && st.st_size > 0) {
+            res = detail::file_system_transfer(in_fd, out_fd, 0, static_cast<size_t>(st.st_size), done,
+                                               detail::file_system_transfer_t::EN_FST_COPY_FILE_RANGE |
+                                                   detail::file_system_transfer_t::EN_FST_SENDFILE);
+        } else {
+            res = detail::file_system_transfer(in_fd, out_fd, 0, static_cast<size_t>(-1), done, 0);
+        }
+
+        ::close(in_fd);
+        if (0 != ::close(out_fd) && 0 == res) {
+            res = errno;
+        }
+        return res;
+#endif
+    }
+
+#ifdef UTIL_FS_POSIX_API
+    LIBATFRAME_UTILS_API int file_system::send_file(int out_fd, const char *file_path, size_t offset, size_t length, size_t &sent) {
+        sent = 0;
+        if (NULL == file_path) {
+            return EINVAL;
+        }
+
+        int in_fd = ::open(file_path, O_RDONLY);
+        if (in_fd < 0) {
+            return errno;
+        }
+
+        if (0 == length) {
+            struct stat st;
+            if (0 != fstat(in_fd, &st)) {
+                int res = errno;
+                ::close(in_fd);
+                return res;
+            }
+
+            length = static_cast<size_t>(st.st_size) > offset ? static_cast<size_t>(st.st_size) - offset : 0;
+        }
+
+        int res = 0;
+        if (length > 0) {
+            res = detail::file_system_transfer(in_fd, out_fd, offset, length, sent, detail::file_system_transfer_t::EN_FST_SENDFILE);
+        }
+
+        ::close(in_fd);
+        return res;
+    }
+#endif
+
+
 #if !defined(UTIL_FS_DISABLE_LINK)
     LIBATFRAME_UTILS_API int file_system::link(const char *oldpath, const char *newpath, int options) {
         if ((options & link_opt_t::EN_LOT_FORCE_REWRITE) && is_exist(newpath)) {
@@ -1,9 +1,613 @@
 #include <common/string_oprs.h>
 #include <sstream>
 
+// 16进制转换、大小写转换和忽略大小写比较的SIMD实现: x86使用SSSE3/AVX2(运行时检测)，aarch64使用NEON
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define UTIL_STRING_OPRS_SSSE3 1
+#define UTIL_STRING_OPRS_SSSE3_TARGET __attribute__((target("ssse3")))
+#define UTIL_STRING_OPRS_AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#define UTIL_STRING_OPRS_SSSE3 1
+#define UTIL_STRING_OPRS_SSSE3_TARGET
+#define UTIL_STRING_OPRS_AVX2_TARGET
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define UTIL_STRING_OPRS_NEON 1
+#endif
+
 
 namespace util {
     namespace string {
+        namespace {
+            static const char g_string_oprs_hex_lower[] = "0123456789abcdef";
+            static const char g_string_oprs_hex_upper[] = "0123456789ABCDEF";
+
+            static inline int string_oprs_hex_value(unsigned char c) {
+                if (c >= '0' && c <= '9') {
+                    return c - '0';
+                }
+                c |= 0x20;
+                if (c >= 'a' && c <= 'f') {
+                    return c - 'a' + 10;
+                }
+                return -1;
+            }
+
+            static inline unsigned char string_oprs_fold(unsigned char c) {
+                return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c | 0x20) : c;
+            }
+
+            // ==================== scalar ====================
+            static void string_oprs_hex_encode_scalar(const unsigned char *src, size_t ss, char *out, bool upper_case) {
+                const char *table = upper_case ? g_string_oprs_hex_upper : g_string_oprs_hex_lower;
+                for (size_t i = 0; i < ss; ++i) {
+                    out[i << 1]       = table[src[i] >> 4];
+                    out[(i << 1) + 1] = table[src[i] & 0x0F];
+                }
+            }
+
+            // 只转换完整的块，返回已转换的字节数，剩下的部分(包括非法字符所在的块)由调用方逐字节处理
+            static size_t string_oprs_hex_decode_scalar(const unsigned char *, size_t, unsigned char *) { return 0; }
+
+            // 和 low 到 low+25 范围内的字节翻转大小写位
+            static void string_oprs_case_convert_scalar(unsigned char *dst, const unsigned char *src, size_t sz, unsigned char low) {
+                for (size_t i = 0; i < sz; ++i) {
+                    unsigned char c = src[i];
+                    dst[i]          = static_cast<unsigned char>(c - low) <= 25 ? static_cast<unsigned char>(c ^ 0x20) : c;
+                }
+            }
+
+            // 返回转小写后第一个不相同的位置，都相同返回sz
+            static size_t string_oprs_case_mismatch_scalar(const unsigned char *l, const unsigned char *r, size_t sz) {
+                size_t i = 0;
+                for (; i < sz; ++i) {
+                    if (l[i] != r[i] && string_oprs_fold(l[i]) != string_oprs_fold(r[i])) {
+                        break;
+                    }
+                }
+                return i;
+            }
+
+            // 返回第一个不可打印字符([32, 127)以外)的位置，没有返回sz
+            static size_t string_oprs_find_unprintable_scalar(const unsigned char *p, size_t sz) {
+                size_t i = 0;
+                for (; i < sz; ++i) {
+                    if (static_cast<unsigned char>(p[i] - 32) > 94) {
+                        break;
+                    }
+                }
+                return i;
+            }
+
+#if defined(UTIL_STRING_OPRS_SSSE3)
+            static inline int string_oprs_ctz(unsigned int mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+                unsigned long index;
+                _BitScanForward(&index, static_cast<unsigned long>(mask));
+                return static_cast<int>(index);
+#else
+                return __builtin_ctz(mask);
+#endif
+            }
+
+            // ==================== SSSE3 ====================
+            UTIL_STRING_OPRS_SSSE3_TARGET static void string_oprs_hex_encode_ssse3(const unsigned char *src, size_t ss, char *out,
+                                                                                   bool upper_case) {
+                const __m128i table  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(upper_case ? g_string_oprs_hex_upper : g_string_oprs_hex_lower));
+                const __m128i nibble = _mm_set1_epi8(0x0F);
+
+                size_t i = 0;
+                for (; i + 16 <= ss; i += 16) {
+                    __m128i v  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+                    __m128i hi = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(v, 4), nibble));
+                    __m128i lo = _mm_shuffle_epi8(table, _mm_and_si128(v, nibble));
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + (i << 1)), _mm_unpacklo_epi8(hi, lo));
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + (i << 1) + 16), _mm_unpackhi_epi8(hi, lo));
+                }
+
+                string_oprs_hex_encode_scalar(src + i, ss - i, out + (i << 1), upper_case);
+            }
+
+            // 16个16进制字符转半字节，valid中非法字符对应的字节为0
+            UTIL_STRING_OPRS_SSSE3_TARGET static inline __m128i string_oprs_hex_nibbles_ssse3(__m128i c, __m128i &valid) {
+                __m128i digit  = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+                __m128i is_dig = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+                __m128i alpha  = _mm_sub_epi8(_mm_or_si128(c, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+                __m128i is_alp = _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(5)), alpha);
+                valid          = _mm_or_si128(is_dig, is_alp);
+                return _mm_or_si128(_mm_and_si128(is_dig, digit), _mm_and_si128(is_alp, _mm_add_epi8(alpha, _mm_set1_epi8(10))));
+            }
+
+            UTIL_STRING_OPRS_SSSE3_TARGET static size_t string_oprs_hex_decode_ssse3(const unsigned char *src, size_t slen, unsigned char *out) {
+                const __m128i merge = _mm_set1_epi16(0x0110);
+
+                size_t i = 0;
+                for (; i + 32 <= slen; i += 32) {
+                    __m128i valid1, valid2;
+                    __m128i n1 = string_oprs_hex_nibbles_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i)), valid1);
+                    __m128i n2 = string_oprs_hex_nibbles_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 16)), valid2);
+                    if (0xFFFF != _mm_movemask_epi8(_mm_and_si128(valid1, valid2))) {
+                        break;
+                    }
+
+                    // 相邻的两个半字节合并: hi * 16 + lo
+                    __m128i b1 = _mm_maddubs_epi16(n1, merge);
+                    __m128i b2 = _mm_maddubs_epi16(n2, merge);
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + (i >> 1)), _mm_packus_epi16(b1, b2));
+                }
+
+                return i;
+            }
+
+            UTIL_STRING_OPRS_SSSE3_TARGET static void string_oprs_case_convert_ssse3(unsigned char *dst, const unsigned char *src, size_t sz,
+                                                                                     unsigned char low) {
+                const __m128i vlow  = _mm_set1_epi8(static_cast<char>(low));
+                const __m128i range = _mm_set1_epi8(25);
+                const __m128i flip  = _mm_set1_epi8(0x20);
+
+                size_t i = 0;
+                for (; i + 16 <= sz; i += 16) {
+                    __m128i v  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+                    __m128i t  = _mm_sub_epi8(v, vlow);
+                    __m128i in = _mm_cmpeq_epi8(_mm_min_epu8(t, range), t);
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_xor_si128(v, _mm_and_si128(in, flip)));
+                }
+
+                string_oprs_case_convert_scalar(dst + i, src + i, sz - i, low);
+            }
+
+            UTIL_STRING_OPRS_SSSE3_TARGET static inline __m128i string_oprs_fold_ssse3(__m128i v) {
+                __m128i t  = _mm_sub_epi8(v, _mm_set1_epi8('A'));
+                __m128i in = _mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8(25)), t);
+                return _mm_or_si128(v, _mm_and_si128(in, _mm_set1_epi8(0x20)));
+            }
+
+            UTIL_STRING_OPRS_SSSE3_TARGET static size_t string_oprs_case_mismatch_ssse3(const unsigned char *l, const unsigned char *r, size_t sz) {
+                size_t i = 0;
+                for (; i + 16 <= sz; i += 16) {
+                    __m128i vl   = string_oprs_fold_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i *>(l + i)));
+                    __m128i vr   = string_oprs_fold_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i *>(r + i)));
+                    int     mask = _mm_movemask_epi8(_mm_cmpeq_epi8(vl, vr));
+                    if (0xFFFF != mask) {
+                        return i + static_cast<size_t>(string_oprs_ctz(static_cast<unsigned int>(~mask) & 0xFFFFU));
+                    }
+                }
+
+                return i + string_oprs_case_mismatch_scalar(l + i, r + i, sz - i);
+            }
+
+            UTIL_STRING_OPRS_SSSE3_TARGET static size_t string_oprs_find_unprintable_ssse3(const unsigned char *p, size_t sz) {
+                const __m128i base  = _mm_set1_epi8(32);
+                const __m128i range = _mm_set1_epi8(94);
+
+                size_t i = 0;
+                for (; i + 16 <= sz; i += 16) {
+                    __m128i t    = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i)), base);
+                    int     mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(t, range), t));
+                    if (0xFFFF != mask) {
+                        return i + static_cast<size_t>(string_oprs_ctz(static_cast<unsigned int>(~mask) & 0xFFFFU));
+                    }
+                }
+
+                return i + string_oprs_find_unprintable_scalar(p + i, sz - i);
+            }
+
+            // ==================== AVX2 ====================
+            UTIL_STRING_OPRS_AVX2_TARGET static void string_oprs_hex_encode_avx2(const unsigned char *src, size_t ss, char *out, bool upper_case) {
+                const __m256i table = _mm256_broadcastsi128_si256(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(upper_case ? g_string_oprs_hex_upper : g_string_oprs_hex_lower)));
+                const __m256i nibble = _mm256_set1_epi8(0x0F);
+
+                size_t i = 0;
+                for (; i + 32 <= ss; i += 32) {
+                    __m256i v  = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+                    __m256i hi = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+                    __m256i lo = _mm256_shuffle_epi8(table, _mm256_and_si256(v, nibble));
+                    // unpack按128位分别交错，再把两个结果的低/高128位重新组合
+                    __m256i r1 = _mm256_unpacklo_epi8(hi, lo);
+                    __m256i r2 = _mm256_unpackhi_epi8(hi, lo);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + (i << 1)), _mm256_permute2x128_si256(r1, r2, 0x20));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + (i << 1) + 32), _mm256_permute2x128_si256(r1, r2, 0x31));
+                }
+
+                string_oprs_hex_encode_ssse3(src + i, ss - i, out + (i << 1), upper_case);
+            }
+
+            UTIL_STRING_OPRS_AVX2_TARGET static inline __m256i string_oprs_hex_nibbles_avx2(__m256i c, __m256i &valid) {
+                __m256i digit  = _mm256_sub_epi8(c, _mm256_set1_epi8('0'));
+                __m256i is_dig = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+                __m256i alpha  = _mm256_sub_epi8(_mm256_or_si256(c, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+                __m256i is_alp = _mm256_cmpeq_epi8(_mm256_min_epu8(alpha, _mm256_set1_epi8(5)), alpha);
+                valid          = _mm256_or_si256(is_dig, is_alp);
+                return _mm256_or_si256(_mm256_and_si256(is_dig, digit), _mm256_and_si256(is_alp, _mm256_add_epi8(alpha, _mm256_set1_epi8(10))));
+            }
+
+            UTIL_STRING_OPRS_AVX2_TARGET static size_t string_oprs_hex_decode_avx2(const unsigned char *src, size_t slen, unsigned char *out) {
+                const __m256i merge = _mm256_set1_epi16(0x0110);
+
+                size_t i = 0;
+                for (; i + 64 <= slen; i += 64) {
+                    __m256i valid1, valid2;
+                    __m256i n1 = string_oprs_hex_nibbles_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i)), valid1);
+                    __m256i n2 = string_oprs_hex_nibbles_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i + 32)), valid2);
+                    if (-1 != _mm256_movemask_epi8(_mm256_and_si256(valid1, valid2))) {
+                        break;
+                    }
+
+                    // packus按128位打包，结果的64位块顺序是 0,2,1,3
+                    __m256i packed = _mm256_packus_epi16(_mm256_maddubs_epi16(n1, merge), _mm256_maddubs_epi16(n2, merge));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + (i >> 1)), _mm256_permute4x64_epi64(packed, 0xD8));
+                }
+
+                return i + string_oprs_hex_decode_ssse3(src + i, slen - i, out + (i >> 1));
+            }
+
+            UTIL_STRING_OPRS_AVX2_TARGET static void string_oprs_case_convert_avx2(unsigned char *dst, const unsigned char *src, size_t sz,
+                                                                                   unsigned char low) {
+                const __m256i vlow  = _mm256_set1_epi8(static_cast<char>(low));
+                const __m256i range = _mm256_set1_epi8(25);
+                const __m256i flip  = _mm256_set1_epi8(0x20);
+
+                size_t i = 0;
+                for (; i + 32 <= sz; i += 32) {
+                    __m256i v  = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+                    __m256i t  = _mm256_sub_epi8(v, vlow);
+                    __m256i in = _mm256_cmpeq_epi8(_mm256_min_epu8(t, range), t);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_xor_si256(v, _mm256_and_si256(in, flip)));
+                }
+
+                string_oprs_case_convert_ssse3(dst + i, src + i, sz - i, low);
+            }
+
+            UTIL_STRING_OPRS_AVX2_TARGET static inline __m256i string_oprs_fold_avx2(__m256i v) {
+                __m256i t  = _mm256_sub_epi8(v, _mm256_set1_epi8('A'));
+                __m256i in = _mm256_cmpeq_epi8(_mm256_min_epu8(t, _mm256_set1_epi8(25)), t);
+                return _mm256_or_si256(v, _mm256_and_si256(in, _mm256_set1_epi8(0x20)));
+            }
+
+            UTIL_STRING_OPRS_AVX2_TARGET static size_t string_oprs_case_mismatch_avx2(const unsigned char *l, const unsigned char *r, size_t sz) {
+                size_t i = 0;
+                for (; i + 32 <= sz; i += 32) {
+                    __m256i  vl   = string_oprs_fold_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(l + i)));
+                    __m256i  vr   = string_oprs_fold_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(r + i)));
+                    unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(vl, vr)));
+                    if (0xFFFFFFFFU != mask) {
+                        return i + static_cast<size_t>(string_oprs_ctz(~mask));
+                    }
+                }
+
+                return i + string_oprs_case_mismatch_ssse3(l + i, r + i, sz - i);
+            }
+
+            UTIL_STRING_OPRS_AVX2_TARGET static size_t string_oprs_find_unprintable_avx2(const unsigned char *p, size_t sz) {
+                const __m256i base  = _mm256_set1_epi8(32);
+                const __m256i range = _mm256_set1_epi8(94);
+
+                size_t i = 0;
+                for (; i + 32 <= sz; i += 32) {
+                    __m256i  t    = _mm256_sub_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i)), base);
+                    unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_min_epu8(t, range), t)));
+                    if (0xFFFFFFFFU != mask) {
+                        return i + static_cast<size_t>(string_oprs_ctz(~mask));
+                    }
+                }
+
+                return i + string_oprs_find_unprintable_ssse3(p + i, sz - i);
+            }
+
+            static int string_oprs_detect_simd() {
+#if defined(_MSC_VER) && !defined(__clang__)
+                int cpu_info[4] = {0};
+                __cpuid(cpu_info, 0);
+                int max_leaf = cpu_info[0];
+
+                __cpuid(cpu_info, 1);
+                bool ssse3   = 0 != (cpu_info[2] & (1 << 9));
+                bool osxsave = 0 != (cpu_info[2] & (1 << 27));
+                bool avx     = 0 != (cpu_info[2] & (1 << 28));
+                if (!ssse3) {
+                    return 0;
+                }
+
+                if (max_leaf >= 7 && osxsave && avx && 6 == (_xgetbv(0) & 6)) {
+                    __cpuidex(cpu_info, 7, 0);
+                    if (0 != (cpu_info[1] & (1 << 5))) {
+                        return 2;
+                    }
+                }
+                return 1;
+#else
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx2")) {
+                    return 2;
+                }
+                return __builtin_cpu_supports("ssse3") ? 1 : 0;
+#endif
+            }
+#endif
+
+#if defined(UTIL_STRING_OPRS_NEON)
+            // ==================== NEON ====================
+            static void string_oprs_hex_encode_neon(const unsigned char *src, size_t ss, char *out, bool upper_case) {
+                const uint8x16_t table  = vld1q_u8(reinterpret_cast<const unsigned char *>(upper_case ? g_string_oprs_hex_upper : g_string_oprs_hex_lower));
+                const uint8x16_t nibble = vdupq_n_u8(0x0F);
+
+                size_t i = 0;
+                for (; i + 16 <= ss; i += 16) {
+                    uint8x16_t   v = vld1q_u8(src + i);
+                    uint8x16x2_t r;
+                    r.val[0] = vqtbl1q_u8(table, vshrq_n_u8(v, 4));
+                    r.val[1] = vqtbl1q_u8(table, vandq_u8(v, nibble));
+                    vst2q_u8(reinterpret_cast<unsigned char *>(out + (i << 1)), r);
+                }
+
+                string_oprs_hex_encode_scalar(src + i, ss - i, out + (i << 1), upper_case);
+            }
+
+            static inline uint8x16_t string_oprs_hex_nibbles_neon(uint8x16_t c, uint8x16_t &valid) {
+                uint8x16_t digit  = vsubq_u8(c, vdupq_n_u8('0'));
+                uint8x16_t is_dig = vcleq_u8(digit, vdupq_n_u8(9));
+                uint8x16_t alpha  = vsubq_u8(vorrq_u8(c, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+                uint8x16_t is_alp = vcleq_u8(alpha, vdupq_n_u8(5));
+                valid             = vorrq_u8(is_dig, is_alp);
+                return vorrq_u8(vandq_u8(is_dig, digit), vandq_u8(is_alp, vaddq_u8(alpha, vdupq_n_u8(10))));
+            }
+
+            static size_t string_oprs_hex_decode_neon(const unsigned char *src, size_t slen, unsigned char *out) {
+                size_t i = 0;
+                for (; i + 32 <= slen; i += 32) {
+                    // 按奇偶位置分开加载，偶数位置是高半字节
+                    uint8x16x2_t c = vld2q_u8(src + i);
+                    uint8x16_t   valid1, valid2;
+                    uint8x16_t   hi = string_oprs_hex_nibbles_neon(c.val[0], valid1);
+                    uint8x16_t   lo = string_oprs_hex_nibbles_neon(c.val[1], valid2);
+                    if (0xFF != vminvq_u8(vandq_u8(valid1, valid2))) {
+                        break;
+                    }
+
+                    vst1q_u8(out + (i >> 1), vorrq_u8(vshlq_n_u8(hi, 4), lo));
+                }
+
+                return i;
+            }
+
+            static void string_oprs_case_convert_neon(unsigned char *dst, const unsigned char *src, size_t sz, unsigned char low) {
+                const uint8x16_t vlow  = vdupq_n_u8(low);
+                const uint8x16_t range = vdupq_n_u8(25);
+                const uint8x16_t flip  = vdupq_n_u8(0x20);
+
+                size_t i = 0;
+                for (; i + 16 <= sz; i += 16) {
+                    uint8x16_t v  = vld1q_u8(src + i);
+                    uint8x16_t in = vcleq_u8(vsubq_u8(v, vlow), range);
+                    vst1q_u8(dst + i, veorq_u8(v, vandq_u8(in, flip)));
+                }
+
+                string_oprs_case_convert_scalar(dst + i, src + i, sz - i, low);
+            }
+
+            static inline uint8x16_t string_oprs_fold_neon(uint8x16_t v) {
+                uint8x16_t in = vcleq_u8(vsubq_u8(v, vdupq_n_u8('A')), vdupq_n_u8(25));
+                return vorrq_u8(v, vandq_u8(in, vdupq_n_u8(0x20)));
+            }
+
+            static size_t string_oprs_case_mismatch_neon(const unsigned char *l, const unsigned char *r, size_t sz) {
+                size_t i = 0;
+                for (; i + 16 <= sz; i += 16) {
+                    uint8x16_t eq = vceqq_u8(string_oprs_fold_neon(vld1q_u8(l + i)), string_oprs_fold_neon(vld1q_u8(r + i)));
+                    if (0xFF != vminvq_u8(eq)) {
+                        break;
+                    }
+                }
+
+                return i + string_oprs_case_mismatch_scalar(l + i, r + i, sz - i);
+            }
+
+            static size_t string_oprs_find_unprintable_neon(const unsigned char *p, size_t sz) {
+                const uint8x16_t base  = vdupq_n_u8(32);
+                const uint8x16_t range = vdupq_n_u8(94);
+
+                size_t i = 0;
+                for (; i + 16 <= sz; i += 16) {
+                    if (0 != vmaxvq_u8(vcgtq_u8(vsubq_u8(vld1q_u8(p + i), base), range))) {
+                        break;
+                    }
+                }
+
+                return i + string_oprs_find_unprintable_scalar(p + i, sz - i);
+            }
+#endif
+
+            typedef void (*string_oprs_hex_encode_fn_t)(const unsigned char *, size_t, char *, bool);
+            typedef size_t (*string_oprs_hex_decode_fn_t)(const unsigned char *, size_t, unsigned char *);
+            typedef void (*string_oprs_case_convert_fn_t)(unsigned char *, const unsigned char *, size_t, unsigned char);
+            typedef size_t (*string_oprs_case_mismatch_fn_t)(const unsigned char *, const unsigned char *, size_t);
+            typedef size_t (*string_oprs_find_unprintable_fn_t)(const unsigned char *, size_t);
+
+            struct string_oprs_dispatch_t {
+                string_oprs_hex_encode_fn_t       hex_encode;
+                string_oprs_hex_decode_fn_t       hex_decode;
+                string_oprs_case_convert_fn_t     case_convert;
+                string_oprs_case_mismatch_fn_t    case_mismatch;
+                string_oprs_find_unprintable_fn_t find_unprintable;
+
+                string_oprs_dispatch_t()
+                    : hex_encode(string_oprs_hex_encode_scalar), hex_decode(string_oprs_hex_decode_scalar),
+                      case_convert(string_oprs_case_convert_scalar), case_mismatch(string_oprs_case_mismatch_scalar),
+                      find_unprintable(string_oprs_find_unprintable_scalar) {
+#if defined(UTIL_STRING_OPRS_SSSE3)
+                    int level = string_oprs_detect_simd();
+                    if (level >= 2) {
+                        hex_encode       = string_oprs_hex_encode_avx2;
+                        hex_decode       = string_oprs_hex_decode_avx2;
+                        case_convert     = string_oprs_case_convert_avx2;
+                        case_mismatch    = string_oprs_case_mismatch_avx2;
+                        find_unprintable = string_oprs_find_unprintable_avx2;
+                    } else if (level >= 1) {
+                        hex_encode       = string_oprs_hex_encode_ssse3;
+                        hex_decode       = string_oprs_hex_decode_ssse3;
+                        case_convert     = string_oprs_case_convert_ssse3;
+                        case_mismatch    = string_oprs_case_mismatch_ssse3;
+                        find_unprintable = string_oprs_find_unprintable_ssse3;
+                    }
+#elif defined(UTIL_STRING_OPRS_NEON)
+                    hex_encode       = string_oprs_hex_encode_neon;
+                    hex_decode       = string_oprs_hex_decode_neon;
+                    case_convert     = string_oprs_case_convert_neon;
+                    case_mismatch    = string_oprs_case_mismatch_neon;
+                    find_unprintable = string_oprs_find_unprintable_neon;
+#endif
+                }
+            };
+
+            // 放在函数内，保证其他模块的静态初始化里也可以使用
+            static const string_oprs_dispatch_t &string_oprs_simd() {
+                static const string_oprs_dispatch_t ret;
+                return ret;
+            }
+        } // namespace
+
+        LIBATFRAME_UTILS_API void dumphex(const void *src, size_t ss, char *out, bool upper_case) {
+            string_oprs_simd().hex_encode(reinterpret_cast<const unsigned char *>(src), ss, out, upper_case);
+        }
+
+        LIBATFRAME_UTILS_API void dumphex(const void *src, size_t ss, std::ostream &out, bool upper_case) {
+            const unsigned char *cs = reinterpret_cast<const unsigned char *>(src);
+            char                 buffer[512];
+            while (ss > 0) {
+                size_t block = ss > sizeof(buffer) / 2 ? sizeof(buffer) / 2 : ss;
+                string_oprs_simd().hex_encode(cs, block, buffer, upper_case);
+                out.write(buffer, static_cast<std::streamsize>(block << 1));
+                cs += block;
+                ss -= block;
+            }
+        }
+
+        LIBATFRAME_UTILS_API int hex_decode(void *dst, size_t dlen, size_t *olen, const char *src, size_t slen) {
+            size_t         need = slen >> 1;
+            unsigned char *out  = reinterpret_cast<unsigned char *>(dst);
+            if (0 != (slen & 1)) {
+                if (NULL != olen) {
+                    *olen = 0;
+                }
+                return -2;
+            }
+
+            if (dlen < need) {
+                if (NULL != olen) {
+                    *olen = need;
+                }
+                return -1;
+            }
+
+            const unsigned char *in = reinterpret_cast<const unsigned char *>(src);
+            size_t               i  = string_oprs_simd().hex_decode(in, slen, out);
+            for (; i < slen; i += 2) {
+                int hi = string_oprs_hex_value(in[i]);
+                int lo = string_oprs_hex_value(in[i + 1]);
+                if (hi < 0 || lo < 0) {
+                    if (NULL != olen) {
+                        *olen = i >> 1;
+                    }
+                    return -2;
+                }
+
+                out[i >> 1] = static_cast<unsigned char>((hi << 4) | lo);
+            }
+
+            if (NULL != olen) {
+                *olen = need;
+            }
+            return 0;
+        }
+
+        LIBATFRAME_UTILS_API void serialization(const void *src, size_t ss, char *out, size_t &os) {
+            const unsigned char *cs = reinterpret_cast<const unsigned char *>(src);
+            size_t               i = 0, j = 0;
+            while (i < ss && j < os) {
+                // 可打印字符整块复制
+                size_t run = string_oprs_simd().find_unprintable(cs + i, ss - i);
+                if (run > os - j) {
+                    run = os - j;
+                }
+                memcpy(out + j, cs + i, run);
+                i += run;
+                j += run;
+
+                if (i >= ss || j >= os) {
+                    break;
+                }
+
+                if (j + 4 > os) {
+                    break;
+                }
+                out[j++] = '\\';
+                oct(&out[j], cs[i]);
+                j += 3;
+                ++i;
+            }
+
+            os = j;
+        }
+
+        LIBATFRAME_UTILS_API void serialization(const void *src, size_t ss, std::ostream &out) {
+            const unsigned char *cs = reinterpret_cast<const unsigned char *>(src);
+            size_t               i  = 0;
+            while (i < ss) {
+                size_t run = string_oprs_simd().find_unprintable(cs + i, ss - i);
+                if (run > 0) {
+                    out.write(reinterpret_cast<const char *>(cs + i), static_cast<std::streamsize>(run));
+                    i += run;
+                }
+
+                if (i < ss) {
+                    char tmp[4] = {'\\', 0, 0, 0};
+                    oct(&tmp[1], cs[i]);
+                    out.write(tmp, 4);
+                    ++i;
+                }
+            }
+        }
+
+        LIBATFRAME_UTILS_API void tolower(char *dst, const char *src, size_t sz) {
+            string_oprs_simd().case_convert(reinterpret_cast<unsigned char *>(dst), reinterpret_cast<const unsigned char *>(src), sz, 'A');
+        }
+
+        LIBATFRAME_UTILS_API void toupper(char *dst, const char *src, size_t sz) {
+            string_oprs_simd().case_convert(reinterpret_cast<unsigned char *>(dst), reinterpret_cast<const unsigned char *>(src), sz, 'a');
+        }
+
+        LIBATFRAME_UTILS_API int case_compare(const char *l, const char *r, size_t sz) {
+            const unsigned char *ul  = reinterpret_cast<const unsigned char *>(l);
+            const unsigned char *ur  = reinterpret_cast<const unsigned char *>(r);
+            size_t               pos = string_oprs_simd().case_mismatch(ul, ur, sz);
+            if (pos >= sz) {
+                return 0;
+            }
+
+            return static_cast<int>(string_oprs_fold(ul[pos])) - static_cast<int>(string_oprs_fold(ur[pos]));
+        }
+
+        LIBATFRAME_UTILS_API int case_compare(const char *l, size_t lsz, const char *r, size_t rsz) {
+            int ret = case_compare(l, r, lsz < rsz ? lsz : rsz);
+            if (0 != ret || lsz == rsz) {
+                return ret;
+            }
+
+            return lsz < rsz ? -1 : 1;
+        }
+
+        LIBATFRAME_UTILS_API bool case_equal(const char *l, size_t lsz, const char *r, size_t rsz) {
+            if (lsz != rsz) {
+                return false;
+            }
+
+            return string_oprs_simd().case_mismatch(reinterpret_cast<const unsigned char *>(l), reinterpret_cast<const unsigned char *>(r), lsz) >= lsz;
+        }
+
         LIBATFRAME_UTILS_API const char *version_tok(const char *v, int64_t &out) {
             if (NULL == v) {
                 out = 0;
@@ -294,11 +294,11 @@ namespace util {
                     break;
                 }
                 case 'l': {
-                    int res = UTIL_STRFUNC_SNPRINTF(&buff[ret], bufz - ret, "%d", static_cast<int>(caller.level_id));
-                    if (res < 0) {
+                    size_t res = util::string::int2str(&buff[ret], bufz - ret, static_cast<int>(caller.level_id));
+                    if (0 == res) {
                         running = false;
                     } else {
-                        ret += static_cast<size_t>(res);
+                        ret += res;
                     }
                     break;
                 }
@@ -347,11 +347,11 @@ namespace util {
                     break;
                 }
                 case 'n': {
-                    int res = UTIL_STRFUNC_SNPRINTF(&buff[ret], bufz - ret, "%u", caller.line_number);
-                    if (res < 0) {
+                    size_t res = util::string::int2str(&buff[ret], bufz - ret, caller.line_number);
+                    if (0 == res) {
                         running = false;
                     } else {
-                        ret += static_cast<size_t>(res);
+                        ret += res;
                     }
                     break;
                 }
@@ -368,11 +368,11 @@ namespace util {
                 }
                 // =================== rotate index ===================
                 case 'N': {
-                    int res = UTIL_STRFUNC_SNPRINTF(&buff[ret], bufz - ret, "%u", caller.rotate_index);
-                    if (res < 0) {
+                    size_t res = util::string::int2str(&buff[ret], bufz - ret, caller.rotate_index);
+                    if (0 == res) {
                         running = false;
                     } else {
-                        ret += static_cast<size_t>(res);
+                        ret += res;
                     }
                     break;
                 }
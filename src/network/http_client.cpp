@@ -0,0 +1,414 @@
+﻿#include <assert.h>
+#include <cstring>
+
+#include <thread>
+#include <unordered_map>
+
+#include "algorithm/murmur_hash.h"
+#include "lock/atomic_int_type.h"
+#include "lock/lock_holder.h"
+#include "lock/spin_lock.h"
+
+#include "network/http_client.h"
+
+#if defined(NETWORK_EVPOLL_ENABLE_LIBUV) && defined(NETWORK_ENABLE_CURL)
+#if NETWORK_ENABLE_CURL && NETWORK_EVPOLL_ENABLE_LIBUV
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+
+namespace util {
+    namespace network {
+        struct http_client::worker_t {
+            struct job_t {
+                std::string                  url;
+                http_request::method_t::type method;
+                setup_fn_t                   setup;
+            };
+
+            struct result_t {
+                http_request::ptr_t            request; // empty if it can not be created
+                int                            error_code;
+                http_request::on_success_fn_t  on_success;
+                http_request::on_error_fn_t    on_error;
+                http_request::on_complete_fn_t on_complete;
+            };
+
+            uv_async_t *                    caller_async; // notify the caller's loop
+            std::thread                     thread;
+            uv_loop_t                       loop;
+            uv_async_t                      async;
+            http_request::curl_m_bind_ptr_t multi;
+            bool                            loop_inited;
+            bool                            async_inited;
+
+            ::util::lock::atomic_int_type<size_t> pending;
+
+            // guarded by lock, used by both the caller and the worker
+            ::util::lock::spin_lock lock;
+            std::vector<job_t>      jobs;
+            std::vector<result_t>   results;
+            bool                    stopping;
+
+            // only used in the worker thread
+            std::unordered_map<http_request *, result_t> running;
+            std::vector<http_request *>                  finished;
+            bool                                         closed;
+
+            worker_t() : caller_async(NULL), loop_inited(false), async_inited(false), pending(0), stopping(false), closed(false) {}
+        };
+
+        namespace detail {
+            static void http_client_worker_main(http_client::worker_t *worker) { uv_run(&worker->loop, UV_RUN_DEFAULT); }
+
+            static void http_client_worker_push_results(http_client::worker_t *worker, std::vector<http_client::worker_t::result_t> &results) {
+                if (results.empty()) {
+                    return;
+                }
+
+                {
+                    ::util::lock::lock_holder< ::util::lock::spin_lock> holder(worker->lock);
+                    worker->results.reserve(worker->results.size() + results.size());
+                    for (size_t i = 0; i < results.size(); ++i) {
+                        worker->results.push_back(results[i]);
+                    }
+                }
+                results.clear();
+
+                uv_async_send(worker->caller_async);
+            }
+
+            static void http_client_worker_start_job(http_client::worker_t *worker, http_client::worker_t::job_t &job,
+                                                     std::vector<http_client::worker_t::result_t> &results) {
+                http_client::worker_t::result_t result;
+                result.error_code = 0;
+                result.request    = http_request::create(worker->multi.get(), job.url);
+                if (!result.request) {
+                    result.error_code = -1;
+                    results.push_back(result);
+                    return;
+                }
+
+                if (job.setup) {
+                    job.setup(*result.request);
+                }
+
+                // these callbacks are called in the caller's loop
+                result.on_success  = result.request->get_on_success();
+                result.on_error    = result.request->get_on_error();
+                result.on_complete = result.request->get_on_complete();
+                result.request->set_on_success(http_request::on_success_fn_t());
+                result.request->set_on_error(http_request::on_error_fn_t());
+
+                // curl_easy handle is still in use when on_complete is called, so results are moved in the next loop
+                result.request->set_on_complete([worker](http_request &req) {
+                    std::unordered_map<http_request *, http_client::worker_t::result_t>::iterator iter = worker->running.find(&req);
+                    if (iter != worker->running.end()) {
+                        iter->second.error_code = req.get_error_code();
+                    }
+
+                    worker->finished.push_back(&req);
+                    uv_async_send(&worker->async);
+                    return 0;
+                });
+
+                http_request *req = result.request.get();
+                worker->running[req] = result;
+
+                int res = req->start(job.method, false);
+                if (0 != res) {
+                    worker->running[req].error_code = res;
+                    worker->finished.push_back(req);
+                    uv_async_send(&worker->async);
+                }
+            }
+
+            static void http_client_worker_on_async(uv_async_t *handle) {
+                http_client::worker_t *worker = reinterpret_cast<http_client::worker_t *>(handle->data);
+                assert(worker);
+
+                std::vector<http_client::worker_t::job_t> jobs;
+                bool                                      stopping;
+                {
+                    ::util::lock::lock_holder< ::util::lock::spin_lock> holder(worker->lock);
+                    jobs.swap(worker->jobs);
+                    stopping = worker->stopping;
+                }
+
+                std::vector<http_client::worker_t::result_t> results;
+                for (size_t i = 0; i < worker->finished.size(); ++i) {
+                    std::unordered_map<http_request *, http_client::worker_t::result_t>::iterator iter =
+                        worker->running.find(worker->finished[i]);
+                    if (iter != worker->running.end()) {
+                        results.push_back(iter->second);
+                        worker->running.erase(iter);
+                    }
+                }
+                worker->finished.clear();
+
+                if (stopping) {
+                    // jobs not started are dropped
+                    worker->pending.fetch_sub(jobs.size());
+
+                    for (std::unordered_map<http_request *, http_client::worker_t::result_t>::iterator iter = worker->running.begin();
+                         iter != worker->running.end(); ++iter) {
+                        iter->first->stop();
+                    }
+                } else {
+                    for (size_t i = 0; i < jobs.size(); ++i) {
+                        http_client_worker_start_job(worker, jobs[i], results);
+                    }
+                }
+
+                http_client_worker_push_results(worker, results);
+
+                if (stopping && worker->running.empty() && !worker->closed) {
+                    worker->closed = true;
+                    http_request::destroy_curl_multi(worker->multi);
+                    uv_close(reinterpret_cast<uv_handle_t *>(&worker->async), NULL);
+                }
+            }
+        } // namespace detail
+
+        LIBATFRAME_UTILS_API http_client::options_t::options_t()
+            : thread_count(0), dispatch_mode(dispatch_mode_t::EN_DM_HOST_HASH), max_host_connections(0), max_total_connections(0) {}
+
+        LIBATFRAME_UTILS_API http_client::http_client()
+            : caller_loop_(NULL), caller_async_(NULL), running_count_(0), round_robin_(0), closing_(false) {}
+
+        LIBATFRAME_UTILS_API http_client::~http_client() { close(); }
+
+        LIBATFRAME_UTILS_API int http_client::init(uv_loop_t *caller_loop, const options_t &options) {
+            if (NULL == caller_loop || NULL != caller_async_) {
+                return -1;
+            }
+
+            options_ = options;
+            if (0 == options_.thread_count) {
+                options_.thread_count = std::thread::hardware_concurrency();
+            }
+            if (0 == options_.thread_count) {
+                options_.thread_count = 1;
+            }
+
+            caller_loop_  = caller_loop;
+            caller_async_ = new uv_async_t();
+            int ret       = uv_async_init(caller_loop_, caller_async_, ev_callback_on_deliver);
+            if (0 != ret) {
+                delete caller_async_;
+                caller_async_ = NULL;
+                return ret;
+            }
+            caller_async_->data = this;
+            // only keep the caller's loop alive when there are running requests
+            uv_unref(reinterpret_cast<uv_handle_t *>(caller_async_));
+
+            for (size_t i = 0; i < options_.thread_count; ++i) {
+                worker_t *worker = new worker_t();
+                worker->caller_async = caller_async_;
+                workers_.push_back(worker);
+
+                ret = uv_loop_init(&worker->loop);
+                if (0 != ret) {
+                    break;
+                }
+                worker->loop_inited = true;
+
+                ret = http_request::create_curl_multi(&worker->loop, worker->multi);
+                if (0 != ret || !worker->multi) {
+                    ret = (0 == ret) ? -1 : ret;
+                    break;
+                }
+
+                if (0 != options_.max_host_connections || 0 != options_.max_total_connections) {
+                    http_request::set_curl_multi_connection_limit(worker->multi.get(), options_.max_host_connections,
+                                                                  options_.max_total_connections);
+                }
+                if (options_.metrics) {
+                    http_request::set_curl_multi_metrics(worker->multi.get(), options_.metrics);
+                }
+
+                ret = uv_async_init(&worker->loop, &worker->async, detail::http_client_worker_on_async);
+                if (0 != ret) {
+                    break;
+                }
+                worker->async.data   = worker;
+                worker->async_inited = true;
+
+                worker->thread = std::thread(detail::http_client_worker_main, worker);
+            }
+
+            if (0 != ret) {
+                close();
+            }
+
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API void http_client::close() {
+            if (closing_ || NULL == caller_async_) {
+                return;
+            }
+            closing_ = true;
+
+            for (size_t i = 0; i < workers_.size(); ++i) {
+                worker_t *worker = workers_[i];
+                {
+                    ::util::lock::lock_holder< ::util::lock::spin_lock> holder(worker->lock);
+                    worker->stopping = true;
+                }
+
+                if (worker->thread.joinable()) {
+                    uv_async_send(&worker->async);
+                } else {
+                    // thread is not started, release resources here
+                    if (worker->async_inited) {
+                        uv_close(reinterpret_cast<uv_handle_t *>(&worker->async), NULL);
+                    }
+                    if (worker->multi) {
+                        http_request::destroy_curl_multi(worker->multi);
+                    }
+                    if (worker->loop_inited) {
+                        uv_run(&worker->loop, UV_RUN_DEFAULT);
+                    }
+                }
+            }
+
+            for (size_t i = 0; i < workers_.size(); ++i) {
+                if (workers_[i]->thread.joinable()) {
+                    workers_[i]->thread.join();
+                }
+            }
+
+            // deliver all results left
+            deliver();
+
+            for (size_t i = 0; i < workers_.size(); ++i) {
+                if (workers_[i]->loop_inited) {
+                    uv_loop_close(&workers_[i]->loop);
+                }
+                delete workers_[i];
+            }
+            workers_.clear();
+
+            if (running_count_ > 0) {
+                running_count_ = 0;
+                uv_unref(reinterpret_cast<uv_handle_t *>(caller_async_));
+            }
+
+            uv_close(reinterpret_cast<uv_handle_t *>(caller_async_), ev_callback_on_caller_closed);
+            caller_async_ = NULL;
+            caller_loop_  = NULL;
+            closing_      = false;
+        }
+
+        LIBATFRAME_UTILS_API int http_client::start_request(const std::string &url, http_request::method_t::type method, setup_fn_t setup) {
+            if (closing_ || NULL == caller_async_ || workers_.empty()) {
+                return -1;
+            }
+
+            worker_t *worker = workers_[select_worker(url)];
+
+            worker_t::job_t job;
+            job.url    = url;
+            job.method = method;
+            job.setup  = setup;
+
+            ++worker->pending;
+            {
+                ::util::lock::lock_holder< ::util::lock::spin_lock> holder(worker->lock);
+                worker->jobs.push_back(job);
+            }
+
+            if (0 == running_count_++) {
+                uv_ref(reinterpret_cast<uv_handle_t *>(caller_async_));
+            }
+
+            return uv_async_send(&worker->async);
+        }
+
+        LIBATFRAME_UTILS_API size_t http_client::get_worker_pending_count(size_t idx) const {
+            if (idx >= workers_.size()) {
+                return 0;
+            }
+
+            return workers_[idx]->pending.load();
+        }
+
+        LIBATFRAME_UTILS_API size_t http_client::select_worker(const std::string &url) {
+            if (workers_.size() <= 1) {
+                return 0;
+            }
+
+            if (dispatch_mode_t::EN_DM_LEAST_LOADED == options_.dispatch_mode) {
+                // start from a different worker each time, so idle workers are used in turn
+                size_t start = (round_robin_++) % workers_.size();
+                size_t ret   = start;
+                size_t min   = workers_[start]->pending.load();
+                for (size_t i = 1; i < workers_.size() && min > 0; ++i) {
+                    size_t idx     = (start + i) % workers_.size();
+                    size_t pending = workers_[idx]->pending.load();
+                    if (pending < min) {
+                        min = pending;
+                        ret = idx;
+                    }
+                }
+                return ret;
+            }
+
+            std::string host = http_request::get_url_host(url);
+            return static_cast<size_t>(::util::hash::murmur_hash2_64a(host.data(), static_cast<int>(host.size()), 0) % workers_.size());
+        }
+
+        void http_client::ev_callback_on_deliver(uv_async_t *handle) {
+            http_client *self = reinterpret_cast<http_client *>(handle->data);
+            assert(self);
+            if (NULL != self) {
+                self->deliver();
+            }
+        }
+
+        void http_client::ev_callback_on_caller_closed(uv_handle_t *handle) { delete reinterpret_cast<uv_async_t *>(handle); }
+
+        void http_client::deliver() {
+            for (size_t i = 0; i < workers_.size(); ++i) {
+                worker_t *                      worker = workers_[i];
+                std::vector<worker_t::result_t> results;
+                {
+                    ::util::lock::lock_holder< ::util::lock::spin_lock> holder(worker->lock);
+                    results.swap(worker->results);
+                }
+
+                for (size_t j = 0; j < results.size(); ++j) {
+                    worker_t::result_t &result = results[j];
+                    --worker->pending;
+                    if (running_count_ > 0 && 0 == --running_count_) {
+                        uv_unref(reinterpret_cast<uv_handle_t *>(caller_async_));
+                    }
+
+                    if (!result.request) {
+                        continue;
+                    }
+
+                    // the same rule as http_request::finish_req_rsp, and also failures of starting
+                    http_request &req = *result.request;
+                    if (0 != result.error_code || 0 != req.get_error_msg()[0]) {
+                        if (result.on_error) {
+                            result.on_error(req);
+                        }
+                    } else {
+                        if (result.on_success) {
+                            result.on_success(req);
+                        }
+                    }
+
+                    if (result.on_complete) {
+                        result.on_complete(req);
+                    }
+                }
+            }
+        }
+    } // namespace network
+} // namespace util
+
+#endif
+#endif
+#endif
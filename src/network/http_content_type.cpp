@@ -4,22 +4,16 @@
 #include <common/string_oprs.h>
 #include <config/compile_optimize.h>
 #include <network/http_content_type.h>
+#include <string/utf8_char_t.h>
 
 namespace util {
     namespace network {
         namespace http_content_type {
             LIBATFRAME_UTILS_API const char *get_type(main_type mt) {
-                static const char *ret[EN_HCT_MT_MAX] = {NULL};
-                if (unlikely(NULL == ret[EN_HCT_MT_DISCRETE_TEXT])) {
-                    ret[EN_HCT_MT_DISCRETE_TEXT]        = "text";
-                    ret[EN_HCT_MT_DISCRETE_IMAGE]       = "image";
-                    ret[EN_HCT_MT_DISCRETE_AUDIO]       = "audio";
-                    ret[EN_HCT_MT_DISCRETE_VIDEO]       = "video";
-                    ret[EN_HCT_MT_DISCRETE_APPLICATION] = "application";
-
-                    ret[EN_HCT_MT_COMPOSITE_MESSAGE]   = "message";
-                    ret[EN_HCT_MT_COMPOSITE_MULTIPART] = "multipart";
-                }
+                // 顺序和main_type一致
+                static const char *ret[EN_HCT_MT_MAX] = {
+                    NULL, "text", "image", "audio", "video", "application", NULL, "message", "multipart", NULL,
+                };
 
                 if (mt >= EN_HCT_MT_MAX) {
                     return NULL;
@@ -29,24 +23,26 @@ namespace util {
             }
 
             LIBATFRAME_UTILS_API const char *get_subtype(sub_type st) {
-                static const char *ret[EN_HCT_ST_MAX] = {NULL};
-                if (unlikely(NULL == ret[EN_HCT_ST_TEXT_PLAIN])) {
-                    ret[EN_HCT_ST_TEXT_PLAIN] = "plain";
+                // 顺序和sub_type一致
+                static const char *ret[EN_HCT_ST_MAX] = {
+                    NULL,
 
-                    ret[EN_HCT_ST_AUDIO_BASIC] = "basic";
+                    "plain",
 
-                    ret[EN_HCT_ST_APPLICATION_OCTET_STREAM]          = "octet-stream";
-                    ret[EN_HCT_ST_APPLICATION_POSTSCRIPT]            = "postscript";
-                    ret[EN_HCT_ST_APPLICATION_X_WWW_FORM_URLENCODED] = "x-www-form-urlencoded";
-                    ret[EN_HCT_ST_APPLICATION_MULTIPART_FORM_DATA]   = "multipart-formdata";
+                    "basic",
 
-                    ret[EN_HCT_ST_MESSAGE_RFC822] = "rfc822";
+                    "octet-stream",
+                    "postscript",
+                    "x-www-form-urlencoded",
+                    "multipart-formdata",
 
-                    ret[EN_HCT_ST_MULTIPART_MIXED]       = "mixed";
-                    ret[EN_HCT_ST_MULTIPART_DIGEST]      = "digest";
-                    ret[EN_HCT_ST_MULTIPART_ALTERNATIVE] = "alternative";
-                    ret[EN_HCT_ST_MULTIPART_FORM_DATA]   = "form-data";
-                }
+                    "rfc822",
+
+                    "mixed",
+                    "digest",
+                    "alternative",
+                    "form-data",
+                };
 
                 if (st >= EN_HCT_ST_MAX) {
                     return NULL;
@@ -140,6 +136,250 @@ namespace util {
                     return -31;
                 }
             }
+            namespace detail {
+                enum {
+                    MAX_EXTENSION_LEN = 32,
+                    MAX_MIME_TYPE_LEN = 128,
+                };
+
+                static inline unsigned char to_lower(unsigned char c) { return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c - 'A' + 'a') : c; }
+
+                // key must be lower case, the entry is compared in lower case
+                static int compare_lower(const char *entry, const unsigned char *key, size_t key_len) {
+                    size_t i = 0;
+                    for (; i < key_len && entry[i]; ++i) {
+                        unsigned char l = to_lower(static_cast<unsigned char>(entry[i]));
+                        if (l != key[i]) {
+                            return l < key[i] ? -1 : 1;
+                        }
+                    }
+
+                    if (i < key_len) {
+                        return -1;
+                    }
+                    return entry[i] ? 1 : 0;
+                }
+
+                static const extension_entry_t *binary_search(const extension_entry_t *table, size_t table_sz, bool by_type,
+                                                              const unsigned char *key, size_t key_len) {
+                    size_t left  = 0;
+                    size_t right = table_sz;
+                    while (left < right) {
+                        size_t mid = left + ((right - left) >> 1);
+                        int    res = compare_lower(by_type ? table[mid].mime_type : table[mid].extension, key, key_len);
+                        if (0 == res) {
+                            return &table[mid];
+                        } else if (res < 0) {
+                            left = mid + 1;
+                        } else {
+                            right = mid;
+                        }
+                    }
+
+                    return NULL;
+                }
+
+                // copy into a buffer on stack in lower case, parameters after ';' and spaces are removed
+                static size_t make_lower_key(unsigned char *out, size_t out_sz, const char *in, size_t in_sz) {
+                    while (in_sz > 0 && (' ' == *in || '\t' == *in)) {
+                        ++in;
+                        --in_sz;
+                    }
+
+                    size_t ret = 0;
+                    for (size_t i = 0; i < in_sz && ';' != in[i]; ++i) {
+                        if (ret >= out_sz) {
+                            return 0;
+                        }
+                        out[ret++] = to_lower(static_cast<unsigned char>(in[i]));
+                    }
+
+                    while (ret > 0 && (' ' == out[ret - 1] || '\t' == out[ret - 1])) {
+                        --ret;
+                    }
+                    return ret;
+                }
+
+                static bool has_prefix(const unsigned char *key, size_t key_len, const char *prefix) {
+                    size_t prefix_len = strlen(prefix);
+                    return key_len >= prefix_len && 0 == memcmp(key, prefix, prefix_len);
+                }
+
+                static bool has_suffix(const unsigned char *key, size_t key_len, const char *suffix) {
+                    size_t suffix_len = strlen(suffix);
+                    return key_len >= suffix_len && 0 == memcmp(key + key_len - suffix_len, suffix, suffix_len);
+                }
+            } // namespace detail
+        }     // namespace http_content_type
+    }         // namespace network
+} // namespace util
+
+#include "http_content_type_table.h"
+
+namespace util {
+    namespace network {
+        namespace http_content_type {
+            LIBATFRAME_UTILS_API const char *get_mime_type_by_extension(const char *ext, size_t ext_sz) {
+                if (NULL == ext) {
+                    return NULL;
+                }
+
+                if (0 == ext_sz) {
+                    ext_sz = strlen(ext);
+                }
+                if (ext_sz > 0 && '.' == *ext) {
+                    ++ext;
+                    --ext_sz;
+                }
+
+                unsigned char key[detail::MAX_EXTENSION_LEN];
+                size_t        key_len = detail::make_lower_key(key, sizeof(key), ext, ext_sz);
+                if (0 == key_len) {
+                    return NULL;
+                }
+
+                const extension_entry_t *entry = detail::binary_search(
+                    detail::extension_table, sizeof(detail::extension_table) / sizeof(detail::extension_table[0]), false, key, key_len);
+                return NULL == entry ? NULL : entry->mime_type;
+            }
+
+            LIBATFRAME_UTILS_API const char *get_mime_type_by_path(const char *path, size_t path_sz, const char *default_type) {
+                if (NULL == path) {
+                    return default_type;
+                }
+
+                if (0 == path_sz) {
+                    path_sz = strlen(path);
+                }
+
+                // query and fragment of URL
+                size_t end = 0;
+                while (end < path_sz && '?' != path[end] && '#' != path[end]) {
+                    ++end;
+                }
+
+                size_t dot = end;
+                while (dot > 0) {
+                    char c = path[dot - 1];
+                    if ('.' == c || '/' == c || '\\' == c) {
+                        break;
+                    }
+                    --dot;
+                }
+                if (0 == dot || '.' != path[dot - 1] || dot >= end) {
+                    return default_type;
+                }
+
+                const char *ret = get_mime_type_by_extension(path + dot, end - dot);
+                return NULL == ret ? default_type : ret;
+            }
+
+            LIBATFRAME_UTILS_API const char *get_extension_by_mime_type(const char *mime_type, size_t mime_type_sz) {
+                if (NULL == mime_type) {
+                    return NULL;
+                }
+
+                if (0 == mime_type_sz) {
+                    mime_type_sz = strlen(mime_type);
+                }
+
+                unsigned char key[detail::MAX_MIME_TYPE_LEN];
+                size_t        key_len = detail::make_lower_key(key, sizeof(key), mime_type, mime_type_sz);
+                if (0 == key_len) {
+                    return NULL;
+                }
+
+                const extension_entry_t *entry = detail::binary_search(
+                    detail::type_table, sizeof(detail::type_table) / sizeof(detail::type_table[0]), true, key, key_len);
+                return NULL == entry ? NULL : entry->extension;
+            }
+
+            LIBATFRAME_UTILS_API bool is_text_mime_type(const char *mime_type, size_t mime_type_sz) {
+                if (NULL == mime_type) {
+                    return false;
+                }
+
+                if (0 == mime_type_sz) {
+                    mime_type_sz = strlen(mime_type);
+                }
+
+                unsigned char key[detail::MAX_MIME_TYPE_LEN];
+                size_t        key_len = detail::make_lower_key(key, sizeof(key), mime_type, mime_type_sz);
+                if (0 == key_len) {
+                    return false;
+                }
+
+                if (detail::has_prefix(key, key_len, "text/") || detail::has_suffix(key, key_len, "+json") ||
+                    detail::has_suffix(key, key_len, "+xml")) {
+                    return true;
+                }
+
+                static const char *text_types[] = {
+                    "application/json",       "application/xml",  "application/javascript", "application/ecmascript",
+                    "application/x-javascript", "application/yaml", "application/toml",
+                };
+                for (size_t i = 0; i < sizeof(text_types) / sizeof(text_types[0]); ++i) {
+                    if (0 == detail::compare_lower(text_types[i], key, key_len)) {
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            LIBATFRAME_UTILS_API const char *sniff_charset(const void *data, size_t sz) {
+                const unsigned char *p = reinterpret_cast<const unsigned char *>(data);
+                if (NULL == p) {
+                    return NULL;
+                }
+
+                // BOM, UTF-32 must be checked before UTF-16
+                if (sz >= 4 && 0x00 == p[0] && 0x00 == p[1] && 0xFE == p[2] && 0xFF == p[3]) {
+                    return "utf-32be";
+                }
+                if (sz >= 4 && 0xFF == p[0] && 0xFE == p[1] && 0x00 == p[2] && 0x00 == p[3]) {
+                    return "utf-32le";
+                }
+                if (sz >= 3 && 0xEF == p[0] && 0xBB == p[1] && 0xBF == p[2]) {
+                    return "utf-8";
+                }
+                if (sz >= 2 && 0xFE == p[0] && 0xFF == p[1]) {
+                    return "utf-16be";
+                }
+                if (sz >= 2 && 0xFF == p[0] && 0xFE == p[1]) {
+                    return "utf-16le";
+                }
+
+                bool is_ascii = true;
+                for (size_t i = 0; i < sz; ++i) {
+                    unsigned char c = p[i];
+                    if (c >= 0x80) {
+                        is_ascii = false;
+                    } else if (c < 0x20 && '\b' != c && '\t' != c && '\n' != c && '\f' != c && '\r' != c && 0x1B != c) {
+                        // control characters except \b \t \n \f \r and ESC mean binary data
+                        return NULL;
+                    }
+                }
+
+                if (is_ascii) {
+                    return "us-ascii";
+                }
+
+                // the sample may be cut in the middle of the last character, only its leading byte is checked then
+                const char *s        = reinterpret_cast<const char *>(p);
+                size_t      check_sz = sz;
+                size_t      last     = ::util::string::utf8_truncate(s, sz, sz - 1);
+                if (p[last] >= 0xC2 && p[last] <= 0xF4 && sz - last < ::util::string::utf8_char_t::length(s + last)) {
+                    check_sz = last;
+                }
+
+                return ::util::string::utf8_validate(s, check_sz) ? "utf-8" : NULL;
+            }
+
+            LIBATFRAME_UTILS_API const extension_entry_t *get_extension_table(size_t &sz) {
+                sz = sizeof(detail::extension_table) / sizeof(detail::extension_table[0]);
+                return detail::extension_table;
+            }
         } // namespace http_content_type
     }     // namespace network
 } // namespace util
@@ -0,0 +1,2761 @@
+// This file is generated by tools/gen_http_content_type_table.py, please don't edit it
+
+#ifndef UTILS_NETWORK_HTTP_CONTENT_TYPE_TABLE_H
+#define UTILS_NETWORK_HTTP_CONTENT_TYPE_TABLE_H
+
+#pragma once
+
+namespace util {
+    namespace network {
+        namespace http_content_type {
+            namespace detail {
+                // sorted by extension(lower case), for binary search
+                static const extension_entry_t extension_table[] = {
+                    {"%", 1, "application/x-trash"},
+                    {"123", 3, "application/vnd.lotus-1-2-3"},
+                    {"1905.1", 6, "application/vnd.ieee.1905"},
+                    {"1clr", 4, "application/clr"},
+                    {"1km", 3, "application/vnd.1000minds.decision-model+xml"},
+                    {"210", 3, "application/p21"},
+                    {"3dm", 3, "text/vnd.in3d.3dml"},
+                    {"3dml", 4, "text/vnd.in3d.3dml"},
+                    {"3mf", 3, "application/vnd.ms-3mfdocument"},
+                    {"3tz", 3, "application/vnd.maxar.archive.3tz+zip"},
+                    {"726", 3, "audio/32kadpcm"},
+                    {"7z", 2, "application/x-7z-compressed"},
+                    {"a", 1, "text/vnd.a"},
+                    {"a2l", 3, "application/A2L"},
+                    {"aa3", 3, "audio/ATRAC3"},
+                    {"aac", 3, "audio/aac"},
+                    {"aal", 3, "audio/ATRAC-ADVANCED-LOSSLESS"},
+                    {"abc", 3, "text/vnd.abc"},
+                    {"abw", 3, "application/x-abiword"},
+                    {"ac", 2, "application/pkix-attr-cert"},
+                    {"ac2", 3, "application/vnd.banana-accounting"},
+                    {"ac3", 3, "audio/ac3"},
+                    {"acc", 3, "application/vnd.americandynamics.acc"},
+                    {"acn", 3, "audio/asc"},
+                    {"acu", 3, "application/vnd.acucobol"},
+                    {"acutc", 5, "application/vnd.acucorp"},
+                    {"adts", 4, "audio/aac"},
+                    {"aep", 3, "application/vnd.audiograph"},
+                    {"afp", 3, "application/vnd.afpc.modca"},
+                    {"age", 3, "application/vnd.age"},
+                    {"ahead", 5, "application/vnd.ahead.space"},
+                    {"ai", 2, "application/postscript"},
+                    {"aif", 3, "audio/x-aiff"},
+                    {"aifc", 4, "audio/x-aiff"},
+                    {"aiff", 4, "audio/x-aiff"},
+                    {"aion", 4, "application/vnd.veritone.aion+json"},
+                    {"ait", 3, "application/vnd.dvb.ait"},
+                    {"alc", 3, "chemical/x-alchemy"},
+                    {"ami", 3, "application/vnd.amiga.ami"},
+                    {"aml", 3, "application/AML"},
+                    {"amlx", 4, "application/automationml-amlx+zip"},
+                    {"amr", 3, "audio/AMR"},
+                    {"anx", 3, "application/annodex"},
+                    {"apex", 4, "application/vnd.apexlang"},
+                    {"apexlang", 8, "application/vnd.apexlang"},
+                    {"apk", 3, "application/vnd.android.package-archive"},
+                    {"apkg", 4, "application/vnd.anki"},
+                    {"apng", 4, "image/apng"},
+                    {"appcache", 8, "text/cache-manifest"},
+                    {"apr", 3, "application/vnd.lotus-approach"},
+                    {"apxml", 5, "application/auth-policy+xml"},
+                    {"arrow", 5, "application/vnd.apache.arrow.file"},
+                    {"arrows", 6, "application/vnd.apache.arrow.stream"},
+                    {"art", 3, "image/x-jg"},
+                    {"artisan", 7, "application/vnd.artisan+json"},
+                    {"asc", 3, "application/pgp-keys"},
+                    {"ascii", 5, "text/vnd.ascii-art"},
+                    {"asf", 3, "application/vnd.ms-asf"},
+                    {"asice", 5, "application/vnd.etsi.asic-e+zip"},
+                    {"asics", 5, "application/vnd.etsi.asic-s+zip"},
+                    {"asn", 3, "chemical/x-ncbi-asn1"},
+                    {"aso", 3, "application/vnd.accpac.simply.aso"},
+                    {"ass", 3, "audio/aac"},
+                    {"at3", 3, "audio/ATRAC3"},
+                    {"atc", 3, "application/vnd.acucorp"},
+                    {"atf", 3, "application/ATF"},
+                    {"atfx", 4, "application/ATFX"},
+                    {"atom", 4, "application/atom+xml"},
+                    {"atomcat", 7, "application/atomcat+xml"},
+                    {"atomdeleted", 11, "application/atomdeleted+xml"},
+                    {"atomsrv", 7, "application/atomserv+xml"},
+                    {"atomsvc", 7, "application/atomsvc+xml"},
+                    {"atx", 3, "audio/ATRAC-X"},
+                    {"atxml", 5, "application/ATXML"},
+                    {"au", 2, "audio/basic"},
+                    {"auc", 3, "application/tamp-apex-update-confirm"},
+                    {"avci", 4, "image/avci"},
+                    {"avcs", 4, "image/avcs"},
+                    {"avi", 3, "video/x-msvideo"},
+                    {"avif", 4, "image/avif"},
+                    {"awb", 3, "audio/AMR-WB"},
+                    {"axa", 3, "audio/annodex"},
+                    {"axv", 3, "video/annodex"},
+                    {"azf", 3, "application/vnd.airzip.filesecure.azf"},
+                    {"azs", 3, "application/vnd.airzip.filesecure.azs"},
+                    {"azv", 3, "image/vnd.airzip.accelerator.azv"},
+                    {"azw3", 4, "application/vnd.amazon.mobi8-ebook"},
+                    {"b", 1, "chemical/x-molconn-Z"},
+                    {"b16", 3, "image/vnd.pco.b16"},
+                    {"bak", 3, "application/x-trash"},
+                    {"bar", 3, "application/vnd.qualcomm.brew-app-res"},
+                    {"bat", 3, "application/x-msdos-program"},
+                    {"bcpio", 5, "application/x-bcpio"},
+                    {"bdm", 3, "application/vnd.syncml.dm+wbxml"},
+                    {"bed", 3, "application/vnd.realvnc.bed"},
+                    {"bh2", 3, "application/vnd.fujitsu.oasysprs"},
+                    {"bib", 3, "text/x-bibtex"},
+                    {"bik", 3, "video/vnd.radgamettools.bink"},
+                    {"bin", 3, "application/octet-stream"},
+                    {"bk2", 3, "video/vnd.radgamettools.bink"},
+                    {"bkm", 3, "application/vnd.nervana"},
+                    {"bmed", 4, "multipart/vnd.bint.med-plus"},
+                    {"bmi", 3, "application/vnd.bmi"},
+                    {"bmml", 4, "application/vnd.balsamiq.bmml+xml"},
+                    {"bmp", 3, "image/bmp"},
+                    {"bmpr", 4, "application/vnd.balsamiq.bmpr"},
+                    {"boo", 3, "text/x-boo"},
+                    {"book", 4, "application/x-maker"},
+                    {"box", 3, "application/vnd.previewsystems.box"},
+                    {"bpd", 3, "application/vnd.hbci"},
+                    {"brf", 3, "text/plain"},
+                    {"bsd", 3, "chemical/x-crossfire"},
+                    {"bsp", 3, "model/vnd.valve.source.compiled-map"},
+                    {"btf", 3, "image/prs.btif"},
+                    {"btif", 4, "image/prs.btif"},
+                    {"c", 1, "text/x-csrc"},
+                    {"c++", 3, "text/x-c++src"},
+                    {"c11amc", 6, "application/vnd.cluetrust.cartomobile-config"},
+                    {"c11amz", 6, "application/vnd.cluetrust.cartomobile-config-pkg"},
+                    {"c3d", 3, "chemical/x-chem3d"},
+                    {"c3ex", 4, "application/cccex"},
+                    {"c4d", 3, "application/vnd.clonk.c4group"},
+                    {"c4f", 3, "application/vnd.clonk.c4group"},
+                    {"c4g", 3, "application/vnd.clonk.c4group"},
+                    {"c4p", 3, "application/vnd.clonk.c4group"},
+                    {"c4u", 3, "application/vnd.clonk.c4group"},
+                    {"c9r", 3, "application/vnd.cryptomator.encrypted"},
+                    {"c9s", 3, "application/vnd.cryptomator.encrypted"},
+                    {"cab", 3, "application/vnd.ms-cab-compressed"},
+                    {"cac", 3, "chemical/x-cache"},
+                    {"cache", 5, "chemical/x-cache"},
+                    {"cap", 3, "application/vnd.tcpdump.pcap"},
+                    {"car", 3, "application/vnd.ipld.car"},
+                    {"carjson", 7, "application/vnd.eu.kasparian.car+json"},
+                    {"cascii", 6, "chemical/x-cactvs-binary"},
+                    {"cat", 3, "application/vnd.ms-pki.seccat"},
+                    {"cbin", 4, "chemical/x-cactvs-binary"},
+                    {"cbor", 4, "application/cbor"},
+                    {"cbr", 3, "application/vnd.comicbook-rar"},
+                    {"cbz", 3, "application/vnd.comicbook+zip"},
+                    {"cc", 2, "text/x-c++src"},
+                    {"ccc", 3, "text/vnd.net2phone.commcenter.command"},
+                    {"ccmp", 4, "application/ccmp+xml"},
+                    {"ccxml", 5, "application/ccxml+xml"},
+                    {"cda", 3, "application/x-cdf"},
+                    {"cdbcmsg", 7, "application/vnd.contact.cmsg"},
+                    {"cdf", 3, "application/x-cdf"},
+                    {"cdfx", 4, "application/CDFX+XML"},
+                    {"cdkey", 5, "application/vnd.mediastation.cdkey"},
+                    {"cdmia", 5, "application/cdmi-capability"},
+                    {"cdmic", 5, "application/cdmi-container"},
+                    {"cdmid", 5, "application/cdmi-domain"},
+                    {"cdmio", 5, "application/cdmi-object"},
+                    {"cdmiq", 5, "application/cdmi-queue"},
+                    {"cdr", 3, "image/x-coreldraw"},
+                    {"cdt", 3, "image/x-coreldrawtemplate"},
+                    {"cdx", 3, "chemical/x-cdx"},
+                    {"cdxml", 5, "application/vnd.chemdraw+xml"},
+                    {"cdy", 3, "application/vnd.cinderella"},
+                    {"cea", 3, "application/CEA"},
+                    {"cef", 3, "chemical/x-cxf"},
+                    {"cellml", 6, "application/cellml+xml"},
+                    {"cer", 3, "application/pkix-cert"},
+                    {"cgm", 3, "image/cgm"},
+                    {"chm", 3, "application/vnd.ms-htmlhelp"},
+                    {"chrt", 4, "application/vnd.kde.kchart"},
+                    {"cif", 3, "application/vnd.multiad.creator.cif"},
+                    {"cii", 3, "application/vnd.anser-web-certificate-issue-initiation"},
+                    {"cil", 3, "application/vnd.ms-artgalry"},
+                    {"cl", 2, "application/simple-filter+xml"},
+                    {"cla", 3, "application/vnd.claymore"},
+                    {"class", 5, "application/java-vm"},
+                    {"cld", 3, "model/vnd.cld"},
+                    {"clkk", 4, "application/vnd.crick.clicker.keyboard"},
+                    {"clkp", 4, "application/vnd.crick.clicker.palette"},
+                    {"clkt", 4, "application/vnd.crick.clicker.template"},
+                    {"clkw", 4, "application/vnd.crick.clicker.wordbank"},
+                    {"clkx", 4, "application/vnd.crick.clicker"},
+                    {"cls", 3, "text/x-tex"},
+                    {"clue", 4, "application/clue_info+xml"},
+                    {"cmc", 3, "application/vnd.cosmocaller"},
+                    {"cmdf", 4, "chemical/x-cmdf"},
+                    {"cml", 3, "application/cellml+xml"},
+                    {"cmp", 3, "application/vnd.yellowriver-custom-menu"},
+                    {"cmsc", 4, "application/cms"},
+                    {"cnd", 3, "text/jcr-cnd"},
+                    {"cod", 3, "application/vnd.rim.cod"},
+                    {"coffee", 6, "application/vnd.coffeescript"},
+                    {"com", 3, "application/x-msdos-program"},
+                    {"copyright", 9, "text/vnd.debian.copyright"},
+                    {"coswid", 6, "application/swid+cbor"},
+                    {"cpa", 3, "chemical/x-compass"},
+                    {"cpio", 4, "application/x-cpio"},
+                    {"cpkg", 4, "application/vnd.xmpie.cpkg"},
+                    {"cpl", 3, "application/cpl+xml"},
+                    {"cpp", 3, "text/x-c++src"},
+                    {"cpt", 3, "application/mac-compactpro"},
+                    {"cql", 3, "text/cql"},
+                    {"cr2", 3, "image/x-canon-cr2"},
+                    {"crl", 3, "application/pkix-crl"},
+                    {"crt", 3, "application/x-x509-ca-cert"},
+                    {"crtr", 4, "application/vnd.multiad.creator"},
+                    {"crw", 3, "image/x-canon-crw"},
+                    {"cryptomator", 11, "application/vnd.cryptomator.vault"},
+                    {"cryptonote", 10, "application/vnd.rig.cryptonote"},
+                    {"csd", 3, "audio/csound"},
+                    {"csf", 3, "chemical/x-cache-csf"},
+                    {"csh", 3, "application/x-csh"},
+                    {"csl", 3, "application/vnd.citationstyles.style+xml"},
+                    {"csm", 3, "chemical/x-csml"},
+                    {"csml", 4, "chemical/x-csml"},
+                    {"csp", 3, "application/vnd.commonspace"},
+                    {"csrattrs", 8, "application/csrattrs"},
+                    {"css", 3, "text/css"},
+                    {"cst", 3, "application/vnd.commonspace"},
+                    {"csv", 3, "text/csv"},
+                    {"csvs", 4, "text/csv-schema"},
+                    {"ctab", 4, "chemical/x-cactvs-binary"},
+                    {"ctx", 3, "chemical/x-ctx"},
+                    {"cu", 2, "application/cu-seeme"},
+                    {"cub", 3, "chemical/x-gaussian-cube"},
+                    {"cuc", 3, "application/tamp-community-update-confirm"},
+                    {"curl", 4, "text/vnd.curl"},
+                    {"cw", 2, "application/prs.cww"},
+                    {"cwl", 3, "application/cwl"},
+                    {"cwl.json", 8, "application/cwl+json"},
+                    {"cww", 3, "application/prs.cww"},
+                    {"cxf", 3, "chemical/x-cxf"},
+                    {"cxx", 3, "text/x-c++src"},
+                    {"d", 1, "text/x-dsrc"},
+                    {"dae", 3, "model/vnd.collada+xml"},
+                    {"daf", 3, "application/vnd.Mobius.DAF"},
+                    {"dart", 4, "application/vnd.dart"},
+                    {"dataless", 8, "application/vnd.fdsn.seed"},
+                    {"davmount", 8, "application/davmount+xml"},
+                    {"dbf", 3, "application/vnd.dbf"},
+                    {"dcd", 3, "application/DCD"},
+                    {"dcm", 3, "application/dicom"},
+                    {"dcr", 3, "application/x-director"},
+                    {"dd2", 3, "application/vnd.oma.dd2+xml"},
+                    {"ddd", 3, "application/vnd.fujixerox.ddd"},
+                    {"ddeb", 4, "application/vnd.debian.binary-package"},
+                    {"ddf", 3, "application/vnd.syncml.dmddf+xml"},
+                    {"deb", 3, "application/vnd.debian.binary-package"},
+                    {"deploy", 6, "application/octet-stream"},
+                    {"dfac", 4, "application/vnd.dreamfactory"},
+                    {"dif", 3, "video/dv"},
+                    {"diff", 4, "text/x-diff"},
+                    {"dii", 3, "application/DII"},
+                    {"dim", 3, "application/vnd.fastcopy-disk-image"},
+                    {"dir", 3, "application/x-director"},
+                    {"dis", 3, "application/vnd.Mobius.DIS"},
+                    {"dist", 4, "application/vnd.apple.installer+xml"},
+                    {"distz", 5, "application/vnd.apple.installer+xml"},
+                    {"dit", 3, "application/DIT"},
+                    {"dive", 4, "application/vnd.patentdive"},
+                    {"djv", 3, "image/vnd.djvu"},
+                    {"djvu", 4, "image/vnd.djvu"},
+                    {"dl", 2, "application/vnd.datalog"},
+                    {"dll", 3, "application/x-msdos-program"},
+                    {"dls", 3, "audio/dls"},
+                    {"dmg", 3, "application/x-apple-diskimage"},
+                    {"dmp", 3, "application/vnd.tcpdump.pcap"},
+                    {"dms", 3, "text/vnd.DMClientScript"},
+                    {"dna", 3, "application/vnd.dna"},
+                    {"doc", 3, "application/msword"},
+                    {"docjson", 7, "application/vnd.document+json"},
+                    {"docm", 4, "application/vnd.ms-word.document.macroEnabled.12"},
+                    {"docx", 4, "application/vnd.openxmlformats-officedocument.wordprocessingml.document"},
+                    {"dor", 3, "model/vnd.gdl"},
+                    {"dot", 3, "text/vnd.graphviz"},
+                    {"dotm", 4, "application/vnd.ms-word.template.macroEnabled.12"},
+                    {"dotx", 4, "application/vnd.openxmlformats-officedocument.wordprocessingml.template"},
+                    {"dp", 2, "application/vnd.osgi.dp"},
+                    {"dpg", 3, "application/vnd.dpgraph"},
+                    {"dpgraph", 7, "application/vnd.dpgraph"},
+                    {"dpkg", 4, "application/vnd.xmpie.dpkg"},
+                    {"dpx", 3, "image/dpx"},
+                    {"drle", 4, "image/dicom-rle"},
+                    {"dsc", 3, "text/prs.lines.tag"},
+                    {"dsm", 3, "application/vnd.desmume.movie"},
+                    {"dssc", 4, "application/dssc+der"},
+                    {"dtd", 3, "application/xml-dtd"},
+                    {"dts", 3, "audio/vnd.dts"},
+                    {"dtshd", 5, "audio/vnd.dts.hd"},
+                    {"dv", 2, "video/dv"},
+                    {"dvb", 3, "video/vnd.dvb.file"},
+                    {"dvc", 3, "application/dvcs"},
+                    {"dvi", 3, "application/x-dvi"},
+                    {"dwd", 3, "application/atsc-dwd+xml"},
+                    {"dwf", 3, "model/vnd.dwf"},
+                    {"dwg", 3, "image/vnd.dwg"},
+                    {"dx", 2, "chemical/x-jcamp-dx"},
+                    {"dxf", 3, "image/vnd.dxf"},
+                    {"dxp", 3, "application/vnd.spotfire.dxp"},
+                    {"dxr", 3, "application/x-director"},
+                    {"dzr", 3, "application/vnd.dzr"},
+                    {"ebuild", 6, "application/vnd.gentoo.ebuild"},
+                    {"ecelp4800", 9, "audio/vnd.nuera.ecelp4800"},
+                    {"ecelp7470", 9, "audio/vnd.nuera.ecelp7470"},
+                    {"ecelp9600", 9, "audio/vnd.nuera.ecelp9600"},
+                    {"ecig", 4, "application/vnd.evolv.ecig.settings"},
+                    {"ecigprofile", 11, "application/vnd.evolv.ecig.profile"},
+                    {"ecigtheme", 9, "application/vnd.evolv.ecig.theme"},
+                    {"eclass", 6, "application/vnd.gentoo.eclass"},
+                    {"edm", 3, "application/vnd.novadigm.EDM"},
+                    {"edx", 3, "application/vnd.novadigm.EDX"},
+                    {"efi", 3, "application/efi"},
+                    {"efif", 4, "application/vnd.picsel"},
+                    {"ei6", 3, "application/vnd.pg.osasli"},
+                    {"eln", 3, "application/vnd.eln+zip"},
+                    {"emb", 3, "chemical/x-embl-dl-nucleotide"},
+                    {"embl", 4, "chemical/x-embl-dl-nucleotide"},
+                    {"emf", 3, "image/emf"},
+                    {"eml", 3, "message/rfc822"},
+                    {"emm", 3, "application/vnd.ibm.electronic-media"},
+                    {"emma", 4, "application/emma+xml"},
+                    {"emotionml", 9, "application/emotionml+xml"},
+                    {"ent", 3, "application/xml-external-parsed-entity"},
+                    {"entity", 6, "application/vnd.nervana"},
+                    {"enw", 3, "audio/EVRCNW"},
+                    {"eol", 3, "audio/vnd.digital-winds"},
+                    {"eot", 3, "application/vnd.ms-fontobject"},
+                    {"ep", 2, "application/vnd.bluetooth.ep.oob"},
+                    {"eps", 3, "application/postscript"},
+                    {"eps2", 4, "application/postscript"},
+                    {"eps3", 4, "application/postscript"},
+                    {"epsf", 4, "application/postscript"},
+                    {"epsi", 4, "application/postscript"},
+                    {"epub", 4, "application/epub+zip"},
+                    {"erf", 3, "image/x-epson-erf"},
+                    {"es", 2, "text/javascript"},
+                    {"es3", 3, "application/vnd.eszigno3+xml"},
+                    {"esa", 3, "application/vnd.osgi.subsystem"},
+                    {"esf", 3, "application/vnd.epson.esf"},
+                    {"espass", 6, "application/vnd.espass-espass+zip"},
+                    {"et3", 3, "application/vnd.eszigno3+xml"},
+                    {"etx", 3, "text/x-setext"},
+                    {"evb", 3, "audio/EVRCB"},
+                    {"evc", 3, "audio/EVRC"},
+                    {"evw", 3, "audio/EVRCWB"},
+                    {"exe", 3, "application/x-msdos-program"},
+                    {"exi", 3, "application/exi"},
+                    {"exp", 3, "application/express"},
+                    {"exr", 3, "image/aces"},
+                    {"ext", 3, "application/vnd.novadigm.EXT"},
+                    {"ez", 2, "application/andrew-inset"},
+                    {"ez2", 3, "application/vnd.ezpix-album"},
+                    {"ez3", 3, "application/vnd.ezpix-package"},
+                    {"fb", 2, "application/x-maker"},
+                    {"fbdoc", 5, "application/x-maker"},
+                    {"fbs", 3, "image/vnd.fastbidsheet"},
+                    {"fcdt", 4, "application/vnd.adobe.formscentral.fcdt"},
+                    {"fch", 3, "chemical/x-gaussian-checkpoint"},
+                    {"fchk", 4, "chemical/x-gaussian-checkpoint"},
+                    {"fcs", 3, "application/vnd.isac.fcs"},
+                    {"fdf", 3, "application/fdf"},
+                    {"fdt", 3, "application/fdt+xml"},
+                    {"fe_launch", 9, "application/vnd.denovo.fcselayout-link"},
+                    {"fg5", 3, "application/vnd.fujitsu.oasysgp"},
+                    {"fig", 3, "application/x-xfig"},
+                    {"finf", 4, "application/fastinfoset"},
+                    {"fit", 3, "image/fits"},
+                    {"fits", 4, "image/fits"},
+                    {"fla", 3, "application/vnd.dtg.local.flash"},
+                    {"flac", 4, "audio/flac"},
+                    {"flb", 3, "application/vnd.ficlab.flb+zip"},
+                    {"fli", 3, "video/fli"},
+                    {"flo", 3, "application/vnd.micrografx.flo"},
+                    {"flt", 3, "text/vnd.ficlab.flt"},
+                    {"flv", 3, "video/x-flv"},
+                    {"flw", 3, "application/vnd.kde.kivio"},
+                    {"flx", 3, "text/vnd.fmi.flexstor"},
+                    {"fly", 3, "text/vnd.fly"},
+                    {"fm", 2, "application/vnd.framemaker"},
+                    {"fo", 2, "application/vnd.software602.filler.form+xml"},
+                    {"fpx", 3, "image/vnd.fpx"},
+                    {"frame", 5, "application/x-maker"},
+                    {"frm", 3, "application/vnd.ufdl"},
+                    {"fsc", 3, "application/vnd.fsc.weblaunch"},
+                    {"fst", 3, "image/vnd.fst"},
+                    {"ftc", 3, "application/vnd.fluxtime.clip"},
+                    {"fti", 3, "application/vnd.anser-web-funds-transfer-initiation"},
+                    {"fts", 3, "image/fits"},
+                    {"fvt", 3, "video/vnd.fvt"},
+                    {"fxp", 3, "application/vnd.adobe.fxp"},
+                    {"fxpl", 4, "application/vnd.adobe.fxp"},
+                    {"fzs", 3, "application/vnd.fuzzysheet"},
+                    {"g2w", 3, "application/vnd.geoplan"},
+                    {"g3w", 3, "application/vnd.geospace"},
+                    {"gac", 3, "application/vnd.groove-account"},
+                    {"gal", 3, "chemical/x-gaussian-log"},
+                    {"gam", 3, "chemical/x-gamess-input"},
+                    {"gamin", 5, "chemical/x-gamess-input"},
+                    {"gan", 3, "application/x-ganttproject"},
+                    {"gau", 3, "chemical/x-gaussian-input"},
+                    {"gbr", 3, "application/rpki-ghostbusters"},
+                    {"gcd", 3, "text/x-pcs-gcd"},
+                    {"gcf", 3, "application/x-graphing-calculator"},
+                    {"gcg", 3, "chemical/x-gcg8-sequence"},
+                    {"gdl", 3, "model/vnd.gdl"},
+                    {"gdz", 3, "application/vnd.familysearch.gedcom+zip"},
+                    {"ged", 3, "text/vnd.familysearch.gedcom"},
+                    {"gen", 3, "chemical/x-genbank"},
+                    {"genozip", 7, "application/vnd.genozip"},
+                    {"geo", 3, "application/vnd.dynageo"},
+                    {"geojson", 7, "application/geo+json"},
+                    {"gex", 3, "application/vnd.geometry-explorer"},
+                    {"gf", 2, "application/x-tex-gf"},
+                    {"gff3", 4, "text/gff3"},
+                    {"ggb", 3, "application/vnd.geogebra.file"},
+                    {"ggs", 3, "application/vnd.geogebra.slides"},
+                    {"ggt", 3, "application/vnd.geogebra.tool"},
+                    {"ghf", 3, "application/vnd.groove-help"},
+                    {"gif", 3, "image/gif"},
+                    {"gim", 3, "application/vnd.groove-identity-message"},
+                    {"gjc", 3, "chemical/x-gaussian-input"},
+                    {"gjf", 3, "chemical/x-gaussian-input"},
+                    {"gl", 2, "video/gl"},
+                    {"glb", 3, "model/gltf-binary"},
+                    {"glbin", 5, "application/gltf-buffer"},
+                    {"glbuf", 5, "application/gltf-buffer"},
+                    {"gltf", 4, "model/gltf+json"},
+                    {"gml", 3, "application/gml+xml"},
+                    {"gnumeric", 8, "application/x-gnumeric"},
+                    {"gph", 3, "application/vnd.FloGraphIt"},
+                    {"gpkg", 4, "application/geopackage+sqlite3"},
+                    {"gpkg.tar", 8, "application/vnd.gentoo.gpkg"},
+                    {"gpt", 3, "chemical/x-mopac-graph"},
+                    {"gqf", 3, "application/vnd.grafeq"},
+                    {"gqs", 3, "application/vnd.grafeq"},
+                    {"gram", 4, "application/srgs"},
+                    {"grd", 3, "application/vnd.gentics.grd+json"},
+                    {"gre", 3, "application/vnd.geometry-explorer"},
+                    {"grv", 3, "application/vnd.groove-injector"},
+                    {"grxml", 5, "application/srgs+xml"},
+                    {"gsf", 3, "application/x-font"},
+                    {"gsheet", 6, "application/urc-grpsheet+xml"},
+                    {"gsm", 3, "audio/x-gsm"},
+                    {"gtar", 4, "application/x-gtar"},
+                    {"gtm", 3, "application/vnd.groove-tool-message"},
+                    {"gtw", 3, "model/vnd.gtw"},
+                    {"gv", 2, "text/vnd.graphviz"},
+                    {"gxt", 3, "application/vnd.geonext"},
+                    {"gz", 2, "application/gzip"},
+                    {"h", 1, "text/x-chdr"},
+                    {"h++", 3, "text/x-c++hdr"},
+                    {"hal", 3, "application/vnd.hal+xml"},
+                    {"hans", 4, "text/vnd.hans"},
+                    {"hbc", 3, "application/vnd.hbci"},
+                    {"hbci", 4, "application/vnd.hbci"},
+                    {"hdf", 3, "application/x-hdf"},
+                    {"hdr", 3, "image/vnd.radiance"},
+                    {"hdt", 3, "application/vnd.hdt"},
+                    {"heic", 4, "image/heic"},
+                    {"heics", 5, "image/heic-sequence"},
+                    {"heif", 4, "image/heif"},
+                    {"heifs", 5, "image/heif-sequence"},
+                    {"hej2", 4, "image/hej2k"},
+                    {"held", 4, "application/atsc-held+xml"},
+                    {"hgl", 3, "text/vnd.hgl"},
+                    {"hh", 2, "text/x-c++hdr"},
+                    {"hif", 3, "image/avif"},
+                    {"hin", 3, "chemical/x-hin"},
+                    {"hpgl", 4, "application/vnd.hp-HPGL"},
+                    {"hpi", 3, "application/vnd.hp-hpid"},
+                    {"hpid", 4, "application/vnd.hp-hpid"},
+                    {"hpp", 3, "text/x-c++hdr"},
+                    {"hps", 3, "application/vnd.hp-hps"},
+                    {"hpub", 4, "application/prs.hpub+zip"},
+                    {"hqx", 3, "application/mac-binhex40"},
+                    {"hs", 2, "text/x-haskell"},
+                    {"hsj2", 4, "image/hsj2"},
+                    {"hta", 3, "application/hta"},
+                    {"htc", 3, "text/x-component"},
+                    {"htke", 4, "application/vnd.kenameaapp"},
+                    {"htm", 3, "text/html"},
+                    {"html", 4, "text/html"},
+                    {"hvd", 3, "application/vnd.yamaha.hv-dic"},
+                    {"hvp", 3, "application/vnd.yamaha.hv-voice"},
+                    {"hvs", 3, "application/vnd.yamaha.hv-script"},
+                    {"hwp", 3, "application/x-hwp"},
+                    {"hxx", 3, "text/x-c++hdr"},
+                    {"i2g", 3, "application/vnd.intergeo"},
+                    {"ic0", 3, "application/vnd.commerce-battelle"},
+                    {"ic1", 3, "application/vnd.commerce-battelle"},
+                    {"ic2", 3, "application/vnd.commerce-battelle"},
+                    {"ic3", 3, "application/vnd.commerce-battelle"},
+                    {"ic4", 3, "application/vnd.commerce-battelle"},
+                    {"ic5", 3, "application/vnd.commerce-battelle"},
+                    {"ic6", 3, "application/vnd.commerce-battelle"},
+                    {"ic7", 3, "application/vnd.commerce-battelle"},
+                    {"ic8", 3, "application/vnd.commerce-battelle"},
+                    {"ica", 3, "application/x-ica"},
+                    {"icc", 3, "application/vnd.iccprofile"},
+                    {"icd", 3, "application/vnd.commerce-battelle"},
+                    {"icf", 3, "application/vnd.commerce-battelle"},
+                    {"icm", 3, "application/vnd.iccprofile"},
+                    {"ico", 3, "image/x-icon"},
+                    {"ics", 3, "text/calendar"},
+                    {"ief", 3, "image/ief"},
+                    {"ifb", 3, "text/calendar"},
+                    {"ifc", 3, "application/p21"},
+                    {"ifm", 3, "application/vnd.shana.informed.formdata"},
+                    {"iges", 4, "model/iges"},
+                    {"igl", 3, "application/vnd.igloader"},
+                    {"igm", 3, "application/vnd.insors.igm"},
+                    {"ign", 3, "application/vnd.coreos.ignition+json"},
+                    {"ignition", 8, "application/vnd.coreos.ignition+json"},
+                    {"igs", 3, "model/iges"},
+                    {"igx", 3, "application/vnd.micrografx.igx"},
+                    {"iif", 3, "application/vnd.shana.informed.interchange"},
+                    {"iii", 3, "application/x-iphone"},
+                    {"imf", 3, "application/vnd.imagemeter.folder+zip"},
+                    {"imgcal", 6, "application/vnd.3lightssoftware.imagescal"},
+                    {"imi", 3, "application/vnd.imagemeter.image+zip"},
+                    {"imp", 3, "application/vnd.accpac.simply.imp"},
+                    {"ims", 3, "application/vnd.ms-ims"},
+                    {"imscc", 5, "application/vnd.ims.imsccv1p1"},
+                    {"info", 4, "application/x-info"},
+                    {"ink", 3, "application/inkml+xml"},
+                    {"inkml", 5, "application/inkml+xml"},
+                    {"inp", 3, "chemical/x-gamess-input"},
+                    {"ins", 3, "application/x-internet-signup"},
+                    {"iota", 4, "application/vnd.astraea-software.iota"},
+                    {"ipfix", 5, "application/ipfix"},
+                    {"ipk", 3, "application/vnd.shana.informed.package"},
+                    {"irm", 3, "application/vnd.ibm.rights-management"},
+                    {"irp", 3, "application/vnd.irepository.package+xml"},
+                    {"ism", 3, "model/vnd.gdl"},
+                    {"iso", 3, "application/x-iso9660-image"},
+                    {"isp", 3, "application/x-internet-signup"},
+                    {"ist", 3, "chemical/x-isostar"},
+                    {"istc", 4, "application/vnd.veryant.thin"},
+                    {"istr", 4, "chemical/x-isostar"},
+                    {"isws", 4, "application/vnd.veryant.thin"},
+                    {"itp", 3, "application/vnd.shana.informed.formtemplate"},
+                    {"its", 3, "application/its+xml"},
+                    {"ivp", 3, "application/vnd.immervision-ivp"},
+                    {"ivu", 3, "application/vnd.immervision-ivu"},
+                    {"jad", 3, "text/vnd.sun.j2me.app-descriptor"},
+                    {"jam", 3, "application/vnd.jam"},
+                    {"jar", 3, "application/java-archive"},
+                    {"java", 4, "text/x-java"},
+                    {"jdx", 3, "chemical/x-jcamp-dx"},
+                    {"jfif", 4, "image/jpeg"},
+                    {"jhc", 3, "image/jphc"},
+                    {"jisp", 4, "application/vnd.jisp"},
+                    {"jls", 3, "image/jls"},
+                    {"jlt", 3, "application/vnd.hp-jlyt"},
+                    {"jmz", 3, "application/x-jmol"},
+                    {"jng", 3, "image/x-jng"},
+                    {"jnlp", 4, "application/x-java-jnlp-file"},
+                    {"joda", 4, "application/vnd.joost.joda-archive"},
+                    {"jp2", 3, "image/jp2"},
+                    {"jpe", 3, "image/jpeg"},
+                    {"jpeg", 4, "image/jpeg"},
+                    {"jpf", 3, "image/jpx"},
+                    {"jpg", 3, "image/jpeg"},
+                    {"jpg2", 4, "image/jp2"},
+                    {"jpgm", 4, "image/jpm"},
+                    {"jph", 3, "image/jph"},
+                    {"jphc", 4, "image/jphc"},
+                    {"jpm", 3, "image/jpm"},
+                    {"jpx", 3, "image/jpx"},
+                    {"jrd", 3, "application/jrd+json"},
+                    {"js", 2, "text/javascript"},
+                    {"json", 4, "application/json"},
+                    {"json-patch", 10, "application/json-patch+json"},
+                    {"jsonld", 6, "application/ld+json"},
+                    {"jsontd", 6, "application/td+json"},
+                    {"jsontm", 6, "application/tm+json"},
+                    {"jt", 2, "model/JT"},
+                    {"jtd", 3, "text/vnd.esmertec.theme-descriptor"},
+                    {"jxl", 3, "image/jxl"},
+                    {"jxr", 3, "image/jxr"},
+                    {"jxra", 4, "image/jxrA"},
+                    {"jxrs", 4, "image/jxrS"},
+                    {"jxs", 3, "image/jxs"},
+                    {"jxsc", 4, "image/jxsc"},
+                    {"jxsi", 4, "image/jxsi"},
+                    {"jxss", 4, "image/jxss"},
+                    {"karbon", 6, "application/vnd.kde.karbon"},
+                    {"kcm", 3, "application/vnd.nervana"},
+                    {"key", 3, "application/pgp-keys"},
+                    {"keynote", 7, "application/vnd.apple.keynote"},
+                    {"kfo", 3, "application/vnd.kde.kformula"},
+                    {"kia", 3, "application/vnd.kidspiration"},
+                    {"kil", 3, "application/x-killustrator"},
+                    {"kin", 3, "chemical/x-kinemage"},
+                    {"kml", 3, "application/vnd.google-earth.kml+xml"},
+                    {"kmz", 3, "application/vnd.google-earth.kmz"},
+                    {"kne", 3, "application/vnd.Kinar"},
+                    {"knp", 3, "application/vnd.Kinar"},
+                    {"kom", 3, "application/vnd.hbci"},
+                    {"kon", 3, "application/vnd.kde.kontour"},
+                    {"koz", 3, "audio/vnd.audiokoz"},
+                    {"kpr", 3, "application/vnd.kde.kpresenter"},
+                    {"kpt", 3, "application/vnd.kde.kpresenter"},
+                    {"ksp", 3, "application/vnd.kde.kspread"},
+                    {"ktr", 3, "application/vnd.kahootz"},
+                    {"ktx", 3, "image/ktx"},
+                    {"ktx2", 4, "image/ktx2"},
+                    {"ktz", 3, "application/vnd.kahootz"},
+                    {"kwd", 3, "application/vnd.kde.kword"},
+                    {"kwt", 3, "application/vnd.kde.kword"},
+                    {"l16", 3, "audio/L16"},
+                    {"las", 3, "application/vnd.las"},
+                    {"lasjson", 7, "application/vnd.las.las+json"},
+                    {"lasxml", 6, "application/vnd.las.las+xml"},
+                    {"latex", 5, "application/x-latex"},
+                    {"lbc", 3, "audio/iLBC"},
+                    {"lbd", 3, "application/vnd.llamagraphics.life-balance.desktop"},
+                    {"lbe", 3, "application/vnd.llamagraphics.life-balance.exchange+xml"},
+                    {"lca", 3, "application/vnd.logipipe.circuit+zip"},
+                    {"lcs", 3, "application/vnd.logipipe.circuit+zip"},
+                    {"le", 2, "application/vnd.bluetooth.le.oob"},
+                    {"les", 3, "application/vnd.hhe.lesson-player"},
+                    {"lgr", 3, "application/lgr+xml"},
+                    {"lha", 3, "application/x-lha"},
+                    {"lhs", 3, "text/x-literate-haskell"},
+                    {"lhzd", 4, "application/vnd.belightsoft.lhzd+zip"},
+                    {"lhzl", 4, "application/vnd.belightsoft.lhzl+zip"},
+                    {"lin", 3, "application/bbolin"},
+                    {"line", 4, "application/vnd.nebumind.line"},
+                    {"link66", 6, "application/vnd.route66.link66+xml"},
+                    {"list3820", 8, "application/vnd.afpc.modca"},
+                    {"listafp", 7, "application/vnd.afpc.modca"},
+                    {"lmp", 3, "model/vnd.gdl"},
+                    {"loas", 4, "audio/usac"},
+                    {"loom", 4, "application/vnd.loom"},
+                    {"lostsyncxml", 11, "application/lostsync+xml"},
+                    {"lostxml", 7, "application/lost+xml"},
+                    {"lpf", 3, "application/lpf+zip"},
+                    {"lrm", 3, "application/vnd.ms-lrm"},
+                    {"lsf", 3, "video/x-la-asf"},
+                    {"lsx", 3, "video/x-la-asf"},
+                    {"ltx", 3, "text/x-tex"},
+                    {"lvp", 3, "audio/vnd.lucent.voice"},
+                    {"lwp", 3, "application/vnd.lotus-wordpro"},
+                    {"lxf", 3, "application/LXF"},
+                    {"ly", 2, "text/x-lilypond"},
+                    {"lyx", 3, "application/x-lyx"},
+                    {"lzh", 3, "application/x-lzh"},
+                    {"lzx", 3, "application/x-lzx"},
+                    {"m", 1, "application/vnd.wolfram.mathematica.package"},
+                    {"m1v", 3, "video/mpeg"},
+                    {"m21", 3, "application/mp21"},
+                    {"m2v", 3, "video/mpeg"},
+                    {"m3g", 3, "application/m3g"},
+                    {"m3u", 3, "audio/mpegurl"},
+                    {"m3u8", 4, "application/vnd.apple.mpegurl"},
+                    {"m4a", 3, "audio/mp4"},
+                    {"m4s", 3, "video/iso.segment"},
+                    {"m4u", 3, "video/vnd.mpegurl"},
+                    {"m4v", 3, "video/mp4"},
+                    {"ma", 2, "application/mathematica"},
+                    {"mads", 4, "application/mads+xml"},
+                    {"maei", 4, "application/mmt-aei+xml"},
+                    {"mag", 3, "application/vnd.ecowin.chart"},
+                    {"mail", 4, "message/rfc822"},
+                    {"maker", 5, "application/x-maker"},
+                    {"man", 3, "application/x-troff-man"},
+                    {"manifest", 8, "text/cache-manifest"},
+                    {"map", 3, "application/json"},
+                    {"markdown", 8, "text/markdown"},
+                    {"mb", 2, "application/mathematica"},
+                    {"mbk", 3, "application/vnd.Mobius.MBK"},
+                    {"mbox", 4, "application/mbox"},
+                    {"mc1", 3, "application/vnd.medcalcdata"},
+                    {"mc2", 3, "text/vnd.senx.warpscript"},
+                    {"mcd", 3, "application/vnd.mcd"},
+                    {"mcif", 4, "chemical/x-mmcif"},
+                    {"mcm", 3, "chemical/x-macmolecule"},
+                    {"md", 2, "text/markdown"},
+                    {"mdb", 3, "application/msaccess"},
+                    {"mdc", 3, "application/vnd.marlin.drm.mdcf"},
+                    {"mdi", 3, "image/vnd.ms-modi"},
+                    {"me", 2, "application/x-troff-me"},
+                    {"mesh", 4, "model/mesh"},
+                    {"meta4", 5, "application/metalink4+xml"},
+                    {"mets", 4, "application/mets+xml"},
+                    {"mf4", 3, "application/MF4"},
+                    {"mfm", 3, "application/vnd.mfmp"},
+                    {"mft", 3, "application/rpki-manifest"},
+                    {"mgp", 3, "application/vnd.osgeo.mapguide.package"},
+                    {"mgz", 3, "application/vnd.proteus.magazine"},
+                    {"mhas", 4, "audio/mhas"},
+                    {"mid", 3, "audio/sp-midi"},
+                    {"mif", 3, "application/vnd.mif"},
+                    {"miz", 3, "text/mizar"},
+                    {"mj2", 3, "video/mj2"},
+                    {"mjp2", 4, "video/mj2"},
+                    {"mjs", 3, "text/javascript"},
+                    {"mkv", 3, "video/x-matroska"},
+                    {"ml2", 3, "application/vnd.sybyl.mol2"},
+                    {"mlp", 3, "audio/vnd.dolby.mlp"},
+                    {"mm", 2, "application/x-freemind"},
+                    {"mmd", 3, "application/vnd.chipnuts.karaoke-mmd"},
+                    {"mmdb", 4, "application/vnd.maxmind.maxmind-db"},
+                    {"mmf", 3, "application/vnd.smaf"},
+                    {"mml", 3, "application/mathml+xml"},
+                    {"mmod", 4, "chemical/x-macromodel-input"},
+                    {"mmr", 3, "image/vnd.fujixerox.edmics-mmr"},
+                    {"mng", 3, "video/x-mng"},
+                    {"moc", 3, "text/x-moc"},
+                    {"mod", 3, "application/xml-dtd"},
+                    {"model-inter", 11, "application/vnd.vd-study"},
+                    {"mods", 4, "application/mods+xml"},
+                    {"mol", 3, "chemical/x-mdl-molfile"},
+                    {"mol2", 4, "application/vnd.sybyl.mol2"},
+                    {"moml", 4, "model/vnd.moml+xml"},
+                    {"moo", 3, "chemical/x-mopac-out"},
+                    {"mop", 3, "chemical/x-mopac-input"},
+                    {"mopcrt", 6, "chemical/x-mopac-input"},
+                    {"mov", 3, "video/quicktime"},
+                    {"movie", 5, "video/x-sgi-movie"},
+                    {"mp1", 3, "audio/mpeg"},
+                    {"mp2", 3, "audio/mpeg"},
+                    {"mp21", 4, "application/mp21"},
+                    {"mp3", 3, "audio/mpeg"},
+                    {"mp4", 3, "video/mp4"},
+                    {"mpc", 3, "application/vnd.mophun.certificate"},
+                    {"mpd", 3, "application/dash+xml"},
+                    {"mpdd", 4, "application/dashdelta"},
+                    {"mpe", 3, "video/mpeg"},
+                    {"mpeg", 4, "video/mpeg"},
+                    {"mpega", 5, "audio/mpeg"},
+                    {"mpf", 3, "text/vnd.ms-mediapackage"},
+                    {"mpg", 3, "video/mpeg"},
+                    {"mpg4", 4, "video/mp4"},
+                    {"mpga", 4, "audio/mpeg"},
+                    {"mph", 3, "application/x-comsol"},
+                    {"mpkg", 4, "application/vnd.apple.installer+xml"},
+                    {"mpm", 3, "application/vnd.blueice.multipass"},
+                    {"mpn", 3, "application/vnd.mophun.application"},
+                    {"mpp", 3, "application/vnd.ms-project"},
+                    {"mpt", 3, "application/vnd.ms-project"},
+                    {"mpv", 3, "video/x-matroska"},
+                    {"mpw", 3, "application/vnd.exstream-empower+zip"},
+                    {"mpy", 3, "application/vnd.ibm.MiniPay"},
+                    {"mqy", 3, "application/vnd.Mobius.MQY"},
+                    {"mrc", 3, "application/marc"},
+                    {"mrcx", 4, "application/marcxml+xml"},
+                    {"ms", 2, "application/x-troff-ms"},
+                    {"msa", 3, "application/vnd.msa-disk-image"},
+                    {"msd", 3, "application/vnd.fdsn.mseed"},
+                    {"mseed", 5, "application/vnd.fdsn.mseed"},
+                    {"mseq", 4, "application/vnd.mseq"},
+                    {"msf", 3, "application/vnd.epson.msf"},
+                    {"msh", 3, "model/mesh"},
+                    {"msi", 3, "application/x-msi"},
+                    {"msl", 3, "application/vnd.Mobius.MSL"},
+                    {"msm", 3, "model/vnd.gdl"},
+                    {"msp", 3, "application/octet-stream"},
+                    {"msty", 4, "application/vnd.muvee.style"},
+                    {"msu", 3, "application/octet-stream"},
+                    {"mtl", 3, "model/mtl"},
+                    {"mts", 3, "model/vnd.mts"},
+                    {"multitrack", 10, "audio/vnd.presonus.multitrack"},
+                    {"mus", 3, "application/vnd.musician"},
+                    {"musd", 4, "application/mmt-usd+xml"},
+                    {"mvb", 3, "chemical/x-mopac-vib"},
+                    {"mvt", 3, "application/vnd.mapbox-vector-tile"},
+                    {"mwc", 3, "application/vnd.dpgraph"},
+                    {"mwf", 3, "application/vnd.MFER"},
+                    {"mxf", 3, "application/mxf"},
+                    {"mxi", 3, "application/vnd.vd-study"},
+                    {"mxl", 3, "application/vnd.recordare.musicxml"},
+                    {"mxmf", 4, "audio/mobile-xmf"},
+                    {"mxml", 4, "application/xv+xml"},
+                    {"mxs", 3, "application/vnd.triscape.mxs"},
+                    {"mxu", 3, "video/vnd.mpegurl"},
+                    {"n3", 2, "text/n3"},
+                    {"nb", 2, "application/vnd.wolfram.mathematica"},
+                    {"nbp", 3, "application/vnd.wolfram.player"},
+                    {"nc", 2, "application/x-netcdf"},
+                    {"ndc", 3, "application/vnd.osa.netdeploy"},
+                    {"ndl", 3, "application/vnd.lotus-notes"},
+                    {"nds", 3, "application/vnd.nintendo.nitro.rom"},
+                    {"nebul", 5, "application/vnd.nebumind.line"},
+                    {"nef", 3, "image/x-nikon-nef"},
+                    {"ngdat", 5, "application/vnd.nokia.n-gage.data"},
+                    {"nim", 3, "video/vnd.nokia.interleaved-multimedia"},
+                    {"nimn", 4, "application/vnd.nimn"},
+                    {"nitf", 4, "application/vnd.nitf"},
+                    {"nlu", 3, "application/vnd.neurolanguage.nlu"},
+                    {"nml", 3, "application/vnd.enliven"},
+                    {"nnd", 3, "application/vnd.noblenet-directory"},
+                    {"nns", 3, "application/vnd.noblenet-sealer"},
+                    {"nnw", 3, "application/vnd.noblenet-web"},
+                    {"notebook", 8, "application/vnd.smart.notebook"},
+                    {"nq", 2, "application/n-quads"},
+                    {"ns2", 3, "application/vnd.lotus-notes"},
+                    {"ns3", 3, "application/vnd.lotus-notes"},
+                    {"ns4", 3, "application/vnd.lotus-notes"},
+                    {"nsf", 3, "application/vnd.lotus-notes"},
+                    {"nsg", 3, "application/vnd.lotus-notes"},
+                    {"nsh", 3, "application/vnd.lotus-notes"},
+                    {"nt", 2, "application/n-triples"},
+                    {"ntf", 3, "application/vnd.lotus-notes"},
+                    {"numbers", 7, "application/vnd.apple.numbers"},
+                    {"nwc", 3, "application/x-nwc"},
+                    {"o", 1, "application/x-object"},
+                    {"oa2", 3, "application/vnd.fujitsu.oasys2"},
+                    {"oa3", 3, "application/vnd.fujitsu.oasys3"},
+                    {"oas", 3, "application/vnd.fujitsu.oasys"},
+                    {"obg", 3, "application/vnd.openblox.game-binary"},
+                    {"obgx", 4, "application/vnd.openblox.game+xml"},
+                    {"obj", 3, "model/obj"},
+                    {"oda", 3, "application/ODA"},
+                    {"odb", 3, "application/vnd.oasis.opendocument.base"},
+                    {"odc", 3, "application/vnd.oasis.opendocument.chart"},
+                    {"odd", 3, "application/tei+xml"},
+                    {"odf", 3, "application/vnd.oasis.opendocument.formula"},
+                    {"odg", 3, "application/vnd.oasis.opendocument.graphics"},
+                    {"odi", 3, "application/vnd.oasis.opendocument.image"},
+                    {"odm", 3, "application/vnd.oasis.opendocument.text-master"},
+                    {"odp", 3, "application/vnd.oasis.opendocument.presentation"},
+                    {"ods", 3, "application/vnd.oasis.opendocument.spreadsheet"},
+                    {"odt", 3, "application/vnd.oasis.opendocument.text"},
+                    {"odx", 3, "application/ODX"},
+                    {"oeb", 3, "application/vnd.openeye.oeb"},
+                    {"oga", 3, "audio/ogg"},
+                    {"ogex", 4, "model/vnd.opengex"},
+                    {"ogg", 3, "audio/ogg"},
+                    {"ogv", 3, "video/ogg"},
+                    {"ogx", 3, "application/ogg"},
+                    {"old", 3, "application/x-trash"},
+                    {"omg", 3, "audio/ATRAC3"},
+                    {"one", 3, "application/onenote"},
+                    {"onepkg", 6, "application/onenote"},
+                    {"onetmp", 6, "application/onenote"},
+                    {"onetoc2", 7, "application/onenote"},
+                    {"opf", 3, "application/oebps-package+xml"},
+                    {"oprc", 4, "application/vnd.palm"},
+                    {"opus", 4, "audio/ogg"},
+                    {"or2", 3, "application/vnd.lotus-organizer"},
+                    {"or3", 3, "application/vnd.lotus-organizer"},
+                    {"orc", 3, "audio/csound"},
+                    {"orf", 3, "image/x-olympus-orf"},
+                    {"org", 3, "application/vnd.lotus-organizer"},
+                    {"orq", 3, "application/ocsp-request"},
+                    {"ors", 3, "application/ocsp-response"},
+                    {"osf", 3, "application/vnd.yamaha.openscoreformat"},
+                    {"osm", 3, "application/vnd.openstreetmap.data+xml"},
+                    {"ota", 3, "application/vnd.android.ota"},
+                    {"otc", 3, "application/vnd.oasis.opendocument.chart-template"},
+                    {"otf", 3, "font/otf"},
+                    {"otg", 3, "application/vnd.oasis.opendocument.graphics-template"},
+                    {"oth", 3, "application/vnd.oasis.opendocument.text-web"},
+                    {"oti", 3, "application/vnd.oasis.opendocument.image-template"},
+                    {"otp", 3, "application/vnd.oasis.opendocument.presentation-template"},
+                    {"ots", 3, "application/vnd.oasis.opendocument.spreadsheet-template"},
+                    {"ott", 3, "application/vnd.oasis.opendocument.text-template"},
+                    {"ovl", 3, "application/vnd.afpc.modca-overlay"},
+                    {"oxlicg", 6, "application/vnd.oxli.countgraph"},
+                    {"oxps", 4, "application/oxps"},
+                    {"oxt", 3, "application/vnd.openofficeorg.extension"},
+                    {"oza", 3, "application/x-oz-application"},
+                    {"p", 1, "text/x-pascal"},
+                    {"p10", 3, "application/pkcs10"},
+                    {"p12", 3, "application/pkcs12"},
+                    {"p21", 3, "application/p21"},
+                    {"p2p", 3, "application/vnd.wfa.p2p"},
+                    {"p7c", 3, "application/pkcs7-mime"},
+                    {"p7m", 3, "application/pkcs7-mime"},
+                    {"p7r", 3, "application/x-pkcs7-certreqresp"},
+                    {"p7s", 3, "application/pkcs7-signature"},
+                    {"p7z", 3, "application/pkcs7-mime"},
+                    {"p8", 2, "application/pkcs8"},
+                    {"p8e", 3, "application/pkcs8-encrypted"},
+                    {"pac", 3, "application/x-ns-proxy-autoconfig"},
+                    {"package", 7, "application/vnd.autopackage"},
+                    {"pages", 5, "application/vnd.apple.pages"},
+                    {"pas", 3, "text/x-pascal"},
+                    {"pat", 3, "image/x-coreldrawpattern"},
+                    {"patch", 5, "text/x-diff"},
+                    {"paw", 3, "application/vnd.pawaafile"},
+                    {"pbd", 3, "application/vnd.powerbuilder6"},
+                    {"pbm", 3, "image/x-portable-bitmap"},
+                    {"pcap", 4, "application/vnd.tcpdump.pcap"},
+                    {"pcf", 3, "application/x-font-pcf"},
+                    {"pcf.z", 5, "application/x-font-pcf"},
+                    {"pcl", 3, "application/vnd.hp-PCL"},
+                    {"pcx", 3, "image/vnd.zbrush.pcx"},
+                    {"pdb", 3, "application/vnd.palm"},
+                    {"pdf", 3, "application/pdf"},
+                    {"pdx", 3, "application/PDX"},
+                    {"pem", 3, "application/pem-certificate-chain"},
+                    {"pfa", 3, "application/x-font"},
+                    {"pfb", 3, "application/x-font"},
+                    {"pfr", 3, "application/font-tdpfr"},
+                    {"pfx", 3, "application/pkcs12"},
+                    {"pgb", 3, "image/vnd.globalgraphics.pgb"},
+                    {"pgm", 3, "image/x-portable-graymap"},
+                    {"pgn", 3, "application/vnd.chess-pgn"},
+                    {"pgp", 3, "application/pgp-encrypted"},
+                    {"pil", 3, "application/vnd.piaccess.application-licence"},
+                    {"pk", 2, "application/x-tex-pk"},
+                    {"pkd", 3, "application/vnd.hbci"},
+                    {"pkg", 3, "application/vnd.apple.installer+xml"},
+                    {"pki", 3, "application/pkixcmp"},
+                    {"pkipath", 7, "application/pkix-pkipath"},
+                    {"pl", 2, "text/x-perl"},
+                    {"plb", 3, "application/vnd.3gpp.pic-bw-large"},
+                    {"plc", 3, "application/vnd.Mobius.PLC"},
+                    {"plf", 3, "application/vnd.pocketlearn"},
+                    {"plj", 3, "audio/vnd.everad.plj"},
+                    {"plp", 3, "application/vnd.panoply"},
+                    {"pls", 3, "audio/x-scpls"},
+                    {"pm", 2, "text/x-perl"},
+                    {"pml", 3, "application/vnd.ctc-posml"},
+                    {"png", 3, "image/png"},
+                    {"pnm", 3, "image/x-portable-anymap"},
+                    {"portpkg", 7, "application/vnd.macports.portpkg"},
+                    {"pot", 3, "text/plain"},
+                    {"potm", 4, "application/vnd.ms-powerpoint.template.macroEnabled.12"},
+                    {"potx", 4, "application/vnd.openxmlformats-officedocument.presentationml.template"},
+                    {"ppam", 4, "application/vnd.ms-powerpoint.addin.macroEnabled.12"},
+                    {"ppd", 3, "application/vnd.cups-ppd"},
+                    {"ppkg", 4, "application/vnd.xmpie.ppkg"},
+                    {"ppm", 3, "image/x-portable-pixmap"},
+                    {"pps", 3, "application/vnd.ms-powerpoint"},
+                    {"ppsm", 4, "application/vnd.ms-powerpoint.slideshow.macroEnabled.12"},
+                    {"ppsx", 4, "application/vnd.openxmlformats-officedocument.presentationml.slideshow"},
+                    {"ppt", 3, "application/vnd.ms-powerpoint"},
+                    {"pptm", 4, "application/vnd.ms-powerpoint.presentation.macroEnabled.12"},
+                    {"ppttc", 5, "application/vnd.think-cell.ppttc+json"},
+                    {"pptx", 4, "application/vnd.openxmlformats-officedocument.presentationml.presentation"},
+                    {"pqa", 3, "application/vnd.palm"},
+                    {"prc", 3, "model/prc"},
+                    {"pre", 3, "application/vnd.lotus-freelance"},
+                    {"preminet", 8, "application/vnd.preminet"},
+                    {"prf", 3, "application/pics-rules"},
+                    {"provn", 5, "text/provenance-notation"},
+                    {"provx", 5, "application/provenance+xml"},
+                    {"prt", 3, "chemical/x-ncbi-asn1-ascii"},
+                    {"prz", 3, "application/vnd.lotus-freelance"},
+                    {"ps", 2, "application/postscript"},
+                    {"psb", 3, "application/vnd.3gpp.pic-bw-small"},
+                    {"psd", 3, "image/vnd.adobe.photoshop"},
+                    {"pseg3820", 8, "application/vnd.afpc.modca"},
+                    {"psfs", 4, "application/vnd.psfs"},
+                    {"psg", 3, "application/vnd.afpc.modca-pagesegment"},
+                    {"psid", 4, "audio/prs.sid"},
+                    {"pskcxml", 7, "application/pskc+xml"},
+                    {"pt", 2, "application/vnd.snesdev-page-table"},
+                    {"pti", 3, "image/prs.pti"},
+                    {"ptid", 4, "application/vnd.pvi.ptid1"},
+                    {"ptrom", 5, "application/vnd.snesdev-page-table"},
+                    {"pub", 3, "application/vnd.exstream-package"},
+                    {"pvb", 3, "application/vnd.3gpp.pic-bw-var"},
+                    {"pwn", 3, "application/vnd.3M.Post-it-Notes"},
+                    {"py", 2, "text/x-python"},
+                    {"pya", 3, "audio/vnd.ms-playready.media.pya"},
+                    {"pyc", 3, "application/x-python-code"},
+                    {"pyo", 3, "application/x-python-code"},
+                    {"pyox", 4, "model/vnd.pytha.pyox"},
+                    {"pyv", 3, "video/vnd.ms-playready.media.pyv"},
+                    {"qam", 3, "application/vnd.epson.quickanime"},
+                    {"qbo", 3, "application/vnd.intu.qbo"},
+                    {"qca", 3, "application/vnd.ericsson.quickcall"},
+                    {"qcall", 5, "application/vnd.ericsson.quickcall"},
+                    {"qcp", 3, "audio/EVRC-QCP"},
+                    {"qfx", 3, "application/vnd.intu.qfx"},
+                    {"qgs", 3, "application/x-qgis"},
+                    {"qps", 3, "application/vnd.publishare-delta-tree"},
+                    {"qt", 2, "video/quicktime"},
+                    {"qtl", 3, "application/x-quicktimeplayer"},
+                    {"quiz", 4, "application/vnd.quobject-quoxdocument"},
+                    {"quox", 4, "application/vnd.quobject-quoxdocument"},
+                    {"qvd", 3, "application/vnd.theqvd"},
+                    {"qwd", 3, "application/vnd.Quark.QuarkXPress"},
+                    {"qwt", 3, "application/vnd.Quark.QuarkXPress"},
+                    {"qxb", 3, "application/vnd.Quark.QuarkXPress"},
+                    {"qxd", 3, "application/vnd.Quark.QuarkXPress"},
+                    {"qxl", 3, "application/vnd.Quark.QuarkXPress"},
+                    {"qxt", 3, "application/vnd.Quark.QuarkXPress"},
+                    {"ra", 2, "audio/x-pn-realaudio"},
+                    {"ram", 3, "audio/x-pn-realaudio"},
+                    {"rapd", 4, "application/route-apd+xml"},
+                    {"rar", 3, "application/vnd.rar"},
+                    {"ras", 3, "image/x-cmu-raster"},
+                    {"rb", 2, "application/x-ruby"},
+                    {"rcprofile", 9, "application/vnd.ipunplugged.rcprofile"},
+                    {"rct", 3, "application/prs.nprend"},
+                    {"rd", 2, "chemical/x-mdl-rdfile"},
+                    {"rdf", 3, "application/rdf+xml"},
+                    {"rdf-crypt", 9, "application/prs.rdf-xml-crypt"},
+                    {"rdp", 3, "application/x-rdp"},
+                    {"rdz", 3, "application/vnd.data-vision.rdz"},
+                    {"relo", 4, "application/p2p-overlay+xml"},
+                    {"reload", 6, "application/vnd.resilient.logic"},
+                    {"rep", 3, "application/vnd.businessobjects"},
+                    {"request", 7, "application/vnd.nervana"},
+                    {"rfcxml", 6, "application/rfc+xml"},
+                    {"rgb", 3, "image/x-rgb"},
+                    {"rgbe", 4, "image/vnd.radiance"},
+                    {"rif", 3, "application/reginfo+xml"},
+                    {"rip", 3, "audio/vnd.rip"},
+                    {"rl", 2, "application/resource-lists+xml"},
+                    {"rlc", 3, "image/vnd.fujixerox.edmics-rlc"},
+                    {"rld", 3, "application/resource-lists-diff+xml"},
+                    {"rlm", 3, "application/vnd.resilient.logic"},
+                    {"rm", 2, "audio/x-pn-realaudio"},
+                    {"rms", 3, "application/vnd.jcp.javame.midlet-rms"},
+                    {"rnc", 3, "application/relax-ng-compact-syntax"},
+                    {"rnd", 3, "application/prs.nprend"},
+                    {"roa", 3, "application/rpki-roa"},
+                    {"roff", 4, "text/troff"},
+                    {"ros", 3, "chemical/x-rosdal"},
+                    {"rp9", 3, "application/vnd.cloanto.rp9"},
+                    {"rpm", 3, "application/x-redhat-package-manager"},
+                    {"rpss", 4, "application/vnd.nokia.radio-presets"},
+                    {"rpst", 4, "application/vnd.nokia.radio-preset"},
+                    {"rq", 2, "application/sparql-query"},
+                    {"rs", 2, "application/rls-services+xml"},
+                    {"rsat", 4, "application/atsc-rsat+xml"},
+                    {"rsheet", 6, "application/urc-ressheet+xml"},
+                    {"rsm", 3, "model/vnd.gdl"},
+                    {"rss", 3, "application/x-rss+xml"},
+                    {"rst", 3, "text/prs.fallenstein.rst"},
+                    {"rtf", 3, "application/rtf"},
+                    {"rusd", 4, "application/route-usd+xml"},
+                    {"rxn", 3, "chemical/x-mdl-rxnfile"},
+                    {"rxt", 3, "application/vnd.medicalholodeck.recordxr"},
+                    {"s11", 3, "video/vnd.sealed.mpeg1"},
+                    {"s14", 3, "video/vnd.sealed.mpeg4"},
+                    {"s1a", 3, "application/vnd.sealedmedia.softseal.pdf"},
+                    {"s1e", 3, "application/vnd.sealed.xls"},
+                    {"s1g", 3, "image/vnd.sealedmedia.softseal.gif"},
+                    {"s1h", 3, "application/vnd.sealedmedia.softseal.html"},
+                    {"s1j", 3, "image/vnd.sealedmedia.softseal.jpg"},
+                    {"s1m", 3, "audio/vnd.sealedmedia.softseal.mpeg"},
+                    {"s1n", 3, "image/vnd.sealed.png"},
+                    {"s1p", 3, "application/vnd.sealed.ppt"},
+                    {"s1q", 3, "video/vnd.sealedmedia.softseal.mov"},
+                    {"s1w", 3, "application/vnd.sealed.doc"},
+                    {"s3df", 4, "application/vnd.sealed.3df"},
+                    {"sac", 3, "application/tamp-sequence-adjust-confirm"},
+                    {"saf", 3, "application/vnd.yamaha.smaf-audio"},
+                    {"sam", 3, "application/vnd.lotus-wordpro"},
+                    {"sar", 3, "application/vnd.sar"},
+                    {"sarif", 5, "application/sarif+json"},
+                    {"sarif-external-properties", 25, "application/sarif-external-properties+json"},
+                    {"sarif-external-properties.json", 30, "application/sarif-external-properties+json"},
+                    {"sarif.json", 10, "application/sarif+json"},
+                    {"sc", 2, "application/vnd.ibm.secure-container"},
+                    {"scala", 5, "text/x-scala"},
+                    {"scd", 3, "application/vnd.scribus"},
+                    {"sce", 3, "application/vnd.etsi.asic-e+zip"},
+                    {"sci", 3, "application/x-scilab"},
+                    {"scim", 4, "application/scim+json"},
+                    {"scl", 3, "application/vnd.sycle+xml"},
+                    {"scld", 4, "application/vnd.doremir.scorecloud-binary-document"},
+                    {"scm", 3, "application/vnd.lotus-screencam"},
+                    {"sco", 3, "audio/csound"},
+                    {"scq", 3, "application/scvp-cv-request"},
+                    {"scr", 3, "application/x-silverlight"},
+                    {"scs", 3, "application/scvp-cv-response"},
+                    {"scsf", 4, "application/vnd.sealed.csf"},
+                    {"sd", 2, "chemical/x-mdl-sdfile"},
+                    {"sd2", 3, "audio/x-sd2"},
+                    {"sda", 3, "application/vnd.stardivision.draw"},
+                    {"sdc", 3, "application/vnd.stardivision.calc"},
+                    {"sdd", 3, "application/vnd.stardivision.impress"},
+                    {"sdf", 3, "application/vnd.Kinar"},
+                    {"sdkd", 4, "application/vnd.solent.sdkm+xml"},
+                    {"sdkm", 4, "application/vnd.solent.sdkm+xml"},
+                    {"sdo", 3, "application/vnd.sealed.doc"},
+                    {"sdoc", 4, "application/vnd.sealed.doc"},
+                    {"sdp", 3, "application/sdp"},
+                    {"sds", 3, "application/vnd.stardivision.chart"},
+                    {"sdw", 3, "application/vnd.stardivision.writer"},
+                    {"see", 3, "application/vnd.seemail"},
+                    {"seed", 4, "application/vnd.fdsn.seed"},
+                    {"sem", 3, "application/vnd.sealed.eml"},
+                    {"sema", 4, "application/vnd.sema"},
+                    {"semd", 4, "application/vnd.semd"},
+                    {"semf", 4, "application/vnd.semf"},
+                    {"seml", 4, "application/vnd.sealed.eml"},
+                    {"senml", 5, "application/senml+json"},
+                    {"senml-etchc", 11, "application/senml-etch+cbor"},
+                    {"senml-etchj", 11, "application/senml-etch+json"},
+                    {"senmlc", 6, "application/senml+cbor"},
+                    {"senmle", 6, "application/senml-exi"},
+                    {"senmlx", 6, "application/senml+xml"},
+                    {"sensml", 6, "application/sensml+json"},
+                    {"sensmlc", 7, "application/sensml+cbor"},
+                    {"sensmle", 7, "application/sensml-exi"},
+                    {"sensmlx", 7, "application/sensml+xml"},
+                    {"ser", 3, "application/java-serialized-object"},
+                    {"sfc", 3, "application/vnd.nintendo.snes.rom"},
+                    {"sfd", 3, "application/vnd.font-fontforge-sfd"},
+                    {"sfd-hdstx", 9, "application/vnd.hydrostatix.sof-data"},
+                    {"sfs", 3, "application/vnd.spotfire.sfs"},
+                    {"sfv", 3, "text/x-sfv"},
+                    {"sgf", 3, "application/x-go-sgf"},
+                    {"sgi", 3, "image/vnd.sealedmedia.softseal.gif"},
+                    {"sgif", 4, "image/vnd.sealedmedia.softseal.gif"},
+                    {"sgl", 3, "application/vnd.stardivision.writer-global"},
+                    {"sgm", 3, "text/SGML"},
+                    {"sgml", 4, "text/SGML"},
+                    {"sh", 2, "application/x-sh"},
+                    {"shaclc", 6, "text/shaclc"},
+                    {"shar", 4, "application/x-shar"},
+                    {"shc", 3, "text/shaclc"},
+                    {"shex", 4, "text/shex"},
+                    {"shf", 3, "application/shf+xml"},
+                    {"shp", 3, "application/vnd.shp"},
+                    {"shtml", 5, "text/html"},
+                    {"shx", 3, "application/vnd.shx"},
+                    {"si", 2, "text/vnd.wap.si"},
+                    {"sic", 3, "application/vnd.wap.sic"},
+                    {"sid", 3, "audio/prs.sid"},
+                    {"sieve", 5, "application/sieve"},
+                    {"sig", 3, "application/pgp-signature"},
+                    {"sik", 3, "application/x-trash"},
+                    {"silo", 4, "model/mesh"},
+                    {"sis", 3, "application/vnd.symbian.install"},
+                    {"sit", 3, "application/x-stuffit"},
+                    {"sitx", 4, "application/x-stuffit"},
+                    {"siv", 3, "application/sieve"},
+                    {"sjp", 3, "image/vnd.sealedmedia.softseal.jpg"},
+                    {"sjpg", 4, "image/vnd.sealedmedia.softseal.jpg"},
+                    {"skd", 3, "application/vnd.koan"},
+                    {"skm", 3, "application/vnd.koan"},
+                    {"skp", 3, "application/vnd.koan"},
+                    {"skt", 3, "application/vnd.koan"},
+                    {"sl", 2, "text/vnd.wap.sl"},
+                    {"sla", 3, "application/vnd.scribus"},
+                    {"slaz", 4, "application/vnd.scribus"},
+                    {"slc", 3, "application/vnd.wap.slc"},
+                    {"sldm", 4, "application/vnd.ms-powerpoint.slide.macroEnabled.12"},
+                    {"sldx", 4, "application/vnd.openxmlformats-officedocument.presentationml.slide"},
+                    {"sls", 3, "application/route-s-tsid+xml"},
+                    {"slt", 3, "application/vnd.epson.salt"},
+                    {"sm", 2, "application/vnd.stepmania.stepchart"},
+                    {"smc", 3, "application/vnd.nintendo.snes.rom"},
+                    {"smf", 3, "application/vnd.stardivision.math"},
+                    {"smh", 3, "application/vnd.sealed.mht"},
+                    {"smht", 4, "application/vnd.sealed.mht"},
+                    {"smi", 3, "application/smil+xml"},
+                    {"smil", 4, "application/smil+xml"},
+                    {"smk", 3, "video/vnd.radgamettools.smacker"},
+                    {"sml", 3, "application/smil+xml"},
+                    {"smo", 3, "video/vnd.sealedmedia.softseal.mov"},
+                    {"smov", 4, "video/vnd.sealedmedia.softseal.mov"},
+                    {"smp", 3, "audio/vnd.sealedmedia.softseal.mpeg"},
+                    {"smp3", 4, "audio/vnd.sealedmedia.softseal.mpeg"},
+                    {"smpg", 4, "video/vnd.sealed.mpeg1"},
+                    {"sms", 3, "application/vnd.3gpp2.sms"},
+                    {"smv", 3, "audio/SMV"},
+                    {"smzip", 5, "application/vnd.stepmania.package"},
+                    {"snd", 3, "audio/basic"},
+                    {"soa", 3, "text/dns"},
+                    {"soc", 3, "application/sgml-open-catalog"},
+                    {"sofa", 4, "audio/sofa"},
+                    {"sos", 3, "text/vnd.sosi"},
+                    {"spc", 3, "chemical/x-galactic-spc"},
+                    {"spd", 3, "application/vnd.sealedmedia.softseal.pdf"},
+                    {"spdf", 4, "application/vnd.sealedmedia.softseal.pdf"},
+                    {"spdx", 4, "text/spdx"},
+                    {"spdx.json", 9, "application/spdx+json"},
+                    {"spf", 3, "application/vnd.yamaha.smaf-phrase"},
+                    {"spl", 3, "application/futuresplash"},
+                    {"spn", 3, "image/vnd.sealed.png"},
+                    {"spng", 4, "image/vnd.sealed.png"},
+                    {"spo", 3, "text/vnd.in3d.spot"},
+                    {"spot", 4, "text/vnd.in3d.spot"},
+                    {"spp", 3, "application/scvp-vp-response"},
+                    {"sppt", 4, "application/vnd.sealed.ppt"},
+                    {"spq", 3, "application/scvp-vp-request"},
+                    {"spx", 3, "audio/ogg"},
+                    {"sql", 3, "application/sql"},
+                    {"sqlite", 6, "application/vnd.sqlite3"},
+                    {"sqlite3", 7, "application/vnd.sqlite3"},
+                    {"sr", 2, "application/vnd.sigrok.session"},
+                    {"src", 3, "application/x-wais-source"},
+                    {"srt", 3, "text/plain"},
+                    {"sru", 3, "application/sru+xml"},
+                    {"srx", 3, "application/sparql-results+xml"},
+                    {"sse", 3, "application/vnd.kodak-descriptor"},
+                    {"ssf", 3, "application/vnd.epson.ssf"},
+                    {"ssml", 4, "application/ssml+xml"},
+                    {"ssv", 3, "application/vnd.shade-save-file"},
+                    {"ssvc", 4, "application/vnd.crypto-shade-file"},
+                    {"ssw", 3, "video/vnd.sealed.swf"},
+                    {"sswf", 4, "video/vnd.sealed.swf"},
+                    {"st", 2, "application/vnd.sailingtracker.track"},
+                    {"stc", 3, "application/vnd.sun.xml.calc.template"},
+                    {"std", 3, "application/vnd.sun.xml.draw.template"},
+                    {"step", 4, "model/step"},
+                    {"stf", 3, "application/vnd.wt.stf"},
+                    {"sti", 3, "application/vnd.sun.xml.impress.template"},
+                    {"stif", 4, "application/vnd.sealed.tiff"},
+                    {"stix", 4, "application/stix+json"},
+                    {"stk", 3, "application/hyperstudio"},
+                    {"stl", 3, "model/stl"},
+                    {"stml", 4, "application/vnd.sealedmedia.softseal.html"},
+                    {"stp", 3, "model/step"},
+                    {"stpnc", 5, "application/p21"},
+                    {"stpx", 4, "model/step+xml"},
+                    {"stpxz", 5, "model/step-xml+zip"},
+                    {"stpz", 4, "model/step+zip"},
+                    {"str", 3, "application/vnd.pg.format"},
+                    {"study-inter", 11, "application/vnd.vd-study"},
+                    {"stw", 3, "application/vnd.sun.xml.writer.template"},
+                    {"sty", 3, "text/x-tex"},
+                    {"sus", 3, "application/vnd.sus-calendar"},
+                    {"susp", 4, "application/vnd.sus-calendar"},
+                    {"sv4cpio", 7, "application/x-sv4cpio"},
+                    {"sv4crc", 6, "application/x-sv4crc"},
+                    {"svc", 3, "application/vnd.dvb.service"},
+                    {"svg", 3, "image/svg+xml"},
+                    {"svgz", 4, "image/svg+xml"},
+                    {"sw", 2, "chemical/x-swissprot"},
+                    {"swf", 3, "application/vnd.adobe.flash.movie"},
+                    {"swi", 3, "application/vnd.aristanetworks.swi"},
+                    {"swidtag", 7, "application/swid+xml"},
+                    {"sxc", 3, "application/vnd.sun.xml.calc"},
+                    {"sxd", 3, "application/vnd.sun.xml.draw"},
+                    {"sxg", 3, "application/vnd.sun.xml.writer.global"},
+                    {"sxi", 3, "application/vnd.sun.xml.impress"},
+                    {"sxl", 3, "application/vnd.sealed.xls"},
+                    {"sxls", 4, "application/vnd.sealed.xls"},
+                    {"sxm", 3, "application/vnd.sun.xml.math"},
+                    {"sxw", 3, "application/vnd.sun.xml.writer"},
+                    {"sy2", 3, "application/vnd.sybyl.mol2"},
+                    {"syft.json", 9, "application/vnd.syft+json"},
+                    {"t", 1, "text/troff"},
+                    {"tag", 3, "text/prs.lines.tag"},
+                    {"taglet", 6, "application/vnd.mynfc"},
+                    {"tam", 3, "application/vnd.onepager"},
+                    {"tamp", 4, "application/vnd.onepagertamp"},
+                    {"tamx", 4, "application/vnd.onepagertamx"},
+                    {"tao", 3, "application/vnd.tao.intent-module-archive"},
+                    {"tap", 3, "image/vnd.tencent.tap"},
+                    {"tar", 3, "application/x-tar"},
+                    {"tat", 3, "application/vnd.onepagertat"},
+                    {"tatp", 4, "application/vnd.onepagertatp"},
+                    {"tatx", 4, "application/vnd.onepagertatx"},
+                    {"tau", 3, "application/tamp-apex-update"},
+                    {"taz", 3, "application/x-gtar-compressed"},
+                    {"tcap", 4, "application/vnd.3gpp2.tcap"},
+                    {"tcl", 3, "application/x-tcl"},
+                    {"tcu", 3, "application/tamp-community-update"},
+                    {"td", 2, "application/urc-targetdesc+xml"},
+                    {"teacher", 7, "application/vnd.smart.teacher"},
+                    {"tei", 3, "application/tei+xml"},
+                    {"teicorpus", 9, "application/tei+xml"},
+                    {"ter", 3, "application/tamp-error"},
+                    {"tex", 3, "text/x-tex"},
+                    {"texi", 4, "application/x-texinfo"},
+                    {"texinfo", 7, "application/x-texinfo"},
+                    {"text", 4, "text/plain"},
+                    {"tfi", 3, "application/thraud+xml"},
+                    {"tfx", 3, "image/tiff-fx"},
+                    {"tgf", 3, "chemical/x-mdl-tgf"},
+                    {"tgz", 3, "application/x-gtar-compressed"},
+                    {"thmx", 4, "application/vnd.ms-officetheme"},
+                    {"tif", 3, "image/tiff"},
+                    {"tiff", 4, "image/tiff"},
+                    {"tk", 2, "text/x-tcl"},
+                    {"tlclient", 8, "application/vnd.cendio.thinlinc.clientconf"},
+                    {"tm", 2, "text/texmacs"},
+                    {"tm.json", 7, "application/tm+json"},
+                    {"tm.jsonld", 9, "application/tm+json"},
+                    {"tmo", 3, "application/vnd.tmobile-livetv"},
+                    {"tnef", 4, "application/vnd.ms-tnef"},
+                    {"tnf", 3, "application/vnd.ms-tnef"},
+                    {"toml", 4, "application/toml"},
+                    {"torrent", 7, "application/x-bittorrent"},
+                    {"tpl", 3, "application/vnd.groove-tool-template"},
+                    {"tpt", 3, "application/vnd.trid.tpt"},
+                    {"tr", 2, "text/troff"},
+                    {"tra", 3, "application/vnd.trueapp"},
+                    {"tree", 4, "application/vnd.rainstor.data"},
+                    {"trig", 4, "application/trig"},
+                    {"ts", 2, "video/mp2t"},
+                    {"tsa", 3, "application/tamp-sequence-adjust"},
+                    {"tsd", 3, "application/timestamped-data"},
+                    {"tsp", 3, "application/dsptype"},
+                    {"tsq", 3, "application/timestamp-query"},
+                    {"tsr", 3, "application/timestamp-reply"},
+                    {"tst", 3, "application/vnd.etsi.timestamp-token"},
+                    {"tsv", 3, "text/tab-separated-values"},
+                    {"ttc", 3, "font/collection"},
+                    {"ttf", 3, "font/ttf"},
+                    {"ttl", 3, "text/turtle"},
+                    {"ttml", 4, "application/ttml+xml"},
+                    {"tuc", 3, "application/tamp-update-confirm"},
+                    {"tur", 3, "application/tamp-update"},
+                    {"twd", 3, "application/vnd.SimTech-MindMapper"},
+                    {"twds", 4, "application/vnd.SimTech-MindMapper"},
+                    {"txd", 3, "application/vnd.genomatix.tuxedo"},
+                    {"txf", 3, "application/vnd.Mobius.TXF"},
+                    {"txt", 3, "text/plain"},
+                    {"u3d", 3, "model/u3d"},
+                    {"u8dsn", 5, "message/global-delivery-status"},
+                    {"u8hdr", 5, "message/global-headers"},
+                    {"u8mdn", 5, "message/global-disposition-notification"},
+                    {"u8msg", 5, "message/global"},
+                    {"udeb", 4, "application/vnd.debian.binary-package"},
+                    {"ufd", 3, "application/vnd.ufdl"},
+                    {"ufdl", 4, "application/vnd.ufdl"},
+                    {"uis", 3, "application/urc-uisocketdesc+xml"},
+                    {"umj", 3, "application/vnd.umajin"},
+                    {"unityweb", 8, "application/vnd.unity"},
+                    {"uo", 2, "application/vnd.uoml+xml"},
+                    {"uoml", 4, "application/vnd.uoml+xml"},
+                    {"upa", 3, "application/vnd.hbci"},
+                    {"uri", 3, "text/uri-list"},
+                    {"urim", 4, "application/vnd.uri-map"},
+                    {"urimap", 6, "application/vnd.uri-map"},
+                    {"uris", 4, "text/uri-list"},
+                    {"usda", 4, "model/vnd.usda"},
+                    {"usdz", 4, "model/vnd.usdz+zip"},
+                    {"ustar", 5, "application/x-ustar"},
+                    {"utz", 3, "application/vnd.uiq.theme"},
+                    {"uva", 3, "audio/vnd.dece.audio"},
+                    {"uvd", 3, "application/vnd.dece.data"},
+                    {"uvf", 3, "application/vnd.dece.data"},
+                    {"uvg", 3, "image/vnd.dece.graphic"},
+                    {"uvh", 3, "video/vnd.dece.hd"},
+                    {"uvi", 3, "image/vnd.dece.graphic"},
+                    {"uvm", 3, "video/vnd.dece.mobile"},
+                    {"uvp", 3, "video/vnd.dece.pd"},
+                    {"uvs", 3, "video/vnd.dece.sd"},
+                    {"uvt", 3, "application/vnd.dece.ttml+xml"},
+                    {"uvu", 3, "video/vnd.dece.mp4"},
+                    {"uvv", 3, "video/vnd.dece.video"},
+                    {"uvva", 4, "audio/vnd.dece.audio"},
+                    {"uvvd", 4, "application/vnd.dece.data"},
+                    {"uvvf", 4, "application/vnd.dece.data"},
+                    {"uvvg", 4, "image/vnd.dece.graphic"},
+                    {"uvvh", 4, "video/vnd.dece.hd"},
+                    {"uvvi", 4, "image/vnd.dece.graphic"},
+                    {"uvvm", 4, "video/vnd.dece.mobile"},
+                    {"uvvp", 4, "video/vnd.dece.pd"},
+                    {"uvvs", 4, "video/vnd.dece.sd"},
+                    {"uvvt", 4, "application/vnd.dece.ttml+xml"},
+                    {"uvvu", 4, "video/vnd.dece.mp4"},
+                    {"uvvv", 4, "video/vnd.dece.video"},
+                    {"uvvx", 4, "application/vnd.dece.unspecified"},
+                    {"uvvz", 4, "application/vnd.dece.zip"},
+                    {"uvx", 3, "application/vnd.dece.unspecified"},
+                    {"uvz", 3, "application/vnd.dece.zip"},
+                    {"val", 3, "chemical/x-ncbi-asn1-binary"},
+                    {"vbk", 3, "audio/vnd.nortel.vbk"},
+                    {"vbox", 4, "application/vnd.previewsystems.box"},
+                    {"vcard", 5, "text/vcard"},
+                    {"vcd", 3, "application/x-cdlink"},
+                    {"vcf", 3, "text/vcard"},
+                    {"vcg", 3, "application/vnd.groove-vcard"},
+                    {"vcj", 3, "application/voucher-cms+json"},
+                    {"vcs", 3, "text/x-vcalendar"},
+                    {"vcx", 3, "application/vnd.vcx"},
+                    {"vds", 3, "model/vnd.sap.vds"},
+                    {"ves", 3, "application/vnd.ves.encrypted"},
+                    {"vew", 3, "application/vnd.lotus-approach"},
+                    {"vfk", 3, "text/vnd.exchangeable"},
+                    {"vfr", 3, "application/vnd.tml"},
+                    {"viaframe", 8, "application/vnd.tml"},
+                    {"vis", 3, "application/vnd.visionary"},
+                    {"viv", 3, "video/vnd.vivo"},
+                    {"vmd", 3, "chemical/x-vmd"},
+                    {"vms", 3, "chemical/x-vamas-iso14976"},
+                    {"vmt", 3, "application/vnd.valve.source.material"},
+                    {"vpm", 3, "multipart/voice-message"},
+                    {"vrm", 3, "model/vrml"},
+                    {"vrml", 4, "model/vrml"},
+                    {"vsc", 3, "application/vnd.vidsoft.vidconference"},
+                    {"vsd", 3, "application/vnd.visio"},
+                    {"vsf", 3, "application/vnd.vsf"},
+                    {"vss", 3, "application/vnd.visio"},
+                    {"vst", 3, "application/vnd.visio"},
+                    {"vsw", 3, "application/vnd.visio"},
+                    {"vtf", 3, "image/vnd.valve.source.texture"},
+                    {"vtnstd", 6, "application/vnd.veritone.aion+json"},
+                    {"vtt", 3, "text/vtt"},
+                    {"vtu", 3, "model/vnd.vtu"},
+                    {"vwx", 3, "application/vnd.vectorworks"},
+                    {"vxml", 4, "application/voicexml+xml"},
+                    {"wad", 3, "application/x-doom"},
+                    {"wadl", 4, "application/vnd.sun.wadl+xml"},
+                    {"wafl", 4, "application/vnd.wasmflow.wafl"},
+                    {"wasm", 4, "application/wasm"},
+                    {"wav", 3, "audio/x-wav"},
+                    {"wax", 3, "audio/x-ms-wax"},
+                    {"wbmp", 4, "image/vnd.wap.wbmp"},
+                    {"wbs", 3, "application/vnd.criticaltools.wbs+xml"},
+                    {"wbxml", 5, "application/vnd.wap.wbxml"},
+                    {"wcm", 3, "application/vnd.ms-works"},
+                    {"wdb", 3, "application/vnd.ms-works"},
+                    {"webm", 4, "video/webm"},
+                    {"webmanifest", 11, "application/manifest+json"},
+                    {"webp", 4, "image/webp"},
+                    {"wg", 2, "application/vnd.pmi.widget"},
+                    {"wgsl", 4, "text/wgsl"},
+                    {"wgt", 3, "application/widget"},
+                    {"wif", 3, "application/watcherinfo+xml"},
+                    {"win", 3, "model/vnd.gdl"},
+                    {"wk", 2, "application/x-123"},
+                    {"wk1", 3, "application/vnd.lotus-1-2-3"},
+                    {"wk3", 3, "application/vnd.lotus-1-2-3"},
+                    {"wk4", 3, "application/vnd.lotus-1-2-3"},
+                    {"wks", 3, "application/vnd.ms-works"},
+                    {"wlnk", 4, "application/link-format"},
+                    {"wm", 2, "video/x-ms-wm"},
+                    {"wma", 3, "audio/x-ms-wma"},
+                    {"wmc", 3, "application/vnd.wmc"},
+                    {"wmd", 3, "application/x-ms-wmd"},
+                    {"wmf", 3, "image/wmf"},
+                    {"wml", 3, "text/vnd.wap.wml"},
+                    {"wmlc", 4, "application/vnd.wap.wmlc"},
+                    {"wmls", 4, "text/vnd.wap.wmlscript"},
+                    {"wmlsc", 5, "application/vnd.wap.wmlscriptc"},
+                    {"wmv", 3, "video/x-ms-wmv"},
+                    {"wmx", 3, "video/x-ms-wmx"},
+                    {"wmz", 3, "application/x-ms-wmz"},
+                    {"woff", 4, "font/woff"},
+                    {"woff2", 5, "font/woff2"},
+                    {"wpd", 3, "application/vnd.wordperfect"},
+                    {"wpl", 3, "application/vnd.ms-wpl"},
+                    {"wps", 3, "application/vnd.ms-works"},
+                    {"wqd", 3, "application/vnd.wqd"},
+                    {"wrl", 3, "model/vrml"},
+                    {"wsc", 3, "application/vnd.wfa.wsc"},
+                    {"wsdl", 4, "application/wsdl+xml"},
+                    {"wspolicy", 8, "application/wspolicy+xml"},
+                    {"wtb", 3, "application/vnd.webturbo"},
+                    {"wv", 2, "application/vnd.wv.csp+wbxml"},
+                    {"wvx", 3, "video/x-ms-wvx"},
+                    {"wz", 2, "application/x-wingz"},
+                    {"x3d", 3, "model/x3d+xml"},
+                    {"x3db", 4, "model/x3d+fastinfoset"},
+                    {"x3dv", 4, "model/x3d-vrml"},
+                    {"x3dvz", 5, "model/x3d-vrml"},
+                    {"x3dz", 4, "model/x3d+xml"},
+                    {"x_b", 3, "model/vnd.parasolid.transmit.binary"},
+                    {"x_t", 3, "model/vnd.parasolid.transmit.text"},
+                    {"xar", 3, "application/vnd.xara"},
+                    {"xav", 3, "application/xcap-att+xml"},
+                    {"xbd", 3, "application/vnd.fujixerox.docuworks.binder"},
+                    {"xbm", 3, "image/x-xbitmap"},
+                    {"xca", 3, "application/xcap-caps+xml"},
+                    {"xcf", 3, "image/x-xcf"},
+                    {"xcos", 4, "application/x-scilab-xcos"},
+                    {"xcs", 3, "application/calendar+xml"},
+                    {"xct", 3, "application/vnd.fujixerox.docuworks.container"},
+                    {"xdd", 3, "application/bacnet-xdd+zip"},
+                    {"xdf", 3, "application/xcap-diff+xml"},
+                    {"xdm", 3, "application/vnd.syncml.dm+xml"},
+                    {"xdp", 3, "application/vnd.adobe.xdp+xml"},
+                    {"xdssc", 5, "application/dssc+xml"},
+                    {"xdw", 3, "application/vnd.fujixerox.docuworks"},
+                    {"xel", 3, "application/xcap-el+xml"},
+                    {"xer", 3, "application/xcap-error+xml"},
+                    {"xfd", 3, "application/vnd.xfdl"},
+                    {"xfdf", 4, "application/xfdf"},
+                    {"xfdl", 4, "application/vnd.xfdl"},
+                    {"xhe", 3, "audio/usac"},
+                    {"xht", 3, "application/xhtml+xml"},
+                    {"xhtm", 4, "application/xhtml+xml"},
+                    {"xhtml", 5, "application/xhtml+xml"},
+                    {"xhvml", 5, "application/xv+xml"},
+                    {"xif", 3, "image/vnd.xiff"},
+                    {"xla", 3, "application/vnd.ms-excel"},
+                    {"xlam", 4, "application/vnd.ms-excel.addin.macroEnabled.12"},
+                    {"xlc", 3, "application/vnd.ms-excel"},
+                    {"xlf", 3, "application/xliff+xml"},
+                    {"xlim", 4, "application/vnd.xmpie.xlim"},
+                    {"xlm", 3, "application/vnd.ms-excel"},
+                    {"xls", 3, "application/vnd.ms-excel"},
+                    {"xlsb", 4, "application/vnd.ms-excel.sheet.binary.macroEnabled.12"},
+                    {"xlsm", 4, "application/vnd.ms-excel.sheet.macroEnabled.12"},
+                    {"xlsx", 4, "application/vnd.openxmlformats-officedocument.spreadsheetml.sheet"},
+                    {"xlt", 3, "application/vnd.ms-excel"},
+                    {"xltm", 4, "application/vnd.ms-excel.template.macroEnabled.12"},
+                    {"xltx", 4, "application/vnd.openxmlformats-officedocument.spreadsheetml.template"},
+                    {"xlw", 3, "application/vnd.ms-excel"},
+                    {"xml", 3, "application/xml"},
+                    {"xmls", 4, "application/dskpp+xml"},
+                    {"xmt_bin", 7, "model/vnd.parasolid.transmit.binary"},
+                    {"xmt_txt", 7, "model/vnd.parasolid.transmit.text"},
+                    {"xns", 3, "application/xcap-ns+xml"},
+                    {"xo", 2, "application/vnd.olpc-sugar"},
+                    {"xodp", 4, "application/vnd.collabio.xodocuments.presentation"},
+                    {"xods", 4, "application/vnd.collabio.xodocuments.spreadsheet"},
+                    {"xodt", 4, "application/vnd.collabio.xodocuments.document"},
+                    {"xop", 3, "application/xop+xml"},
+                    {"xotp", 4, "application/vnd.collabio.xodocuments.presentation-template"},
+                    {"xots", 4, "application/vnd.collabio.xodocuments.spreadsheet-template"},
+                    {"xott", 4, "application/vnd.collabio.xodocuments.document-template"},
+                    {"xpak", 4, "application/vnd.gentoo.xpak"},
+                    {"xpi", 3, "application/x-xpinstall"},
+                    {"xpm", 3, "image/x-xpixmap"},
+                    {"xpr", 3, "application/vnd.is-xpr"},
+                    {"xps", 3, "application/vnd.ms-xpsdocument"},
+                    {"xpw", 3, "application/vnd.intercon.formnet"},
+                    {"xpx", 3, "application/vnd.intercon.formnet"},
+                    {"xsf", 3, "application/prs.xsf+xml"},
+                    {"xsl", 3, "application/xslt+xml"},
+                    {"xslt", 4, "application/xslt+xml"},
+                    {"xsm", 3, "application/vnd.syncml+xml"},
+                    {"xspf", 4, "application/xspf+xml"},
+                    {"xtel", 4, "chemical/x-xtel"},
+                    {"xul", 3, "application/vnd.mozilla.xul+xml"},
+                    {"xvm", 3, "application/xv+xml"},
+                    {"xvml", 4, "application/xv+xml"},
+                    {"xwd", 3, "image/x-xwindowdump"},
+                    {"xyz", 3, "chemical/x-xyz"},
+                    {"xyze", 4, "image/vnd.radiance"},
+                    {"xz", 2, "application/x-xz"},
+                    {"yaml", 4, "application/yaml"},
+                    {"yang", 4, "application/yang"},
+                    {"yin", 3, "application/yin+xml"},
+                    {"yme", 3, "application/vnd.yaoweme"},
+                    {"yml", 3, "application/yaml"},
+                    {"yt", 2, "video/vnd.youtube.yt"},
+                    {"zaz", 3, "application/vnd.zzazz.deck+xml"},
+                    {"zfc", 3, "application/vnd.filmit.zfc"},
+                    {"zfo", 3, "application/vnd.software602.filler.form-xml-zip"},
+                    {"zip", 3, "application/zip"},
+                    {"zir", 3, "application/vnd.zul"},
+                    {"zirz", 4, "application/vnd.zul"},
+                    {"zmm", 3, "application/vnd.HandHeld-Entertainment+xml"},
+                    {"zmt", 3, "chemical/x-mopac-input"},
+                    {"zone", 4, "text/dns"},
+                    {"zst", 3, "application/zstd"},
+                    {"~", 1, "application/x-trash"},
+                };
+
+                // sorted by type(lower case) with the preferred extension, for binary search
+                static const extension_entry_t type_table[] = {
+                    {"a2l", 3, "application/A2L"},
+                    {"aml", 3, "application/AML"},
+                    {"ez", 2, "application/andrew-inset"},
+                    {"anx", 3, "application/annodex"},
+                    {"atf", 3, "application/ATF"},
+                    {"atfx", 4, "application/ATFX"},
+                    {"atom", 4, "application/atom+xml"},
+                    {"atomcat", 7, "application/atomcat+xml"},
+                    {"atomdeleted", 11, "application/atomdeleted+xml"},
+                    {"atomsrv", 7, "application/atomserv+xml"},
+                    {"atomsvc", 7, "application/atomsvc+xml"},
+                    {"dwd", 3, "application/atsc-dwd+xml"},
+                    {"held", 4, "application/atsc-held+xml"},
+                    {"rsat", 4, "application/atsc-rsat+xml"},
+                    {"atxml", 5, "application/ATXML"},
+                    {"apxml", 5, "application/auth-policy+xml"},
+                    {"amlx", 4, "application/automationml-amlx+zip"},
+                    {"xdd", 3, "application/bacnet-xdd+zip"},
+                    {"lin", 3, "application/bbolin"},
+                    {"xcs", 3, "application/calendar+xml"},
+                    {"cbor", 4, "application/cbor"},
+                    {"c3ex", 4, "application/cccex"},
+                    {"ccmp", 4, "application/ccmp+xml"},
+                    {"ccxml", 5, "application/ccxml+xml"},
+                    {"cdfx", 4, "application/CDFX+XML"},
+                    {"cdmia", 5, "application/cdmi-capability"},
+                    {"cdmic", 5, "application/cdmi-container"},
+                    {"cdmid", 5, "application/cdmi-domain"},
+                    {"cdmio", 5, "application/cdmi-object"},
+                    {"cdmiq", 5, "application/cdmi-queue"},
+                    {"cea", 3, "application/CEA"},
+                    {"cellml", 6, "application/cellml+xml"},
+                    {"1clr", 4, "application/clr"},
+                    {"clue", 4, "application/clue_info+xml"},
+                    {"cmsc", 4, "application/cms"},
+                    {"cpl", 3, "application/cpl+xml"},
+                    {"csrattrs", 8, "application/csrattrs"},
+                    {"cu", 2, "application/cu-seeme"},
+                    {"cwl", 3, "application/cwl"},
+                    {"cwl.json", 8, "application/cwl+json"},
+                    {"mpd", 3, "application/dash+xml"},
+                    {"mpdd", 4, "application/dashdelta"},
+                    {"davmount", 8, "application/davmount+xml"},
+                    {"dcd", 3, "application/DCD"},
+                    {"dcm", 3, "application/dicom"},
+                    {"dii", 3, "application/DII"},
+                    {"dit", 3, "application/DIT"},
+                    {"xmls", 4, "application/dskpp+xml"},
+                    {"tsp", 3, "application/dsptype"},
+                    {"dssc", 4, "application/dssc+der"},
+                    {"xdssc", 5, "application/dssc+xml"},
+                    {"dvc", 3, "application/dvcs"},
+                    {"efi", 3, "application/efi"},
+                    {"emma", 4, "application/emma+xml"},
+                    {"emotionml", 9, "application/emotionml+xml"},
+                    {"epub", 4, "application/epub+zip"},
+                    {"exi", 3, "application/exi"},
+                    {"exp", 3, "application/express"},
+                    {"finf", 4, "application/fastinfoset"},
+                    {"fdf", 3, "application/fdf"},
+                    {"fdt", 3, "application/fdt+xml"},
+                    {"pfr", 3, "application/font-tdpfr"},
+                    {"spl", 3, "application/futuresplash"},
+                    {"geojson", 7, "application/geo+json"},
+                    {"gpkg", 4, "application/geopackage+sqlite3"},
+                    {"glbin", 5, "application/gltf-buffer"},
+                    {"gml", 3, "application/gml+xml"},
+                    {"gz", 2, "application/gzip"},
+                    {"hta", 3, "application/hta"},
+                    {"stk", 3, "application/hyperstudio"},
+                    {"ink", 3, "application/inkml+xml"},
+                    {"ipfix", 5, "application/ipfix"},
+                    {"its", 3, "application/its+xml"},
+                    {"jar", 3, "application/java-archive"},
+                    {"ser", 3, "application/java-serialized-object"},
+                    {"class", 5, "application/java-vm"},
+                    {"jrd", 3, "application/jrd+json"},
+                    {"json", 4, "application/json"},
+                    {"json-patch", 10, "application/json-patch+json"},
+                    {"jsonld", 6, "application/ld+json"},
+                    {"lgr", 3, "application/lgr+xml"},
+                    {"wlnk", 4, "application/link-format"},
+                    {"lostxml", 7, "application/lost+xml"},
+                    {"lostsyncxml", 11, "application/lostsync+xml"},
+                    {"lpf", 3, "application/lpf+zip"},
+                    {"lxf", 3, "application/LXF"},
+                    {"m3g", 3, "application/m3g"},
+                    {"hqx", 3, "application/mac-binhex40"},
+                    {"cpt", 3, "application/mac-compactpro"},
+                    {"mads", 4, "application/mads+xml"},
+                    {"webmanifest", 11, "application/manifest+json"},
+                    {"mrc", 3, "application/marc"},
+                    {"mrcx", 4, "application/marcxml+xml"},
+                    {"ma", 2, "application/mathematica"},
+                    {"mml", 3, "application/mathml+xml"},
+                    {"mbox", 4, "application/mbox"},
+                    {"meta4", 5, "application/metalink4+xml"},
+                    {"mets", 4, "application/mets+xml"},
+                    {"mf4", 3, "application/MF4"},
+                    {"maei", 4, "application/mmt-aei+xml"},
+                    {"musd", 4, "application/mmt-usd+xml"},
+                    {"mods", 4, "application/mods+xml"},
+                    {"m21", 3, "application/mp21"},
+                    {"mdb", 3, "application/msaccess"},
+                    {"doc", 3, "application/msword"},
+                    {"mxf", 3, "application/mxf"},
+                    {"nq", 2, "application/n-quads"},
+                    {"nt", 2, "application/n-triples"},
+                    {"orq", 3, "application/ocsp-request"},
+                    {"ors", 3, "application/ocsp-response"},
+                    {"bin", 3, "application/octet-stream"},
+                    {"oda", 3, "application/ODA"},
+                    {"odx", 3, "application/ODX"},
+                    {"opf", 3, "application/oebps-package+xml"},
+                    {"ogx", 3, "application/ogg"},
+                    {"one", 3, "application/onenote"},
+                    {"oxps", 4, "application/oxps"},
+                    {"p21", 3, "application/p21"},
+                    {"relo", 4, "application/p2p-overlay+xml"},
+                    {"pdf", 3, "application/pdf"},
+                    {"pdx", 3, "application/PDX"},
+                    {"pem", 3, "application/pem-certificate-chain"},
+                    {"pgp", 3, "application/pgp-encrypted"},
+                    {"asc", 3, "application/pgp-keys"},
+                    {"sig", 3, "application/pgp-signature"},
+                    {"prf", 3, "application/pics-rules"},
+                    {"p10", 3, "application/pkcs10"},
+                    {"p12", 3, "application/pkcs12"},
+                    {"p7m", 3, "application/pkcs7-mime"},
+                    {"p7s", 3, "application/pkcs7-signature"},
+                    {"p8", 2, "application/pkcs8"},
+                    {"p8e", 3, "application/pkcs8-encrypted"},
+                    {"ac", 2, "application/pkix-attr-cert"},
+                    {"cer", 3, "application/pkix-cert"},
+                    {"crl", 3, "application/pkix-crl"},
+                    {"pkipath", 7, "application/pkix-pkipath"},
+                    {"pki", 3, "application/pkixcmp"},
+                    {"ps", 2, "application/postscript"},
+                    {"provx", 5, "application/provenance+xml"},
+                    {"cw", 2, "application/prs.cww"},
+                    {"hpub", 4, "application/prs.hpub+zip"},
+                    {"rnd", 3, "application/prs.nprend"},
+                    {"rdf-crypt", 9, "application/prs.rdf-xml-crypt"},
+                    {"xsf", 3, "application/prs.xsf+xml"},
+                    {"pskcxml", 7, "application/pskc+xml"},
+                    {"rdf", 3, "application/rdf+xml"},
+                    {"rif", 3, "application/reginfo+xml"},
+                    {"rnc", 3, "application/relax-ng-compact-syntax"},
+                    {"rl", 2, "application/resource-lists+xml"},
+                    {"rld", 3, "application/resource-lists-diff+xml"},
+                    {"rfcxml", 6, "application/rfc+xml"},
+                    {"rs", 2, "application/rls-services+xml"},
+                    {"rapd", 4, "application/route-apd+xml"},
+                    {"sls", 3, "application/route-s-tsid+xml"},
+                    {"rusd", 4, "application/route-usd+xml"},
+                    {"gbr", 3, "application/rpki-ghostbusters"},
+                    {"mft", 3, "application/rpki-manifest"},
+                    {"roa", 3, "application/rpki-roa"},
+                    {"rtf", 3, "application/rtf"},
+                    {"sarif", 5, "application/sarif+json"},
+                    {"sarif-external-properties", 25, "application/sarif-external-properties+json"},
+                    {"scim", 4, "application/scim+json"},
+                    {"scq", 3, "application/scvp-cv-request"},
+                    {"scs", 3, "application/scvp-cv-response"},
+                    {"spq", 3, "application/scvp-vp-request"},
+                    {"spp", 3, "application/scvp-vp-response"},
+                    {"sdp", 3, "application/sdp"},
+                    {"senmlc", 6, "application/senml+cbor"},
+                    {"senml", 5, "application/senml+json"},
+                    {"senmlx", 6, "application/senml+xml"},
+                    {"senml-etchc", 11, "application/senml-etch+cbor"},
+                    {"senml-etchj", 11, "application/senml-etch+json"},
+                    {"senmle", 6, "application/senml-exi"},
+                    {"sensmlc", 7, "application/sensml+cbor"},
+                    {"sensml", 6, "application/sensml+json"},
+                    {"sensmlx", 7, "application/sensml+xml"},
+                    {"sensmle", 7, "application/sensml-exi"},
+                    {"soc", 3, "application/sgml-open-catalog"},
+                    {"shf", 3, "application/shf+xml"},
+                    {"siv", 3, "application/sieve"},
+                    {"cl", 2, "application/simple-filter+xml"},
+                    {"smil", 4, "application/smil+xml"},
+                    {"rq", 2, "application/sparql-query"},
+                    {"srx", 3, "application/sparql-results+xml"},
+                    {"spdx.json", 9, "application/spdx+json"},
+                    {"sql", 3, "application/sql"},
+                    {"gram", 4, "application/srgs"},
+                    {"grxml", 5, "application/srgs+xml"},
+                    {"sru", 3, "application/sru+xml"},
+                    {"ssml", 4, "application/ssml+xml"},
+                    {"stix", 4, "application/stix+json"},
+                    {"coswid", 6, "application/swid+cbor"},
+                    {"swidtag", 7, "application/swid+xml"},
+                    {"tau", 3, "application/tamp-apex-update"},
+                    {"auc", 3, "application/tamp-apex-update-confirm"},
+                    {"tcu", 3, "application/tamp-community-update"},
+                    {"cuc", 3, "application/tamp-community-update-confirm"},
+                    {"ter", 3, "application/tamp-error"},
+                    {"tsa", 3, "application/tamp-sequence-adjust"},
+                    {"sac", 3, "application/tamp-sequence-adjust-confirm"},
+                    {"tur", 3, "application/tamp-update"},
+                    {"tuc", 3, "application/tamp-update-confirm"},
+                    {"jsontd", 6, "application/td+json"},
+                    {"tei", 3, "application/tei+xml"},
+                    {"tfi", 3, "application/thraud+xml"},
+                    {"tsq", 3, "application/timestamp-query"},
+                    {"tsr", 3, "application/timestamp-reply"},
+                    {"tsd", 3, "application/timestamped-data"},
+                    {"tm.jsonld", 9, "application/tm+json"},
+                    {"toml", 4, "application/toml"},
+                    {"trig", 4, "application/trig"},
+                    {"ttml", 4, "application/ttml+xml"},
+                    {"gsheet", 6, "application/urc-grpsheet+xml"},
+                    {"rsheet", 6, "application/urc-ressheet+xml"},
+                    {"td", 2, "application/urc-targetdesc+xml"},
+                    {"uis", 3, "application/urc-uisocketdesc+xml"},
+                    {"1km", 3, "application/vnd.1000minds.decision-model+xml"},
+                    {"plb", 3, "application/vnd.3gpp.pic-bw-large"},
+                    {"psb", 3, "application/vnd.3gpp.pic-bw-small"},
+                    {"pvb", 3, "application/vnd.3gpp.pic-bw-var"},
+                    {"sms", 3, "application/vnd.3gpp2.sms"},
+                    {"tcap", 4, "application/vnd.3gpp2.tcap"},
+                    {"imgcal", 6, "application/vnd.3lightssoftware.imagescal"},
+                    {"pwn", 3, "application/vnd.3M.Post-it-Notes"},
+                    {"aso", 3, "application/vnd.accpac.simply.aso"},
+                    {"imp", 3, "application/vnd.accpac.simply.imp"},
+                    {"acu", 3, "application/vnd.acucobol"},
+                    {"atc", 3, "application/vnd.acucorp"},
+                    {"swf", 3, "application/vnd.adobe.flash.movie"},
+                    {"fcdt", 4, "application/vnd.adobe.formscentral.fcdt"},
+                    {"fxp", 3, "application/vnd.adobe.fxp"},
+                    {"xdp", 3, "application/vnd.adobe.xdp+xml"},
+                    {"list3820", 8, "application/vnd.afpc.modca"},
+                    {"ovl", 3, "application/vnd.afpc.modca-overlay"},
+                    {"psg", 3, "application/vnd.afpc.modca-pagesegment"},
+                    {"age", 3, "application/vnd.age"},
+                    {"ahead", 5, "application/vnd.ahead.space"},
+                    {"azf", 3, "application/vnd.airzip.filesecure.azf"},
+                    {"azs", 3, "application/vnd.airzip.filesecure.azs"},
+                    {"azw3", 4, "application/vnd.amazon.mobi8-ebook"},
+                    {"acc", 3, "application/vnd.americandynamics.acc"},
+                    {"ami", 3, "application/vnd.amiga.ami"},
+                    {"ota", 3, "application/vnd.android.ota"},
+                    {"apk", 3, "application/vnd.android.package-archive"},
+                    {"apkg", 4, "application/vnd.anki"},
+                    {"cii", 3, "application/vnd.anser-web-certificate-issue-initiation"},
+                    {"fti", 3, "application/vnd.anser-web-funds-transfer-initiation"},
+                    {"arrow", 5, "application/vnd.apache.arrow.file"},
+                    {"arrows", 6, "application/vnd.apache.arrow.stream"},
+                    {"apexlang", 8, "application/vnd.apexlang"},
+                    {"dist", 4, "application/vnd.apple.installer+xml"},
+                    {"keynote", 7, "application/vnd.apple.keynote"},
+                    {"m3u8", 4, "application/vnd.apple.mpegurl"},
+                    {"numbers", 7, "application/vnd.apple.numbers"},
+                    {"pages", 5, "application/vnd.apple.pages"},
+                    {"swi", 3, "application/vnd.aristanetworks.swi"},
+                    {"artisan", 7, "application/vnd.artisan+json"},
+                    {"iota", 4, "application/vnd.astraea-software.iota"},
+                    {"aep", 3, "application/vnd.audiograph"},
+                    {"package", 7, "application/vnd.autopackage"},
+                    {"bmml", 4, "application/vnd.balsamiq.bmml+xml"},
+                    {"bmpr", 4, "application/vnd.balsamiq.bmpr"},
+                    {"ac2", 3, "application/vnd.banana-accounting"},
+                    {"lhzd", 4, "application/vnd.belightsoft.lhzd+zip"},
+                    {"lhzl", 4, "application/vnd.belightsoft.lhzl+zip"},
+                    {"mpm", 3, "application/vnd.blueice.multipass"},
+                    {"ep", 2, "application/vnd.bluetooth.ep.oob"},
+                    {"le", 2, "application/vnd.bluetooth.le.oob"},
+                    {"bmi", 3, "application/vnd.bmi"},
+                    {"rep", 3, "application/vnd.businessobjects"},
+                    {"tlclient", 8, "application/vnd.cendio.thinlinc.clientconf"},
+                    {"cdxml", 5, "application/vnd.chemdraw+xml"},
+                    {"pgn", 3, "application/vnd.chess-pgn"},
+                    {"mmd", 3, "application/vnd.chipnuts.karaoke-mmd"},
+                    {"cdy", 3, "application/vnd.cinderella"},
+                    {"csl", 3, "application/vnd.citationstyles.style+xml"},
+                    {"cla", 3, "application/vnd.claymore"},
+                    {"rp9", 3, "application/vnd.cloanto.rp9"},
+                    {"c4g", 3, "application/vnd.clonk.c4group"},
+                    {"c11amc", 6, "application/vnd.cluetrust.cartomobile-config"},
+                    {"c11amz", 6, "application/vnd.cluetrust.cartomobile-config-pkg"},
+                    {"coffee", 6, "application/vnd.coffeescript"},
+                    {"xodt", 4, "application/vnd.collabio.xodocuments.document"},
+                    {"xott", 4, "application/vnd.collabio.xodocuments.document-template"},
+                    {"xodp", 4, "application/vnd.collabio.xodocuments.presentation"},
+                    {"xotp", 4, "application/vnd.collabio.xodocuments.presentation-template"},
+                    {"xods", 4, "application/vnd.collabio.xodocuments.spreadsheet"},
+                    {"xots", 4, "application/vnd.collabio.xodocuments.spreadsheet-template"},
+                    {"cbz", 3, "application/vnd.comicbook+zip"},
+                    {"cbr", 3, "application/vnd.comicbook-rar"},
+                    {"icf", 3, "application/vnd.commerce-battelle"},
+                    {"csp", 3, "application/vnd.commonspace"},
+                    {"cdbcmsg", 7, "application/vnd.contact.cmsg"},
+                    {"ign", 3, "application/vnd.coreos.ignition+json"},
+                    {"cmc", 3, "application/vnd.cosmocaller"},
+                    {"clkx", 4, "application/vnd.crick.clicker"},
+                    {"clkk", 4, "application/vnd.crick.clicker.keyboard"},
+                    {"clkp", 4, "application/vnd.crick.clicker.palette"},
+                    {"clkt", 4, "application/vnd.crick.clicker.template"},
+                    {"clkw", 4, "application/vnd.crick.clicker.wordbank"},
+                    {"wbs", 3, "application/vnd.criticaltools.wbs+xml"},
+                    {"ssvc", 4, "application/vnd.crypto-shade-file"},
+                    {"c9r", 3, "application/vnd.cryptomator.encrypted"},
+                    {"cryptomator", 11, "application/vnd.cryptomator.vault"},
+                    {"pml", 3, "application/vnd.ctc-posml"},
+                    {"ppd", 3, "application/vnd.cups-ppd"},
+                    {"dart", 4, "application/vnd.dart"},
+                    {"rdz", 3, "application/vnd.data-vision.rdz"},
+                    {"dl", 2, "application/vnd.datalog"},
+                    {"dbf", 3, "application/vnd.dbf"},
+                    {"deb", 3, "application/vnd.debian.binary-package"},
+                    {"uvf", 3, "application/vnd.dece.data"},
+                    {"uvt", 3, "application/vnd.dece.ttml+xml"},
+                    {"uvx", 3, "application/vnd.dece.unspecified"},
+                    {"uvz", 3, "application/vnd.dece.zip"},
+                    {"fe_launch", 9, "application/vnd.denovo.fcselayout-link"},
+                    {"dsm", 3, "application/vnd.desmume.movie"},
+                    {"dna", 3, "application/vnd.dna"},
+                    {"docjson", 7, "application/vnd.document+json"},
+                    {"scld", 4, "application/vnd.doremir.scorecloud-binary-document"},
+                    {"dpg", 3, "application/vnd.dpgraph"},
+                    {"dfac", 4, "application/vnd.dreamfactory"},
+                    {"fla", 3, "application/vnd.dtg.local.flash"},
+                    {"ait", 3, "application/vnd.dvb.ait"},
+                    {"svc", 3, "application/vnd.dvb.service"},
+                    {"geo", 3, "application/vnd.dynageo"},
+                    {"dzr", 3, "application/vnd.dzr"},
+                    {"mag", 3, "application/vnd.ecowin.chart"},
+                    {"eln", 3, "application/vnd.eln+zip"},
+                    {"nml", 3, "application/vnd.enliven"},
+                    {"esf", 3, "application/vnd.epson.esf"},
+                    {"msf", 3, "application/vnd.epson.msf"},
+                    {"qam", 3, "application/vnd.epson.quickanime"},
+                    {"slt", 3, "application/vnd.epson.salt"},
+                    {"ssf", 3, "application/vnd.epson.ssf"},
+                    {"qcall", 5, "application/vnd.ericsson.quickcall"},
+                    {"espass", 6, "application/vnd.espass-espass+zip"},
+                    {"es3", 3, "application/vnd.eszigno3+xml"},
+                    {"asice", 5, "application/vnd.etsi.asic-e+zip"},
+                    {"asics", 5, "application/vnd.etsi.asic-s+zip"},
+                    {"tst", 3, "application/vnd.etsi.timestamp-token"},
+                    {"carjson", 7, "application/vnd.eu.kasparian.car+json"},
+                    {"ecigprofile", 11, "application/vnd.evolv.ecig.profile"},
+                    {"ecig", 4, "application/vnd.evolv.ecig.settings"},
+                    {"ecigtheme", 9, "application/vnd.evolv.ecig.theme"},
+                    {"mpw", 3, "application/vnd.exstream-empower+zip"},
+                    {"pub", 3, "application/vnd.exstream-package"},
+                    {"ez2", 3, "application/vnd.ezpix-album"},
+                    {"ez3", 3, "application/vnd.ezpix-package"},
+                    {"gdz", 3, "application/vnd.familysearch.gedcom+zip"},
+                    {"dim", 3, "application/vnd.fastcopy-disk-image"},
+                    {"msd", 3, "application/vnd.fdsn.mseed"},
+                    {"seed", 4, "application/vnd.fdsn.seed"},
+                    {"flb", 3, "application/vnd.ficlab.flb+zip"},
+                    {"zfc", 3, "application/vnd.filmit.zfc"},
+                    {"gph", 3, "application/vnd.FloGraphIt"},
+                    {"ftc", 3, "application/vnd.fluxtime.clip"},
+                    {"sfd", 3, "application/vnd.font-fontforge-sfd"},
+                    {"fm", 2, "application/vnd.framemaker"},
+                    {"fsc", 3, "application/vnd.fsc.weblaunch"},
+                    {"oas", 3, "application/vnd.fujitsu.oasys"},
+                    {"oa2", 3, "application/vnd.fujitsu.oasys2"},
+                    {"oa3", 3, "application/vnd.fujitsu.oasys3"},
+                    {"fg5", 3, "application/vnd.fujitsu.oasysgp"},
+                    {"bh2", 3, "application/vnd.fujitsu.oasysprs"},
+                    {"ddd", 3, "application/vnd.fujixerox.ddd"},
+                    {"xdw", 3, "application/vnd.fujixerox.docuworks"},
+                    {"xbd", 3, "application/vnd.fujixerox.docuworks.binder"},
+                    {"xct", 3, "application/vnd.fujixerox.docuworks.container"},
+                    {"fzs", 3, "application/vnd.fuzzysheet"},
+                    {"txd", 3, "application/vnd.genomatix.tuxedo"},
+                    {"genozip", 7, "application/vnd.genozip"},
+                    {"grd", 3, "application/vnd.gentics.grd+json"},
+                    {"ebuild", 6, "application/vnd.gentoo.ebuild"},
+                    {"eclass", 6, "application/vnd.gentoo.eclass"},
+                    {"gpkg.tar", 8, "application/vnd.gentoo.gpkg"},
+                    {"xpak", 4, "application/vnd.gentoo.xpak"},
+                    {"ggb", 3, "application/vnd.geogebra.file"},
+                    {"ggs", 3, "application/vnd.geogebra.slides"},
+                    {"ggt", 3, "application/vnd.geogebra.tool"},
+                    {"gex", 3, "application/vnd.geometry-explorer"},
+                    {"gxt", 3, "application/vnd.geonext"},
+                    {"g2w", 3, "application/vnd.geoplan"},
+                    {"g3w", 3, "application/vnd.geospace"},
+                    {"kml", 3, "application/vnd.google-earth.kml+xml"},
+                    {"kmz", 3, "application/vnd.google-earth.kmz"},
+                    {"gqf", 3, "application/vnd.grafeq"},
+                    {"gac", 3, "application/vnd.groove-account"},
+                    {"ghf", 3, "application/vnd.groove-help"},
+                    {"gim", 3, "application/vnd.groove-identity-message"},
+                    {"grv", 3, "application/vnd.groove-injector"},
+                    {"gtm", 3, "application/vnd.groove-tool-message"},
+                    {"tpl", 3, "application/vnd.groove-tool-template"},
+                    {"vcg", 3, "application/vnd.groove-vcard"},
+                    {"hal", 3, "application/vnd.hal+xml"},
+                    {"zmm", 3, "application/vnd.HandHeld-Entertainment+xml"},
+                    {"hbci", 4, "application/vnd.hbci"},
+                    {"hdt", 3, "application/vnd.hdt"},
+                    {"les", 3, "application/vnd.hhe.lesson-player"},
+                    {"hpgl", 4, "application/vnd.hp-HPGL"},
+                    {"hpi", 3, "application/vnd.hp-hpid"},
+                    {"hps", 3, "application/vnd.hp-hps"},
+                    {"jlt", 3, "application/vnd.hp-jlyt"},
+                    {"pcl", 3, "application/vnd.hp-PCL"},
+                    {"sfd-hdstx", 9, "application/vnd.hydrostatix.sof-data"},
+                    {"emm", 3, "application/vnd.ibm.electronic-media"},
+                    {"mpy", 3, "application/vnd.ibm.MiniPay"},
+                    {"irm", 3, "application/vnd.ibm.rights-management"},
+                    {"sc", 2, "application/vnd.ibm.secure-container"},
+                    {"icc", 3, "application/vnd.iccprofile"},
+                    {"1905.1", 6, "application/vnd.ieee.1905"},
+                    {"igl", 3, "application/vnd.igloader"},
+                    {"imf", 3, "application/vnd.imagemeter.folder+zip"},
+                    {"imi", 3, "application/vnd.imagemeter.image+zip"},
+                    {"ivp", 3, "application/vnd.immervision-ivp"},
+                    {"ivu", 3, "application/vnd.immervision-ivu"},
+                    {"imscc", 5, "application/vnd.ims.imsccv1p1"},
+                    {"igm", 3, "application/vnd.insors.igm"},
+                    {"xpw", 3, "application/vnd.intercon.formnet"},
+                    {"i2g", 3, "application/vnd.intergeo"},
+                    {"qbo", 3, "application/vnd.intu.qbo"},
+                    {"qfx", 3, "application/vnd.intu.qfx"},
+                    {"car", 3, "application/vnd.ipld.car"},
+                    {"rcprofile", 9, "application/vnd.ipunplugged.rcprofile"},
+                    {"irp", 3, "application/vnd.irepository.package+xml"},
+                    {"xpr", 3, "application/vnd.is-xpr"},
+                    {"fcs", 3, "application/vnd.isac.fcs"},
+                    {"jam", 3, "application/vnd.jam"},
+                    {"rms", 3, "application/vnd.jcp.javame.midlet-rms"},
+                    {"jisp", 4, "application/vnd.jisp"},
+                    {"joda", 4, "application/vnd.joost.joda-archive"},
+                    {"ktz", 3, "application/vnd.kahootz"},
+                    {"karbon", 6, "application/vnd.kde.karbon"},
+                    {"chrt", 4, "application/vnd.kde.kchart"},
+                    {"kfo", 3, "application/vnd.kde.kformula"},
+                    {"flw", 3, "application/vnd.kde.kivio"},
+                    {"kon", 3, "application/vnd.kde.kontour"},
+                    {"kpr", 3, "application/vnd.kde.kpresenter"},
+                    {"ksp", 3, "application/vnd.kde.kspread"},
+                    {"kwd", 3, "application/vnd.kde.kword"},
+                    {"htke", 4, "application/vnd.kenameaapp"},
+                    {"kia", 3, "application/vnd.kidspiration"},
+                    {"kne", 3, "application/vnd.Kinar"},
+                    {"skp", 3, "application/vnd.koan"},
+                    {"sse", 3, "application/vnd.kodak-descriptor"},
+                    {"las", 3, "application/vnd.las"},
+                    {"lasjson", 7, "application/vnd.las.las+json"},
+                    {"lasxml", 6, "application/vnd.las.las+xml"},
+                    {"lbd", 3, "application/vnd.llamagraphics.life-balance.desktop"},
+                    {"lbe", 3, "application/vnd.llamagraphics.life-balance.exchange+xml"},
+                    {"lcs", 3, "application/vnd.logipipe.circuit+zip"},
+                    {"loom", 4, "application/vnd.loom"},
+                    {"123", 3, "application/vnd.lotus-1-2-3"},
+                    {"apr", 3, "application/vnd.lotus-approach"},
+                    {"prz", 3, "application/vnd.lotus-freelance"},
+                    {"nsf", 3, "application/vnd.lotus-notes"},
+                    {"or3", 3, "application/vnd.lotus-organizer"},
+                    {"scm", 3, "application/vnd.lotus-screencam"},
+                    {"lwp", 3, "application/vnd.lotus-wordpro"},
+                    {"portpkg", 7, "application/vnd.macports.portpkg"},
+                    {"mvt", 3, "application/vnd.mapbox-vector-tile"},
+                    {"mdc", 3, "application/vnd.marlin.drm.mdcf"},
+                    {"3tz", 3, "application/vnd.maxar.archive.3tz+zip"},
+                    {"mmdb", 4, "application/vnd.maxmind.maxmind-db"},
+                    {"mcd", 3, "application/vnd.mcd"},
+                    {"mc1", 3, "application/vnd.medcalcdata"},
+                    {"cdkey", 5, "application/vnd.mediastation.cdkey"},
+                    {"rxt", 3, "application/vnd.medicalholodeck.recordxr"},
+                    {"mwf", 3, "application/vnd.MFER"},
+                    {"mfm", 3, "application/vnd.mfmp"},
+                    {"flo", 3, "application/vnd.micrografx.flo"},
+                    {"igx", 3, "application/vnd.micrografx.igx"},
+                    {"mif", 3, "application/vnd.mif"},
+                    {"daf", 3, "application/vnd.Mobius.DAF"},
+                    {"dis", 3, "application/vnd.Mobius.DIS"},
+                    {"mbk", 3, "application/vnd.Mobius.MBK"},
+                    {"mqy", 3, "application/vnd.Mobius.MQY"},
+                    {"msl", 3, "application/vnd.Mobius.MSL"},
+                    {"plc", 3, "application/vnd.Mobius.PLC"},
+                    {"txf", 3, "application/vnd.Mobius.TXF"},
+                    {"mpn", 3, "application/vnd.mophun.application"},
+                    {"mpc", 3, "application/vnd.mophun.certificate"},
+                    {"xul", 3, "application/vnd.mozilla.xul+xml"},
+                    {"3mf", 3, "application/vnd.ms-3mfdocument"},
+                    {"cil", 3, "application/vnd.ms-artgalry"},
+                    {"asf", 3, "application/vnd.ms-asf"},
+                    {"cab", 3, "application/vnd.ms-cab-compressed"},
+                    {"xls", 3, "application/vnd.ms-excel"},
+                    {"xlam", 4, "application/vnd.ms-excel.addin.macroEnabled.12"},
+                    {"xlsb", 4, "application/vnd.ms-excel.sheet.binary.macroEnabled.12"},
+                    {"xlsm", 4, "application/vnd.ms-excel.sheet.macroEnabled.12"},
+                    {"xltm", 4, "application/vnd.ms-excel.template.macroEnabled.12"},
+                    {"eot", 3, "application/vnd.ms-fontobject"},
+                    {"chm", 3, "application/vnd.ms-htmlhelp"},
+                    {"ims", 3, "application/vnd.ms-ims"},
+                    {"lrm", 3, "application/vnd.ms-lrm"},
+                    {"thmx", 4, "application/vnd.ms-officetheme"},
+                    {"cat", 3, "application/vnd.ms-pki.seccat"},
+                    {"ppt", 3, "application/vnd.ms-powerpoint"},
+                    {"ppam", 4, "application/vnd.ms-powerpoint.addin.macroEnabled.12"},
+                    {"pptm", 4, "application/vnd.ms-powerpoint.presentation.macroEnabled.12"},
+                    {"sldm", 4, "application/vnd.ms-powerpoint.slide.macroEnabled.12"},
+                    {"ppsm", 4, "application/vnd.ms-powerpoint.slideshow.macroEnabled.12"},
+                    {"potm", 4, "application/vnd.ms-powerpoint.template.macroEnabled.12"},
+                    {"mpp", 3, "application/vnd.ms-project"},
+                    {"tnef", 4, "application/vnd.ms-tnef"},
+                    {"docm", 4, "application/vnd.ms-word.document.macroEnabled.12"},
+                    {"dotm", 4, "application/vnd.ms-word.template.macroEnabled.12"},
+                    {"wcm", 3, "application/vnd.ms-works"},
+                    {"wpl", 3, "application/vnd.ms-wpl"},
+                    {"xps", 3, "application/vnd.ms-xpsdocument"},
+                    {"msa", 3, "application/vnd.msa-disk-image"},
+                    {"mseq", 4, "application/vnd.mseq"},
+                    {"crtr", 4, "application/vnd.multiad.creator"},
+                    {"cif", 3, "application/vnd.multiad.creator.cif"},
+                    {"mus", 3, "application/vnd.musician"},
+                    {"msty", 4, "application/vnd.muvee.style"},
+                    {"taglet", 6, "application/vnd.mynfc"},
+                    {"nebul", 5, "application/vnd.nebumind.line"},
+                    {"entity", 6, "application/vnd.nervana"},
+                    {"nlu", 3, "application/vnd.neurolanguage.nlu"},
+                    {"nimn", 4, "application/vnd.nimn"},
+                    {"nds", 3, "application/vnd.nintendo.nitro.rom"},
+                    {"sfc", 3, "application/vnd.nintendo.snes.rom"},
+                    {"nitf", 4, "application/vnd.nitf"},
+                    {"nnd", 3, "application/vnd.noblenet-directory"},
+                    {"nns", 3, "application/vnd.noblenet-sealer"},
+                    {"nnw", 3, "application/vnd.noblenet-web"},
+                    {"ngdat", 5, "application/vnd.nokia.n-gage.data"},
+                    {"rpst", 4, "application/vnd.nokia.radio-preset"},
+                    {"rpss", 4, "application/vnd.nokia.radio-presets"},
+                    {"edm", 3, "application/vnd.novadigm.EDM"},
+                    {"edx", 3, "application/vnd.novadigm.EDX"},
+                    {"ext", 3, "application/vnd.novadigm.EXT"},
+                    {"odb", 3, "application/vnd.oasis.opendocument.base"},
+                    {"odc", 3, "application/vnd.oasis.opendocument.chart"},
+                    {"otc", 3, "application/vnd.oasis.opendocument.chart-template"},
+                    {"odf", 3, "application/vnd.oasis.opendocument.formula"},
+                    {"odg", 3, "application/vnd.oasis.opendocument.graphics"},
+                    {"otg", 3, "application/vnd.oasis.opendocument.graphics-template"},
+                    {"odi", 3, "application/vnd.oasis.opendocument.image"},
+                    {"oti", 3, "application/vnd.oasis.opendocument.image-template"},
+                    {"odp", 3, "application/vnd.oasis.opendocument.presentation"},
+                    {"otp", 3, "application/vnd.oasis.opendocument.presentation-template"},
+                    {"ods", 3, "application/vnd.oasis.opendocument.spreadsheet"},
+                    {"ots", 3, "application/vnd.oasis.opendocument.spreadsheet-template"},
+                    {"odt", 3, "application/vnd.oasis.opendocument.text"},
+                    {"odm", 3, "application/vnd.oasis.opendocument.text-master"},
+                    {"ott", 3, "application/vnd.oasis.opendocument.text-template"},
+                    {"oth", 3, "application/vnd.oasis.opendocument.text-web"},
+                    {"xo", 2, "application/vnd.olpc-sugar"},
+                    {"dd2", 3, "application/vnd.oma.dd2+xml"},
+                    {"tam", 3, "application/vnd.onepager"},
+                    {"tamp", 4, "application/vnd.onepagertamp"},
+                    {"tamx", 4, "application/vnd.onepagertamx"},
+                    {"tat", 3, "application/vnd.onepagertat"},
+                    {"tatp", 4, "application/vnd.onepagertatp"},
+                    {"tatx", 4, "application/vnd.onepagertatx"},
+                    {"obgx", 4, "application/vnd.openblox.game+xml"},
+                    {"obg", 3, "application/vnd.openblox.game-binary"},
+                    {"oeb", 3, "application/vnd.openeye.oeb"},
+                    {"oxt", 3, "application/vnd.openofficeorg.extension"},
+                    {"osm", 3, "application/vnd.openstreetmap.data+xml"},
+                    {"pptx", 4, "application/vnd.openxmlformats-officedocument.presentationml.presentation"},
+                    {"sldx", 4, "application/vnd.openxmlformats-officedocument.presentationml.slide"},
+                    {"ppsx", 4, "application/vnd.openxmlformats-officedocument.presentationml.slideshow"},
+                    {"potx", 4, "application/vnd.openxmlformats-officedocument.presentationml.template"},
+                    {"xlsx", 4, "application/vnd.openxmlformats-officedocument.spreadsheetml.sheet"},
+                    {"xltx", 4, "application/vnd.openxmlformats-officedocument.spreadsheetml.template"},
+                    {"docx", 4, "application/vnd.openxmlformats-officedocument.wordprocessingml.document"},
+                    {"dotx", 4, "application/vnd.openxmlformats-officedocument.wordprocessingml.template"},
+                    {"ndc", 3, "application/vnd.osa.netdeploy"},
+                    {"mgp", 3, "application/vnd.osgeo.mapguide.package"},
+                    {"dp", 2, "application/vnd.osgi.dp"},
+                    {"esa", 3, "application/vnd.osgi.subsystem"},
+                    {"oxlicg", 6, "application/vnd.oxli.countgraph"},
+                    {"pdb", 3, "application/vnd.palm"},
+                    {"plp", 3, "application/vnd.panoply"},
+                    {"dive", 4, "application/vnd.patentdive"},
+                    {"paw", 3, "application/vnd.pawaafile"},
+                    {"str", 3, "application/vnd.pg.format"},
+                    {"ei6", 3, "application/vnd.pg.osasli"},
+                    {"pil", 3, "application/vnd.piaccess.application-licence"},
+                    {"efif", 4, "application/vnd.picsel"},
+                    {"wg", 2, "application/vnd.pmi.widget"},
+                    {"plf", 3, "application/vnd.pocketlearn"},
+                    {"pbd", 3, "application/vnd.powerbuilder6"},
+                    {"preminet", 8, "application/vnd.preminet"},
+                    {"box", 3, "application/vnd.previewsystems.box"},
+                    {"mgz", 3, "application/vnd.proteus.magazine"},
+                    {"psfs", 4, "application/vnd.psfs"},
+                    {"qps", 3, "application/vnd.publishare-delta-tree"},
+                    {"ptid", 4, "application/vnd.pvi.ptid1"},
+                    {"bar", 3, "application/vnd.qualcomm.brew-app-res"},
+                    {"qxd", 3, "application/vnd.Quark.QuarkXPress"},
+                    {"quox", 4, "application/vnd.quobject-quoxdocument"},
+                    {"tree", 4, "application/vnd.rainstor.data"},
+                    {"rar", 3, "application/vnd.rar"},
+                    {"bed", 3, "application/vnd.realvnc.bed"},
+                    {"mxl", 3, "application/vnd.recordare.musicxml"},
+                    {"rlm", 3, "application/vnd.resilient.logic"},
+                    {"cryptonote", 10, "application/vnd.rig.cryptonote"},
+                    {"cod", 3, "application/vnd.rim.cod"},
+                    {"link66", 6, "application/vnd.route66.link66+xml"},
+                    {"st", 2, "application/vnd.sailingtracker.track"},
+                    {"sar", 3, "application/vnd.sar"},
+                    {"scd", 3, "application/vnd.scribus"},
+                    {"s3df", 4, "application/vnd.sealed.3df"},
+                    {"scsf", 4, "application/vnd.sealed.csf"},
+                    {"sdoc", 4, "application/vnd.sealed.doc"},
+                    {"seml", 4, "application/vnd.sealed.eml"},
+                    {"smht", 4, "application/vnd.sealed.mht"},
+                    {"sppt", 4, "application/vnd.sealed.ppt"},
+                    {"stif", 4, "application/vnd.sealed.tiff"},
+                    {"sxls", 4, "application/vnd.sealed.xls"},
+                    {"stml", 4, "application/vnd.sealedmedia.softseal.html"},
+                    {"spdf", 4, "application/vnd.sealedmedia.softseal.pdf"},
+                    {"see", 3, "application/vnd.seemail"},
+                    {"sema", 4, "application/vnd.sema"},
+                    {"semd", 4, "application/vnd.semd"},
+                    {"semf", 4, "application/vnd.semf"},
+                    {"ssv", 3, "application/vnd.shade-save-file"},
+                    {"ifm", 3, "application/vnd.shana.informed.formdata"},
+                    {"itp", 3, "application/vnd.shana.informed.formtemplate"},
+                    {"iif", 3, "application/vnd.shana.informed.interchange"},
+                    {"ipk", 3, "application/vnd.shana.informed.package"},
+                    {"shp", 3, "application/vnd.shp"},
+                    {"shx", 3, "application/vnd.shx"},
+                    {"sr", 2, "application/vnd.sigrok.session"},
+                    {"twd", 3, "application/vnd.SimTech-MindMapper"},
+                    {"mmf", 3, "application/vnd.smaf"},
+                    {"notebook", 8, "application/vnd.smart.notebook"},
+                    {"teacher", 7, "application/vnd.smart.teacher"},
+                    {"ptrom", 5, "application/vnd.snesdev-page-table"},
+                    {"fo", 2, "application/vnd.software602.filler.form+xml"},
+                    {"zfo", 3, "application/vnd.software602.filler.form-xml-zip"},
+                    {"sdkm", 4, "application/vnd.solent.sdkm+xml"},
+                    {"dxp", 3, "application/vnd.spotfire.dxp"},
+                    {"sfs", 3, "application/vnd.spotfire.sfs"},
+                    {"sqlite", 6, "application/vnd.sqlite3"},
+                    {"sdc", 3, "application/vnd.stardivision.calc"},
+                    {"sds", 3, "application/vnd.stardivision.chart"},
+                    {"sda", 3, "application/vnd.stardivision.draw"},
+                    {"sdd", 3, "application/vnd.stardivision.impress"},
+                    {"smf", 3, "application/vnd.stardivision.math"},
+                    {"sdw", 3, "application/vnd.stardivision.writer"},
+                    {"sgl", 3, "application/vnd.stardivision.writer-global"},
+                    {"smzip", 5, "application/vnd.stepmania.package"},
+                    {"sm", 2, "application/vnd.stepmania.stepchart"},
+                    {"wadl", 4, "application/vnd.sun.wadl+xml"},
+                    {"sxc", 3, "application/vnd.sun.xml.calc"},
+                    {"stc", 3, "application/vnd.sun.xml.calc.template"},
+                    {"sxd", 3, "application/vnd.sun.xml.draw"},
+                    {"std", 3, "application/vnd.sun.xml.draw.template"},
+                    {"sxi", 3, "application/vnd.sun.xml.impress"},
+                    {"sti", 3, "application/vnd.sun.xml.impress.template"},
+                    {"sxm", 3, "application/vnd.sun.xml.math"},
+                    {"sxw", 3, "application/vnd.sun.xml.writer"},
+                    {"sxg", 3, "application/vnd.sun.xml.writer.global"},
+                    {"stw", 3, "application/vnd.sun.xml.writer.template"},
+                    {"sus", 3, "application/vnd.sus-calendar"},
+                    {"ml2", 3, "application/vnd.sybyl.mol2"},
+                    {"scl", 3, "application/vnd.sycle+xml"},
+                    {"syft.json", 9, "application/vnd.syft+json"},
+                    {"sis", 3, "application/vnd.symbian.install"},
+                    {"xsm", 3, "application/vnd.syncml+xml"},
+                    {"bdm", 3, "application/vnd.syncml.dm+wbxml"},
+                    {"xdm", 3, "application/vnd.syncml.dm+xml"},
+                    {"ddf", 3, "application/vnd.syncml.dmddf+xml"},
+                    {"tao", 3, "application/vnd.tao.intent-module-archive"},
+                    {"pcap", 4, "application/vnd.tcpdump.pcap"},
+                    {"qvd", 3, "application/vnd.theqvd"},
+                    {"ppttc", 5, "application/vnd.think-cell.ppttc+json"},
+                    {"vfr", 3, "application/vnd.tml"},
+                    {"tmo", 3, "application/vnd.tmobile-livetv"},
+                    {"tpt", 3, "application/vnd.trid.tpt"},
+                    {"mxs", 3, "application/vnd.triscape.mxs"},
+                    {"tra", 3, "application/vnd.trueapp"},
+                    {"ufdl", 4, "application/vnd.ufdl"},
+                    {"utz", 3, "application/vnd.uiq.theme"},
+                    {"umj", 3, "application/vnd.umajin"},
+                    {"unityweb", 8, "application/vnd.unity"},
+                    {"uoml", 4, "application/vnd.uoml+xml"},
+                    {"urim", 4, "application/vnd.uri-map"},
+                    {"vmt", 3, "application/vnd.valve.source.material"},
+                    {"vcx", 3, "application/vnd.vcx"},
+                    {"mxi", 3, "application/vnd.vd-study"},
+                    {"vwx", 3, "application/vnd.vectorworks"},
+                    {"aion", 4, "application/vnd.veritone.aion+json"},
+                    {"istc", 4, "application/vnd.veryant.thin"},
+                    {"ves", 3, "application/vnd.ves.encrypted"},
+                    {"vsc", 3, "application/vnd.vidsoft.vidconference"},
+                    {"vsd", 3, "application/vnd.visio"},
+                    {"vis", 3, "application/vnd.visionary"},
+                    {"vsf", 3, "application/vnd.vsf"},
+                    {"sic", 3, "application/vnd.wap.sic"},
+                    {"slc", 3, "application/vnd.wap.slc"},
+                    {"wbxml", 5, "application/vnd.wap.wbxml"},
+                    {"wmlc", 4, "application/vnd.wap.wmlc"},
+                    {"wmlsc", 5, "application/vnd.wap.wmlscriptc"},
+                    {"wafl", 4, "application/vnd.wasmflow.wafl"},
+                    {"wtb", 3, "application/vnd.webturbo"},
+                    {"p2p", 3, "application/vnd.wfa.p2p"},
+                    {"wsc", 3, "application/vnd.wfa.wsc"},
+                    {"wmc", 3, "application/vnd.wmc"},
+                    {"nb", 2, "application/vnd.wolfram.mathematica"},
+                    {"m", 1, "application/vnd.wolfram.mathematica.package"},
+                    {"nbp", 3, "application/vnd.wolfram.player"},
+                    {"wpd", 3, "application/vnd.wordperfect"},
+                    {"wqd", 3, "application/vnd.wqd"},
+                    {"stf", 3, "application/vnd.wt.stf"},
+                    {"wv", 2, "application/vnd.wv.csp+wbxml"},
+                    {"xar", 3, "application/vnd.xara"},
+                    {"xfdl", 4, "application/vnd.xfdl"},
+                    {"cpkg", 4, "application/vnd.xmpie.cpkg"},
+                    {"dpkg", 4, "application/vnd.xmpie.dpkg"},
+                    {"ppkg", 4, "application/vnd.xmpie.ppkg"},
+                    {"xlim", 4, "application/vnd.xmpie.xlim"},
+                    {"hvd", 3, "application/vnd.yamaha.hv-dic"},
+                    {"hvs", 3, "application/vnd.yamaha.hv-script"},
+                    {"hvp", 3, "application/vnd.yamaha.hv-voice"},
+                    {"osf", 3, "application/vnd.yamaha.openscoreformat"},
+                    {"saf", 3, "application/vnd.yamaha.smaf-audio"},
+                    {"spf", 3, "application/vnd.yamaha.smaf-phrase"},
+                    {"yme", 3, "application/vnd.yaoweme"},
+                    {"cmp", 3, "application/vnd.yellowriver-custom-menu"},
+                    {"zir", 3, "application/vnd.zul"},
+                    {"zaz", 3, "application/vnd.zzazz.deck+xml"},
+                    {"vxml", 4, "application/voicexml+xml"},
+                    {"vcj", 3, "application/voucher-cms+json"},
+                    {"wasm", 4, "application/wasm"},
+                    {"wif", 3, "application/watcherinfo+xml"},
+                    {"wgt", 3, "application/widget"},
+                    {"wsdl", 4, "application/wsdl+xml"},
+                    {"wspolicy", 8, "application/wspolicy+xml"},
+                    {"wk", 2, "application/x-123"},
+                    {"7z", 2, "application/x-7z-compressed"},
+                    {"abw", 3, "application/x-abiword"},
+                    {"dmg", 3, "application/x-apple-diskimage"},
+                    {"bcpio", 5, "application/x-bcpio"},
+                    {"torrent", 7, "application/x-bittorrent"},
+                    {"cdf", 3, "application/x-cdf"},
+                    {"vcd", 3, "application/x-cdlink"},
+                    {"mph", 3, "application/x-comsol"},
+                    {"cpio", 4, "application/x-cpio"},
+                    {"csh", 3, "application/x-csh"},
+                    {"dcr", 3, "application/x-director"},
+                    {"wad", 3, "application/x-doom"},
+                    {"dvi", 3, "application/x-dvi"},
+                    {"pfa", 3, "application/x-font"},
+                    {"pcf", 3, "application/x-font-pcf"},
+                    {"mm", 2, "application/x-freemind"},
+                    {"gan", 3, "application/x-ganttproject"},
+                    {"gnumeric", 8, "application/x-gnumeric"},
+                    {"sgf", 3, "application/x-go-sgf"},
+                    {"gcf", 3, "application/x-graphing-calculator"},
+                    {"gtar", 4, "application/x-gtar"},
+                    {"tgz", 3, "application/x-gtar-compressed"},
+                    {"hdf", 3, "application/x-hdf"},
+                    {"hwp", 3, "application/x-hwp"},
+                    {"ica", 3, "application/x-ica"},
+                    {"info", 4, "application/x-info"},
+                    {"ins", 3, "application/x-internet-signup"},
+                    {"iii", 3, "application/x-iphone"},
+                    {"iso", 3, "application/x-iso9660-image"},
+                    {"jnlp", 4, "application/x-java-jnlp-file"},
+                    {"jmz", 3, "application/x-jmol"},
+                    {"kil", 3, "application/x-killustrator"},
+                    {"latex", 5, "application/x-latex"},
+                    {"lha", 3, "application/x-lha"},
+                    {"lyx", 3, "application/x-lyx"},
+                    {"lzh", 3, "application/x-lzh"},
+                    {"lzx", 3, "application/x-lzx"},
+                    {"frm", 3, "application/x-maker"},
+                    {"wmd", 3, "application/x-ms-wmd"},
+                    {"wmz", 3, "application/x-ms-wmz"},
+                    {"com", 3, "application/x-msdos-program"},
+                    {"msi", 3, "application/x-msi"},
+                    {"nc", 2, "application/x-netcdf"},
+                    {"pac", 3, "application/x-ns-proxy-autoconfig"},
+                    {"nwc", 3, "application/x-nwc"},
+                    {"o", 1, "application/x-object"},
+                    {"oza", 3, "application/x-oz-application"},
+                    {"p7r", 3, "application/x-pkcs7-certreqresp"},
+                    {"pyc", 3, "application/x-python-code"},
+                    {"qgs", 3, "application/x-qgis"},
+                    {"qtl", 3, "application/x-quicktimeplayer"},
+                    {"rdp", 3, "application/x-rdp"},
+                    {"rpm", 3, "application/x-redhat-package-manager"},
+                    {"rss", 3, "application/x-rss+xml"},
+                    {"rb", 2, "application/x-ruby"},
+                    {"sci", 3, "application/x-scilab"},
+                    {"xcos", 4, "application/x-scilab-xcos"},
+                    {"sh", 2, "application/x-sh"},
+                    {"shar", 4, "application/x-shar"},
+                    {"scr", 3, "application/x-silverlight"},
+                    {"sit", 3, "application/x-stuffit"},
+                    {"sv4cpio", 7, "application/x-sv4cpio"},
+                    {"sv4crc", 6, "application/x-sv4crc"},
+                    {"tar", 3, "application/x-tar"},
+                    {"tcl", 3, "application/x-tcl"},
+                    {"gf", 2, "application/x-tex-gf"},
+                    {"pk", 2, "application/x-tex-pk"},
+                    {"texinfo", 7, "application/x-texinfo"},
+                    {"~", 1, "application/x-trash"},
+                    {"man", 3, "application/x-troff-man"},
+                    {"me", 2, "application/x-troff-me"},
+                    {"ms", 2, "application/x-troff-ms"},
+                    {"ustar", 5, "application/x-ustar"},
+                    {"src", 3, "application/x-wais-source"},
+                    {"wz", 2, "application/x-wingz"},
+                    {"crt", 3, "application/x-x509-ca-cert"},
+                    {"fig", 3, "application/x-xfig"},
+                    {"xpi", 3, "application/x-xpinstall"},
+                    {"xz", 2, "application/x-xz"},
+                    {"xav", 3, "application/xcap-att+xml"},
+                    {"xca", 3, "application/xcap-caps+xml"},
+                    {"xdf", 3, "application/xcap-diff+xml"},
+                    {"xel", 3, "application/xcap-el+xml"},
+                    {"xer", 3, "application/xcap-error+xml"},
+                    {"xns", 3, "application/xcap-ns+xml"},
+                    {"xfdf", 4, "application/xfdf"},
+                    {"xhtml", 5, "application/xhtml+xml"},
+                    {"xlf", 3, "application/xliff+xml"},
+                    {"xml", 3, "application/xml"},
+                    {"dtd", 3, "application/xml-dtd"},
+                    {"ent", 3, "application/xml-external-parsed-entity"},
+                    {"xop", 3, "application/xop+xml"},
+                    {"xsl", 3, "application/xslt+xml"},
+                    {"xspf", 4, "application/xspf+xml"},
+                    {"mxml", 4, "application/xv+xml"},
+                    {"yaml", 4, "application/yaml"},
+                    {"yang", 4, "application/yang"},
+                    {"yin", 3, "application/yin+xml"},
+                    {"zip", 3, "application/zip"},
+                    {"zst", 3, "application/zstd"},
+                    {"726", 3, "audio/32kadpcm"},
+                    {"adts", 4, "audio/aac"},
+                    {"ac3", 3, "audio/ac3"},
+                    {"amr", 3, "audio/AMR"},
+                    {"awb", 3, "audio/AMR-WB"},
+                    {"axa", 3, "audio/annodex"},
+                    {"acn", 3, "audio/asc"},
+                    {"aal", 3, "audio/ATRAC-ADVANCED-LOSSLESS"},
+                    {"atx", 3, "audio/ATRAC-X"},
+                    {"at3", 3, "audio/ATRAC3"},
+                    {"au", 2, "audio/basic"},
+                    {"csd", 3, "audio/csound"},
+                    {"dls", 3, "audio/dls"},
+                    {"evc", 3, "audio/EVRC"},
+                    {"qcp", 3, "audio/EVRC-QCP"},
+                    {"evb", 3, "audio/EVRCB"},
+                    {"enw", 3, "audio/EVRCNW"},
+                    {"evw", 3, "audio/EVRCWB"},
+                    {"flac", 4, "audio/flac"},
+                    {"lbc", 3, "audio/iLBC"},
+                    {"l16", 3, "audio/L16"},
+                    {"mhas", 4, "audio/mhas"},
+                    {"mxmf", 4, "audio/mobile-xmf"},
+                    {"m4a", 3, "audio/mp4"},
+                    {"mp3", 3, "audio/mpeg"},
+                    {"m3u", 3, "audio/mpegurl"},
+                    {"oga", 3, "audio/ogg"},
+                    {"sid", 3, "audio/prs.sid"},
+                    {"smv", 3, "audio/SMV"},
+                    {"sofa", 4, "audio/sofa"},
+                    {"mid", 3, "audio/sp-midi"},
+                    {"loas", 4, "audio/usac"},
+                    {"koz", 3, "audio/vnd.audiokoz"},
+                    {"uva", 3, "audio/vnd.dece.audio"},
+                    {"eol", 3, "audio/vnd.digital-winds"},
+                    {"mlp", 3, "audio/vnd.dolby.mlp"},
+                    {"dts", 3, "audio/vnd.dts"},
+                    {"dtshd", 5, "audio/vnd.dts.hd"},
+                    {"plj", 3, "audio/vnd.everad.plj"},
+                    {"lvp", 3, "audio/vnd.lucent.voice"},
+                    {"pya", 3, "audio/vnd.ms-playready.media.pya"},
+                    {"vbk", 3, "audio/vnd.nortel.vbk"},
+                    {"ecelp4800", 9, "audio/vnd.nuera.ecelp4800"},
+                    {"ecelp7470", 9, "audio/vnd.nuera.ecelp7470"},
+                    {"ecelp9600", 9, "audio/vnd.nuera.ecelp9600"},
+                    {"multitrack", 10, "audio/vnd.presonus.multitrack"},
+                    {"rip", 3, "audio/vnd.rip"},
+                    {"smp3", 4, "audio/vnd.sealedmedia.softseal.mpeg"},
+                    {"aif", 3, "audio/x-aiff"},
+                    {"gsm", 3, "audio/x-gsm"},
+                    {"wax", 3, "audio/x-ms-wax"},
+                    {"wma", 3, "audio/x-ms-wma"},
+                    {"ra", 2, "audio/x-pn-realaudio"},
+                    {"pls", 3, "audio/x-scpls"},
+                    {"sd2", 3, "audio/x-sd2"},
+                    {"wav", 3, "audio/x-wav"},
+                    {"alc", 3, "chemical/x-alchemy"},
+                    {"cac", 3, "chemical/x-cache"},
+                    {"csf", 3, "chemical/x-cache-csf"},
+                    {"cbin", 4, "chemical/x-cactvs-binary"},
+                    {"cdx", 3, "chemical/x-cdx"},
+                    {"c3d", 3, "chemical/x-chem3d"},
+                    {"chm", 3, "chemical/x-chemdraw"},
+                    {"cif", 3, "chemical/x-cif"},
+                    {"cmdf", 4, "chemical/x-cmdf"},
+                    {"cml", 3, "chemical/x-cml"},
+                    {"cpa", 3, "chemical/x-compass"},
+                    {"bsd", 3, "chemical/x-crossfire"},
+                    {"csml", 4, "chemical/x-csml"},
+                    {"ctx", 3, "chemical/x-ctx"},
+                    {"cxf", 3, "chemical/x-cxf"},
+                    {"emb", 3, "chemical/x-embl-dl-nucleotide"},
+                    {"spc", 3, "chemical/x-galactic-spc"},
+                    {"inp", 3, "chemical/x-gamess-input"},
+                    {"fch", 3, "chemical/x-gaussian-checkpoint"},
+                    {"cub", 3, "chemical/x-gaussian-cube"},
+                    {"gau", 3, "chemical/x-gaussian-input"},
+                    {"gal", 3, "chemical/x-gaussian-log"},
+                    {"gcg", 3, "chemical/x-gcg8-sequence"},
+                    {"gen", 3, "chemical/x-genbank"},
+                    {"hin", 3, "chemical/x-hin"},
+                    {"istr", 4, "chemical/x-isostar"},
+                    {"jdx", 3, "chemical/x-jcamp-dx"},
+                    {"kin", 3, "chemical/x-kinemage"},
+                    {"mcm", 3, "chemical/x-macmolecule"},
+                    {"mmod", 4, "chemical/x-macromodel-input"},
+                    {"mol", 3, "chemical/x-mdl-molfile"},
+                    {"rd", 2, "chemical/x-mdl-rdfile"},
+                    {"rxn", 3, "chemical/x-mdl-rxnfile"},
+                    {"sd", 2, "chemical/x-mdl-sdfile"},
+                    {"tgf", 3, "chemical/x-mdl-tgf"},
+                    {"mcif", 4, "chemical/x-mmcif"},
+                    {"b", 1, "chemical/x-molconn-Z"},
+                    {"gpt", 3, "chemical/x-mopac-graph"},
+                    {"mop", 3, "chemical/x-mopac-input"},
+                    {"moo", 3, "chemical/x-mopac-out"},
+                    {"mvb", 3, "chemical/x-mopac-vib"},
+                    {"asn", 3, "chemical/x-ncbi-asn1"},
+                    {"prt", 3, "chemical/x-ncbi-asn1-ascii"},
+                    {"val", 3, "chemical/x-ncbi-asn1-binary"},
+                    {"asn", 3, "chemical/x-ncbi-asn1-spec"},
+                    {"pdb", 3, "chemical/x-pdb"},
+                    {"ros", 3, "chemical/x-rosdal"},
+                    {"sw", 2, "chemical/x-swissprot"},
+                    {"vms", 3, "chemical/x-vamas-iso14976"},
+                    {"vmd", 3, "chemical/x-vmd"},
+                    {"xtel", 4, "chemical/x-xtel"},
+                    {"xyz", 3, "chemical/x-xyz"},
+                    {"ttc", 3, "font/collection"},
+                    {"otf", 3, "font/otf"},
+                    {"ttf", 3, "font/ttf"},
+                    {"woff", 4, "font/woff"},
+                    {"woff2", 5, "font/woff2"},
+                    {"exr", 3, "image/aces"},
+                    {"apng", 4, "image/apng"},
+                    {"avci", 4, "image/avci"},
+                    {"avcs", 4, "image/avcs"},
+                    {"avif", 4, "image/avif"},
+                    {"bmp", 3, "image/bmp"},
+                    {"cgm", 3, "image/cgm"},
+                    {"drle", 4, "image/dicom-rle"},
+                    {"dpx", 3, "image/dpx"},
+                    {"emf", 3, "image/emf"},
+                    {"fits", 4, "image/fits"},
+                    {"gif", 3, "image/gif"},
+                    {"heic", 4, "image/heic"},
+                    {"heics", 5, "image/heic-sequence"},
+                    {"heif", 4, "image/heif"},
+                    {"heifs", 5, "image/heif-sequence"},
+                    {"hej2", 4, "image/hej2k"},
+                    {"hsj2", 4, "image/hsj2"},
+                    {"ief", 3, "image/ief"},
+                    {"jls", 3, "image/jls"},
+                    {"jp2", 3, "image/jp2"},
+                    {"jpg", 3, "image/jpeg"},
+                    {"jph", 3, "image/jph"},
+                    {"jhc", 3, "image/jphc"},
+                    {"jpm", 3, "image/jpm"},
+                    {"jpx", 3, "image/jpx"},
+                    {"jxl", 3, "image/jxl"},
+                    {"jxr", 3, "image/jxr"},
+                    {"jxra", 4, "image/jxrA"},
+                    {"jxrs", 4, "image/jxrS"},
+                    {"jxs", 3, "image/jxs"},
+                    {"jxsc", 4, "image/jxsc"},
+                    {"jxsi", 4, "image/jxsi"},
+                    {"jxss", 4, "image/jxss"},
+                    {"ktx", 3, "image/ktx"},
+                    {"ktx2", 4, "image/ktx2"},
+                    {"png", 3, "image/png"},
+                    {"btif", 4, "image/prs.btif"},
+                    {"pti", 3, "image/prs.pti"},
+                    {"svg", 3, "image/svg+xml"},
+                    {"tiff", 4, "image/tiff"},
+                    {"tfx", 3, "image/tiff-fx"},
+                    {"psd", 3, "image/vnd.adobe.photoshop"},
+                    {"azv", 3, "image/vnd.airzip.accelerator.azv"},
+                    {"uvi", 3, "image/vnd.dece.graphic"},
+                    {"djvu", 4, "image/vnd.djvu"},
+                    {"dwg", 3, "image/vnd.dwg"},
+                    {"dxf", 3, "image/vnd.dxf"},
+                    {"fbs", 3, "image/vnd.fastbidsheet"},
+                    {"fpx", 3, "image/vnd.fpx"},
+                    {"fst", 3, "image/vnd.fst"},
+                    {"mmr", 3, "image/vnd.fujixerox.edmics-mmr"},
+                    {"rlc", 3, "image/vnd.fujixerox.edmics-rlc"},
+                    {"pgb", 3, "image/vnd.globalgraphics.pgb"},
+                    {"ico", 3, "image/vnd.microsoft.icon"},
+                    {"mdi", 3, "image/vnd.ms-modi"},
+                    {"b16", 3, "image/vnd.pco.b16"},
+                    {"hdr", 3, "image/vnd.radiance"},
+                    {"spng", 4, "image/vnd.sealed.png"},
+                    {"sgif", 4, "image/vnd.sealedmedia.softseal.gif"},
+                    {"sjpg", 4, "image/vnd.sealedmedia.softseal.jpg"},
+                    {"tap", 3, "image/vnd.tencent.tap"},
+                    {"vtf", 3, "image/vnd.valve.source.texture"},
+                    {"wbmp", 4, "image/vnd.wap.wbmp"},
+                    {"xif", 3, "image/vnd.xiff"},
+                    {"pcx", 3, "image/vnd.zbrush.pcx"},
+                    {"webp", 4, "image/webp"},
+                    {"wmf", 3, "image/wmf"},
+                    {"cr2", 3, "image/x-canon-cr2"},
+                    {"crw", 3, "image/x-canon-crw"},
+                    {"ras", 3, "image/x-cmu-raster"},
+                    {"cdr", 3, "image/x-coreldraw"},
+                    {"pat", 3, "image/x-coreldrawpattern"},
+                    {"cdt", 3, "image/x-coreldrawtemplate"},
+                    {"cpt", 3, "image/x-corelphotopaint"},
+                    {"erf", 3, "image/x-epson-erf"},
+                    {"ico", 3, "image/x-icon"},
+                    {"art", 3, "image/x-jg"},
+                    {"jng", 3, "image/x-jng"},
+                    {"nef", 3, "image/x-nikon-nef"},
+                    {"orf", 3, "image/x-olympus-orf"},
+                    {"pnm", 3, "image/x-portable-anymap"},
+                    {"pbm", 3, "image/x-portable-bitmap"},
+                    {"pgm", 3, "image/x-portable-graymap"},
+                    {"ppm", 3, "image/x-portable-pixmap"},
+                    {"rgb", 3, "image/x-rgb"},
+                    {"xbm", 3, "image/x-xbitmap"},
+                    {"xcf", 3, "image/x-xcf"},
+                    {"xpm", 3, "image/x-xpixmap"},
+                    {"xwd", 3, "image/x-xwindowdump"},
+                    {"u8msg", 5, "message/global"},
+                    {"u8dsn", 5, "message/global-delivery-status"},
+                    {"u8mdn", 5, "message/global-disposition-notification"},
+                    {"u8hdr", 5, "message/global-headers"},
+                    {"eml", 3, "message/rfc822"},
+                    {"gltf", 4, "model/gltf+json"},
+                    {"glb", 3, "model/gltf-binary"},
+                    {"igs", 3, "model/iges"},
+                    {"jt", 2, "model/JT"},
+                    {"msh", 3, "model/mesh"},
+                    {"mtl", 3, "model/mtl"},
+                    {"obj", 3, "model/obj"},
+                    {"prc", 3, "model/prc"},
+                    {"stp", 3, "model/step"},
+                    {"stpx", 4, "model/step+xml"},
+                    {"stpz", 4, "model/step+zip"},
+                    {"stpxz", 5, "model/step-xml+zip"},
+                    {"stl", 3, "model/stl"},
+                    {"u3d", 3, "model/u3d"},
+                    {"cld", 3, "model/vnd.cld"},
+                    {"dae", 3, "model/vnd.collada+xml"},
+                    {"dwf", 3, "model/vnd.dwf"},
+                    {"gdl", 3, "model/vnd.gdl"},
+                    {"gtw", 3, "model/vnd.gtw"},
+                    {"moml", 4, "model/vnd.moml+xml"},
+                    {"mts", 3, "model/vnd.mts"},
+                    {"ogex", 4, "model/vnd.opengex"},
+                    {"x_b", 3, "model/vnd.parasolid.transmit.binary"},
+                    {"x_t", 3, "model/vnd.parasolid.transmit.text"},
+                    {"pyox", 4, "model/vnd.pytha.pyox"},
+                    {"vds", 3, "model/vnd.sap.vds"},
+                    {"usda", 4, "model/vnd.usda"},
+                    {"usdz", 4, "model/vnd.usdz+zip"},
+                    {"bsp", 3, "model/vnd.valve.source.compiled-map"},
+                    {"vtu", 3, "model/vnd.vtu"},
+                    {"wrl", 3, "model/vrml"},
+                    {"x3db", 4, "model/x3d+fastinfoset"},
+                    {"x3d", 3, "model/x3d+xml"},
+                    {"x3dv", 4, "model/x3d-vrml"},
+                    {"bmed", 4, "multipart/vnd.bint.med-plus"},
+                    {"vpm", 3, "multipart/voice-message"},
+                    {"appcache", 8, "text/cache-manifest"},
+                    {"ics", 3, "text/calendar"},
+                    {"cql", 3, "text/cql"},
+                    {"css", 3, "text/css"},
+                    {"csv", 3, "text/csv"},
+                    {"csvs", 4, "text/csv-schema"},
+                    {"soa", 3, "text/dns"},
+                    {"gff3", 4, "text/gff3"},
+                    {"html", 4, "text/html"},
+                    {"js", 2, "text/javascript"},
+                    {"cnd", 3, "text/jcr-cnd"},
+                    {"md", 2, "text/markdown"},
+                    {"miz", 3, "text/mizar"},
+                    {"n3", 2, "text/n3"},
+                    {"txt", 3, "text/plain"},
+                    {"provn", 5, "text/provenance-notation"},
+                    {"rst", 3, "text/prs.fallenstein.rst"},
+                    {"tag", 3, "text/prs.lines.tag"},
+                    {"sgml", 4, "text/SGML"},
+                    {"shaclc", 6, "text/shaclc"},
+                    {"shex", 4, "text/shex"},
+                    {"spdx", 4, "text/spdx"},
+                    {"tsv", 3, "text/tab-separated-values"},
+                    {"tm", 2, "text/texmacs"},
+                    {"t", 1, "text/troff"},
+                    {"ttl", 3, "text/turtle"},
+                    {"uris", 4, "text/uri-list"},
+                    {"vcf", 3, "text/vcard"},
+                    {"a", 1, "text/vnd.a"},
+                    {"abc", 3, "text/vnd.abc"},
+                    {"ascii", 5, "text/vnd.ascii-art"},
+                    {"curl", 4, "text/vnd.curl"},
+                    {"copyright", 9, "text/vnd.debian.copyright"},
+                    {"dms", 3, "text/vnd.DMClientScript"},
+                    {"jtd", 3, "text/vnd.esmertec.theme-descriptor"},
+                    {"vfk", 3, "text/vnd.exchangeable"},
+                    {"ged", 3, "text/vnd.familysearch.gedcom"},
+                    {"flt", 3, "text/vnd.ficlab.flt"},
+                    {"fly", 3, "text/vnd.fly"},
+                    {"flx", 3, "text/vnd.fmi.flexstor"},
+                    {"gv", 2, "text/vnd.graphviz"},
+                    {"hans", 4, "text/vnd.hans"},
+                    {"hgl", 3, "text/vnd.hgl"},
+                    {"3dml", 4, "text/vnd.in3d.3dml"},
+                    {"spot", 4, "text/vnd.in3d.spot"},
+                    {"mpf", 3, "text/vnd.ms-mediapackage"},
+                    {"ccc", 3, "text/vnd.net2phone.commcenter.command"},
+                    {"mc2", 3, "text/vnd.senx.warpscript"},
+                    {"sos", 3, "text/vnd.sosi"},
+                    {"jad", 3, "text/vnd.sun.j2me.app-descriptor"},
+                    {"ts", 2, "text/vnd.trolltech.linguist"},
+                    {"si", 2, "text/vnd.wap.si"},
+                    {"sl", 2, "text/vnd.wap.sl"},
+                    {"wml", 3, "text/vnd.wap.wml"},
+                    {"wmls", 4, "text/vnd.wap.wmlscript"},
+                    {"vtt", 3, "text/vtt"},
+                    {"wgsl", 4, "text/wgsl"},
+                    {"bib", 3, "text/x-bibtex"},
+                    {"boo", 3, "text/x-boo"},
+                    {"h++", 3, "text/x-c++hdr"},
+                    {"c++", 3, "text/x-c++src"},
+                    {"h", 1, "text/x-chdr"},
+                    {"htc", 3, "text/x-component"},
+                    {"csh", 3, "text/x-csh"},
+                    {"c", 1, "text/x-csrc"},
+                    {"diff", 4, "text/x-diff"},
+                    {"d", 1, "text/x-dsrc"},
+                    {"hs", 2, "text/x-haskell"},
+                    {"java", 4, "text/x-java"},
+                    {"ly", 2, "text/x-lilypond"},
+                    {"lhs", 3, "text/x-literate-haskell"},
+                    {"moc", 3, "text/x-moc"},
+                    {"p", 1, "text/x-pascal"},
+                    {"gcd", 3, "text/x-pcs-gcd"},
+                    {"pl", 2, "text/x-perl"},
+                    {"py", 2, "text/x-python"},
+                    {"scala", 5, "text/x-scala"},
+                    {"etx", 3, "text/x-setext"},
+                    {"sfv", 3, "text/x-sfv"},
+                    {"sh", 2, "text/x-sh"},
+                    {"tcl", 3, "text/x-tcl"},
+                    {"tex", 3, "text/x-tex"},
+                    {"vcs", 3, "text/x-vcalendar"},
+                    {"axv", 3, "video/annodex"},
+                    {"dif", 3, "video/dv"},
+                    {"fli", 3, "video/fli"},
+                    {"gl", 2, "video/gl"},
+                    {"m4s", 3, "video/iso.segment"},
+                    {"mj2", 3, "video/mj2"},
+                    {"ts", 2, "video/mp2t"},
+                    {"mp4", 3, "video/mp4"},
+                    {"mpeg", 4, "video/mpeg"},
+                    {"ogv", 3, "video/ogg"},
+                    {"qt", 2, "video/quicktime"},
+                    {"uvh", 3, "video/vnd.dece.hd"},
+                    {"uvm", 3, "video/vnd.dece.mobile"},
+                    {"uvu", 3, "video/vnd.dece.mp4"},
+                    {"uvp", 3, "video/vnd.dece.pd"},
+                    {"uvs", 3, "video/vnd.dece.sd"},
+                    {"uvv", 3, "video/vnd.dece.video"},
+                    {"dvb", 3, "video/vnd.dvb.file"},
+                    {"fvt", 3, "video/vnd.fvt"},
+                    {"mxu", 3, "video/vnd.mpegurl"},
+                    {"pyv", 3, "video/vnd.ms-playready.media.pyv"},
+                    {"nim", 3, "video/vnd.nokia.interleaved-multimedia"},
+                    {"bik", 3, "video/vnd.radgamettools.bink"},
+                    {"smk", 3, "video/vnd.radgamettools.smacker"},
+                    {"smpg", 4, "video/vnd.sealed.mpeg1"},
+                    {"s14", 3, "video/vnd.sealed.mpeg4"},
+                    {"sswf", 4, "video/vnd.sealed.swf"},
+                    {"smov", 4, "video/vnd.sealedmedia.softseal.mov"},
+                    {"viv", 3, "video/vnd.vivo"},
+                    {"yt", 2, "video/vnd.youtube.yt"},
+                    {"webm", 4, "video/webm"},
+                    {"flv", 3, "video/x-flv"},
+                    {"lsf", 3, "video/x-la-asf"},
+                    {"mpv", 3, "video/x-matroska"},
+                    {"mng", 3, "video/x-mng"},
+                    {"wm", 2, "video/x-ms-wm"},
+                    {"wmv", 3, "video/x-ms-wmv"},
+                    {"wmx", 3, "video/x-ms-wmx"},
+                    {"wvx", 3, "video/x-ms-wvx"},
+                    {"avi", 3, "video/x-msvideo"},
+                    {"movie", 5, "video/x-sgi-movie"},
+                };
+            } // namespace detail
+        }     // namespace http_content_type
+    }         // namespace network
+} // namespace util
+
+#endif
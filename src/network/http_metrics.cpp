@@ -0,0 +1,315 @@
+﻿#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "lock/lock_holder.h"
+
+#include "network/http_metrics.h"
+#include "network/http_request.h"
+
+namespace util {
+    namespace network {
+        namespace detail {
+            static inline int http_metrics_highest_bit(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+                return 63 - __builtin_clzll(static_cast<unsigned long long>(v));
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+                unsigned long ret;
+                _BitScanReverse64(&ret, v);
+                return static_cast<int>(ret);
+#else
+                int ret = 0;
+                while (v >>= 1) {
+                    ++ret;
+                }
+                return ret;
+#endif
+            }
+        } // namespace detail
+
+        LIBATFRAME_UTILS_API http_histogram::snapshot_t::snapshot_t() : counts(BUCKET_COUNT, 0), count(0), sum(0), min(0), max(0) {}
+
+        LIBATFRAME_UTILS_API uint64_t http_histogram::snapshot_t::percentile(double percentile) const {
+            if (0 == count) {
+                return 0;
+            }
+
+            if (percentile < 0.0) {
+                percentile = 0.0;
+            } else if (percentile > 1.0) {
+                percentile = 1.0;
+            }
+
+            uint64_t target = static_cast<uint64_t>(percentile * static_cast<double>(count) + 0.5);
+            if (target < 1) {
+                target = 1;
+            } else if (target > count) {
+                target = count;
+            }
+
+            uint64_t total = 0;
+            for (size_t i = 0; i < counts.size(); ++i) {
+                total += counts[i];
+                if (total >= target) {
+                    uint64_t ret = get_bucket_highest_value(i);
+                    return ret > max ? max : ret;
+                }
+            }
+
+            return max;
+        }
+
+        LIBATFRAME_UTILS_API double http_histogram::snapshot_t::mean() const {
+            if (0 == count) {
+                return 0.0;
+            }
+
+            return static_cast<double>(sum) / static_cast<double>(count);
+        }
+
+        LIBATFRAME_UTILS_API void http_histogram::snapshot_t::merge(const snapshot_t &other) {
+            if (0 == other.count) {
+                return;
+            }
+
+            for (size_t i = 0; i < counts.size() && i < other.counts.size(); ++i) {
+                counts[i] += other.counts[i];
+            }
+
+            min = (0 == count || other.min < min) ? other.min : min;
+            max = other.max > max ? other.max : max;
+            count += other.count;
+            sum += other.sum;
+        }
+
+        LIBATFRAME_UTILS_API http_histogram::http_histogram() : count_(0), sum_(0), min_(std::numeric_limits<uint64_t>::max()), max_(0) {
+            for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+                counts_[i].store(0, ::util::lock::memory_order_relaxed);
+            }
+        }
+
+        LIBATFRAME_UTILS_API void http_histogram::record(uint64_t value) {
+            counts_[get_bucket_index(value)].fetch_add(1, ::util::lock::memory_order_relaxed);
+            sum_.fetch_add(value, ::util::lock::memory_order_relaxed);
+
+            uint64_t old_min = min_.load(::util::lock::memory_order_relaxed);
+            while (value < old_min && !min_.compare_exchange_weak(old_min, value, ::util::lock::memory_order_relaxed)) {
+            }
+
+            uint64_t old_max = max_.load(::util::lock::memory_order_relaxed);
+            while (value > old_max && !max_.compare_exchange_weak(old_max, value, ::util::lock::memory_order_relaxed)) {
+            }
+
+            // count is the last one, so a snapshot never has more count than buckets
+            count_.fetch_add(1, ::util::lock::memory_order_release);
+        }
+
+        LIBATFRAME_UTILS_API void http_histogram::snapshot(snapshot_t &out) const {
+            out.count = count_.load(::util::lock::memory_order_acquire);
+            out.counts.resize(BUCKET_COUNT);
+
+            uint64_t total = 0;
+            for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+                out.counts[i] = counts_[i].load(::util::lock::memory_order_relaxed);
+                total += out.counts[i];
+            }
+
+            // values recorded while copying
+            if (total > out.count) {
+                out.count = total;
+            }
+
+            out.sum = sum_.load(::util::lock::memory_order_relaxed);
+            out.max = max_.load(::util::lock::memory_order_relaxed);
+            out.min = (0 == out.count) ? 0 : min_.load(::util::lock::memory_order_relaxed);
+        }
+
+        LIBATFRAME_UTILS_API size_t http_histogram::get_bucket_index(uint64_t value) {
+            if (value < static_cast<uint64_t>(SUB_BUCKET_COUNT)) {
+                return static_cast<size_t>(value);
+            }
+
+            if (0 != (value >> MAX_VALUE_BITS)) {
+                return BUCKET_COUNT - 1;
+            }
+
+            int    highest = detail::http_metrics_highest_bit(value);
+            size_t block   = static_cast<size_t>(highest - SUB_BUCKET_BITS + 1);
+            size_t sub     = static_cast<size_t>(value >> (highest - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1);
+            return block * SUB_BUCKET_COUNT + sub;
+        }
+
+        LIBATFRAME_UTILS_API uint64_t http_histogram::get_bucket_lowest_value(size_t idx) {
+            if (idx < static_cast<size_t>(SUB_BUCKET_COUNT)) {
+                return static_cast<uint64_t>(idx);
+            }
+
+            size_t block = idx / SUB_BUCKET_COUNT;
+            size_t sub   = idx % SUB_BUCKET_COUNT;
+            return static_cast<uint64_t>(SUB_BUCKET_COUNT + sub) << (block - 1);
+        }
+
+        LIBATFRAME_UTILS_API uint64_t http_histogram::get_bucket_highest_value(size_t idx) {
+            if (idx < static_cast<size_t>(SUB_BUCKET_COUNT)) {
+                return static_cast<uint64_t>(idx);
+            }
+
+            size_t block = idx / SUB_BUCKET_COUNT;
+            return get_bucket_lowest_value(idx) + (static_cast<uint64_t>(1) << (block - 1)) - 1;
+        }
+
+        http_metrics::group_t::group_t() : request_count(0), error_count(0), upload_bytes(0), download_bytes(0) {}
+
+        http_metrics::host_t::host_t() {
+            for (int i = 0; i < STATUS_GROUP_COUNT; ++i) {
+                groups[i] = NULL;
+            }
+        }
+
+        http_metrics::host_t::~host_t() {
+            for (int i = 0; i < STATUS_GROUP_COUNT; ++i) {
+                delete groups[i];
+            }
+        }
+
+        LIBATFRAME_UTILS_API http_metrics::http_metrics() {}
+
+        LIBATFRAME_UTILS_API http_metrics::~http_metrics() {
+            for (std::unordered_map<std::string, host_t *>::iterator iter = hosts_.begin(); iter != hosts_.end(); ++iter) {
+                delete iter->second;
+            }
+            hosts_.clear();
+        }
+
+        LIBATFRAME_UTILS_API void http_metrics::record(const std::string &host, const http_request_timing_t &timing) {
+#if defined(NETWORK_EVPOLL_ENABLE_LIBUV) && defined(NETWORK_ENABLE_CURL) && NETWORK_ENABLE_CURL && NETWORK_EVPOLL_ENABLE_LIBUV
+            int group_idx = http_request::get_status_code_group(timing.response_code);
+#else
+            // http_request is not available without libcurl, records only come from the caller then
+            int group_idx = timing.response_code / 100;
+#endif
+            if (group_idx < 0 || group_idx >= STATUS_GROUP_COUNT) {
+                group_idx = 0;
+            }
+
+            // most records only need the read lock, histograms are lock-free
+            {
+                ::util::lock::read_lock_holder< ::util::lock::spin_rw_lock> holder(lock_);
+                std::unordered_map<std::string, host_t *>::iterator iter = hosts_.find(host);
+                if (iter != hosts_.end() && NULL != iter->second->groups[group_idx]) {
+                    record_group(*iter->second->groups[group_idx], timing);
+                    return;
+                }
+            }
+
+            ::util::lock::write_lock_holder< ::util::lock::spin_rw_lock> holder(lock_);
+            host_t *&host_ptr = hosts_[host];
+            if (NULL == host_ptr) {
+                host_ptr = new host_t();
+            }
+            if (NULL == host_ptr->groups[group_idx]) {
+                host_ptr->groups[group_idx] = new group_t();
+            }
+            record_group(*host_ptr->groups[group_idx], timing);
+        }
+
+        LIBATFRAME_UTILS_API void http_metrics::snapshot(snapshot_t &out) const {
+            out.clear();
+
+            ::util::lock::read_lock_holder< ::util::lock::spin_rw_lock> holder(lock_);
+            for (std::unordered_map<std::string, host_t *>::const_iterator iter = hosts_.begin(); iter != hosts_.end(); ++iter) {
+                for (int i = 0; i < STATUS_GROUP_COUNT; ++i) {
+                    const group_t *group = iter->second->groups[i];
+                    if (NULL == group) {
+                        continue;
+                    }
+
+                    out.push_back(snapshot_entry_t());
+                    snapshot_entry_t &entry = out.back();
+                    entry.host              = iter->first;
+                    entry.status_group      = i;
+                    entry.request_count     = group->request_count.load(::util::lock::memory_order_relaxed);
+                    entry.error_count       = group->error_count.load(::util::lock::memory_order_relaxed);
+                    entry.upload_bytes      = group->upload_bytes.load(::util::lock::memory_order_relaxed);
+                    entry.download_bytes    = group->download_bytes.load(::util::lock::memory_order_relaxed);
+                    for (int j = 0; j < phase_t::EN_HMP_MAX; ++j) {
+                        group->phases[j].snapshot(entry.phases[j]);
+                    }
+                }
+            }
+        }
+
+        LIBATFRAME_UTILS_API void http_metrics::dump_to_log(::util::log::log_wrapper &logger, ::util::log::log_wrapper::level_t::type level) const {
+            if (!logger.check_level(level)) {
+                return;
+            }
+
+            snapshot_t entries;
+            snapshot(entries);
+            for (size_t i = 0; i < entries.size(); ++i) {
+                const snapshot_entry_t &entry = entries[i];
+
+                char   phases[512];
+                size_t len = 0;
+                for (int j = 0; j < phase_t::EN_HMP_MAX && len < sizeof(phases); ++j) {
+                    const http_histogram::snapshot_t &hist = entry.phases[j];
+                    int res = snprintf(phases + len, sizeof(phases) - len, " %s=%llu/%llu/%llu/%llu", get_phase_name(static_cast<phase_t::type>(j)),
+                                       static_cast<unsigned long long>(hist.percentile(0.5)), static_cast<unsigned long long>(hist.percentile(0.9)),
+                                       static_cast<unsigned long long>(hist.percentile(0.99)), static_cast<unsigned long long>(hist.max));
+                    if (res < 0) {
+                        break;
+                    }
+                    len += static_cast<size_t>(res);
+                }
+                phases[sizeof(phases) - 1] = 0;
+
+                WINSTLOGDEFLV(level, NULL, logger, "http metrics host=%s status=%dxx count=%llu errors=%llu upload=%llu download=%llu, p50/p90/p99/max(us):%s",
+                              entry.host.c_str(), entry.status_group, static_cast<unsigned long long>(entry.request_count),
+                              static_cast<unsigned long long>(entry.error_count), static_cast<unsigned long long>(entry.upload_bytes),
+                              static_cast<unsigned long long>(entry.download_bytes), phases);
+            }
+        }
+
+        LIBATFRAME_UTILS_API const char *http_metrics::get_phase_name(phase_t::type phase) {
+            switch (phase) {
+            case phase_t::EN_HMP_DNS:
+                return "dns";
+            case phase_t::EN_HMP_CONNECT:
+                return "connect";
+            case phase_t::EN_HMP_TLS:
+                return "tls";
+            case phase_t::EN_HMP_TTFB:
+                return "ttfb";
+            case phase_t::EN_HMP_TOTAL:
+                return "total";
+            default:
+                return "unknown";
+            }
+        }
+
+        void http_metrics::record_group(group_t &group, const http_request_timing_t &timing) {
+            // connection phases of reused connections are always 0, skip them to keep the percentiles useful
+            if (timing.new_connection) {
+                group.phases[phase_t::EN_HMP_DNS].record(timing.dns_us);
+                group.phases[phase_t::EN_HMP_CONNECT].record(timing.connect_us);
+                if (timing.tls_us > 0) {
+                    group.phases[phase_t::EN_HMP_TLS].record(timing.tls_us);
+                }
+            }
+            group.phases[phase_t::EN_HMP_TTFB].record(timing.ttfb_us);
+            group.phases[phase_t::EN_HMP_TOTAL].record(timing.total_us);
+
+            group.request_count.fetch_add(1, ::util::lock::memory_order_relaxed);
+            if (0 != timing.error_code) {
+                group.error_count.fetch_add(1, ::util::lock::memory_order_relaxed);
+            }
+            group.upload_bytes.fetch_add(timing.upload_bytes, ::util::lock::memory_order_relaxed);
+            group.download_bytes.fetch_add(timing.download_bytes, ::util::lock::memory_order_relaxed);
+        }
+    } // namespace network
+} // namespace util
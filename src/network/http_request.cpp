@@ -31,6 +31,11 @@ namespace util {
             static const char custom_no_expect_header[]     = "Expect:";
             static const char content_type_multipart_post[] = "Content-Type: application/x-www-form-urlencoded";
             // static const char content_type_multipart_form_data[] = "Content-Type: multipart/form-data";
+
+            // Content-Length is only a hint, do not allocate too much memory for a bad server
+            static const size_t max_response_reserve_size = 64 * 1024 * 1024;
+
+            static const size_t default_max_free_handles = 64;
         } // namespace detail
 
         LIBATFRAME_UTILS_API http_request::ptr_t http_request::create(curl_m_bind_t *curl_multi, const std::string &url) {
@@ -53,8 +58,29 @@ namespace util {
 
         LIBATFRAME_UTILS_API int http_request::get_status_code_group(int code) { return code / 100; }
 
+        LIBATFRAME_UTILS_API std::string http_request::get_url_host(const std::string &url) {
+            size_t begin = url.find("://");
+            begin        = (std::string::npos == begin) ? 0 : begin + 3;
+
+            size_t end = url.find_first_of("/?#", begin);
+            if (std::string::npos == end) {
+                end = url.size();
+            }
+
+            // skip userinfo
+            size_t at = url.find('@', begin);
+            if (std::string::npos != at && at < end) {
+                begin = at + 1;
+            }
+
+            return url.substr(begin, end - begin);
+        }
+
         LIBATFRAME_UTILS_API http_request::http_request(curl_m_bind_t *curl_multi)
-            : timeout_ms_(0), bind_m_(curl_multi), request_(NULL), flags_(0), response_code_(0), last_error_code_(0), priv_data_(NULL) {
+            : timeout_ms_(0), bind_m_(curl_multi), request_(NULL), flags_(0), response_buffer_(NULL), response_stream_synced_(0),
+              response_code_(0), last_error_code_(0), priv_data_(NULL) {
+            set_response_sink(http_response_sink::ptr_t());
+            memset(&timing_, 0, sizeof(timing_));
             http_form_.begin         = NULL;
             http_form_.end           = NULL;
             http_form_.headerlist    = NULL;
@@ -103,14 +129,19 @@ namespace util {
             }
 
             last_error_code_ = CURLE_OK;
-            build_http_form(method);
+            memset(&timing_, 0, sizeof(timing_));
+            if (request_source_) {
+                setup_request_source(method);
+            } else {
+                build_http_form(method);
+            }
 
             if (NULL != http_form_.begin) {
                 set_libcurl_no_expect();
                 curl_easy_setopt(req, CURLOPT_HTTPPOST, http_form_.begin);
                 // curl_easy_setopt(req, CURLOPT_VERBOSE, 1L);
             }
-            if (!post_data_.empty()) {
+            if (!post_data_.empty() && !request_source_) {
                 set_opt_long(CURLOPT_POSTFIELDSIZE, post_data_.size());
                 curl_easy_setopt(req, CURLOPT_POSTFIELDS, post_data_.c_str());
                 // curl_easy_setopt(req, CURLOPT_COPYPOSTFIELDS, post_data_.c_str());
@@ -140,6 +171,7 @@ namespace util {
                 set_opt_long(CURLOPT_TIMEOUT_MS, timeout_ms_);
             }
 
+            UNSET_FLAG(flags_, flag_t::EN_FT_RESPONSE_RESERVED);
             if (wait) {
                 SET_FLAG(flags_, flag_t::EN_FT_RUNNING);
                 last_error_code_ = curl_easy_perform(req);
@@ -222,10 +254,50 @@ namespace util {
 
         LIBATFRAME_UTILS_API int http_request::get_error_code() const { return last_error_code_; }
 
+        LIBATFRAME_UTILS_API const http_request_timing_t &http_request::get_timing() const { return timing_; }
+
         LIBATFRAME_UTILS_API const char *http_request::get_error_msg() const { return error_buffer_; }
 
-        LIBATFRAME_UTILS_API std::stringstream &http_request::get_response_stream() { return response_; }
-        LIBATFRAME_UTILS_API const std::stringstream &http_request::get_response_stream() const { return response_; }
+        LIBATFRAME_UTILS_API std::stringstream &http_request::get_response_stream() {
+            sync_response_stream();
+            return response_stream_;
+        }
+
+        LIBATFRAME_UTILS_API const std::stringstream &http_request::get_response_stream() const {
+            sync_response_stream();
+            return response_stream_;
+        }
+
+        LIBATFRAME_UTILS_API void http_request::set_response_sink(const http_response_sink::ptr_t &sink) {
+            if (sink) {
+                response_sink_ = sink;
+            } else {
+                response_sink_ = std::make_shared<http_buffer_chain>();
+            }
+            response_buffer_ = dynamic_cast<http_buffer_chain *>(response_sink_.get());
+
+            response_stream_.str(std::string());
+            response_stream_.clear();
+            response_stream_synced_ = 0;
+        }
+
+        LIBATFRAME_UTILS_API const http_response_sink::ptr_t &http_request::get_response_sink() const { return response_sink_; }
+
+        LIBATFRAME_UTILS_API http_buffer_chain *http_request::get_response_buffer() { return response_buffer_; }
+
+        LIBATFRAME_UTILS_API const http_buffer_chain *http_request::get_response_buffer() const { return response_buffer_; }
+
+        LIBATFRAME_UTILS_API void http_request::set_request_source(const http_request_source::ptr_t &source) { request_source_ = source; }
+
+        LIBATFRAME_UTILS_API const http_request_source::ptr_t &http_request::get_request_source() const { return request_source_; }
+
+        LIBATFRAME_UTILS_API int http_request::resume_upload() {
+            if (NULL == request_ || !CHECK_FLAG(flags_, flag_t::EN_FT_RUNNING)) {
+                return -1;
+            }
+
+            return curl_easy_pause(request_, CURLPAUSE_CONT);
+        }
 
         LIBATFRAME_UTILS_API int http_request::add_form_file(const std::string &fieldname, const char *filename) {
             if (CHECK_FLAG(flags_, flag_t::EN_FT_CLEANING)) {
@@ -508,12 +580,15 @@ namespace util {
             request_  = NULL;
             if (NULL != req) {
                 if (NULL != bind_m_ && CHECK_FLAG(flags_, flag_t::EN_FT_CURL_MULTI_HANDLE)) {
-                    // can not be called inside socket callback
-                    last_error_code_ = curl_multi_remove_handle(bind_m_->curl_multi, req);
+                    // can not be called inside socket callback, and keep the error code of the transfer
+                    int res = curl_multi_remove_handle(bind_m_->curl_multi, req);
+                    if (CURLM_OK != res && 0 == last_error_code_) {
+                        last_error_code_ = res;
+                    }
                     UNSET_FLAG(flags_, flag_t::EN_FT_CURL_MULTI_HANDLE);
                 }
 
-                curl_easy_cleanup(req);
+                free_easy_handle(handle_pool_.get(), req);
             }
             UNSET_FLAG(flags_, flag_t::EN_FT_STOPING);
 
@@ -554,12 +629,35 @@ namespace util {
         LIBATFRAME_UTILS_API void http_request::finish_req_rsp() {
             UNSET_FLAG(flags_, flag_t::EN_FT_RUNNING);
 
+            if (response_sink_) {
+                response_sink_->finish();
+            }
+
             {
                 long rsp_code = 0;
                 curl_easy_getinfo(request_, CURLINFO_RESPONSE_CODE, &rsp_code);
                 response_code_ = static_cast<int>(rsp_code);
             }
 
+            collect_timing();
+            if (handle_pool_ && NULL != request_) {
+                curl_handle_stats_t &stats = handle_pool_->stats;
+                ++stats.request_count;
+
+                if (timing_.new_connection) {
+                    ++stats.new_connection_count;
+                    stats.connect_time_us += timing_.dns_us + timing_.connect_us;
+                    // 和CURLINFO_APPCONNECT_TIME一样，没有TLS握手的连接不计入
+                    if (timing_.tls_us > 0) {
+                        stats.appconnect_time_us += timing_.dns_us + timing_.connect_us + timing_.tls_us;
+                    }
+                }
+
+                if (handle_pool_->metrics) {
+                    handle_pool_->metrics->record(get_url_host(url_), timing_);
+                }
+            }
+
             size_t err_len = strlen(error_buffer_);
             if (err_len > 0) {
                 if (on_error_fn_) {
@@ -576,12 +674,75 @@ namespace util {
             }
         }
 
+        LIBATFRAME_UTILS_API void http_request::collect_timing() {
+            memset(&timing_, 0, sizeof(timing_));
+            timing_.response_code = response_code_;
+            timing_.error_code    = last_error_code_;
+            if (NULL == request_) {
+                return;
+            }
+
+            // NUM_CONNECTS is 0 if an existing connection is reused
+            long new_connects = 0;
+            curl_easy_getinfo(request_, CURLINFO_NUM_CONNECTS, &new_connects);
+            timing_.new_connection = new_connects > 0;
+
+            // all times from libcurl are from the start, convert them into durations of phases
+#if LIBCURL_VERSION_NUM >= 0x073d00
+            curl_off_t namelookup = 0, connect = 0, appconnect = 0, starttransfer = 0, total = 0;
+            curl_easy_getinfo(request_, CURLINFO_NAMELOOKUP_TIME_T, &namelookup);
+            curl_easy_getinfo(request_, CURLINFO_CONNECT_TIME_T, &connect);
+            curl_easy_getinfo(request_, CURLINFO_APPCONNECT_TIME_T, &appconnect);
+            curl_easy_getinfo(request_, CURLINFO_STARTTRANSFER_TIME_T, &starttransfer);
+            curl_easy_getinfo(request_, CURLINFO_TOTAL_TIME_T, &total);
+#else
+            double namelookup_sec = 0, connect_sec = 0, appconnect_sec = 0, starttransfer_sec = 0, total_sec = 0;
+            curl_easy_getinfo(request_, CURLINFO_NAMELOOKUP_TIME, &namelookup_sec);
+            curl_easy_getinfo(request_, CURLINFO_CONNECT_TIME, &connect_sec);
+            curl_easy_getinfo(request_, CURLINFO_APPCONNECT_TIME, &appconnect_sec);
+            curl_easy_getinfo(request_, CURLINFO_STARTTRANSFER_TIME, &starttransfer_sec);
+            curl_easy_getinfo(request_, CURLINFO_TOTAL_TIME, &total_sec);
+            int64_t namelookup    = static_cast<int64_t>(namelookup_sec * 1000000);
+            int64_t connect       = static_cast<int64_t>(connect_sec * 1000000);
+            int64_t appconnect    = static_cast<int64_t>(appconnect_sec * 1000000);
+            int64_t starttransfer = static_cast<int64_t>(starttransfer_sec * 1000000);
+            int64_t total         = static_cast<int64_t>(total_sec * 1000000);
+#endif
+            if (timing_.new_connection) {
+                timing_.dns_us     = namelookup > 0 ? static_cast<uint64_t>(namelookup) : 0;
+                timing_.connect_us = connect > namelookup ? static_cast<uint64_t>(connect - namelookup) : 0;
+                timing_.tls_us     = appconnect > connect ? static_cast<uint64_t>(appconnect - connect) : 0;
+            }
+            timing_.ttfb_us  = starttransfer > 0 ? static_cast<uint64_t>(starttransfer) : 0;
+            timing_.total_us = total > 0 ? static_cast<uint64_t>(total) : 0;
+            // some protocols(file://) report the start of transfer after the end
+            if (timing_.ttfb_us > timing_.total_us) {
+                timing_.ttfb_us = timing_.total_us;
+            }
+
+#if LIBCURL_VERSION_NUM >= 0x073700
+            curl_off_t upload_bytes = 0, download_bytes = 0;
+            curl_easy_getinfo(request_, CURLINFO_SIZE_UPLOAD_T, &upload_bytes);
+            curl_easy_getinfo(request_, CURLINFO_SIZE_DOWNLOAD_T, &download_bytes);
+#else
+            double upload_bytes = 0, download_bytes = 0;
+            curl_easy_getinfo(request_, CURLINFO_SIZE_UPLOAD, &upload_bytes);
+            curl_easy_getinfo(request_, CURLINFO_SIZE_DOWNLOAD, &download_bytes);
+#endif
+            timing_.upload_bytes   = upload_bytes > 0 ? static_cast<uint64_t>(upload_bytes) : 0;
+            timing_.download_bytes = download_bytes > 0 ? static_cast<uint64_t>(download_bytes) : 0;
+        }
+
         LIBATFRAME_UTILS_API CURL *http_request::mutable_request() {
             if (NULL != request_) {
                 return request_;
             }
 
-            request_ = curl_easy_init();
+            if (!handle_pool_ && NULL != bind_m_) {
+                handle_pool_ = bind_m_->handle_pool;
+            }
+
+            request_ = alloc_easy_handle(handle_pool_.get());
             if (NULL != request_) {
                 curl_easy_setopt(request_, CURLOPT_PRIVATE, this);
                 curl_easy_setopt(request_, CURLOPT_WRITEDATA, this);
@@ -594,6 +755,76 @@ namespace util {
             return request_;
         }
 
+        LIBATFRAME_UTILS_API void http_request::reserve_response(size_t total_size) {
+            SET_FLAG(flags_, flag_t::EN_FT_RESPONSE_RESERVED);
+            if (0 == total_size || !response_sink_) {
+                return;
+            }
+
+            if (total_size > detail::max_response_reserve_size) {
+                total_size = detail::max_response_reserve_size;
+            }
+            response_sink_->reserve(total_size);
+        }
+
+        LIBATFRAME_UTILS_API void http_request::sync_response_stream() const {
+            if (NULL == response_buffer_) {
+                return;
+            }
+
+            // the buffer is cleared by user
+            if (response_buffer_->size() < response_stream_synced_) {
+                response_stream_.str(std::string());
+                response_stream_.clear();
+                response_stream_synced_ = 0;
+            }
+
+            size_t offset = response_stream_synced_;
+            for (size_t i = 0; i < response_buffer_->segment_count() && response_stream_synced_ < response_buffer_->size(); ++i) {
+                http_buffer_chain::span_t seg = response_buffer_->segment(i);
+                if (offset >= seg.size) {
+                    offset -= seg.size;
+                    continue;
+                }
+
+                response_stream_.write(seg.data + offset, static_cast<std::streamsize>(seg.size - offset));
+                response_stream_synced_ += seg.size - offset;
+                offset = 0;
+            }
+        }
+
+        LIBATFRAME_UTILS_API void http_request::setup_request_source(method_t::type method) {
+            CURL *req = mutable_request();
+            if (NULL == req) {
+                return;
+            }
+
+            // libcurl pulls the body by CURLOPT_READFUNCTION, so only one buffer of libcurl is used however large it is
+            curl_easy_setopt(req, CURLOPT_READFUNCTION, curl_callback_on_read);
+            curl_easy_setopt(req, CURLOPT_READDATA, this);
+            curl_easy_setopt(req, CURLOPT_SEEKFUNCTION, curl_callback_on_seek);
+            curl_easy_setopt(req, CURLOPT_SEEKDATA, this);
+
+            int64_t total_size = request_source_->size();
+            if (method_t::EN_MT_PUT == method) {
+                // chunked transfer encoding is used by libcurl if the size is unknown
+                curl_easy_setopt(req, CURLOPT_INFILESIZE_LARGE, static_cast<curl_off_t>(total_size >= 0 ? total_size : -1));
+            } else {
+                curl_easy_setopt(req, CURLOPT_POST, 1L);
+                curl_easy_setopt(req, CURLOPT_POSTFIELDSIZE_LARGE, static_cast<curl_off_t>(total_size >= 0 ? total_size : -1));
+                if (total_size < 0) {
+                    append_http_header("Transfer-Encoding: chunked");
+                }
+            }
+
+            const char *encoding = request_source_->content_encoding();
+            if (NULL != encoding && *encoding) {
+                std::string header = "Content-Encoding: ";
+                header += encoding;
+                append_http_header(header.c_str());
+            }
+        }
+
         LIBATFRAME_UTILS_API void http_request::build_http_form(method_t::type method) {
             if (method_t::EN_MT_PUT == method) {
                 http_form_.posted_size = 0;
@@ -681,6 +912,44 @@ namespace util {
 
         LIBATFRAME_UTILS_API void http_request::free_poll(curl_poll_context_t *p) { free(p); }
 
+        LIBATFRAME_UTILS_API CURL *http_request::alloc_easy_handle(curl_handle_pool_t *pool) {
+            if (NULL == pool) {
+                return curl_easy_init();
+            }
+
+            CURL *ret;
+            if (!pool->free_handles.empty()) {
+                // handles are reset when released, and they keep their DNS cache and TLS session cache
+                ret = pool->free_handles.back();
+                pool->free_handles.pop_back();
+                ++pool->stats.reused_count;
+            } else {
+                ret = curl_easy_init();
+                if (NULL == ret) {
+                    return ret;
+                }
+                ++pool->stats.created_count;
+            }
+
+            if (NULL != pool->curl_share) {
+                curl_easy_setopt(ret, CURLOPT_SHARE, pool->curl_share);
+            }
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API void http_request::free_easy_handle(curl_handle_pool_t *pool, CURL *handle) {
+            if (NULL == handle) {
+                return;
+            }
+
+            if (NULL != pool && pool->free_handles.size() < pool->max_free_handles) {
+                curl_easy_reset(handle);
+                pool->free_handles.push_back(handle);
+            } else {
+                curl_easy_cleanup(handle);
+            }
+        }
+
         LIBATFRAME_UTILS_API void http_request::check_multi_info(CURLM *curl_handle) {
             CURLMsg *message;
             int      pending;
@@ -711,6 +980,24 @@ namespace util {
             }
         }
 
+        LIBATFRAME_UTILS_API http_request::curl_handle_pool_t::curl_handle_pool_t()
+            : curl_share(NULL), max_free_handles(detail::default_max_free_handles) {
+            memset(&stats, 0, sizeof(stats));
+        }
+
+        LIBATFRAME_UTILS_API http_request::curl_handle_pool_t::~curl_handle_pool_t() {
+            for (size_t i = 0; i < free_handles.size(); ++i) {
+                curl_easy_cleanup(free_handles[i]);
+            }
+            free_handles.clear();
+
+            // all easy handles using it hold this pool, so it's not in use now
+            if (NULL != curl_share) {
+                curl_share_cleanup(curl_share);
+                curl_share = NULL;
+            }
+        }
+
         LIBATFRAME_UTILS_API http_request::curl_m_bind_t::curl_m_bind_t() : ev_loop(NULL), curl_multi(NULL) {}
 
         LIBATFRAME_UTILS_API int http_request::create_curl_multi(uv_loop_t *evloop, std::shared_ptr<curl_m_bind_t> &manager) {
@@ -737,6 +1024,16 @@ namespace util {
             }
             manager->ev_timeout.data = manager.get();
 
+            manager->handle_pool             = std::make_shared<curl_handle_pool_t>();
+            manager->handle_pool->curl_share = curl_share_init();
+            if (NULL != manager->handle_pool->curl_share) {
+                curl_share_setopt(manager->handle_pool->curl_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+                curl_share_setopt(manager->handle_pool->curl_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073900
+                curl_share_setopt(manager->handle_pool->curl_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+            }
+
             int ret = curl_multi_setopt(manager->curl_multi, CURLMOPT_SOCKETFUNCTION, http_request::curl_callback_handle_socket);
             ret     = (CURLE_OK != ret) || curl_multi_setopt(manager->curl_multi, CURLMOPT_SOCKETDATA, manager.get());
             ret     = (CURLE_OK != ret) ||
@@ -757,6 +1054,9 @@ namespace util {
             int ret             = curl_multi_cleanup(manager->curl_multi);
             manager->curl_multi = NULL;
 
+            // the pool will be destroyed after all requests using it are released
+            manager->handle_pool.reset();
+
             // hold self in case of timer in libuv invalid
             manager->self_holder = manager;
             uv_timer_stop(&manager->ev_timeout);
@@ -766,6 +1066,52 @@ namespace util {
             return ret;
         }
 
+        LIBATFRAME_UTILS_API int http_request::set_curl_multi_connection_limit(curl_m_bind_t *manager, long max_host_connections,
+                                                                               long max_total_connections) {
+            if (NULL == manager || NULL == manager->curl_multi) {
+                return -1;
+            }
+
+#if LIBCURL_VERSION_NUM >= 0x071e00
+            int ret = curl_multi_setopt(manager->curl_multi, CURLMOPT_MAX_HOST_CONNECTIONS, max_host_connections);
+            if (CURLM_OK != ret) {
+                return ret;
+            }
+            return curl_multi_setopt(manager->curl_multi, CURLMOPT_MAX_TOTAL_CONNECTIONS, max_total_connections);
+#else
+            return (0 == max_host_connections && 0 == max_total_connections) ? 0 : -1;
+#endif
+        }
+
+        LIBATFRAME_UTILS_API void http_request::set_curl_multi_metrics(curl_m_bind_t *manager, const http_metrics::ptr_t &metrics) {
+            if (NULL == manager || !manager->handle_pool) {
+                return;
+            }
+
+            manager->handle_pool->metrics = metrics;
+        }
+
+        LIBATFRAME_UTILS_API void http_request::set_curl_multi_max_free_handles(curl_m_bind_t *manager, size_t v) {
+            if (NULL == manager || !manager->handle_pool) {
+                return;
+            }
+
+            curl_handle_pool_t &pool = *manager->handle_pool;
+            pool.max_free_handles    = v;
+            while (pool.free_handles.size() > v) {
+                curl_easy_cleanup(pool.free_handles.back());
+                pool.free_handles.pop_back();
+            }
+        }
+
+        LIBATFRAME_UTILS_API const http_request::curl_handle_stats_t *http_request::get_curl_multi_stats(const curl_m_bind_t *manager) {
+            if (NULL == manager || !manager->handle_pool) {
+                return NULL;
+            }
+
+            return &manager->handle_pool->stats;
+        }
+
         LIBATFRAME_UTILS_API void http_request::ev_callback_on_timer_closed(uv_handle_t *handle) {
             curl_m_bind_t *bind = reinterpret_cast<curl_m_bind_t *>(handle->data);
             assert(bind);
@@ -913,8 +1259,23 @@ namespace util {
                 self->on_write_fn_(*self, data, data_len, data, data_len);
             }
 
-            if (NULL != data && data_len > 0) {
-                self->response_.write(data, data_len);
+            // reserve from Content-Length before the first write, all headers are received now
+            if (!CHECK_FLAG(self->flags_, flag_t::EN_FT_RESPONSE_RESERVED)) {
+#if LIBCURL_VERSION_NUM >= 0x073700
+                curl_off_t content_length = -1;
+                curl_easy_getinfo(self->request_, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &content_length);
+#else
+                double content_length = -1;
+                curl_easy_getinfo(self->request_, CURLINFO_CONTENT_LENGTH_DOWNLOAD, &content_length);
+#endif
+                self->reserve_response(content_length > 0 ? static_cast<size_t>(content_length) : 0);
+            }
+
+            if (NULL != data && data_len > 0 && self->response_sink_) {
+                // abort the transfer if the sink can not take all data
+                if (self->response_sink_->write(data, data_len) < data_len) {
+                    return 0;
+                }
             }
 
             return size * nmemb;
@@ -933,6 +1294,10 @@ namespace util {
                 return ret;
             }
 
+            if (dltotal > 0 && !CHECK_FLAG(self->flags_, flag_t::EN_FT_RESPONSE_RESERVED)) {
+                self->reserve_response(static_cast<size_t>(dltotal));
+            }
+
             if (self->on_progress_fn_) {
                 progress_t progress;
                 progress.dltotal = static_cast<size_t>(dltotal);
@@ -957,6 +1322,19 @@ namespace util {
                 return 0;
             }
 
+            if (self->request_source_) {
+                size_t nread = self->request_source_->read(buffer, size * nitems);
+                if (http_request_source::read_result_t::EN_RR_PAUSE == nread) {
+                    return CURL_READFUNC_PAUSE;
+                }
+
+                if (http_request_source::read_result_t::EN_RR_ABORT == nread || nread > size * nitems) {
+                    return CURL_READFUNC_ABORT;
+                }
+
+                return nread;
+            }
+
             if (self->post_data_.empty() && NULL != self->http_form_.uploaded_file) {
                 return fread(buffer, size, nitems, self->http_form_.uploaded_file);
             }
@@ -975,6 +1353,21 @@ namespace util {
             return nwrite;
         }
 
+        LIBATFRAME_UTILS_API int http_request::curl_callback_on_seek(void *userp, curl_off_t offset, int origin) {
+            http_request *self = reinterpret_cast<http_request *>(userp);
+            assert(self);
+            if (NULL == self || !self->request_source_) {
+                return CURL_SEEKFUNC_CANTSEEK;
+            }
+
+            // libcurl only seeks to the beginning to send the body again
+            if (0 != offset || SEEK_SET != origin) {
+                return CURL_SEEKFUNC_CANTSEEK;
+            }
+
+            return self->request_source_->rewind() ? CURL_SEEKFUNC_OK : CURL_SEEKFUNC_CANTSEEK;
+        }
+
         LIBATFRAME_UTILS_API size_t http_request::curl_callback_on_header(char *buffer, size_t size, size_t nitems, void *userdata) {
             http_request *self = reinterpret_cast<http_request *>(userdata);
             assert(self);
@@ -0,0 +1,450 @@
+﻿#include <assert.h>
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+
+#include "network/http_request_policy.h"
+
+#if defined(NETWORK_EVPOLL_ENABLE_LIBUV) && defined(NETWORK_ENABLE_CURL)
+#if NETWORK_ENABLE_CURL && NETWORK_EVPOLL_ENABLE_LIBUV
+
+namespace util {
+    namespace network {
+        namespace detail {
+            static const size_t http_policy_max_latency_samples = 128;
+        }
+
+        LIBATFRAME_UTILS_API http_request_policy::options_t::options_t()
+            : max_retries(2), retry_base_delay_ms(50), retry_max_delay_ms(2000), retry_non_idempotent(false), enable_hedge(false),
+              hedge_percentile(0.95), hedge_min_samples(16), hedge_min_delay_ms(5), hedge_default_delay_ms(0), breaker_failure_threshold(5),
+              breaker_open_ms(5000), budget_ratio(0.2), budget_max_tokens(10) {}
+
+        http_request_policy::host_state_t::host_state_t()
+            : latency_next(0), consecutive_failures(0), circuit_state(circuit_state_t::EN_CS_CLOSED), circuit_open_until(0),
+              probe_running(false) {}
+
+        LIBATFRAME_UTILS_API http_request_policy::http_request_policy(http_request::curl_m_bind_t *bind, const options_t &options)
+            : bind_m_(bind), options_(options), budget_tokens_(options.budget_max_tokens) {
+            memset(&stats_, 0, sizeof(stats_));
+            random_.init_seed(static_cast<uint64_t>(time(NULL)) ^ static_cast<uint64_t>(reinterpret_cast<uintptr_t>(this)));
+        }
+
+        LIBATFRAME_UTILS_API http_request_policy::~http_request_policy() {
+            std::unordered_set<operation_t *> ops;
+            ops.swap(operations_);
+            for (std::unordered_set<operation_t *>::iterator iter = ops.begin(); iter != ops.end(); ++iter) {
+                operation_t *op = *iter;
+                // requests are removed from curl multi handle when they are destroyed
+                for (size_t i = 0; i < op->attempts.size(); ++i) {
+                    op->attempts[i].request->set_on_complete(http_request::on_complete_fn_t());
+                }
+                op->attempts.clear();
+                op->finished = true;
+                release_operation(op);
+            }
+        }
+
+        LIBATFRAME_UTILS_API int http_request_policy::start_request(const std::string &url, http_request::method_t::type method,
+                                                                    setup_fn_t setup) {
+            if (NULL == bind_m_ || NULL == bind_m_->ev_loop || url.empty()) {
+                return error_code_t::EN_ERR_PARAM;
+            }
+
+            std::string   host_name = http_request::get_url_host(url);
+            host_state_t &host      = hosts_[host_name];
+            if (!circuit_allow(host, uv_now(bind_m_->ev_loop))) {
+                ++stats_.circuit_rejected_count;
+                return error_code_t::EN_ERR_CIRCUIT_OPEN;
+            }
+
+            budget_tokens_ += options_.budget_ratio;
+            if (budget_tokens_ > options_.budget_max_tokens) {
+                budget_tokens_ = options_.budget_max_tokens;
+            }
+
+            operation_t *op     = new operation_t();
+            op->owner           = this;
+            op->url             = url;
+            op->host            = host_name;
+            op->method          = method;
+            op->setup           = setup;
+            op->timer           = NULL;
+            op->timer_for_hedge = false;
+            op->retry_times     = 0;
+            op->has_callbacks   = false;
+            op->finished        = false;
+
+            int ret = start_attempt(op, false);
+            if (0 != ret) {
+                host.probe_running = false;
+                delete op;
+                return ret;
+            }
+
+            operations_.insert(op);
+            ++stats_.request_count;
+            schedule_hedge(op);
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API void http_request_policy::set_check_failure(check_failure_fn_t fn) { check_failure_fn_ = fn; }
+
+        LIBATFRAME_UTILS_API size_t http_request_policy::get_running_count() const {
+            size_t ret = 0;
+            for (std::unordered_set<operation_t *>::const_iterator iter = operations_.begin(); iter != operations_.end(); ++iter) {
+                if (!(*iter)->finished) {
+                    ++ret;
+                }
+            }
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API http_request_policy::circuit_state_t::type http_request_policy::get_circuit_state(const std::string &host) const {
+            std::unordered_map<std::string, host_state_t>::const_iterator iter = hosts_.find(host);
+            if (iter == hosts_.end()) {
+                return circuit_state_t::EN_CS_CLOSED;
+            }
+
+            return iter->second.circuit_state;
+        }
+
+        LIBATFRAME_UTILS_API time_t http_request_policy::get_latency_percentile(const std::string &host, double percentile) const {
+            std::unordered_map<std::string, host_state_t>::const_iterator iter = hosts_.find(host);
+            if (iter == hosts_.end()) {
+                return -1;
+            }
+
+            return get_percentile(iter->second, percentile);
+        }
+
+        int http_request_policy::start_attempt(operation_t *op, bool is_hedge) {
+            http_request::ptr_t req = http_request::create(bind_m_, op->url);
+            if (!req) {
+                return error_code_t::EN_ERR_CREATE_REQUEST;
+            }
+
+            if (op->setup) {
+                op->setup(*req);
+            }
+
+            // user callbacks are only called once with the final attempt
+            if (!op->has_callbacks) {
+                op->has_callbacks = true;
+                op->on_success    = req->get_on_success();
+                op->on_error      = req->get_on_error();
+                op->on_complete   = req->get_on_complete();
+            }
+            req->set_on_success(http_request::on_success_fn_t());
+            req->set_on_error(http_request::on_error_fn_t());
+            req->set_on_complete([op](http_request &r) {
+                op->owner->on_attempt_complete(op, r);
+                return 0;
+            });
+
+            attempt_t attempt;
+            attempt.request    = req;
+            attempt.start_time = uv_now(bind_m_->ev_loop);
+            attempt.is_hedge   = is_hedge;
+            op->attempts.push_back(attempt);
+
+            int ret = req->start(op->method, false);
+            if (0 != ret) {
+                op->attempts.pop_back();
+                return ret;
+            }
+
+            ++stats_.attempt_count;
+            return 0;
+        }
+
+        void http_request_policy::on_attempt_complete(operation_t *op, http_request &req) {
+            uint64_t  now   = uv_now(bind_m_->ev_loop);
+            attempt_t attempt;
+            bool      found = false;
+            for (size_t i = 0; i < op->attempts.size(); ++i) {
+                if (op->attempts[i].request.get() == &req) {
+                    attempt = op->attempts[i];
+                    op->attempts.erase(op->attempts.begin() + static_cast<std::ptrdiff_t>(i));
+                    found = true;
+                    break;
+                }
+            }
+            assert(found);
+            if (!found) {
+                return;
+            }
+
+            // losers stopped by us
+            if (op->finished) {
+                release_operation(op);
+                return;
+            }
+
+            host_state_t &host   = hosts_[op->host];
+            bool          failed = is_failed(req);
+            circuit_report(host, !failed, now);
+
+            if (!failed) {
+                if (host.latency_samples.size() < detail::http_policy_max_latency_samples) {
+                    host.latency_samples.push_back(static_cast<uint32_t>(now - attempt.start_time));
+                } else {
+                    host.latency_samples[host.latency_next] = static_cast<uint32_t>(now - attempt.start_time);
+                    host.latency_next                       = (host.latency_next + 1) % detail::http_policy_max_latency_samples;
+                }
+
+                finish_operation(op, req, attempt.is_hedge);
+                return;
+            }
+
+            op->last_failed = attempt.request;
+
+            // the other hedged request is still running
+            if (!op->attempts.empty()) {
+                return;
+            }
+
+            // POST is not idempotent, only retry it when no response is received
+            bool retryable = is_idempotent(op->method) || options_.retry_non_idempotent || 0 == req.get_response_code();
+            if (retryable && op->retry_times < options_.max_retries && circuit_allow(host, now) && budget_withdraw()) {
+                ++op->retry_times;
+                ++stats_.retry_count;
+
+                if (NULL == op->timer) {
+                    op->timer = new uv_timer_t();
+                    uv_timer_init(bind_m_->ev_loop, op->timer);
+                    op->timer->data = op;
+                }
+                op->timer_for_hedge = false;
+                uv_timer_start(op->timer, ev_callback_on_timer, static_cast<uint64_t>(get_retry_delay(op->retry_times)), 0);
+                return;
+            }
+
+            finish_operation(op, req, attempt.is_hedge);
+        }
+
+        void http_request_policy::finish_operation(operation_t *op, http_request &req, bool is_hedge) {
+            op->finished = true;
+            if (NULL != op->timer) {
+                uv_timer_stop(op->timer);
+            }
+
+            if (is_hedge) {
+                ++stats_.hedge_win_count;
+            }
+
+            // stop the losers, they will be released when completed
+            for (size_t i = 0; i < op->attempts.size(); ++i) {
+                op->attempts[i].request->stop();
+            }
+
+            if (is_failed(req)) {
+                ++stats_.failure_count;
+            } else {
+                ++stats_.success_count;
+            }
+
+            // the same rule as http_request::finish_req_rsp
+            if (0 != req.get_error_msg()[0]) {
+                if (op->on_error) {
+                    op->on_error(req);
+                }
+            } else {
+                if (op->on_success) {
+                    op->on_success(req);
+                }
+            }
+
+            if (op->on_complete) {
+                op->on_complete(req);
+            }
+
+            release_operation(op);
+        }
+
+        void http_request_policy::release_operation(operation_t *op) {
+            if (!op->finished || !op->attempts.empty()) {
+                return;
+            }
+
+            operations_.erase(op);
+            if (NULL != op->timer) {
+                uv_timer_stop(op->timer);
+                op->timer->data = NULL;
+                uv_close(reinterpret_cast<uv_handle_t *>(op->timer), ev_callback_on_timer_closed);
+                op->timer = NULL;
+            }
+
+            delete op;
+        }
+
+        void http_request_policy::schedule_hedge(operation_t *op) {
+            if (!options_.enable_hedge || op->finished || op->attempts.size() != 1) {
+                return;
+            }
+
+            if (!is_idempotent(op->method) && !options_.retry_non_idempotent) {
+                return;
+            }
+
+            time_t delay = get_hedge_delay(hosts_[op->host]);
+            if (delay <= 0) {
+                return;
+            }
+
+            if (NULL == op->timer) {
+                op->timer = new uv_timer_t();
+                uv_timer_init(bind_m_->ev_loop, op->timer);
+                op->timer->data = op;
+            }
+            op->timer_for_hedge = true;
+            uv_timer_start(op->timer, ev_callback_on_timer, static_cast<uint64_t>(delay), 0);
+        }
+
+        bool http_request_policy::is_failed(const http_request &req) const {
+            if (check_failure_fn_) {
+                return check_failure_fn_(req);
+            }
+
+            if (0 != req.get_error_msg()[0]) {
+                return true;
+            }
+
+            int code = req.get_response_code();
+            return 0 == code || code >= 500 || http_request::status_code_t::EN_SCT_TOO_MANY_REQUESTS == code;
+        }
+
+        bool http_request_policy::is_idempotent(http_request::method_t::type method) const { return http_request::method_t::EN_MT_POST != method; }
+
+        bool http_request_policy::circuit_allow(host_state_t &host, uint64_t now) {
+            if (0 == options_.breaker_failure_threshold) {
+                return true;
+            }
+
+            switch (host.circuit_state) {
+            case circuit_state_t::EN_CS_OPEN:
+                if (now < host.circuit_open_until) {
+                    return false;
+                }
+                host.circuit_state = circuit_state_t::EN_CS_HALF_OPEN;
+                host.probe_running = true;
+                return true;
+            case circuit_state_t::EN_CS_HALF_OPEN:
+                // only one probe request is allowed
+                if (host.probe_running) {
+                    return false;
+                }
+                host.probe_running = true;
+                return true;
+            default:
+                return true;
+            }
+        }
+
+        void http_request_policy::circuit_report(host_state_t &host, bool success, uint64_t now) {
+            if (0 == options_.breaker_failure_threshold) {
+                return;
+            }
+
+            host.probe_running = false;
+            if (success) {
+                host.consecutive_failures = 0;
+                host.circuit_state        = circuit_state_t::EN_CS_CLOSED;
+                return;
+            }
+
+            ++host.consecutive_failures;
+            if (circuit_state_t::EN_CS_HALF_OPEN == host.circuit_state ||
+                (circuit_state_t::EN_CS_CLOSED == host.circuit_state && host.consecutive_failures >= options_.breaker_failure_threshold)) {
+                host.circuit_state      = circuit_state_t::EN_CS_OPEN;
+                host.circuit_open_until = now + static_cast<uint64_t>(options_.breaker_open_ms);
+                ++stats_.circuit_open_count;
+            }
+        }
+
+        bool http_request_policy::budget_withdraw() {
+            if (budget_tokens_ < 1.0) {
+                ++stats_.budget_exhausted_count;
+                return false;
+            }
+
+            budget_tokens_ -= 1.0;
+            return true;
+        }
+
+        time_t http_request_policy::get_hedge_delay(const host_state_t &host) const {
+            time_t ret;
+            if (host.latency_samples.size() < options_.hedge_min_samples || host.latency_samples.empty()) {
+                ret = options_.hedge_default_delay_ms;
+            } else {
+                ret = get_percentile(host, options_.hedge_percentile);
+            }
+
+            if (ret > 0 && ret < options_.hedge_min_delay_ms) {
+                ret = options_.hedge_min_delay_ms;
+            }
+            return ret;
+        }
+
+        time_t http_request_policy::get_retry_delay(size_t retry_times) {
+            // exponential backoff with equal jitter, so retries of different requests are spread
+            time_t delay = options_.retry_base_delay_ms;
+            for (size_t i = 1; i < retry_times && delay < options_.retry_max_delay_ms; ++i) {
+                delay *= 2;
+            }
+            if (delay > options_.retry_max_delay_ms) {
+                delay = options_.retry_max_delay_ms;
+            }
+            if (delay <= 1) {
+                return delay;
+            }
+
+            return delay / 2 + random_.random_between<time_t>(0, delay / 2 + 1);
+        }
+
+        time_t http_request_policy::get_percentile(const host_state_t &host, double percentile) {
+            if (host.latency_samples.empty()) {
+                return -1;
+            }
+
+            std::vector<uint32_t> samples = host.latency_samples;
+            size_t                idx     = static_cast<size_t>(percentile * static_cast<double>(samples.size()));
+            if (idx >= samples.size()) {
+                idx = samples.size() - 1;
+            }
+            std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(idx), samples.end());
+            return static_cast<time_t>(samples[idx]);
+        }
+
+        void http_request_policy::ev_callback_on_timer(uv_timer_t *handle) {
+            operation_t *op = reinterpret_cast<operation_t *>(handle->data);
+            if (NULL == op || op->finished) {
+                return;
+            }
+
+            http_request_policy *self = op->owner;
+            if (op->timer_for_hedge) {
+                if (op->attempts.size() == 1 && self->budget_withdraw() && 0 == self->start_attempt(op, true)) {
+                    ++self->stats_.hedge_count;
+                }
+                return;
+            }
+
+            // retry
+            int res = self->start_attempt(op, false);
+            if (0 == res) {
+                self->schedule_hedge(op);
+            } else if (op->last_failed) {
+                http_request::ptr_t last_failed = op->last_failed;
+                self->finish_operation(op, *last_failed, false);
+            } else {
+                op->finished = true;
+                self->release_operation(op);
+            }
+        }
+
+        void http_request_policy::ev_callback_on_timer_closed(uv_handle_t *handle) { delete reinterpret_cast<uv_timer_t *>(handle); }
+    } // namespace network
+} // namespace util
+
+#endif
+#endif
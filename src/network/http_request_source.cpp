@@ -0,0 +1,229 @@
+﻿#include <cstring>
+
+#include "network/http_request_source.h"
+
+namespace util {
+    namespace network {
+        LIBATFRAME_UTILS_API http_request_source::~http_request_source() {}
+
+        LIBATFRAME_UTILS_API int64_t http_request_source::size() const { return -1; }
+
+        LIBATFRAME_UTILS_API bool http_request_source::rewind() { return false; }
+
+        LIBATFRAME_UTILS_API const char *http_request_source::content_encoding() const { return NULL; }
+
+        LIBATFRAME_UTILS_API http_file_source::http_file_source() : file_(NULL), file_size_(0), offset_(0) {}
+
+        LIBATFRAME_UTILS_API http_file_source::~http_file_source() { close(); }
+
+        LIBATFRAME_UTILS_API int http_file_source::open(const char *path, bool use_mmap) {
+            close();
+            if (NULL == path) {
+                return -1;
+            }
+
+            size_t sz = 0;
+            if (!util::file_system::file_size(path, sz)) {
+                return -1;
+            }
+            file_size_ = static_cast<int64_t>(sz);
+            offset_    = 0;
+
+            // empty file can not be mapped
+            if (use_mmap && file_size_ > 0 && 0 == mapped_.open(path, ::util::file_system::mmap_opt_t::EN_MOT_SEQUENTIAL) &&
+                mapped_.is_mapped()) {
+                file_size_ = static_cast<int64_t>(mapped_.size());
+                return 0;
+            }
+
+            UTIL_FS_OPEN(res, file_, path, "rb");
+            if (NULL == file_) {
+                return 0 != res ? res : -1;
+            }
+
+            return 0;
+        }
+
+        LIBATFRAME_UTILS_API void http_file_source::close() {
+            if (NULL != file_) {
+                UTIL_FS_CLOSE(file_);
+                file_ = NULL;
+            }
+
+            mapped_.close();
+            file_size_ = 0;
+            offset_    = 0;
+        }
+
+        LIBATFRAME_UTILS_API int64_t http_file_source::size() const { return is_open() ? file_size_ : -1; }
+
+        LIBATFRAME_UTILS_API size_t http_file_source::read(char *buffer, size_t sz) {
+            if (mapped_.is_mapped()) {
+                if (offset_ >= file_size_) {
+                    return 0;
+                }
+
+                if (static_cast<int64_t>(sz) > file_size_ - offset_) {
+                    sz = static_cast<size_t>(file_size_ - offset_);
+                }
+                memcpy(buffer, mapped_.data() + offset_, sz);
+                offset_ += static_cast<int64_t>(sz);
+                return sz;
+            }
+
+            if (NULL == file_) {
+                return read_result_t::EN_RR_ABORT;
+            }
+
+            size_t ret = fread(buffer, 1, sz, file_);
+            if (0 == ret && ferror(file_)) {
+                return read_result_t::EN_RR_ABORT;
+            }
+            offset_ += static_cast<int64_t>(ret);
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API bool http_file_source::rewind() {
+            if (mapped_.is_mapped()) {
+                offset_ = 0;
+                return true;
+            }
+
+            if (NULL == file_) {
+                return false;
+            }
+
+            if (0 != fseek(file_, 0, SEEK_SET)) {
+                return false;
+            }
+            offset_ = 0;
+            return true;
+        }
+
+        LIBATFRAME_UTILS_API http_generator_source::http_generator_source(generator_fn_t fn, int64_t total_size, rewind_fn_t rewind_fn)
+            : fn_(fn), rewind_fn_(rewind_fn), total_size_(total_size) {}
+
+        LIBATFRAME_UTILS_API http_generator_source::~http_generator_source() {}
+
+        LIBATFRAME_UTILS_API int64_t http_generator_source::size() const { return total_size_; }
+
+        LIBATFRAME_UTILS_API size_t http_generator_source::read(char *buffer, size_t sz) {
+            if (!fn_) {
+                return read_result_t::EN_RR_ABORT;
+            }
+
+            return fn_(buffer, sz);
+        }
+
+        LIBATFRAME_UTILS_API bool http_generator_source::rewind() {
+            if (!rewind_fn_) {
+                return false;
+            }
+
+            return rewind_fn_();
+        }
+
+#if defined(NETWORK_ENABLE_ZLIB) && NETWORK_ENABLE_ZLIB
+        LIBATFRAME_UTILS_API http_compress_source::http_compress_source(const http_request_source::ptr_t &upstream, codec_t::type codec,
+                                                                        int level)
+            : upstream_(upstream), codec_(codec), level_(level), stream_inited_(false), upstream_eof_(false), finished_(false),
+              input_(INPUT_BUFFER_SIZE), input_size_(0), output_size_(0) {
+            memset(&stream_, 0, sizeof(stream_));
+            reset_stream();
+        }
+
+        LIBATFRAME_UTILS_API http_compress_source::~http_compress_source() {
+            if (stream_inited_) {
+                deflateEnd(&stream_);
+            }
+        }
+
+        LIBATFRAME_UTILS_API size_t http_compress_source::read(char *buffer, size_t sz) {
+            if (!stream_inited_ || !upstream_) {
+                return read_result_t::EN_RR_ABORT;
+            }
+
+            if (finished_) {
+                return 0;
+            }
+
+            stream_.next_out  = reinterpret_cast<Bytef *>(buffer);
+            stream_.avail_out = static_cast<uInt>(sz);
+
+            // fill as much as possible into the output buffer, pending data are kept in z_stream
+            while (stream_.avail_out > 0) {
+                if (0 == stream_.avail_in && !upstream_eof_) {
+                    size_t res = upstream_->read(&input_[0], input_.size());
+                    if (read_result_t::EN_RR_ABORT == res) {
+                        return read_result_t::EN_RR_ABORT;
+                    }
+
+                    if (read_result_t::EN_RR_PAUSE == res) {
+                        // send what we have, and pause only if nothing is produced
+                        break;
+                    }
+
+                    if (0 == res) {
+                        upstream_eof_ = true;
+                    } else {
+                        stream_.next_in  = reinterpret_cast<Bytef *>(&input_[0]);
+                        stream_.avail_in = static_cast<uInt>(res);
+                        input_size_ += res;
+                    }
+                }
+
+                int res = deflate(&stream_, upstream_eof_ ? Z_FINISH : Z_NO_FLUSH);
+                if (Z_STREAM_END == res) {
+                    finished_ = true;
+                    break;
+                }
+
+                if (Z_OK != res && Z_BUF_ERROR != res) {
+                    return read_result_t::EN_RR_ABORT;
+                }
+            }
+
+            size_t ret = sz - stream_.avail_out;
+            output_size_ += ret;
+            if (0 == ret && !finished_) {
+                return read_result_t::EN_RR_PAUSE;
+            }
+
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API bool http_compress_source::rewind() {
+            if (!upstream_ || !upstream_->rewind()) {
+                return false;
+            }
+
+            return reset_stream();
+        }
+
+        LIBATFRAME_UTILS_API const char *http_compress_source::content_encoding() const {
+            return codec_t::EN_CC_GZIP == codec_ ? "gzip" : "deflate";
+        }
+
+        bool http_compress_source::reset_stream() {
+            if (stream_inited_) {
+                deflateEnd(&stream_);
+                stream_inited_ = false;
+            }
+
+            memset(&stream_, 0, sizeof(stream_));
+            // windowBits + 16 means gzip header and trailer
+            int window_bits = codec_t::EN_CC_GZIP == codec_ ? MAX_WBITS + 16 : MAX_WBITS;
+            if (Z_OK != deflateInit2(&stream_, level_, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY)) {
+                return false;
+            }
+
+            stream_inited_ = true;
+            upstream_eof_  = false;
+            finished_      = false;
+            input_size_    = 0;
+            output_size_   = 0;
+            return true;
+        }
+#endif
+    } // namespace network
+} // namespace util
@@ -0,0 +1,244 @@
+﻿#include <cstring>
+
+#include "common/file_system.h"
+#include "lock/lock_holder.h"
+#include "lock/spin_lock.h"
+
+#include "network/http_response_sink.h"
+
+namespace util {
+    namespace network {
+        namespace detail {
+            // 普通段的全局缓存池
+            struct http_segment_pool_t {
+                ::util::lock::spin_lock lock;
+                std::vector<char *>     free_list;
+                size_t                  max_cached;
+
+                http_segment_pool_t() : max_cached(256) {}
+                ~http_segment_pool_t() {
+                    for (size_t i = 0; i < free_list.size(); ++i) {
+                        delete[] free_list[i];
+                    }
+                }
+            };
+
+            // 放在函数内，保证其他模块的静态初始化和析构里也可以使用
+            static http_segment_pool_t &http_segment_pool() {
+                static http_segment_pool_t ret;
+                return ret;
+            }
+
+            static char *http_segment_alloc(size_t capacity) {
+                if (http_buffer_chain::SEGMENT_SIZE == capacity) {
+                    http_segment_pool_t &                               pool = http_segment_pool();
+                    ::util::lock::lock_holder< ::util::lock::spin_lock> holder(pool.lock);
+                    if (!pool.free_list.empty()) {
+                        char *ret = pool.free_list.back();
+                        pool.free_list.pop_back();
+                        return ret;
+                    }
+                }
+
+                return new char[capacity];
+            }
+
+            static void http_segment_free(char *data, size_t capacity) {
+                if (http_buffer_chain::SEGMENT_SIZE == capacity) {
+                    http_segment_pool_t &                               pool = http_segment_pool();
+                    ::util::lock::lock_holder< ::util::lock::spin_lock> holder(pool.lock);
+                    if (pool.free_list.size() < pool.max_cached) {
+                        pool.free_list.push_back(data);
+                        return;
+                    }
+                }
+
+                delete[] data;
+            }
+        } // namespace detail
+
+        LIBATFRAME_UTILS_API http_response_sink::~http_response_sink() {}
+
+        LIBATFRAME_UTILS_API void http_response_sink::reserve(size_t) {}
+
+        LIBATFRAME_UTILS_API void http_response_sink::finish() {}
+
+        LIBATFRAME_UTILS_API http_buffer_chain::http_buffer_chain() : total_size_(0) {}
+
+        LIBATFRAME_UTILS_API http_buffer_chain::~http_buffer_chain() { clear(); }
+
+        LIBATFRAME_UTILS_API void http_buffer_chain::reserve(size_t total_size) {
+            if (total_size <= total_size_) {
+                return;
+            }
+
+            size_t need = total_size - total_size_;
+            if (!segments_.empty() && segments_.back().capacity - segments_.back().size >= need) {
+                return;
+            }
+
+            // 剩余空间放不下时新分配一个足够大的段，之前段的剩余空间不再使用
+            push_segment(need > static_cast<size_t>(SEGMENT_SIZE) ? need : static_cast<size_t>(SEGMENT_SIZE));
+        }
+
+        LIBATFRAME_UTILS_API size_t http_buffer_chain::write(const char *data, size_t sz) {
+            size_t ret = sz;
+            while (sz > 0) {
+                if (segments_.empty() || segments_.back().size >= segments_.back().capacity) {
+                    push_segment(SEGMENT_SIZE);
+                }
+
+                segment_t &tail = segments_.back();
+                size_t     len  = tail.capacity - tail.size;
+                if (len > sz) {
+                    len = sz;
+                }
+
+                memcpy(tail.data + tail.size, data, len);
+                tail.size += len;
+                total_size_ += len;
+                data += len;
+                sz -= len;
+            }
+
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API http_buffer_chain::span_t http_buffer_chain::segment(size_t idx) const {
+            span_t ret;
+            if (idx >= segments_.size()) {
+                ret.data = NULL;
+                ret.size = 0;
+            } else {
+                ret.data = segments_[idx].data;
+                ret.size = segments_[idx].size;
+            }
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API size_t http_buffer_chain::copy_to(char *dst, size_t dlen, size_t offset) const {
+            size_t ret = 0;
+            for (size_t i = 0; i < segments_.size() && ret < dlen; ++i) {
+                const segment_t &seg = segments_[i];
+                if (offset >= seg.size) {
+                    offset -= seg.size;
+                    continue;
+                }
+
+                size_t len = seg.size - offset;
+                if (len > dlen - ret) {
+                    len = dlen - ret;
+                }
+                memcpy(dst + ret, seg.data + offset, len);
+                ret += len;
+                offset = 0;
+            }
+
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API void http_buffer_chain::append_to(std::string &out) const {
+            out.reserve(out.size() + total_size_);
+            for (size_t i = 0; i < segments_.size(); ++i) {
+                out.append(segments_[i].data, segments_[i].size);
+            }
+        }
+
+        LIBATFRAME_UTILS_API std::string http_buffer_chain::to_string() const {
+            std::string ret;
+            append_to(ret);
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API http_buffer_chain::span_t http_buffer_chain::linearize() {
+            if (segments_.size() > 1) {
+                segment_t merged;
+                merged.capacity = total_size_;
+                merged.size     = total_size_;
+                merged.data     = detail::http_segment_alloc(merged.capacity);
+                copy_to(merged.data, merged.size);
+
+                size_t total_size = total_size_;
+                clear();
+                segments_.push_back(merged);
+                total_size_ = total_size;
+            }
+
+            return segment(0);
+        }
+
+        LIBATFRAME_UTILS_API void http_buffer_chain::clear() {
+            for (size_t i = 0; i < segments_.size(); ++i) {
+                detail::http_segment_free(segments_[i].data, segments_[i].capacity);
+            }
+            segments_.clear();
+            total_size_ = 0;
+        }
+
+        LIBATFRAME_UTILS_API size_t http_buffer_chain::get_pool_cached_count() {
+            detail::http_segment_pool_t &                       pool = detail::http_segment_pool();
+            ::util::lock::lock_holder< ::util::lock::spin_lock> holder(pool.lock);
+            return pool.free_list.size();
+        }
+
+        LIBATFRAME_UTILS_API void http_buffer_chain::set_pool_max_cached_count(size_t v) {
+            detail::http_segment_pool_t &                       pool = detail::http_segment_pool();
+            ::util::lock::lock_holder< ::util::lock::spin_lock> holder(pool.lock);
+            pool.max_cached = v;
+            while (pool.free_list.size() > v) {
+                delete[] pool.free_list.back();
+                pool.free_list.pop_back();
+            }
+        }
+
+        void http_buffer_chain::push_segment(size_t capacity) {
+            segment_t seg;
+            seg.data     = detail::http_segment_alloc(capacity);
+            seg.size     = 0;
+            seg.capacity = capacity;
+            segments_.push_back(seg);
+        }
+
+        LIBATFRAME_UTILS_API http_file_sink::http_file_sink() : file_(NULL), written_size_(0) {}
+
+        LIBATFRAME_UTILS_API http_file_sink::~http_file_sink() { close(); }
+
+        LIBATFRAME_UTILS_API int http_file_sink::open(const char *path, bool append) {
+            close();
+            if (NULL == path) {
+                return -1;
+            }
+
+            UTIL_FS_OPEN(res, file_, path, append ? "ab" : "wb");
+            if (NULL == file_) {
+                return 0 != res ? res : -1;
+            }
+
+            written_size_ = 0;
+            return 0;
+        }
+
+        LIBATFRAME_UTILS_API void http_file_sink::close() {
+            if (NULL != file_) {
+                UTIL_FS_CLOSE(file_);
+                file_ = NULL;
+            }
+        }
+
+        LIBATFRAME_UTILS_API size_t http_file_sink::write(const char *data, size_t sz) {
+            if (NULL == file_) {
+                return 0;
+            }
+
+            size_t ret = fwrite(data, 1, sz, file_);
+            written_size_ += ret;
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API void http_file_sink::finish() {
+            if (NULL != file_) {
+                fflush(file_);
+            }
+        }
+    } // namespace network
+} // namespace util
@@ -0,0 +1,810 @@
+﻿#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "common/string_oprs.h"
+#include "string/tquerystring.h"
+
+#include "network/http_server.h"
+
+namespace util {
+    namespace network {
+        namespace detail {
+            static const char http_server_continue_response[] = "HTTP/1.1 100 Continue\r\n\r\n";
+
+            // the response body is not copied, large buffers are released after written to keep the pool small
+            static const size_t http_server_max_kept_buffer_size = 65536;
+
+            static inline bool http_server_is_space(char c) { return ' ' == c || '\t' == c; }
+
+            static void http_server_trim(const char *&begin, const char *&end) {
+                while (begin < end && http_server_is_space(*begin)) {
+                    ++begin;
+                }
+                while (end > begin && http_server_is_space(*(end - 1))) {
+                    --end;
+                }
+            }
+
+            static bool http_server_has_token(const std::string &value, const char *token) {
+                size_t token_len = strlen(token);
+                size_t begin     = 0;
+                while (begin < value.size()) {
+                    size_t end = value.find(',', begin);
+                    if (std::string::npos == end) {
+                        end = value.size();
+                    }
+
+                    const char *b = value.data() + begin;
+                    const char *e = value.data() + end;
+                    http_server_trim(b, e);
+                    if (static_cast<size_t>(e - b) == token_len && 0 == UTIL_STRFUNC_STRNCASE_CMP(b, token, token_len)) {
+                        return true;
+                    }
+                    begin = end + 1;
+                }
+
+                return false;
+            }
+
+            static void http_server_shrink(std::string &buffer) {
+                if (buffer.capacity() > http_server_max_kept_buffer_size) {
+                    std::string().swap(buffer);
+                } else {
+                    buffer.clear();
+                }
+            }
+        } // namespace detail
+
+        LIBATFRAME_UTILS_API http_server_request::http_server_request() : version_minor(1), keep_alive(true) {}
+
+        LIBATFRAME_UTILS_API void http_server_request::reset() {
+            method.clear();
+            target.clear();
+            path.clear();
+            query.clear();
+            version_minor = 1;
+            headers.clear();
+            detail::http_server_shrink(body);
+            keep_alive = true;
+        }
+
+        LIBATFRAME_UTILS_API const std::string *http_server_request::get_header(const char *name) const {
+            if (NULL == name) {
+                return NULL;
+            }
+
+            for (header_list_t::const_iterator iter = headers.begin(); iter != headers.end(); ++iter) {
+                if (0 == UTIL_STRFUNC_STRCASE_CMP(iter->first.c_str(), name)) {
+                    return &iter->second;
+                }
+            }
+
+            return NULL;
+        }
+
+        LIBATFRAME_UTILS_API http_server_response::http_server_response() : status(200), content_type("text/plain; charset=utf-8") {}
+
+        LIBATFRAME_UTILS_API void http_server_response::reset() {
+            status       = 200;
+            content_type = "text/plain; charset=utf-8";
+            headers.clear();
+            detail::http_server_shrink(body);
+        }
+
+        LIBATFRAME_UTILS_API const char *http_server_response::get_reason_phrase(int status) {
+            switch (status) {
+            case 100:
+                return "Continue";
+            case 200:
+                return "OK";
+            case 201:
+                return "Created";
+            case 202:
+                return "Accepted";
+            case 204:
+                return "No Content";
+            case 301:
+                return "Moved Permanently";
+            case 302:
+                return "Found";
+            case 304:
+                return "Not Modified";
+            case 400:
+                return "Bad Request";
+            case 401:
+                return "Unauthorized";
+            case 403:
+                return "Forbidden";
+            case 404:
+                return "Not Found";
+            case 405:
+                return "Method Not Allowed";
+            case 408:
+                return "Request Timeout";
+            case 413:
+                return "Payload Too Large";
+            case 429:
+                return "Too Many Requests";
+            case 431:
+                return "Request Header Fields Too Large";
+            case 500:
+                return "Internal Server Error";
+            case 501:
+                return "Not Implemented";
+            case 503:
+                return "Service Unavailable";
+            case 505:
+                return "HTTP Version Not Supported";
+            default:
+                return "Unknown";
+            }
+        }
+
+        LIBATFRAME_UTILS_API http_server_parser::http_server_parser(size_t max_header_size, size_t max_body_size)
+            : state_(state_t::EN_HSPS_REQUEST_LINE), error_status_(0), max_header_size_(max_header_size), max_body_size_(max_body_size),
+              header_size_(0), body_remain_(0) {}
+
+        LIBATFRAME_UTILS_API size_t http_server_parser::parse(const char *data, size_t sz) {
+            size_t consumed = 0;
+            while (consumed < sz && state_t::EN_HSPS_DONE != state_ && state_t::EN_HSPS_ERROR != state_) {
+                if (state_t::EN_HSPS_BODY == state_) {
+                    size_t len = sz - consumed;
+                    if (len > body_remain_) {
+                        len = body_remain_;
+                    }
+                    request_.body.append(data + consumed, len);
+                    consumed += len;
+                    body_remain_ -= len;
+                    if (0 == body_remain_) {
+                        state_ = state_t::EN_HSPS_DONE;
+                    }
+                    continue;
+                }
+
+                const char *begin = data + consumed;
+                const char *end   = reinterpret_cast<const char *>(memchr(begin, '\n', sz - consumed));
+                size_t      len   = (NULL == end) ? (sz - consumed) : static_cast<size_t>(end - begin + 1);
+
+                consumed += len;
+                header_size_ += len;
+                if (header_size_ > max_header_size_) {
+                    set_error(431);
+                    break;
+                }
+
+                // wait for the rest of the line
+                if (NULL == end) {
+                    line_.append(begin, len);
+                    break;
+                }
+
+                const char *line     = begin;
+                size_t      line_len = len - 1;
+                if (!line_.empty()) {
+                    line_.append(begin, len - 1);
+                    line     = line_.data();
+                    line_len = line_.size();
+                }
+                if (line_len > 0 && '\r' == line[line_len - 1]) {
+                    --line_len;
+                }
+
+                bool res;
+                if (state_t::EN_HSPS_REQUEST_LINE == state_) {
+                    // empty lines before the request line should be ignored, @see RFC 7230 3.5
+                    res = (0 == line_len) ? true : parse_request_line(line, line_len);
+                } else if (0 == line_len) {
+                    res = finish_headers();
+                } else {
+                    res = parse_header_line(line, line_len);
+                }
+
+                line_.clear();
+                if (!res) {
+                    break;
+                }
+            }
+
+            return consumed;
+        }
+
+        LIBATFRAME_UTILS_API void http_server_parser::reset() {
+            state_        = state_t::EN_HSPS_REQUEST_LINE;
+            error_status_ = 0;
+            header_size_  = 0;
+            body_remain_  = 0;
+            line_.clear();
+            request_.reset();
+        }
+
+        LIBATFRAME_UTILS_API void http_server_parser::set_limits(size_t max_header_size, size_t max_body_size) {
+            max_header_size_ = max_header_size;
+            max_body_size_   = max_body_size;
+        }
+
+        bool http_server_parser::parse_request_line(const char *line, size_t sz) {
+            const char *end          = line + sz;
+            const char *method_end   = std::find(line, end, ' ');
+            const char *target_begin = method_end + 1;
+            if (method_end == end || method_end == line) {
+                set_error(400);
+                return false;
+            }
+
+            const char *target_end = std::find(target_begin, end, ' ');
+            if (target_end == end || target_end == target_begin) {
+                set_error(400);
+                return false;
+            }
+
+            const char *version = target_end + 1;
+            if (end - version != 8 || 0 != memcmp(version, "HTTP/1.", 7) || version[7] < '0' || version[7] > '9') {
+                bool is_http = (end - version) >= 5 && 0 == memcmp(version, "HTTP/", 5);
+                set_error(is_http ? 505 : 400);
+                return false;
+            }
+
+            request_.method.assign(line, method_end);
+            request_.target.assign(target_begin, target_end);
+            request_.version_minor = version[7] - '0';
+            // HTTP/1.0 closes the connection by default
+            request_.keep_alive = request_.version_minor >= 1;
+
+            const char *query_begin = std::find(target_begin, target_end, '?');
+            if (query_begin != target_begin) {
+                request_.path = ::util::uri::decode_uri_component(target_begin, static_cast<size_t>(query_begin - target_begin));
+            }
+            if (query_begin != target_end) {
+                request_.query.assign(query_begin + 1, target_end);
+            }
+
+            state_ = state_t::EN_HSPS_HEADERS;
+            return true;
+        }
+
+        bool http_server_parser::parse_header_line(const char *line, size_t sz) {
+            // obsolete line folding is not allowed, @see RFC 7230 3.2.4
+            if (detail::http_server_is_space(line[0])) {
+                set_error(400);
+                return false;
+            }
+
+            const char *end   = line + sz;
+            const char *colon = std::find(line, end, ':');
+            if (colon == end || colon == line) {
+                set_error(400);
+                return false;
+            }
+
+            const char *name_end    = colon;
+            const char *value_begin = colon + 1;
+            const char *value_end   = end;
+            if (detail::http_server_is_space(*(name_end - 1))) {
+                set_error(400);
+                return false;
+            }
+            detail::http_server_trim(value_begin, value_end);
+
+            request_.headers.push_back(std::make_pair(std::string(line, name_end), std::string(value_begin, value_end)));
+            return true;
+        }
+
+        bool http_server_parser::finish_headers() {
+            const std::string *connection = request_.get_header("Connection");
+            if (NULL != connection) {
+                if (detail::http_server_has_token(*connection, "close")) {
+                    request_.keep_alive = false;
+                } else if (detail::http_server_has_token(*connection, "keep-alive")) {
+                    request_.keep_alive = true;
+                }
+            }
+
+            if (NULL != request_.get_header("Transfer-Encoding")) {
+                set_error(501);
+                return false;
+            }
+
+            body_remain_                      = 0;
+            const std::string *content_length = request_.get_header("Content-Length");
+            if (NULL != content_length) {
+                if (content_length->empty() || content_length->size() > 18) {
+                    set_error(400);
+                    return false;
+                }
+
+                uint64_t len = 0;
+                for (size_t i = 0; i < content_length->size(); ++i) {
+                    char c = (*content_length)[i];
+                    if (c < '0' || c > '9') {
+                        set_error(400);
+                        return false;
+                    }
+                    len = len * 10 + static_cast<uint64_t>(c - '0');
+                }
+
+                if (len > max_body_size_) {
+                    set_error(413);
+                    return false;
+                }
+                body_remain_ = static_cast<size_t>(len);
+            }
+
+            if (body_remain_ > 0) {
+                request_.body.reserve(body_remain_);
+                state_ = state_t::EN_HSPS_BODY;
+            } else {
+                state_ = state_t::EN_HSPS_DONE;
+            }
+            return true;
+        }
+
+        void http_server_parser::set_error(int status) {
+            state_        = state_t::EN_HSPS_ERROR;
+            error_status_ = status;
+        }
+
+#if defined(NETWORK_EVPOLL_ENABLE_LIBUV) && NETWORK_EVPOLL_ENABLE_LIBUV
+        struct http_server::connection_t {
+            enum {
+                READ_BUFFER_SIZE = 4096,
+            };
+
+            http_server *        owner; // NULL if the server is destroyed before the handles are closed
+            uv_tcp_t             tcp;
+            uv_timer_t           timer;
+            uv_write_t           write_req;
+            int                  pending_close;
+            bool                 in_use;
+            bool                 closing;
+            bool                 writing;
+            bool                 close_after_write;
+            bool                 continue_sent;
+            http_server_parser   parser;
+            http_server_response response; // kept until written, so the body is not copied
+            std::string          input;
+            size_t               input_offset;
+            std::string          output_head;
+            char                 read_buffer[READ_BUFFER_SIZE];
+
+            connection_t()
+                : owner(NULL), pending_close(0), in_use(false), closing(false), writing(false), close_after_write(false),
+                  continue_sent(false), input_offset(0) {}
+        };
+
+        LIBATFRAME_UTILS_API http_server::options_t::options_t()
+            : max_connections(256), max_header_size(8192), max_body_size(1048576), keep_alive_timeout_ms(30000), backlog(128) {}
+
+        LIBATFRAME_UTILS_API http_server::stats_t::stats_t()
+            : accepted_count(0), rejected_count(0), request_count(0), error_count(0), active_connections(0) {}
+
+        LIBATFRAME_UTILS_API http_server::http_server() : loop_(NULL), listener_(NULL), port_(-1), closing_(false) {}
+
+        LIBATFRAME_UTILS_API http_server::~http_server() {
+            close();
+
+            // connections which are still closing are released by the loop
+            for (size_t i = 0; i < connections_.size(); ++i) {
+                if (connections_[i]->in_use) {
+                    connections_[i]->owner = NULL;
+                } else {
+                    delete connections_[i];
+                }
+            }
+            connections_.clear();
+            free_connections_.clear();
+        }
+
+        LIBATFRAME_UTILS_API int http_server::listen(uv_loop_t *loop, const char *ip, int port, const options_t &options) {
+            if (NULL == loop || NULL == ip || NULL != listener_ || !connections_.empty()) {
+                return UV_EINVAL;
+            }
+
+            sockaddr_storage addr;
+            int              ret;
+            if (NULL != strchr(ip, ':')) {
+                ret = uv_ip6_addr(ip, port, reinterpret_cast<sockaddr_in6 *>(&addr));
+            } else {
+                ret = uv_ip4_addr(ip, port, reinterpret_cast<sockaddr_in *>(&addr));
+            }
+            if (0 != ret) {
+                return ret;
+            }
+
+            listener_ = new uv_tcp_t();
+            uv_tcp_init(loop, listener_);
+            listener_->data = this;
+
+            ret = uv_tcp_bind(listener_, reinterpret_cast<const sockaddr *>(&addr), 0);
+            if (0 == ret) {
+                ret = uv_listen(reinterpret_cast<uv_stream_t *>(listener_), options.backlog, on_connection);
+            }
+            if (0 != ret) {
+                listener_->data = NULL;
+                uv_close(reinterpret_cast<uv_handle_t *>(listener_), on_tcp_closed);
+                listener_ = NULL;
+                return ret;
+            }
+
+            sockaddr_storage bound;
+            int              len = static_cast<int>(sizeof(bound));
+            uv_tcp_getsockname(listener_, reinterpret_cast<sockaddr *>(&bound), &len);
+            if (AF_INET6 == bound.ss_family) {
+                port_ = ntohs(reinterpret_cast<sockaddr_in6 *>(&bound)->sin6_port);
+            } else {
+                port_ = ntohs(reinterpret_cast<sockaddr_in *>(&bound)->sin_port);
+            }
+
+            loop_    = loop;
+            options_ = options;
+            closing_ = false;
+
+            // all connections are allocated here, nothing is allocated when accepting
+            connections_.reserve(options_.max_connections);
+            free_connections_.reserve(options_.max_connections);
+            for (size_t i = 0; i < options_.max_connections; ++i) {
+                connection_t *conn = new connection_t();
+                conn->owner        = this;
+                conn->parser.set_limits(options_.max_header_size, options_.max_body_size);
+                connections_.push_back(conn);
+                free_connections_.push_back(conn);
+            }
+
+            return 0;
+        }
+
+        LIBATFRAME_UTILS_API void http_server::close() {
+            closing_ = true;
+            if (NULL != listener_) {
+                listener_->data = NULL;
+                uv_close(reinterpret_cast<uv_handle_t *>(listener_), on_tcp_closed);
+                listener_ = NULL;
+            }
+
+            for (size_t i = 0; i < connections_.size(); ++i) {
+                if (connections_[i]->in_use) {
+                    close_connection(connections_[i]);
+                }
+            }
+        }
+
+        LIBATFRAME_UTILS_API bool http_server::is_closed() const { return NULL == listener_ && 0 == stats_.active_connections; }
+
+        LIBATFRAME_UTILS_API int http_server::get_port() const { return NULL == listener_ ? -1 : port_; }
+
+        LIBATFRAME_UTILS_API void http_server::set_route(const std::string &path, handler_fn_t fn) {
+            if (path.empty() || '/' != path[path.size() - 1]) {
+                if (fn) {
+                    exact_routes_[path] = fn;
+                } else {
+                    exact_routes_.erase(path);
+                }
+                return;
+            }
+
+            for (size_t i = 0; i < prefix_routes_.size(); ++i) {
+                if (prefix_routes_[i].first == path) {
+                    prefix_routes_.erase(prefix_routes_.begin() + static_cast<std::ptrdiff_t>(i));
+                    break;
+                }
+            }
+
+            if (!fn) {
+                return;
+            }
+
+            size_t pos = 0;
+            while (pos < prefix_routes_.size() && prefix_routes_[pos].first.size() >= path.size()) {
+                ++pos;
+            }
+            prefix_routes_.insert(prefix_routes_.begin() + static_cast<std::ptrdiff_t>(pos), std::make_pair(path, fn));
+        }
+
+        LIBATFRAME_UTILS_API void http_server::set_command_route(const std::string &prefix, const command_router_ptr_t &router) {
+            std::string path = prefix;
+            if (path.empty() || '/' != path[path.size() - 1]) {
+                path += '/';
+            }
+
+            if (!router) {
+                set_route(path, handler_fn_t());
+                return;
+            }
+
+            command_router_ptr_t r = router;
+            set_route(path, [path, r](const http_server_request &req, http_server_response &rsp) {
+                // every segment of the path is a command or a parameter
+                std::vector<std::string> cmds;
+                size_t                   begin = path.size();
+                while (begin < req.path.size()) {
+                    size_t end = req.path.find('/', begin);
+                    if (std::string::npos == end) {
+                        end = req.path.size();
+                    }
+                    if (end > begin) {
+                        cmds.push_back(req.path.substr(begin, end - begin));
+                    }
+                    begin = end + 1;
+                }
+
+                command_context_t ctx;
+                ctx.request  = &req;
+                ctx.response = &rsp;
+                ctx.handled  = false;
+                if (!cmds.empty()) {
+                    r->start(cmds, true, &ctx);
+                }
+
+                if (!ctx.handled) {
+                    rsp.status = 404;
+                    rsp.body   = "Command Not Found";
+                }
+            });
+        }
+
+        LIBATFRAME_UTILS_API void http_server::set_default_handler(handler_fn_t fn) { default_handler_ = fn; }
+
+        LIBATFRAME_UTILS_API http_server::command_context_t *http_server::get_command_context(::util::cli::callback_param params) {
+            command_context_t *ret = reinterpret_cast<command_context_t *>(params.get_ext_param());
+            if (NULL != ret) {
+                ret->handled = true;
+            }
+
+            return ret;
+        }
+
+        void http_server::dispatch(const http_server_request &req, http_server_response &rsp) {
+            std::unordered_map<std::string, handler_fn_t>::const_iterator iter = exact_routes_.find(req.path);
+            if (iter != exact_routes_.end()) {
+                iter->second(req, rsp);
+                return;
+            }
+
+            for (size_t i = 0; i < prefix_routes_.size(); ++i) {
+                const std::string &prefix = prefix_routes_[i].first;
+                if (req.path.size() >= prefix.size() && 0 == req.path.compare(0, prefix.size(), prefix)) {
+                    prefix_routes_[i].second(req, rsp);
+                    return;
+                }
+            }
+
+            if (default_handler_) {
+                default_handler_(req, rsp);
+                return;
+            }
+
+            rsp.status = 404;
+            rsp.body   = "Not Found";
+        }
+
+        void http_server::on_connection(uv_stream_t *server, int status) {
+            http_server *self = reinterpret_cast<http_server *>(server->data);
+            if (NULL == self || status < 0) {
+                return;
+            }
+
+            if (self->free_connections_.empty() || self->closing_) {
+                // accept and close it at once, or the listener will be waked up again and again
+                uv_tcp_t *rejected = new uv_tcp_t();
+                uv_tcp_init(server->loop, rejected);
+                uv_accept(server, reinterpret_cast<uv_stream_t *>(rejected));
+                uv_close(reinterpret_cast<uv_handle_t *>(rejected), on_tcp_closed);
+                ++self->stats_.rejected_count;
+                return;
+            }
+
+            connection_t *conn = self->free_connections_.back();
+            self->free_connections_.pop_back();
+            ++self->stats_.active_connections;
+
+            conn->in_use            = true;
+            conn->closing           = false;
+            conn->writing           = false;
+            conn->close_after_write = false;
+            conn->continue_sent     = false;
+            conn->input_offset      = 0;
+            conn->input.clear();
+            conn->parser.reset();
+
+            uv_tcp_init(server->loop, &conn->tcp);
+            uv_timer_init(server->loop, &conn->timer);
+            conn->tcp.data       = conn;
+            conn->timer.data     = conn;
+            conn->write_req.data = conn;
+
+            if (0 != uv_accept(server, reinterpret_cast<uv_stream_t *>(&conn->tcp))) {
+                self->close_connection(conn);
+                return;
+            }
+            ++self->stats_.accepted_count;
+
+            uv_tcp_nodelay(&conn->tcp, 1);
+            uv_timer_start(&conn->timer, on_timeout, self->options_.keep_alive_timeout_ms, 0);
+            uv_read_start(reinterpret_cast<uv_stream_t *>(&conn->tcp), on_alloc, on_read);
+        }
+
+        void http_server::on_tcp_closed(uv_handle_t *handle) { delete reinterpret_cast<uv_tcp_t *>(handle); }
+
+        void http_server::on_alloc(uv_handle_t *handle, size_t, uv_buf_t *buf) {
+            connection_t *conn = reinterpret_cast<connection_t *>(handle->data);
+            buf->base          = conn->read_buffer;
+            buf->len           = connection_t::READ_BUFFER_SIZE;
+        }
+
+        void http_server::on_read(uv_stream_t *stream, ssize_t nread, const uv_buf_t *buf) {
+            connection_t *conn = reinterpret_cast<connection_t *>(stream->data);
+            http_server * self = conn->owner;
+            if (NULL == self || conn->closing) {
+                return;
+            }
+
+            if (nread < 0) {
+                self->close_connection(conn);
+                return;
+            }
+
+            if (0 == nread) {
+                return;
+            }
+
+            uv_timer_start(&conn->timer, on_timeout, self->options_.keep_alive_timeout_ms, 0);
+            conn->input.append(buf->base, static_cast<size_t>(nread));
+            self->process_input(conn);
+        }
+
+        void http_server::on_write(uv_write_t *req, int status) {
+            connection_t *conn = reinterpret_cast<connection_t *>(req->data);
+            conn->writing      = false;
+            http_server *self  = conn->owner;
+            if (NULL == self || conn->closing) {
+                return;
+            }
+
+            if (status < 0 || conn->close_after_write) {
+                self->close_connection(conn);
+                return;
+            }
+
+            conn->response.reset();
+            uv_timer_start(&conn->timer, on_timeout, self->options_.keep_alive_timeout_ms, 0);
+            uv_read_start(reinterpret_cast<uv_stream_t *>(&conn->tcp), on_alloc, on_read);
+
+            // pipelined requests
+            self->process_input(conn);
+        }
+
+        void http_server::on_timeout(uv_timer_t *timer) {
+            connection_t *conn = reinterpret_cast<connection_t *>(timer->data);
+            if (NULL != conn->owner) {
+                conn->owner->close_connection(conn);
+            }
+        }
+
+        void http_server::on_connection_closed(uv_handle_t *handle) {
+            connection_t *conn = reinterpret_cast<connection_t *>(handle->data);
+            if (--conn->pending_close > 0) {
+                return;
+            }
+
+            if (NULL == conn->owner) {
+                delete conn;
+            } else {
+                conn->owner->release_connection(conn);
+            }
+        }
+
+        void http_server::process_input(connection_t *conn) {
+            while (!conn->writing && !conn->closing && conn->input_offset < conn->input.size()) {
+                conn->input_offset += conn->parser.parse(conn->input.data() + conn->input_offset, conn->input.size() - conn->input_offset);
+
+                if (conn->parser.has_error()) {
+                    ++stats_.error_count;
+                    conn->response.reset();
+                    conn->response.status = conn->parser.get_error_status();
+                    conn->response.body   = http_server_response::get_reason_phrase(conn->response.status);
+                    send_response(conn, conn->parser.get_request(), conn->response, false);
+                    break;
+                }
+
+                if (!conn->parser.is_done()) {
+                    // client may wait for 100-continue before sending the body
+                    if (http_server_parser::state_t::EN_HSPS_BODY == conn->parser.get_state() && !conn->continue_sent) {
+                        conn->continue_sent    = true;
+                        const std::string *val = conn->parser.get_request().get_header("Expect");
+                        if (NULL != val && 0 == UTIL_STRFUNC_STRCASE_CMP(val->c_str(), "100-continue")) {
+                            uv_buf_t buf = uv_buf_init(const_cast<char *>(detail::http_server_continue_response),
+                                                       static_cast<unsigned int>(sizeof(detail::http_server_continue_response) - 1));
+                            uv_try_write(reinterpret_cast<uv_stream_t *>(&conn->tcp), &buf, 1);
+                        }
+                    }
+                    break;
+                }
+
+                ++stats_.request_count;
+                conn->response.reset();
+                dispatch(conn->parser.get_request(), conn->response);
+                send_response(conn, conn->parser.get_request(), conn->response, conn->parser.get_request().keep_alive);
+                conn->parser.reset();
+                conn->continue_sent = false;
+            }
+
+            if (conn->input_offset >= conn->input.size()) {
+                detail::http_server_shrink(conn->input);
+                conn->input_offset = 0;
+            }
+        }
+
+        void http_server::send_response(connection_t *conn, const http_server_request &req, http_server_response &rsp, bool keep_alive) {
+            if (conn->closing) {
+                return;
+            }
+
+            if (closing_) {
+                keep_alive = false;
+            }
+
+            std::string &head = conn->output_head;
+            head.clear();
+
+            char line[128];
+            int  len = snprintf(line, sizeof(line), "HTTP/1.1 %d %s\r\n", rsp.status, http_server_response::get_reason_phrase(rsp.status));
+            head.append(line, static_cast<size_t>(len));
+            if (!rsp.content_type.empty()) {
+                head += "Content-Type: ";
+                head += rsp.content_type;
+                head += "\r\n";
+            }
+            for (http_server_response::header_list_t::const_iterator iter = rsp.headers.begin(); iter != rsp.headers.end(); ++iter) {
+                head += iter->first;
+                head += ": ";
+                head += iter->second;
+                head += "\r\n";
+            }
+            len = snprintf(line, sizeof(line), "Content-Length: %llu\r\n", static_cast<unsigned long long>(rsp.body.size()));
+            head.append(line, static_cast<size_t>(len));
+            head += keep_alive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n";
+
+            uv_buf_t     bufs[2];
+            unsigned int buf_count = 1;
+            bufs[0]                = uv_buf_init(&head[0], static_cast<unsigned int>(head.size()));
+            if (!rsp.body.empty() && "HEAD" != req.method) {
+                bufs[1]   = uv_buf_init(&rsp.body[0], static_cast<unsigned int>(rsp.body.size()));
+                buf_count = 2;
+            }
+
+            // stop reading until the response is written, so a client can not make us buffer too much
+            uv_read_stop(reinterpret_cast<uv_stream_t *>(&conn->tcp));
+            conn->writing           = true;
+            conn->close_after_write = !keep_alive;
+            if (0 != uv_write(&conn->write_req, reinterpret_cast<uv_stream_t *>(&conn->tcp), bufs, buf_count, on_write)) {
+                conn->writing = false;
+                close_connection(conn);
+            }
+        }
+
+        void http_server::close_connection(connection_t *conn) {
+            if (conn->closing || !conn->in_use) {
+                return;
+            }
+
+            conn->closing       = true;
+            conn->pending_close = 2;
+            uv_timer_stop(&conn->timer);
+            uv_close(reinterpret_cast<uv_handle_t *>(&conn->tcp), on_connection_closed);
+            uv_close(reinterpret_cast<uv_handle_t *>(&conn->timer), on_connection_closed);
+        }
+
+        void http_server::release_connection(connection_t *conn) {
+            conn->in_use = false;
+            detail::http_server_shrink(conn->input);
+            conn->input_offset = 0;
+            conn->response.reset();
+            conn->parser.reset();
+            free_connections_.push_back(conn);
+            if (stats_.active_connections > 0) {
+                --stats_.active_connections;
+            }
+        }
+#endif
+    } // namespace network
+} // namespace util
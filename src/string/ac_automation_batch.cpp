@@ -0,0 +1,196 @@
+﻿// Licensed under the MIT licenses.
+
+#include <algorithm>
+#include <cstring>
+
+#include "string/ac_automation_batch.h"
+
+namespace util {
+    namespace string {
+        namespace detail {
+            static const size_t ac_batch_default_chunk_size = 64;
+        }
+
+        LIBATFRAME_UTILS_API ac_automation_batch_matcher::ac_automation_batch_matcher(size_t thread_count, size_t chunk_size)
+            : chunk_size_(0 == chunk_size ? detail::ac_batch_default_chunk_size : chunk_size), job_ac_(NULL), job_contents_(NULL),
+              job_count_(0), job_offsets_(NULL)
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+              ,
+              job_seq_(0), job_pending_(0), stop_(false), next_chunk_(0)
+#else
+              ,
+              next_chunk_(0)
+#endif
+        {
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            if (0 == thread_count) {
+                thread_count = std::thread::hardware_concurrency();
+            }
+            if (0 == thread_count) {
+                thread_count = 1;
+            }
+#else
+            thread_count = 1;
+#endif
+
+            scratch_.resize(thread_count);
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            // 下标0是调用线程
+            threads_.reserve(thread_count - 1);
+            for (size_t i = 1; i < thread_count; ++i) {
+                threads_.push_back(std::thread(&ac_automation_batch_matcher::worker_main, this, i));
+            }
+#endif
+        }
+
+        LIBATFRAME_UTILS_API ac_automation_batch_matcher::~ac_automation_batch_matcher() {
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            {
+                std::lock_guard<std::mutex> guard(job_lock_);
+                stop_ = true;
+            }
+            job_start_.notify_all();
+
+            for (size_t i = 0; i < threads_.size(); ++i) {
+                if (threads_[i].joinable()) {
+                    threads_[i].join();
+                }
+            }
+#endif
+        }
+
+        LIBATFRAME_UTILS_API size_t ac_automation_batch_matcher::match(const ac_automation_compiled &ac, const std::string *contents, size_t count,
+                                                                       result_t &out) {
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            std::lock_guard<std::mutex> match_guard(match_lock_);
+#endif
+
+            out.matches.clear();
+            out.offsets.assign(count + 1, 0);
+            if (0 == count || NULL == contents) {
+                return 0;
+            }
+
+            for (size_t i = 0; i < scratch_.size(); ++i) {
+                scratch_[i].clear();
+            }
+            chunks_.resize((count + chunk_size_ - 1) / chunk_size_);
+
+            job_ac_       = &ac;
+            job_contents_ = contents;
+            job_count_    = count;
+            job_offsets_  = &out.offsets[0];
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            next_chunk_.store(0);
+            // 只有一个块时不需要唤醒工作线程
+            if (!threads_.empty() && chunks_.size() > 1) {
+                {
+                    std::lock_guard<std::mutex> guard(job_lock_);
+                    job_pending_ = threads_.size();
+                    ++job_seq_;
+                }
+                job_start_.notify_all();
+
+                run_chunks(0);
+
+                std::unique_lock<std::mutex> guard(job_lock_);
+                while (0 != job_pending_) {
+                    job_done_.wait(guard);
+                }
+            } else {
+                run_chunks(0);
+            }
+#else
+            next_chunk_ = 0;
+            run_chunks(0);
+#endif
+
+            // offsets[i + 1] 目前是第i个目标串的匹配数量，转为前缀和
+            for (size_t i = 0; i < count; ++i) {
+                out.offsets[i + 1] += out.offsets[i];
+            }
+
+            // 按输入顺序合并每个块的结果
+            out.matches.resize(out.offsets[count]);
+            for (size_t i = 0; i < chunks_.size(); ++i) {
+                size_t from = i * chunk_size_;
+                size_t to   = std::min(from + chunk_size_, count);
+                size_t n    = out.offsets[to] - out.offsets[from];
+                if (0 == n) {
+                    continue;
+                }
+
+                const value_type &scratch = scratch_[chunks_[i].worker];
+                memcpy(&out.matches[out.offsets[from]], &scratch[chunks_[i].scratch_from], n * sizeof(match_t));
+            }
+
+            job_ac_       = NULL;
+            job_contents_ = NULL;
+            job_count_    = 0;
+            job_offsets_  = NULL;
+            return out.matches.size();
+        }
+
+        LIBATFRAME_UTILS_API size_t ac_automation_batch_matcher::match(const ac_automation_compiled &ac, const std::vector<std::string> &contents,
+                                                                       result_t &out) {
+            return match(ac, contents.empty() ? NULL : &contents[0], contents.size(), out);
+        }
+
+        LIBATFRAME_UTILS_API size_t ac_automation_batch_matcher::thread_count() const { return scratch_.size(); }
+
+        void ac_automation_batch_matcher::run_chunks(size_t worker) {
+            value_type &scratch = scratch_[worker];
+            while (true) {
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+                size_t chunk = next_chunk_.fetch_add(1);
+#else
+                size_t chunk = next_chunk_++;
+#endif
+                if (chunk >= chunks_.size()) {
+                    break;
+                }
+
+                chunks_[chunk].worker       = worker;
+                chunks_[chunk].scratch_from = scratch.size();
+
+                size_t from = chunk * chunk_size_;
+                size_t to   = std::min(from + chunk_size_, job_count_);
+                for (size_t i = from; i < to; ++i) {
+                    job_offsets_[i + 1] = job_ac_->match(job_contents_[i].c_str(), job_contents_[i].size(), scratch);
+                }
+            }
+        }
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+        void ac_automation_batch_matcher::worker_main(size_t worker) {
+            size_t seen_seq = 0;
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> guard(job_lock_);
+                    while (!stop_ && seen_seq == job_seq_) {
+                        job_start_.wait(guard);
+                    }
+
+                    if (stop_) {
+                        break;
+                    }
+                    seen_seq = job_seq_;
+                }
+
+                run_chunks(worker);
+
+                bool all_done;
+                {
+                    std::lock_guard<std::mutex> guard(job_lock_);
+                    all_done = 0 == --job_pending_;
+                }
+                if (all_done) {
+                    job_done_.notify_one();
+                }
+            }
+        }
+#endif
+    } // namespace string
+} // namespace util
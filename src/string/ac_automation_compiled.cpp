@@ -0,0 +1,1180 @@
+﻿// Licensed under the MIT licenses.
+
+#include <algorithm>
+#include <assert.h>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#include "algorithm/crc.h"
+#include "common/compiler_message.h"
+#include "common/file_system.h"
+#include "common/string_oprs.h"
+#include "string/ac_automation_compiled.h"
+
+#if defined(_WIN32) && !defined(__CYGWIN__)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#define UTIL_STRING_AC_COMPILED_WINDOWS_MMAP 1
+#elif defined(UTIL_FS_POSIX_API)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define UTIL_STRING_AC_COMPILED_POSIX_MMAP 1
+#endif
+
+// 前置过滤的SIMD实现: x86使用SSSE3(运行时检测)，aarch64使用NEON
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <tmmintrin.h>
+#define UTIL_STRING_AC_COMPILED_SSSE3 1
+#define UTIL_STRING_AC_COMPILED_SSSE3_TARGET __attribute__((target("ssse3")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <tmmintrin.h>
+#define UTIL_STRING_AC_COMPILED_SSSE3 1
+#define UTIL_STRING_AC_COMPILED_SSSE3_TARGET
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define UTIL_STRING_AC_COMPILED_NEON 1
+#endif
+
+namespace util {
+    namespace string {
+        namespace detail {
+            static const uint32_t ac_compiled_class_mask = 0x00FFFFFFU;
+            static const uint32_t ac_compiled_skip_bit   = 0x80000000U;
+
+            static const char     ac_compiled_image_magic[8]   = {'A', 'T', 'A', 'C', 'D', 'F', 'A', 0};
+            static const uint32_t ac_compiled_image_byte_order = 0x01020304U;
+            static const uint32_t ac_compiled_flag_nocase      = 0x01U;
+            static const uint32_t ac_compiled_flag_utf8        = 0x02U;
+            static const uint32_t ac_compiled_flag_prefilter   = 0x04U; // 启用前置过滤
+            static const uint32_t ac_compiled_flag_prefix_bloom = 0x08U; // 前缀3字节的bloom过滤可用(没有可跳过字符)
+
+            static const unsigned char ac_compiled_start_root   = 0x01U; // 根节点有这个字节的转移
+            static const unsigned char ac_compiled_start_short  = 0x02U; // 有以这个字节开始的长度小于3的关键字
+            static const size_t        ac_compiled_prefix_bloom_bits = 65536;
+
+            static inline uint32_t ac_compiled_prefix_hash(uint32_t c0, uint32_t c1, uint32_t c2) {
+                uint32_t h = c0 * 0x9E3779B1U ^ (c1 + 0x7F4A7C15U) * 0x85EBCA77U ^ (c2 + 0x165667B1U) * 0xC2B2AE3DU;
+                h ^= h >> 15;
+                h *= 0x2C1B3C6DU;
+                h ^= h >> 16;
+                return h & static_cast<uint32_t>(ac_compiled_prefix_bloom_bits - 1);
+            }
+
+            /**
+             * @brief 镜像文件头，所有section都用相对镜像起始位置的偏移表示
+             */
+            struct ac_compiled_image_header_t {
+                char     magic[8];
+                uint32_t version;
+                uint32_t header_size;
+                uint32_t byte_order;
+                uint32_t flags;
+                uint32_t state_count;
+                uint32_t class_count;
+                uint32_t keyword_count;
+                uint32_t keyword_data_size;
+                uint32_t multibyte_skip_count;
+                uint32_t multibyte_skip_data_size;
+                uint32_t checksum; // crc32 of [header_size, image_size)
+                uint32_t reserved;
+                uint64_t image_size;
+                uint64_t offset_byte_info;
+                uint64_t offset_base;
+                uint64_t offset_check;
+                uint64_t offset_fail;
+                uint64_t offset_output;
+                uint64_t offset_keyword_offset;
+                uint64_t offset_keyword_data;
+                uint64_t offset_multibyte_skip_offset;
+                uint64_t offset_multibyte_skip_data;
+                uint64_t offset_start_flags;  // 256字节
+                uint64_t offset_prefix_bloom; // ac_compiled_prefix_bloom_bits/8 字节
+            };
+
+            /**
+             * @brief 镜像写入器，每个section按8字节对齐
+             */
+            class ac_compiled_image_writer {
+            public:
+                explicit ac_compiled_image_writer(std::vector<uint64_t> &out) : out_(&out), size_(0) {
+                    out_->clear();
+                    append(NULL, sizeof(ac_compiled_image_header_t));
+                }
+
+                uint64_t append(const void *data, size_t sz) {
+                    uint64_t ret      = static_cast<uint64_t>(size_);
+                    size_t   new_size = size_ + ((sz + sizeof(uint64_t) - 1) / sizeof(uint64_t)) * sizeof(uint64_t);
+                    out_->resize(new_size / sizeof(uint64_t), 0);
+                    if (NULL != data && sz > 0) {
+                        memcpy(reinterpret_cast<unsigned char *>(&(*out_)[0]) + size_, data, sz);
+                    }
+                    size_ = new_size;
+                    return ret;
+                }
+
+                void reserve(size_t sz) { out_->reserve((sz + sizeof(uint64_t) - 1) / sizeof(uint64_t)); }
+
+                inline ac_compiled_image_header_t *header() { return reinterpret_cast<ac_compiled_image_header_t *>(&(*out_)[0]); }
+                inline unsigned char *             data() { return reinterpret_cast<unsigned char *>(&(*out_)[0]); }
+                inline size_t                      size() const { return size_; }
+
+            private:
+                std::vector<uint64_t> *out_;
+                size_t                 size_;
+            };
+
+            static inline bool ac_compiled_check_section(const ac_compiled_image_header_t &header, uint64_t offset, uint64_t sz,
+                                                         uint64_t align) {
+                if (offset < header.header_size || offset > header.image_size || sz > header.image_size - offset) {
+                    return false;
+                }
+
+                return 0 == offset % align;
+            }
+
+            /**
+             * @brief 编译期使用的临时字典树节点
+             */
+            struct ac_compiled_build_node_t {
+                std::vector<std::pair<uint32_t, uint32_t> > children; // (字节类型, 节点下标), 按字节类型排序
+                uint32_t                                    keyword;  // 关键字下标+1, 0表示非结束节点
+                uint32_t                                    fail;
+                uint32_t                                    output;
+                uint32_t                                    cell;
+
+                ac_compiled_build_node_t() : keyword(0), fail(0), output(0), cell(0) {}
+
+                uint32_t find(uint32_t cls) const {
+                    std::vector<std::pair<uint32_t, uint32_t> >::const_iterator iter =
+                        std::lower_bound(children.begin(), children.end(), std::make_pair(cls, static_cast<uint32_t>(0)));
+                    if (iter != children.end() && iter->first == cls) {
+                        return iter->second;
+                    }
+
+                    return ac_automation_compiled::INVALID_STATE;
+                }
+            };
+
+            static inline size_t ac_compiled_utf8_length(unsigned char c) {
+                if (!(c & 0x80)) {
+                    return 1;
+                }
+
+                size_t ret = 1;
+                for (; ret < 6; ++ret, c <<= 1) {
+                    if (!(c & 0x40)) {
+                        break;
+                    }
+                }
+
+                return ret;
+            }
+
+            /**
+             * @brief 双数组空闲单元查找(带路径压缩的并查集，find(i)返回>=i的第一个空闲单元)
+             */
+            class ac_compiled_free_cells {
+            public:
+                ac_compiled_free_cells() {}
+
+                void resize(size_t sz) {
+                    size_t old_sz = next_.size();
+                    if (sz + 1 <= old_sz) {
+                        return;
+                    }
+
+                    next_.resize(sz + 1);
+                    for (size_t i = old_sz; i < next_.size(); ++i) {
+                        next_[i] = static_cast<uint32_t>(i);
+                    }
+                }
+
+                uint32_t find(uint32_t i) {
+                    if (i >= next_.size()) {
+                        return i;
+                    }
+
+                    uint32_t r = i;
+                    while (r < next_.size() && next_[r] != r) {
+                        r = next_[r];
+                    }
+
+                    while (i < next_.size() && next_[i] != i) {
+                        uint32_t n = next_[i];
+                        next_[i]   = r;
+                        i          = n;
+                    }
+
+                    return r;
+                }
+
+                inline bool is_free(uint32_t i) { return find(i) == i; }
+
+                void use(uint32_t i) {
+                    resize(static_cast<size_t>(i) + 1);
+                    next_[i] = i + 1;
+                }
+
+            private:
+                std::vector<uint32_t> next_;
+            };
+
+            static inline int ac_compiled_compare(const char *l, size_t lsz, const unsigned char *r, size_t rsz) {
+                int res = memcmp(l, r, lsz < rsz ? lsz : rsz);
+                if (res != 0) {
+                    return res;
+                }
+                return lsz < rsz ? -1 : (lsz > rsz ? 1 : 0);
+            }
+        } // namespace detail
+
+        LIBATFRAME_UTILS_API ac_automation_compiled::option_t::option_t() : nocase(false), utf8(false), prefilter(true) {}
+
+        LIBATFRAME_UTILS_API ac_automation_compiled::ac_automation_compiled(protect_constructor_helper)
+            : image_(NULL), image_size_(0), byte_info_(NULL), base_(NULL), check_(NULL), fail_(NULL), output_(NULL), keyword_offset_(NULL),
+              keyword_data_(NULL), multibyte_skip_offset_(NULL), multibyte_skip_data_(NULL), state_count_(0), class_count_(0),
+              keyword_count_(0), multibyte_skip_count_(0), start_flags_(NULL), prefix_bloom_(NULL), nocase_(false), utf8_(false),
+              prefilter_(false), prefix_bloom_enabled_(false), mapped_addr_(NULL), mapped_size_(0)
+#if defined(_WIN32) && !defined(__CYGWIN__)
+              ,
+              mapped_file_(NULL), mapped_handle_(NULL)
+#endif
+        {
+        }
+
+        LIBATFRAME_UTILS_API ac_automation_compiled::~ac_automation_compiled() {
+#if defined(UTIL_STRING_AC_COMPILED_POSIX_MMAP)
+            if (NULL != mapped_addr_) {
+                ::munmap(mapped_addr_, mapped_size_);
+            }
+#elif defined(UTIL_STRING_AC_COMPILED_WINDOWS_MMAP)
+            if (NULL != mapped_addr_) {
+                UnmapViewOfFile(mapped_addr_);
+            }
+            if (NULL != mapped_handle_) {
+                CloseHandle(mapped_handle_);
+            }
+            if (NULL != mapped_file_) {
+                CloseHandle(mapped_file_);
+            }
+#endif
+        }
+
+        LIBATFRAME_UTILS_API ac_automation_compiled::ptr_t ac_automation_compiled::create(const std::vector<std::string> &keywords,
+                                                                                          const option_t &                opts) {
+            ptr_t ret = std::make_shared<ac_automation_compiled>(protect_constructor_helper());
+            if (!ret) {
+                return ret;
+            }
+
+            uint32_t byte_info[256];
+
+            // 字节等价类，忽略大小写时大写字母和小写字母共享一个类型
+            unsigned char fold[256];
+            for (int i = 0; i < 256; ++i) {
+                fold[i] = static_cast<unsigned char>(i);
+                if (opts.nocase) {
+                    fold[i] = static_cast<unsigned char>(util::string::tolower<char>(static_cast<char>(i)));
+                }
+            }
+
+            bool used[256] = {false};
+            for (size_t i = 0; i < keywords.size(); ++i) {
+                for (size_t j = 0; j < keywords[i].size(); ++j) {
+                    used[fold[static_cast<unsigned char>(keywords[i][j])]] = true;
+                }
+            }
+
+            uint32_t class_of[256] = {0};
+            uint32_t class_count   = 0;
+            for (int i = 0; i < 256; ++i) {
+                if (used[i]) {
+                    class_of[i] = ++class_count;
+                }
+            }
+
+            for (int i = 0; i < 256; ++i) {
+                byte_info[i] = class_of[fold[i]];
+            }
+
+            std::vector<std::string> multibyte_skip;
+
+            for (size_t i = 0; i < opts.skip_chars.size(); ++i) {
+                const std::string &c = opts.skip_chars[i];
+                if (c.empty()) {
+                    continue;
+                }
+
+                if (c.size() == 1) {
+                    unsigned char skip_byte = fold[static_cast<unsigned char>(c[0])];
+                    for (int j = 0; j < 256; ++j) {
+                        if (fold[j] == skip_byte) {
+                            byte_info[j] |= detail::ac_compiled_skip_bit;
+                        }
+                    }
+                } else if (opts.utf8) {
+                    multibyte_skip.push_back(c);
+                }
+            }
+            std::sort(multibyte_skip.begin(), multibyte_skip.end());
+            multibyte_skip.erase(std::unique(multibyte_skip.begin(), multibyte_skip.end()), multibyte_skip.end());
+
+            // 构建临时字典树
+            std::vector<detail::ac_compiled_build_node_t> nodes;
+            std::vector<const std::string *>              keyword_list;
+            nodes.push_back(detail::ac_compiled_build_node_t());
+            for (size_t i = 0; i < keywords.size(); ++i) {
+                if (keywords[i].empty()) {
+                    continue;
+                }
+
+                uint32_t cur = 0;
+                for (size_t j = 0; j < keywords[i].size(); ++j) {
+                    uint32_t cls  = byte_info[static_cast<unsigned char>(keywords[i][j])] & detail::ac_compiled_class_mask;
+                    uint32_t next = nodes[cur].find(cls);
+                    if (INVALID_STATE == next) {
+                        next = static_cast<uint32_t>(nodes.size());
+                        nodes.push_back(detail::ac_compiled_build_node_t());
+
+                        std::vector<std::pair<uint32_t, uint32_t> > &children = nodes[cur].children;
+                        children.insert(std::lower_bound(children.begin(), children.end(), std::make_pair(cls, static_cast<uint32_t>(0))),
+                                        std::make_pair(cls, next));
+                    }
+                    cur = next;
+                }
+
+                // 和ac_automation一致，重复的关键字以最后一个为准
+                if (0 != nodes[cur].keyword) {
+                    keyword_list[nodes[cur].keyword - 1] = &keywords[i];
+                } else {
+                    keyword_list.push_back(&keywords[i]);
+                    nodes[cur].keyword = static_cast<uint32_t>(keyword_list.size());
+                }
+            }
+
+            // BFS 建立失败指针和输出
+            std::vector<uint32_t> bfs_order;
+            bfs_order.reserve(nodes.size());
+            bfs_order.push_back(0);
+            for (size_t i = 0; i < bfs_order.size(); ++i) {
+                uint32_t u = bfs_order[i];
+                for (size_t j = 0; j < nodes[u].children.size(); ++j) {
+                    uint32_t cls = nodes[u].children[j].first;
+                    uint32_t v   = nodes[u].children[j].second;
+                    bfs_order.push_back(v);
+
+                    uint32_t f = 0;
+                    if (0 != u) {
+                        f = nodes[u].fail;
+                        while (0 != f && INVALID_STATE == nodes[f].find(cls)) {
+                            f = nodes[f].fail;
+                        }
+                        f = nodes[f].find(cls);
+                        if (INVALID_STATE == f) {
+                            f = 0;
+                        }
+                    }
+
+                    nodes[v].fail   = f;
+                    nodes[v].output = 0 != nodes[v].keyword ? nodes[v].keyword : nodes[f].output;
+                }
+            }
+
+            // 双数组布局
+            detail::ac_compiled_free_cells free_cells;
+            std::vector<uint32_t>          base;
+            std::vector<uint32_t>          check;
+            size_t                         capacity = nodes.size() + class_count + 1;
+            base.assign(capacity, 0);
+            check.assign(capacity, INVALID_STATE);
+            free_cells.resize(capacity);
+            free_cells.use(0);
+
+            uint32_t max_cell = 0;
+            for (size_t i = 0; i < bfs_order.size(); ++i) {
+                detail::ac_compiled_build_node_t &u = nodes[bfs_order[i]];
+                if (u.children.empty()) {
+                    continue;
+                }
+
+                uint32_t first_cls = u.children.front().first;
+                uint32_t last_cls  = u.children.back().first;
+                uint32_t e         = free_cells.find(first_cls);
+                uint32_t b         = 0;
+                while (true) {
+                    b = e - first_cls;
+                    if (static_cast<size_t>(b) + last_cls >= capacity) {
+                        capacity = (static_cast<size_t>(b) + last_cls + 1) * 3 / 2;
+                        base.resize(capacity, 0);
+                        check.resize(capacity, INVALID_STATE);
+                        free_cells.resize(capacity);
+                    }
+
+                    bool ok = true;
+                    for (size_t j = 1; ok && j < u.children.size(); ++j) {
+                        ok = free_cells.is_free(b + u.children[j].first);
+                    }
+
+                    if (ok) {
+                        break;
+                    }
+                    e = free_cells.find(e + 1);
+                }
+
+                base[u.cell] = b;
+                for (size_t j = 0; j < u.children.size(); ++j) {
+                    uint32_t cell = b + u.children[j].first;
+                    free_cells.use(cell);
+                    check[cell]                         = u.cell;
+                    nodes[u.children[j].second].cell = cell;
+                    if (cell > max_cell) {
+                        max_cell = cell;
+                    }
+                }
+            }
+
+            // 保证任意状态加任意字节类型都不越界，匹配时可以省去边界检查
+            uint32_t max_base = 0;
+            for (size_t i = 0; i <= max_cell && i < base.size(); ++i) {
+                if (base[i] > max_base) {
+                    max_base = base[i];
+                }
+            }
+            capacity = static_cast<size_t>(max_cell > max_base ? max_cell : max_base) + class_count + 1;
+            base.resize(capacity, 0);
+            check.resize(capacity, INVALID_STATE);
+            std::vector<uint32_t> fail(capacity, 0);
+            std::vector<uint32_t> output(capacity, 0);
+            for (size_t i = 0; i < nodes.size(); ++i) {
+                fail[nodes[i].cell]   = nodes[nodes[i].fail].cell;
+                output[nodes[i].cell] = nodes[i].output;
+            }
+
+            // 关键字存储
+            std::vector<uint32_t> keyword_offset;
+            std::string           keyword_data;
+            keyword_offset.reserve(keyword_list.size() + 1);
+            for (size_t i = 0; i < keyword_list.size(); ++i) {
+                keyword_offset.push_back(static_cast<uint32_t>(keyword_data.size()));
+                keyword_data.append(*keyword_list[i]);
+            }
+            keyword_offset.push_back(static_cast<uint32_t>(keyword_data.size()));
+
+            std::vector<uint32_t> multibyte_skip_offset;
+            std::string           multibyte_skip_data;
+            multibyte_skip_offset.reserve(multibyte_skip.size() + 1);
+            for (size_t i = 0; i < multibyte_skip.size(); ++i) {
+                multibyte_skip_offset.push_back(static_cast<uint32_t>(multibyte_skip_data.size()));
+                multibyte_skip_data.append(multibyte_skip[i]);
+            }
+            multibyte_skip_offset.push_back(static_cast<uint32_t>(multibyte_skip_data.size()));
+
+            // 前置过滤: 根节点可转移的字节，以及关键字前3个字节的bloom过滤
+            unsigned char start_flags[256];
+            memset(start_flags, 0, sizeof(start_flags));
+            std::vector<unsigned char> prefix_bloom(detail::ac_compiled_prefix_bloom_bits / 8, 0);
+            bool                       use_prefix_bloom = opts.prefilter && multibyte_skip.empty();
+            for (int i = 0; i < 256; ++i) {
+                if (0 != (byte_info[i] & detail::ac_compiled_skip_bit)) {
+                    use_prefix_bloom = false;
+                }
+
+                uint32_t cls = byte_info[i] & detail::ac_compiled_class_mask;
+                if (0 != cls && INVALID_STATE != nodes[0].find(cls)) {
+                    start_flags[i] |= detail::ac_compiled_start_root;
+                }
+            }
+            for (size_t i = 0; i < keyword_list.size(); ++i) {
+                const std::string &kw = *keyword_list[i];
+                uint32_t           c0 = byte_info[static_cast<unsigned char>(kw[0])] & detail::ac_compiled_class_mask;
+                if (kw.size() < 3) {
+                    for (int j = 0; j < 256; ++j) {
+                        if ((byte_info[j] & detail::ac_compiled_class_mask) == c0) {
+                            start_flags[j] |= detail::ac_compiled_start_short;
+                        }
+                    }
+                } else {
+                    uint32_t h = detail::ac_compiled_prefix_hash(c0, byte_info[static_cast<unsigned char>(kw[1])] & detail::ac_compiled_class_mask,
+                                                                 byte_info[static_cast<unsigned char>(kw[2])] & detail::ac_compiled_class_mask);
+                    prefix_bloom[h / 8] |= static_cast<unsigned char>(1 << (h % 8));
+                }
+            }
+
+            // 打包成镜像
+            detail::ac_compiled_image_writer writer(ret->owned_image_);
+            writer.reserve(sizeof(detail::ac_compiled_image_header_t) + sizeof(byte_info) + capacity * 4 * sizeof(uint32_t) +
+                           (keyword_offset.size() + multibyte_skip_offset.size()) * sizeof(uint32_t) + keyword_data.size() +
+                           multibyte_skip_data.size() + sizeof(start_flags) + prefix_bloom.size() + 11 * sizeof(uint64_t));
+            uint64_t                         offset_byte_info             = writer.append(byte_info, sizeof(byte_info));
+            uint64_t                         offset_base                  = writer.append(&base[0], base.size() * sizeof(uint32_t));
+            uint64_t                         offset_check                 = writer.append(&check[0], check.size() * sizeof(uint32_t));
+            uint64_t                         offset_fail                  = writer.append(&fail[0], fail.size() * sizeof(uint32_t));
+            uint64_t                         offset_output                = writer.append(&output[0], output.size() * sizeof(uint32_t));
+            uint64_t                         offset_keyword_offset        = writer.append(&keyword_offset[0], keyword_offset.size() * sizeof(uint32_t));
+            uint64_t                         offset_keyword_data          = writer.append(keyword_data.data(), keyword_data.size());
+            uint64_t                         offset_multibyte_skip_offset =
+                writer.append(&multibyte_skip_offset[0], multibyte_skip_offset.size() * sizeof(uint32_t));
+            uint64_t offset_multibyte_skip_data = writer.append(multibyte_skip_data.data(), multibyte_skip_data.size());
+            uint64_t offset_start_flags         = writer.append(start_flags, sizeof(start_flags));
+            uint64_t offset_prefix_bloom        = writer.append(&prefix_bloom[0], prefix_bloom.size());
+
+            detail::ac_compiled_image_header_t *header = writer.header();
+            memcpy(header->magic, detail::ac_compiled_image_magic, sizeof(header->magic));
+            header->version     = IMAGE_VERSION;
+            header->header_size = static_cast<uint32_t>(sizeof(detail::ac_compiled_image_header_t));
+            header->byte_order  = detail::ac_compiled_image_byte_order;
+            header->flags       = (opts.nocase ? detail::ac_compiled_flag_nocase : 0) | (opts.utf8 ? detail::ac_compiled_flag_utf8 : 0) |
+                            (opts.prefilter ? detail::ac_compiled_flag_prefilter : 0) |
+                            (use_prefix_bloom ? detail::ac_compiled_flag_prefix_bloom : 0);
+            header->state_count = static_cast<uint32_t>(capacity);
+            header->class_count = class_count;
+            header->keyword_count               = static_cast<uint32_t>(keyword_list.size());
+            header->keyword_data_size           = static_cast<uint32_t>(keyword_data.size());
+            header->multibyte_skip_count        = static_cast<uint32_t>(multibyte_skip.size());
+            header->multibyte_skip_data_size    = static_cast<uint32_t>(multibyte_skip_data.size());
+            header->reserved                    = 0;
+            header->image_size                  = static_cast<uint64_t>(writer.size());
+            header->offset_byte_info            = offset_byte_info;
+            header->offset_base                 = offset_base;
+            header->offset_check                = offset_check;
+            header->offset_fail                 = offset_fail;
+            header->offset_output               = offset_output;
+            header->offset_keyword_offset       = offset_keyword_offset;
+            header->offset_keyword_data         = offset_keyword_data;
+            header->offset_multibyte_skip_offset = offset_multibyte_skip_offset;
+            header->offset_multibyte_skip_data  = offset_multibyte_skip_data;
+            header->offset_start_flags          = offset_start_flags;
+            header->offset_prefix_bloom         = offset_prefix_bloom;
+            header->checksum = util::crc32(writer.data() + header->header_size, writer.size() - header->header_size);
+
+            if (!ret->bind_image(writer.data(), writer.size(), false)) {
+                return ptr_t();
+            }
+
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API ac_automation_compiled::ptr_t ac_automation_compiled::load_image(const void *data, size_t sz, bool copy,
+                                                                                              bool verify) {
+            if (NULL == data || sz < sizeof(detail::ac_compiled_image_header_t)) {
+                return ptr_t();
+            }
+
+            ptr_t ret = std::make_shared<ac_automation_compiled>(protect_constructor_helper());
+            if (!ret) {
+                return ret;
+            }
+
+            if (copy) {
+                ret->owned_image_.resize((sz + sizeof(uint64_t) - 1) / sizeof(uint64_t), 0);
+                memcpy(&ret->owned_image_[0], data, sz);
+                data = &ret->owned_image_[0];
+            }
+
+            if (!ret->bind_image(data, sz, verify)) {
+                return ptr_t();
+            }
+
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API ac_automation_compiled::ptr_t ac_automation_compiled::mmap_image(const char *file_path, bool verify) {
+            if (NULL == file_path) {
+                return ptr_t();
+            }
+
+#if defined(UTIL_STRING_AC_COMPILED_POSIX_MMAP)
+            int fd = ::open(file_path, O_RDONLY);
+            if (fd < 0) {
+                return ptr_t();
+            }
+
+            struct stat st;
+            if (0 != ::fstat(fd, &st) || st.st_size < static_cast<off_t>(sizeof(detail::ac_compiled_image_header_t))) {
+                ::close(fd);
+                return ptr_t();
+            }
+
+            size_t sz   = static_cast<size_t>(st.st_size);
+            void * addr = ::mmap(NULL, sz, PROT_READ, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (MAP_FAILED == addr) {
+                return ptr_t();
+            }
+
+            ptr_t ret = std::make_shared<ac_automation_compiled>(protect_constructor_helper());
+            if (!ret) {
+                ::munmap(addr, sz);
+                return ret;
+            }
+
+            // 析构时负责unmap
+            ret->mapped_addr_ = addr;
+            ret->mapped_size_ = sz;
+            if (!ret->bind_image(addr, sz, verify)) {
+                return ptr_t();
+            }
+
+            return ret;
+#elif defined(UTIL_STRING_AC_COMPILED_WINDOWS_MMAP)
+            HANDLE file = CreateFileA(file_path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+            if (INVALID_HANDLE_VALUE == file) {
+                return ptr_t();
+            }
+
+            LARGE_INTEGER file_size;
+            if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart < static_cast<LONGLONG>(sizeof(detail::ac_compiled_image_header_t))) {
+                CloseHandle(file);
+                return ptr_t();
+            }
+
+            HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (NULL == mapping) {
+                CloseHandle(file);
+                return ptr_t();
+            }
+
+            void *addr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (NULL == addr) {
+                CloseHandle(mapping);
+                CloseHandle(file);
+                return ptr_t();
+            }
+
+            ptr_t ret = std::make_shared<ac_automation_compiled>(protect_constructor_helper());
+            if (!ret) {
+                UnmapViewOfFile(addr);
+                CloseHandle(mapping);
+                CloseHandle(file);
+                return ret;
+            }
+
+            ret->mapped_addr_   = addr;
+            ret->mapped_size_   = static_cast<size_t>(file_size.QuadPart);
+            ret->mapped_file_   = file;
+            ret->mapped_handle_ = mapping;
+            if (!ret->bind_image(addr, ret->mapped_size_, verify)) {
+                return ptr_t();
+            }
+
+            return ret;
+#else
+            std::string content;
+            if (!util::file_system::get_file_content(content, file_path, true)) {
+                return ptr_t();
+            }
+
+            return load_image(content.data(), content.size(), true, verify);
+#endif
+        }
+
+        bool ac_automation_compiled::bind_image(const void *data, size_t sz, bool verify) {
+            if (NULL == data || sz < sizeof(detail::ac_compiled_image_header_t) || 0 != reinterpret_cast<uintptr_t>(data) % sizeof(uint32_t)) {
+                return false;
+            }
+
+            const detail::ac_compiled_image_header_t *header = reinterpret_cast<const detail::ac_compiled_image_header_t *>(data);
+            if (0 != memcmp(header->magic, detail::ac_compiled_image_magic, sizeof(header->magic))) {
+                return false;
+            }
+
+            if (IMAGE_VERSION != header->version || header->header_size < sizeof(detail::ac_compiled_image_header_t) ||
+                detail::ac_compiled_image_byte_order != header->byte_order || header->image_size > sz || 0 == header->state_count ||
+                header->state_count <= header->class_count) {
+                return false;
+            }
+
+            uint64_t state_bytes = static_cast<uint64_t>(header->state_count) * sizeof(uint32_t);
+            if (!detail::ac_compiled_check_section(*header, header->offset_byte_info, 256 * sizeof(uint32_t), sizeof(uint32_t)) ||
+                !detail::ac_compiled_check_section(*header, header->offset_base, state_bytes, sizeof(uint32_t)) ||
+                !detail::ac_compiled_check_section(*header, header->offset_check, state_bytes, sizeof(uint32_t)) ||
+                !detail::ac_compiled_check_section(*header, header->offset_fail, state_bytes, sizeof(uint32_t)) ||
+                !detail::ac_compiled_check_section(*header, header->offset_output, state_bytes, sizeof(uint32_t)) ||
+                !detail::ac_compiled_check_section(*header, header->offset_keyword_offset,
+                                                   (static_cast<uint64_t>(header->keyword_count) + 1) * sizeof(uint32_t), sizeof(uint32_t)) ||
+                !detail::ac_compiled_check_section(*header, header->offset_keyword_data, header->keyword_data_size, 1) ||
+                !detail::ac_compiled_check_section(*header, header->offset_multibyte_skip_offset,
+                                                   (static_cast<uint64_t>(header->multibyte_skip_count) + 1) * sizeof(uint32_t),
+                                                   sizeof(uint32_t)) ||
+                !detail::ac_compiled_check_section(*header, header->offset_multibyte_skip_data, header->multibyte_skip_data_size, 1) ||
+                !detail::ac_compiled_check_section(*header, header->offset_start_flags, 256, 1) ||
+                !detail::ac_compiled_check_section(*header, header->offset_prefix_bloom, detail::ac_compiled_prefix_bloom_bits / 8, 1)) {
+                return false;
+            }
+
+            const unsigned char *image = reinterpret_cast<const unsigned char *>(data);
+            if (verify) {
+                if (header->checksum != util::crc32(image + header->header_size, static_cast<size_t>(header->image_size - header->header_size))) {
+                    return false;
+                }
+            }
+
+            image_                 = image;
+            image_size_            = static_cast<size_t>(header->image_size);
+            byte_info_             = reinterpret_cast<const uint32_t *>(image + header->offset_byte_info);
+            base_                  = reinterpret_cast<const uint32_t *>(image + header->offset_base);
+            check_                 = reinterpret_cast<const uint32_t *>(image + header->offset_check);
+            fail_                  = reinterpret_cast<const uint32_t *>(image + header->offset_fail);
+            output_                = reinterpret_cast<const uint32_t *>(image + header->offset_output);
+            keyword_offset_        = reinterpret_cast<const uint32_t *>(image + header->offset_keyword_offset);
+            keyword_data_          = reinterpret_cast<const char *>(image + header->offset_keyword_data);
+            multibyte_skip_offset_ = reinterpret_cast<const uint32_t *>(image + header->offset_multibyte_skip_offset);
+            multibyte_skip_data_   = reinterpret_cast<const char *>(image + header->offset_multibyte_skip_data);
+            start_flags_           = image + header->offset_start_flags;
+            prefix_bloom_          = image + header->offset_prefix_bloom;
+            state_count_           = header->state_count;
+            class_count_           = header->class_count;
+            keyword_count_         = header->keyword_count;
+            multibyte_skip_count_  = header->multibyte_skip_count;
+            nocase_                = 0 != (header->flags & detail::ac_compiled_flag_nocase);
+            utf8_                  = 0 != (header->flags & detail::ac_compiled_flag_utf8);
+            prefilter_             = 0 != (header->flags & detail::ac_compiled_flag_prefilter);
+            prefix_bloom_enabled_  = 0 != (header->flags & detail::ac_compiled_flag_prefix_bloom);
+
+            // SIMD查表数据(shufti): 低4位查表得到高4位的位图，scan_table_[0-15]对应高4位0-7，scan_table_[16-31]对应高4位8-15
+            memset(scan_table_, 0, sizeof(scan_table_));
+            for (int i = 0; i < 256; ++i) {
+                if (0 != (start_flags_[i] & detail::ac_compiled_start_root)) {
+                    int hi = i >> 4;
+                    int lo = i & 0x0F;
+                    scan_table_[(hi < 8 ? 0 : 16) + lo] |= static_cast<unsigned char>(1 << (hi & 0x07));
+                }
+            }
+
+            if (verify) {
+                // 保证匹配时的所有访问都不越界
+                for (uint32_t i = 0; i < 256; ++i) {
+                    if ((byte_info_[i] & detail::ac_compiled_class_mask) > class_count_) {
+                        return false;
+                    }
+                }
+
+                for (uint32_t i = 0; i < state_count_; ++i) {
+                    if (base_[i] >= state_count_ - class_count_ || (INVALID_STATE != check_[i] && check_[i] >= state_count_) ||
+                        fail_[i] >= state_count_ || output_[i] > keyword_count_) {
+                        return false;
+                    }
+                }
+
+                for (uint32_t i = 0; i < keyword_count_; ++i) {
+                    if (keyword_offset_[i] > keyword_offset_[i + 1]) {
+                        return false;
+                    }
+                }
+                if (0 != keyword_offset_[0] || keyword_offset_[keyword_count_] > header->keyword_data_size) {
+                    return false;
+                }
+
+                for (uint32_t i = 0; i < multibyte_skip_count_; ++i) {
+                    if (multibyte_skip_offset_[i] > multibyte_skip_offset_[i + 1]) {
+                        return false;
+                    }
+                }
+                if (0 != multibyte_skip_offset_[0] || multibyte_skip_offset_[multibyte_skip_count_] > header->multibyte_skip_data_size) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        LIBATFRAME_UTILS_API void ac_automation_compiled::dump_image(std::string &out) const {
+            if (NULL == image_) {
+                out.clear();
+                return;
+            }
+
+            out.assign(reinterpret_cast<const char *>(image_), image_size_);
+        }
+
+        LIBATFRAME_UTILS_API bool ac_automation_compiled::save_image(const char *file_path) const {
+            if (NULL == image_ || NULL == file_path) {
+                return false;
+            }
+
+            FILE *f = NULL;
+            UTIL_FS_OPEN(error_code, f, file_path, "wb");
+            COMPILER_UNUSED(error_code);
+            if (NULL == f) {
+                return false;
+            }
+
+            bool ret = image_size_ == fwrite(image_, 1, image_size_, f);
+            UTIL_FS_CLOSE(f);
+            return ret;
+        }
+
+        namespace detail {
+            static size_t ac_compiled_scan_scalar(const unsigned char *start_flags, const unsigned char *, const unsigned char *p, size_t i,
+                                                  size_t sz) {
+                while (i + 4 <= sz) {
+                    if (0 != (start_flags[p[i]] & ac_compiled_start_root)) {
+                        return i;
+                    }
+                    if (0 != (start_flags[p[i + 1]] & ac_compiled_start_root)) {
+                        return i + 1;
+                    }
+                    if (0 != (start_flags[p[i + 2]] & ac_compiled_start_root)) {
+                        return i + 2;
+                    }
+                    if (0 != (start_flags[p[i + 3]] & ac_compiled_start_root)) {
+                        return i + 3;
+                    }
+                    i += 4;
+                }
+
+                while (i < sz && 0 == (start_flags[p[i]] & ac_compiled_start_root)) {
+                    ++i;
+                }
+                return i;
+            }
+
+#if defined(UTIL_STRING_AC_COMPILED_SSSE3)
+            UTIL_STRING_AC_COMPILED_SSSE3_TARGET static size_t ac_compiled_scan_ssse3(const unsigned char *start_flags,
+                                                                                     const unsigned char *scan_table, const unsigned char *p,
+                                                                                     size_t i, size_t sz) {
+                const __m128i table_low  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(scan_table));
+                const __m128i table_high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(scan_table + 16));
+                const __m128i bit_table  = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+                const __m128i nibble     = _mm_set1_epi8(0x0F);
+                const __m128i zero       = _mm_setzero_si128();
+
+                for (; i + 16 <= sz; i += 16) {
+                    __m128i v       = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+                    __m128i lo      = _mm_and_si128(v, nibble);
+                    __m128i hi      = _mm_and_si128(_mm_srli_epi16(v, 4), nibble);
+                    __m128i is_high = _mm_cmplt_epi8(v, zero);
+                    __m128i row     = _mm_or_si128(_mm_andnot_si128(is_high, _mm_shuffle_epi8(table_low, lo)),
+                                               _mm_and_si128(is_high, _mm_shuffle_epi8(table_high, lo)));
+                    __m128i hit     = _mm_and_si128(row, _mm_shuffle_epi8(bit_table, hi));
+                    int     mask    = (~_mm_movemask_epi8(_mm_cmpeq_epi8(hit, zero))) & 0xFFFF;
+                    if (0 != mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+                        unsigned long index;
+                        _BitScanForward(&index, static_cast<unsigned long>(mask));
+                        return i + index;
+#else
+                        return i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned int>(mask)));
+#endif
+                    }
+                }
+
+                return ac_compiled_scan_scalar(start_flags, scan_table, p, i, sz);
+            }
+
+            static bool ac_compiled_has_ssse3() {
+#if defined(_MSC_VER) && !defined(__clang__)
+                int cpu_info[4] = {0};
+                __cpuid(cpu_info, 1);
+                return 0 != (cpu_info[2] & (1 << 9));
+#else
+                __builtin_cpu_init();
+                return 0 != __builtin_cpu_supports("ssse3");
+#endif
+            }
+#endif
+
+#if defined(UTIL_STRING_AC_COMPILED_NEON)
+            static size_t ac_compiled_scan_neon(const unsigned char *start_flags, const unsigned char *scan_table, const unsigned char *p,
+                                                size_t i, size_t sz) {
+                static const unsigned char bits[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+                const uint8x16_t           table_low  = vld1q_u8(scan_table);
+                const uint8x16_t           table_high = vld1q_u8(scan_table + 16);
+                const uint8x16_t           bit_table  = vld1q_u8(bits);
+                const uint8x16_t           nibble     = vdupq_n_u8(0x0F);
+
+                for (; i + 16 <= sz; i += 16) {
+                    uint8x16_t v       = vld1q_u8(p + i);
+                    uint8x16_t lo      = vandq_u8(v, nibble);
+                    uint8x16_t hi      = vshrq_n_u8(v, 4);
+                    uint8x16_t is_high = vcgeq_u8(v, vdupq_n_u8(0x80));
+                    uint8x16_t row     = vbslq_u8(is_high, vqtbl1q_u8(table_high, lo), vqtbl1q_u8(table_low, lo));
+                    uint8x16_t hit     = vandq_u8(row, vqtbl1q_u8(bit_table, hi));
+                    if (0 != vmaxvq_u8(hit)) {
+                        break;
+                    }
+                }
+
+                return ac_compiled_scan_scalar(start_flags, scan_table, p, i, sz);
+            }
+#endif
+
+            typedef size_t (*ac_compiled_scan_fn_t)(const unsigned char *, const unsigned char *, const unsigned char *, size_t, size_t);
+
+            static ac_compiled_scan_fn_t ac_compiled_select_scan() {
+#if defined(UTIL_STRING_AC_COMPILED_SSSE3)
+                if (ac_compiled_has_ssse3()) {
+                    return ac_compiled_scan_ssse3;
+                }
+#elif defined(UTIL_STRING_AC_COMPILED_NEON)
+                return ac_compiled_scan_neon;
+#endif
+                return ac_compiled_scan_scalar;
+            }
+
+            // 放在函数内，保证其他模块的静态初始化里也可以使用
+            static ac_compiled_scan_fn_t ac_compiled_scan() {
+                static const ac_compiled_scan_fn_t ret = ac_compiled_select_scan();
+                return ret;
+            }
+        } // namespace detail
+
+        size_t ac_automation_compiled::skip_clean(const unsigned char *p, size_t i, size_t sz) const {
+            detail::ac_compiled_scan_fn_t scan = detail::ac_compiled_scan();
+            while (i < sz) {
+                i = scan(start_flags_, scan_table_, p, i, sz);
+                if (i >= sz || !prefix_bloom_enabled_) {
+                    return i;
+                }
+
+                if (0 != (start_flags_[p[i]] & detail::ac_compiled_start_short)) {
+                    return i;
+                }
+
+                if (i + 2 < sz) {
+                    uint32_t h = detail::ac_compiled_prefix_hash(byte_info_[p[i]] & detail::ac_compiled_class_mask,
+                                                                 byte_info_[p[i + 1]] & detail::ac_compiled_class_mask,
+                                                                 byte_info_[p[i + 2]] & detail::ac_compiled_class_mask);
+                    if (0 != (prefix_bloom_[h / 8] & (1 << (h % 8)))) {
+                        return i;
+                    }
+                }
+
+                ++i;
+            }
+
+            return i;
+        }
+
+        bool ac_automation_compiled::is_multibyte_skip(uint32_t s, const unsigned char *p, size_t left, size_t &skip_len) const {
+            skip_len = detail::ac_compiled_utf8_length(*p);
+            if (skip_len < 2 || skip_len > left) {
+                return false;
+            }
+
+            // 二分查找
+            uint32_t l = 0;
+            uint32_t r = multibyte_skip_count_;
+            bool     found = false;
+            while (l < r) {
+                uint32_t m   = l + (r - l) / 2;
+                int      res = detail::ac_compiled_compare(multibyte_skip_data_ + multibyte_skip_offset_[m],
+                                                           multibyte_skip_offset_[m + 1] - multibyte_skip_offset_[m], p, skip_len);
+                if (0 == res) {
+                    found = true;
+                    break;
+                } else if (res < 0) {
+                    l = m + 1;
+                } else {
+                    r = m;
+                }
+            }
+
+            if (!found) {
+                return false;
+            }
+
+            // 和ac_automation一致，优先走字典树分支
+            for (size_t i = 0; i < skip_len; ++i) {
+                uint32_t cls = byte_info_[p[i]] & detail::ac_compiled_class_mask;
+                if (0 == cls) {
+                    return true;
+                }
+
+                s = go(s, cls);
+                if (INVALID_STATE == s) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        size_t ac_automation_compiled::find_start(uint32_t keyword_index, const unsigned char *content, size_t end) const {
+            const unsigned char *kw   = reinterpret_cast<const unsigned char *>(keyword_data_) + keyword_offset_[keyword_index];
+            size_t               need = keyword_offset_[keyword_index + 1] - keyword_offset_[keyword_index];
+
+            // 中间有跳过的字符，从后往前找回关键字的起始位置
+            while (need > 0 && end > 0) {
+                --end;
+                if ((byte_info_[content[end]] & detail::ac_compiled_class_mask) ==
+                    (byte_info_[kw[need - 1]] & detail::ac_compiled_class_mask)) {
+                    --need;
+                }
+            }
+
+            return end;
+        }
+
+        template <typename TFN>
+        void ac_automation_compiled::walk(const char *content, size_t sz, TFN &fn) const {
+            if (NULL == content || 0 == sz || NULL == image_) {
+                return;
+            }
+
+            const unsigned char *p                  = reinterpret_cast<const unsigned char *>(content);
+            const uint32_t *     byte_info          = byte_info_;
+            const uint32_t *     base               = base_;
+            const uint32_t *     check              = check_;
+            const uint32_t *     fail               = fail_;
+            const uint32_t *     output             = output_;
+            bool                 has_multibyte_skip = 0 != multibyte_skip_count_;
+
+            uint32_t s       = 0;
+            bool     skipped = false;
+            size_t   i       = 0;
+            while (i < sz) {
+                // 在根节点时直接跳到下一个可能是关键字开始的位置
+                if (0 == s && prefilter_) {
+                    i = skip_clean(p, i, sz);
+                    if (i >= sz) {
+                        break;
+                    }
+                }
+
+                uint32_t info = byte_info[p[i]];
+                uint32_t cls  = info & detail::ac_compiled_class_mask;
+
+                if (has_multibyte_skip && p[i] >= 0xC0) {
+                    size_t skip_len = 0;
+                    if (is_multibyte_skip(s, p + i, sz - i, skip_len)) {
+                        skipped = skipped || 0 != s;
+                        i += skip_len;
+                        continue;
+                    }
+                }
+
+                if (0 == cls) {
+                    // 不在任何关键字中的字节，只可能跳过或者回到根节点
+                    if (0 != (info & detail::ac_compiled_skip_bit)) {
+                        skipped = skipped || 0 != s;
+                    } else {
+                        s       = 0;
+                        skipped = false;
+                    }
+                    ++i;
+                    continue;
+                }
+
+                uint32_t t = base[s] + cls;
+                if (likely(check[t] == s)) {
+                    s = t;
+                } else if (0 != s && 0 != (info & detail::ac_compiled_skip_bit)) {
+                    skipped = true;
+                    ++i;
+                    continue;
+                } else {
+                    while (0 != s) {
+                        s = fail[s];
+                        t = base[s] + cls;
+                        if (check[t] == s) {
+                            s = t;
+                            break;
+                        }
+                    }
+                }
+                ++i;
+
+                if (0 == s) {
+                    skipped = false;
+                    continue;
+                }
+
+                if (0 != output[s]) {
+                    uint32_t keyword_index = output[s] - 1;
+                    size_t   keyword_len   = keyword_offset_[keyword_index + 1] - keyword_offset_[keyword_index];
+                    size_t   start         = skipped ? find_start(keyword_index, p, i) : i - keyword_len;
+                    if (!fn(start, i - start, keyword_index)) {
+                        return;
+                    }
+
+                    s       = 0;
+                    skipped = false;
+                }
+            }
+        }
+
+        namespace detail {
+            struct ac_compiled_collect_fn {
+                ac_automation_compiled::value_type *out;
+                size_t                              count;
+
+                inline bool operator()(size_t start, size_t length, uint32_t keyword_index) {
+                    out->push_back(ac_automation_compiled::match_t());
+                    ac_automation_compiled::match_t &item = out->back();
+                    item.start                            = start;
+                    item.length                           = length;
+                    item.keyword_index                    = keyword_index;
+                    ++count;
+                    return true;
+                }
+            };
+
+            struct ac_compiled_contains_fn {
+                bool found;
+
+                inline bool operator()(size_t, size_t, uint32_t) {
+                    found = true;
+                    return false;
+                }
+            };
+        } // namespace detail
+
+        LIBATFRAME_UTILS_API size_t ac_automation_compiled::match(const char *content, size_t sz, value_type &out) const {
+            detail::ac_compiled_collect_fn fn;
+            fn.out   = &out;
+            fn.count = 0;
+            walk(content, sz, fn);
+            return fn.count;
+        }
+
+        LIBATFRAME_UTILS_API ac_automation_compiled::value_type ac_automation_compiled::match(const std::string &content) const {
+            value_type ret;
+            match(content.data(), content.size(), ret);
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API bool ac_automation_compiled::contains(const char *content, size_t sz) const {
+            detail::ac_compiled_contains_fn fn;
+            fn.found = false;
+            walk(content, sz, fn);
+            return fn.found;
+        }
+
+        LIBATFRAME_UTILS_API const char *ac_automation_compiled::get_keyword(uint32_t idx, size_t &len) const {
+            if (NULL == image_ || idx >= keyword_count_) {
+                len = 0;
+                return NULL;
+            }
+
+            len = keyword_offset_[idx + 1] - keyword_offset_[idx];
+            return keyword_data_ + keyword_offset_[idx];
+        }
+
+        LIBATFRAME_UTILS_API std::string ac_automation_compiled::get_keyword(uint32_t idx) const {
+            size_t      len = 0;
+            const char *ret = get_keyword(idx, len);
+            if (NULL == ret) {
+                return std::string();
+            }
+
+            return std::string(ret, len);
+        }
+
+        LIBATFRAME_UTILS_API size_t ac_automation_compiled::keyword_size() const { return keyword_count_; }
+
+        LIBATFRAME_UTILS_API size_t ac_automation_compiled::state_size() const { return state_count_; }
+
+        LIBATFRAME_UTILS_API size_t ac_automation_compiled::memory_usage() const {
+            return sizeof(ac_automation_compiled) + owned_image_.capacity() * sizeof(uint64_t);
+        }
+
+        LIBATFRAME_UTILS_API size_t ac_automation_compiled::image_size() const { return image_size_; }
+    } // namespace string
+} // namespace util
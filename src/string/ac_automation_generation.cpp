@@ -0,0 +1,237 @@
+﻿#include <cstring>
+
+#include "lock/lock_holder.h"
+#include "std/chrono.h"
+
+#include "string/ac_automation_generation.h"
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+#define UTIL_STRING_AC_GENERATION_LOCK(L) std::lock_guard<std::mutex> L##_guard(L)
+#else
+#define UTIL_STRING_AC_GENERATION_LOCK(L)
+#endif
+
+namespace util {
+    namespace string {
+        LIBATFRAME_UTILS_API ac_automation_generation_manager::ac_automation_generation_manager(const ac_automation_compiled::option_t &opts)
+            : options_(opts), keywords_revision_(0), built_revision_(0)
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+              ,
+              async_requested_(false), async_running_(false), async_stop_(false)
+#endif
+        {
+            memset(&stats_, 0, sizeof(stats_));
+        }
+
+        LIBATFRAME_UTILS_API ac_automation_generation_manager::~ac_automation_generation_manager() {
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            {
+                std::lock_guard<std::mutex> guard(async_lock_);
+                async_stop_ = true;
+            }
+            async_cond_.notify_all();
+
+            if (async_thread_.joinable()) {
+                async_thread_.join();
+            }
+#endif
+        }
+
+        LIBATFRAME_UTILS_API bool ac_automation_generation_manager::add_keyword(const std::string &keyword) {
+            if (keyword.empty()) {
+                return false;
+            }
+
+            UTIL_STRING_AC_GENERATION_LOCK(keywords_lock_);
+            if (!keywords_.insert(keyword).second) {
+                return false;
+            }
+
+            ++keywords_revision_;
+            return true;
+        }
+
+        LIBATFRAME_UTILS_API bool ac_automation_generation_manager::remove_keyword(const std::string &keyword) {
+            UTIL_STRING_AC_GENERATION_LOCK(keywords_lock_);
+            if (0 == keywords_.erase(keyword)) {
+                return false;
+            }
+
+            ++keywords_revision_;
+            return true;
+        }
+
+        LIBATFRAME_UTILS_API size_t ac_automation_generation_manager::update_keywords(const std::vector<std::string> &add_keywords,
+                                                                                      const std::vector<std::string> &remove_keywords) {
+            size_t ret = 0;
+
+            UTIL_STRING_AC_GENERATION_LOCK(keywords_lock_);
+            for (size_t i = 0; i < add_keywords.size(); ++i) {
+                if (!add_keywords[i].empty() && keywords_.insert(add_keywords[i]).second) {
+                    ++ret;
+                }
+            }
+
+            for (size_t i = 0; i < remove_keywords.size(); ++i) {
+                ret += keywords_.erase(remove_keywords[i]);
+            }
+
+            if (ret > 0) {
+                ++keywords_revision_;
+            }
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API void ac_automation_generation_manager::reset_keywords(const std::vector<std::string> &keywords) {
+            std::set<std::string> new_keywords;
+            for (size_t i = 0; i < keywords.size(); ++i) {
+                if (!keywords[i].empty()) {
+                    new_keywords.insert(keywords[i]);
+                }
+            }
+
+            UTIL_STRING_AC_GENERATION_LOCK(keywords_lock_);
+            keywords_.swap(new_keywords);
+            ++keywords_revision_;
+        }
+
+        LIBATFRAME_UTILS_API bool ac_automation_generation_manager::build() {
+            // 编译过程串行执行，保证新版本总是基于更新的关键字集合
+            UTIL_STRING_AC_GENERATION_LOCK(build_lock_);
+
+            std::vector<std::string> keywords;
+            uint64_t                 revision;
+            {
+                UTIL_STRING_AC_GENERATION_LOCK(keywords_lock_);
+                revision = keywords_revision_;
+                if (current_ && revision == built_revision_) {
+                    return true;
+                }
+
+                keywords.reserve(keywords_.size());
+                keywords.assign(keywords_.begin(), keywords_.end());
+            }
+
+            std::chrono::steady_clock::time_point begin      = std::chrono::steady_clock::now();
+            ac_automation_compiled::ptr_t         automation = ac_automation_compiled::create(keywords, options_);
+            std::chrono::steady_clock::time_point end        = std::chrono::steady_clock::now();
+            int64_t build_time_us = static_cast<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+
+            if (!automation) {
+                ::util::lock::lock_holder< ::util::lock::spin_lock> holder(current_lock_);
+                ++stats_.build_failed_count;
+                return false;
+            }
+
+            std::shared_ptr<generation_t> generation = std::make_shared<generation_t>();
+            generation->automation                   = automation;
+            generation->keyword_count                = automation->keyword_size();
+            generation->memory_usage                 = automation->memory_usage() + sizeof(generation_t);
+            generation->build_time_us                = build_time_us;
+
+            // 旧版本在锁外释放，避免在锁内析构
+            generation_ptr_t old_generation;
+            {
+                ::util::lock::lock_holder< ::util::lock::spin_lock> holder(current_lock_);
+                generation->id = stats_.generation + 1;
+
+                old_generation = current_;
+                current_       = generation;
+
+                stats_.generation    = generation->id;
+                stats_.keyword_count = generation->keyword_count;
+                stats_.state_count   = automation->state_size();
+                stats_.memory_usage  = generation->memory_usage;
+                ++stats_.build_count;
+                stats_.last_build_time_us = build_time_us;
+                if (build_time_us > stats_.max_build_time_us) {
+                    stats_.max_build_time_us = build_time_us;
+                }
+                stats_.total_build_time_us += build_time_us;
+            }
+
+            {
+                UTIL_STRING_AC_GENERATION_LOCK(keywords_lock_);
+                built_revision_ = revision;
+            }
+            return true;
+        }
+
+        LIBATFRAME_UTILS_API void ac_automation_generation_manager::build_async() {
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            {
+                std::lock_guard<std::mutex> guard(async_lock_);
+                if (async_stop_) {
+                    return;
+                }
+
+                async_requested_ = true;
+                if (!async_thread_.joinable()) {
+                    async_thread_ = std::thread(&ac_automation_generation_manager::async_main, this);
+                }
+            }
+            async_cond_.notify_one();
+#else
+            build();
+#endif
+        }
+
+        LIBATFRAME_UTILS_API void ac_automation_generation_manager::wait_async() {
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            std::unique_lock<std::mutex> guard(async_lock_);
+            while (!async_stop_ && (async_requested_ || async_running_)) {
+                async_idle_.wait(guard);
+            }
+#endif
+        }
+
+        LIBATFRAME_UTILS_API ac_automation_generation_manager::generation_ptr_t ac_automation_generation_manager::get() const {
+            ::util::lock::lock_holder< ::util::lock::spin_lock> holder(current_lock_);
+            return current_;
+        }
+
+        LIBATFRAME_UTILS_API ac_automation_generation_manager::stats_t ac_automation_generation_manager::get_stats() const {
+            stats_t ret;
+            {
+                ::util::lock::lock_holder< ::util::lock::spin_lock> holder(current_lock_);
+                ret = stats_;
+            }
+
+            {
+                UTIL_STRING_AC_GENERATION_LOCK(keywords_lock_);
+                ret.pending_keywords = keywords_.size();
+                ret.dirty            = 0 == ret.generation || keywords_revision_ != built_revision_;
+            }
+            return ret;
+        }
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+        void ac_automation_generation_manager::async_main() {
+            std::unique_lock<std::mutex> guard(async_lock_);
+            while (true) {
+                while (!async_stop_ && !async_requested_) {
+                    async_cond_.wait(guard);
+                }
+
+                if (async_stop_) {
+                    break;
+                }
+
+                async_requested_ = false;
+                async_running_   = true;
+                guard.unlock();
+
+                build();
+
+                guard.lock();
+                async_running_ = false;
+                if (!async_requested_) {
+                    async_idle_.notify_all();
+                }
+            }
+
+            async_idle_.notify_all();
+        }
+#endif
+    } // namespace string
+} // namespace util
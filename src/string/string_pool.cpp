@@ -0,0 +1,179 @@
+﻿#include <cstring>
+
+#include "algorithm/murmur_hash.h"
+#include "lock/lock_holder.h"
+
+#include "string/string_pool.h"
+
+namespace util {
+    namespace string {
+        namespace {
+            static const uint64_t g_string_pool_hash_seed = 0x9E3779B97F4A7C15ULL;
+
+            // 每次分配的内存块大小，超过1/4的长字符串单独分配
+            static const size_t g_string_pool_block_size = 16 * 1024;
+
+            static inline const interned_string::header_t *string_pool_header(const char *data) {
+                return reinterpret_cast<const interned_string::header_t *>(data) - 1;
+            }
+
+            static inline size_t string_pool_entry_size(size_t sz) {
+                // 头部 + 数据 + 结尾的\0，按头部对齐
+                size_t align = sizeof(interned_string::header_t);
+                return (sizeof(interned_string::header_t) + sz + 1 + align - 1) / align * align;
+            }
+        } // namespace
+
+        LIBATFRAME_UTILS_API string_pool::string_pool() {}
+
+        LIBATFRAME_UTILS_API string_pool::~string_pool() {
+            for (size_t i = 0; i < SHARD_COUNT; ++i) {
+                for (size_t j = 0; j < shards_[i].blocks.size(); ++j) {
+                    delete[] reinterpret_cast<interned_string::header_t *>(shards_[i].blocks[j]);
+                }
+            }
+        }
+
+        LIBATFRAME_UTILS_API string_pool &string_pool::instance() {
+            static string_pool ret;
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API interned_string string_pool::intern(const char *str, size_t sz) {
+            if (NULL == str || 0 == sz) {
+                return interned_string();
+            }
+
+            uint64_t hash  = hash_of(str, sz);
+            uint32_t index = static_cast<uint32_t>(hash >> (64 - SHARD_BITS));
+
+            shard_t &                                           shard = shards_[index];
+            ::util::lock::lock_holder< ::util::lock::spin_lock> holder(shard.lock);
+
+            const char *ret = lookup(shard, hash, str, sz);
+            if (NULL == ret) {
+                ret = insert(shard, index, hash, str, sz);
+            }
+            return interned_string(ret);
+        }
+
+        LIBATFRAME_UTILS_API interned_string string_pool::find(const char *str, size_t sz) const {
+            if (NULL == str || 0 == sz) {
+                return interned_string();
+            }
+
+            uint64_t       hash  = hash_of(str, sz);
+            const shard_t &shard = shards_[hash >> (64 - SHARD_BITS)];
+
+            ::util::lock::lock_holder< ::util::lock::spin_lock> holder(shard.lock);
+            return interned_string(lookup(shard, hash, str, sz));
+        }
+
+        LIBATFRAME_UTILS_API interned_string string_pool::get(uint32_t id) const {
+            uint32_t local = id >> SHARD_BITS;
+            if (0 == local) {
+                return interned_string();
+            }
+
+            const shard_t &                                     shard = shards_[id & (SHARD_COUNT - 1)];
+            ::util::lock::lock_holder< ::util::lock::spin_lock> holder(shard.lock);
+            if (local > shard.by_index.size()) {
+                return interned_string();
+            }
+            return interned_string(shard.by_index[local - 1]);
+        }
+
+        LIBATFRAME_UTILS_API string_pool::stats_t string_pool::get_stats() const {
+            stats_t ret;
+            memset(&ret, 0, sizeof(ret));
+            for (size_t i = 0; i < SHARD_COUNT; ++i) {
+                const shard_t &                                     shard = shards_[i];
+                ::util::lock::lock_holder< ::util::lock::spin_lock> holder(shard.lock);
+
+                ret.count += shard.by_index.size();
+                ret.data_bytes += shard.data_bytes;
+                ret.memory_usage += shard.block_bytes + shard.table.capacity() * sizeof(const char *) +
+                                    shard.by_index.capacity() * sizeof(const char *) + shard.blocks.capacity() * sizeof(char *);
+            }
+            return ret;
+        }
+
+        uint64_t string_pool::hash_of(const char *str, size_t sz) {
+            return ::util::hash::murmur_hash2_64a(str, static_cast<int>(sz), g_string_pool_hash_seed);
+        }
+
+        const char *string_pool::lookup(const shard_t &shard, uint64_t hash, const char *str, size_t sz) {
+            if (shard.table.empty()) {
+                return NULL;
+            }
+
+            size_t mask = shard.table.size() - 1;
+            for (size_t pos = static_cast<size_t>(hash) & mask;; pos = (pos + 1) & mask) {
+                const char *data = shard.table[pos];
+                if (NULL == data) {
+                    return NULL;
+                }
+
+                const interned_string::header_t *header = string_pool_header(data);
+                if (header->hash == hash && header->size == sz && 0 == memcmp(data, str, sz)) {
+                    return data;
+                }
+            }
+        }
+
+        const char *string_pool::insert(shard_t &shard, uint32_t shard_index, uint64_t hash, const char *str, size_t sz) {
+            // 负载因子不超过1/2
+            if ((shard.by_index.size() + 1) * 2 > shard.table.size()) {
+                std::vector<const char *> table(shard.table.empty() ? 64 : shard.table.size() * 2, static_cast<const char *>(NULL));
+                size_t                    mask = table.size() - 1;
+                for (size_t i = 0; i < shard.by_index.size(); ++i) {
+                    size_t pos = static_cast<size_t>(string_pool_header(shard.by_index[i])->hash) & mask;
+                    while (NULL != table[pos]) {
+                        pos = (pos + 1) & mask;
+                    }
+                    table[pos] = shard.by_index[i];
+                }
+                shard.table.swap(table);
+            }
+
+            size_t entry_size = string_pool_entry_size(sz);
+            char * entry;
+            if (entry_size > g_string_pool_block_size / 4) {
+                entry = reinterpret_cast<char *>(new interned_string::header_t[entry_size / sizeof(interned_string::header_t)]);
+                shard.blocks.push_back(entry);
+                shard.block_bytes += entry_size;
+            } else {
+                if (shard.remain < entry_size) {
+                    shard.cursor = reinterpret_cast<char *>(new interned_string::header_t[g_string_pool_block_size / sizeof(interned_string::header_t)]);
+                    shard.remain = g_string_pool_block_size;
+                    shard.blocks.push_back(shard.cursor);
+                    shard.block_bytes += g_string_pool_block_size;
+                }
+
+                entry = shard.cursor;
+                shard.cursor += entry_size;
+                shard.remain -= entry_size;
+            }
+
+            interned_string::header_t *header = reinterpret_cast<interned_string::header_t *>(entry);
+            header->hash                      = hash;
+            header->id                        = (static_cast<uint32_t>(shard.by_index.size() + 1) << SHARD_BITS) | shard_index;
+            header->size                      = static_cast<uint32_t>(sz);
+
+            char *data = entry + sizeof(interned_string::header_t);
+            memcpy(data, str, sz);
+            data[sz] = 0;
+
+            size_t mask = shard.table.size() - 1;
+            size_t pos  = static_cast<size_t>(hash) & mask;
+            while (NULL != shard.table[pos]) {
+                pos = (pos + 1) & mask;
+            }
+            shard.table[pos] = data;
+            shard.by_index.push_back(data);
+            shard.data_bytes += sz;
+
+            return data;
+        }
+    } // namespace string
+} // namespace util
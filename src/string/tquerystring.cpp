@@ -5,12 +5,26 @@
 
 #include "string/tquerystring.h"
 
+// 转义字符查找的SIMD实现: x86使用SSSE3/AVX2(运行时检测)，aarch64使用NEON
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define UTIL_STRING_URI_SSSE3 1
+#define UTIL_STRING_URI_SSSE3_TARGET __attribute__((target("ssse3")))
+#define UTIL_STRING_URI_AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#define UTIL_STRING_URI_SSSE3 1
+#define UTIL_STRING_URI_SSSE3_TARGET
+#define UTIL_STRING_URI_AVX2_TARGET
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define UTIL_STRING_URI_NEON 1
+#endif
+
 namespace util {
     namespace uri {
-        typedef bool        uri_map_type[256];
-        static uri_map_type g_raw_url_map       = {false};
-        static uri_map_type g_uri_map           = {false};
-        static uri_map_type g_uri_component_map = {false};
+        typedef bool uri_map_type[256];
 
         // RFC 3986
         static void _init_raw_url_map(uri_map_type &uri_map) {
@@ -54,48 +68,327 @@ namespace util {
             }
         }
 
+        /**
+         * @brief 不需要转义的字符集合
+         * @note 不需要转义的字符都是ASCII，nibble_table[低4位]的第(高4位)个bit表示是否不需要转义，
+         *       SIMD实现用两次查表就可以一次判断16/32个字节
+         */
+        struct uri_charset_t {
+            uri_map_type  map;
+            unsigned char nibble_table[16];
+
+            explicit uri_charset_t(void (*init_fn)(uri_map_type &)) {
+                memset(map, 0, sizeof(map));
+                memset(nibble_table, 0, sizeof(nibble_table));
+                init_fn(map);
+
+                for (int i = 0; i < 128; ++i) {
+                    if (map[i]) {
+                        nibble_table[i & 0x0F] |= static_cast<unsigned char>(1 << (i >> 4));
+                    }
+                }
+            }
+        };
 
-        static std::string _encode_uri(uri_map_type &uri_map, const char *data, size_t sz, bool like_php) {
-            std::string ret;
-            ret.reserve(sz);
+        static const uri_charset_t &_get_raw_url_charset() {
+            static uri_charset_t ret(_init_raw_url_map);
+            return ret;
+        }
 
-            while (sz--) {
-                unsigned char data_uc = static_cast<unsigned char>(*data);
+        static const uri_charset_t &_get_uri_component_charset() {
+            static uri_charset_t ret(_init_uri_component_map);
+            return ret;
+        }
 
-                if (uri_map[data_uc]) {
-                    ret += *data;
-                } else if (like_php && ' ' == data_uc) {
-                    ret += '+';
-                } else {
-                    ret += '%';
-                    static char hex_char_map[16] = {0};
-                    // 初始化16进制表
-                    if (0 == hex_char_map[0]) {
-                        for (int i = 0; i < 10; i++) {
-                            hex_char_map[i] = static_cast<char>('0' + i);
-                        }
-
-                        for (int i = 10; i < 16; i++) {
-                            hex_char_map[i] = static_cast<char>('A' - 10 + i);
-                        }
-                    }
+        static const uri_charset_t &_get_uri_charset() {
+            static uri_charset_t ret(_init_uri_map);
+            return ret;
+        }
 
-                    // 转义前4位
-                    ret += hex_char_map[data_uc >> 4];
-                    // 转义后4位
-                    ret += hex_char_map[data_uc & 0x0F];
+        // ==================== 查找需要转义的字节 ====================
+        // 返回第一个需要转义的字节，没有则返回end
+        typedef const unsigned char *(*uri_scan_safe_fn_t)(const unsigned char *nibble_table, const unsigned char *p,
+                                                           const unsigned char *end);
+        // 返回第一个c1或c2，没有则返回end
+        typedef const unsigned char *(*uri_scan_char_fn_t)(const unsigned char *p, const unsigned char *end, unsigned char c1,
+                                                           unsigned char c2);
+
+        static const unsigned char *_uri_scan_safe_scalar(const unsigned char *nibble_table, const unsigned char *p, const unsigned char *end) {
+            for (; p < end; ++p) {
+                if (*p >= 0x80 || 0 == (nibble_table[*p & 0x0F] & (1 << (*p >> 4)))) {
+                    break;
                 }
+            }
+            return p;
+        }
 
-                ++data;
+        static const unsigned char *_uri_scan_char_scalar(const unsigned char *p, const unsigned char *end, unsigned char c1, unsigned char c2) {
+            for (; p < end; ++p) {
+                if (c1 == *p || c2 == *p) {
+                    break;
+                }
             }
+            return p;
+        }
+
+#if defined(UTIL_STRING_URI_SSSE3)
+        static inline int _uri_ctz(unsigned int mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+            unsigned long index;
+            _BitScanForward(&index, static_cast<unsigned long>(mask));
+            return static_cast<int>(index);
+#else
+            return __builtin_ctz(mask);
+#endif
+        }
+
+        UTIL_STRING_URI_SSSE3_TARGET static const unsigned char *_uri_scan_safe_ssse3(const unsigned char *nibble_table, const unsigned char *p,
+                                                                                     const unsigned char *end) {
+            const __m128i table  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(nibble_table));
+            const __m128i bits   = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+            const __m128i nibble = _mm_set1_epi8(0x0F);
+            const __m128i zero   = _mm_setzero_si128();
+
+            for (; end - p >= 16; p += 16) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+                // 高位为1的字节查表结果为0，所以非ASCII字节都需要转义
+                __m128i row    = _mm_shuffle_epi8(table, _mm_and_si128(v, nibble));
+                __m128i select = _mm_shuffle_epi8(bits, _mm_and_si128(_mm_srli_epi16(v, 4), nibble));
+                int     mask   = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(row, select), zero));
+                if (0 != mask) {
+                    return p + _uri_ctz(static_cast<unsigned int>(mask));
+                }
+            }
+
+            return _uri_scan_safe_scalar(nibble_table, p, end);
+        }
+
+        UTIL_STRING_URI_SSSE3_TARGET static const unsigned char *_uri_scan_char_ssse3(const unsigned char *p, const unsigned char *end,
+                                                                                     unsigned char c1, unsigned char c2) {
+            const __m128i v1 = _mm_set1_epi8(static_cast<char>(c1));
+            const __m128i v2 = _mm_set1_epi8(static_cast<char>(c2));
+
+            for (; end - p >= 16; p += 16) {
+                __m128i v    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+                int     mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, v1), _mm_cmpeq_epi8(v, v2)));
+                if (0 != mask) {
+                    return p + _uri_ctz(static_cast<unsigned int>(mask));
+                }
+            }
+
+            return _uri_scan_char_scalar(p, end, c1, c2);
+        }
+
+        UTIL_STRING_URI_AVX2_TARGET static const unsigned char *_uri_scan_safe_avx2(const unsigned char *nibble_table, const unsigned char *p,
+                                                                                   const unsigned char *end) {
+            const __m256i table  = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(nibble_table)));
+            const __m256i bits   = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0,
+                                                  0, 0, 0, 0, 0);
+            const __m256i nibble = _mm256_set1_epi8(0x0F);
+            const __m256i zero   = _mm256_setzero_si256();
+
+            for (; end - p >= 32; p += 32) {
+                __m256i  v      = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+                __m256i  row    = _mm256_shuffle_epi8(table, _mm256_and_si256(v, nibble));
+                __m256i  select = _mm256_shuffle_epi8(bits, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+                unsigned mask   = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(row, select), zero)));
+                if (0 != mask) {
+                    return p + _uri_ctz(mask);
+                }
+            }
+
+            return _uri_scan_safe_ssse3(nibble_table, p, end);
+        }
+
+        UTIL_STRING_URI_AVX2_TARGET static const unsigned char *_uri_scan_char_avx2(const unsigned char *p, const unsigned char *end,
+                                                                                   unsigned char c1, unsigned char c2) {
+            const __m256i v1 = _mm256_set1_epi8(static_cast<char>(c1));
+            const __m256i v2 = _mm256_set1_epi8(static_cast<char>(c2));
 
+            for (; end - p >= 32; p += 32) {
+                __m256i  v    = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+                unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(v, v1), _mm256_cmpeq_epi8(v, v2))));
+                if (0 != mask) {
+                    return p + _uri_ctz(mask);
+                }
+            }
+
+            return _uri_scan_char_ssse3(p, end, c1, c2);
+        }
+
+        static int _uri_detect_simd() {
+#if defined(_MSC_VER) && !defined(__clang__)
+            int cpu_info[4] = {0};
+            __cpuid(cpu_info, 0);
+            int max_leaf = cpu_info[0];
+
+            __cpuid(cpu_info, 1);
+            bool ssse3   = 0 != (cpu_info[2] & (1 << 9));
+            bool osxsave = 0 != (cpu_info[2] & (1 << 27));
+            bool avx     = 0 != (cpu_info[2] & (1 << 28));
+            if (!ssse3) {
+                return 0;
+            }
+
+            if (max_leaf >= 7 && osxsave && avx && 6 == (_xgetbv(0) & 6)) {
+                __cpuidex(cpu_info, 7, 0);
+                if (0 != (cpu_info[1] & (1 << 5))) {
+                    return 2;
+                }
+            }
+            return 1;
+#else
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) {
+                return 2;
+            }
+            return __builtin_cpu_supports("ssse3") ? 1 : 0;
+#endif
+        }
+#endif
+
+#if defined(UTIL_STRING_URI_NEON)
+        static const unsigned char *_uri_scan_safe_neon(const unsigned char *nibble_table, const unsigned char *p, const unsigned char *end) {
+            static const unsigned char bit_values[16] = {1, 2, 4, 8, 16, 32, 64, 128, 0, 0, 0, 0, 0, 0, 0, 0};
+            const uint8x16_t           table          = vld1q_u8(nibble_table);
+            const uint8x16_t           bits           = vld1q_u8(bit_values);
+            const uint8x16_t           nibble         = vdupq_n_u8(0x0F);
+
+            for (; end - p >= 16; p += 16) {
+                uint8x16_t v      = vld1q_u8(p);
+                uint8x16_t row    = vqtbl1q_u8(table, vandq_u8(v, nibble));
+                uint8x16_t select = vqtbl1q_u8(bits, vshrq_n_u8(v, 4));
+                if (0 == vminvq_u8(vandq_u8(row, select))) {
+                    break;
+                }
+            }
+
+            return _uri_scan_safe_scalar(nibble_table, p, end);
+        }
+
+        static const unsigned char *_uri_scan_char_neon(const unsigned char *p, const unsigned char *end, unsigned char c1, unsigned char c2) {
+            const uint8x16_t v1 = vdupq_n_u8(c1);
+            const uint8x16_t v2 = vdupq_n_u8(c2);
+
+            for (; end - p >= 16; p += 16) {
+                uint8x16_t v = vld1q_u8(p);
+                if (0 != vmaxvq_u8(vorrq_u8(vceqq_u8(v, v1), vceqq_u8(v, v2)))) {
+                    break;
+                }
+            }
+
+            return _uri_scan_char_scalar(p, end, c1, c2);
+        }
+#endif
+
+        struct uri_scan_dispatch_t {
+            uri_scan_safe_fn_t scan_safe;
+            uri_scan_char_fn_t scan_char;
+
+            uri_scan_dispatch_t() : scan_safe(_uri_scan_safe_scalar), scan_char(_uri_scan_char_scalar) {
+#if defined(UTIL_STRING_URI_SSSE3)
+                int level = _uri_detect_simd();
+                if (level >= 2) {
+                    scan_safe = _uri_scan_safe_avx2;
+                    scan_char = _uri_scan_char_avx2;
+                } else if (level >= 1) {
+                    scan_safe = _uri_scan_safe_ssse3;
+                    scan_char = _uri_scan_char_ssse3;
+                }
+#elif defined(UTIL_STRING_URI_NEON)
+                scan_safe = _uri_scan_safe_neon;
+                scan_char = _uri_scan_char_neon;
+#endif
+            }
+        };
+
+        // 放在函数内，保证其他模块的静态初始化里也可以使用
+        static const uri_scan_dispatch_t &uri_scan() {
+            static const uri_scan_dispatch_t ret;
             return ret;
         }
 
-        static std::string _decode_uri(const char *data, size_t sz, bool like_php) {
-            std::string ret;
+        // ==================== 编码和解码 ====================
+        // 不需要转义的连续字节较短时逐字节处理，超过这个长度再使用SIMD查找
+        static const size_t g_uri_scan_probe = 16;
 
-            sz                                     = sz ? sz : strlen(data);
+        static inline const unsigned char *_uri_find_unsafe(const uri_charset_t &charset, const unsigned char *p, const unsigned char *end) {
+            const unsigned char *probe_end = static_cast<size_t>(end - p) > g_uri_scan_probe ? p + g_uri_scan_probe : end;
+            while (p < probe_end && charset.map[*p]) {
+                ++p;
+            }
+
+            if (p == probe_end && p < end) {
+                p = uri_scan().scan_safe(charset.nibble_table, p, end);
+            }
+            return p;
+        }
+
+        static inline const unsigned char *_uri_find_escape(const unsigned char *p, const unsigned char *end, unsigned char second) {
+            const unsigned char *probe_end = static_cast<size_t>(end - p) > g_uri_scan_probe ? p + g_uri_scan_probe : end;
+            while (p < probe_end && '%' != *p && second != *p) {
+                ++p;
+            }
+
+            if (p == probe_end && p < end) {
+                p = uri_scan().scan_char(p, end, '%', second);
+            }
+            return p;
+        }
+
+        static size_t _encode_uri_to(const uri_charset_t &charset, const char *data, size_t sz, bool like_php, char *out) {
+            static const char hex_char_map[] = "0123456789ABCDEF";
+
+            const unsigned char *p     = reinterpret_cast<const unsigned char *>(data);
+            const unsigned char *end   = p + sz;
+            char *               begin = out;
+
+            while (p < end) {
+                // 不需要转义的连续字节直接复制
+                if (charset.map[*p]) {
+                    const unsigned char *stop = _uri_find_unsafe(charset, p + 1, end);
+                    memcpy(out, p, static_cast<size_t>(stop - p));
+                    out += stop - p;
+                    p = stop;
+                    continue;
+                }
+
+                if (like_php && ' ' == *p) {
+                    *out++ = '+';
+                } else {
+                    // 转义前4位和后4位
+                    out[0] = '%';
+                    out[1] = hex_char_map[*p >> 4];
+                    out[2] = hex_char_map[*p & 0x0F];
+                    out += 3;
+                }
+                ++p;
+            }
+
+            return static_cast<size_t>(out - begin);
+        }
+
+        static size_t _encode_uri_length(const uri_charset_t &charset, const char *data, size_t sz, bool like_php) {
+            const unsigned char *p   = reinterpret_cast<const unsigned char *>(data);
+            const unsigned char *end = p + sz;
+            size_t               ret = 0;
+
+            while (p < end) {
+                if (charset.map[*p]) {
+                    const unsigned char *stop = _uri_find_unsafe(charset, p + 1, end);
+                    ret += static_cast<size_t>(stop - p);
+                    p = stop;
+                    continue;
+                }
+
+                ret += (like_php && ' ' == *p) ? 1 : 3;
+                ++p;
+            }
+
+            return ret;
+        }
+
+        static size_t _decode_uri_to(const char *data, size_t sz, bool like_php, char *out) {
             static unsigned char hex_char_map[256] = {0};
 
             // 初始化字符表
@@ -109,31 +402,133 @@ namespace util {
                 }
             }
 
-            while (sz--) {
-                if (like_php && '+' == *data) {
-                    ret += ' ';
-                } else if (*data != '%' || sz < 2) {
-                    ret += *data;
+            const unsigned char *p      = reinterpret_cast<const unsigned char *>(data);
+            const unsigned char *end    = p + sz;
+            char *               begin  = out;
+            const unsigned char  second = like_php ? '+' : '%';
+
+            while (p < end) {
+                // 没有转义的连续字节较短时边判断边复制，较长的用SIMD查找后整块复制
+                if ('%' != *p && second != *p) {
+                    const unsigned char *probe_end = static_cast<size_t>(end - p) > g_uri_scan_probe ? p + g_uri_scan_probe : end;
+                    do {
+                        *out++ = static_cast<char>(*p++);
+                    } while (p < probe_end && '%' != *p && second != *p);
+
+                    if (p == probe_end && p < end && '%' != *p && second != *p) {
+                        const unsigned char *stop = uri_scan().scan_char(p, end, '%', second);
+                        memcpy(out, p, static_cast<size_t>(stop - p));
+                        out += stop - p;
+                        p = stop;
+                    }
+                    continue;
+                }
+
+                if ('+' == *p) {
+                    *out++ = ' ';
+                    ++p;
+                } else if (end - p < 3) {
+                    *out++ = static_cast<char>(*p++);
                 } else {
-                    const unsigned char high_c = static_cast<unsigned char>(data[1]);
-                    const unsigned char low_c  = static_cast<unsigned char>(data[2]);
-                    ret += static_cast<unsigned char>((hex_char_map[high_c] << 4) + hex_char_map[low_c]);
-                    data += 2;
-                    sz -= 2;
+                    *out++ = static_cast<char>((hex_char_map[p[1]] << 4) + hex_char_map[p[2]]);
+                    p += 3;
                 }
+            }
+
+            return static_cast<size_t>(out - begin);
+        }
+
+        static size_t _decode_uri_length(const char *data, size_t sz, bool like_php) {
+            const unsigned char *p      = reinterpret_cast<const unsigned char *>(data);
+            const unsigned char *end    = p + sz;
+            size_t               ret    = 0;
+            const unsigned char  second = like_php ? '+' : '%';
+
+            while (p < end) {
+                const unsigned char *stop = _uri_find_escape(p, end, second);
+                ret += static_cast<size_t>(stop - p);
+                p = stop;
+                if (p >= end) {
+                    break;
+                }
+
+                ++ret;
+                p += ('%' == *p && end - p >= 3) ? 3 : 1;
+            }
+
+            return ret;
+        }
+
+        static std::string _encode_uri(const uri_charset_t &charset, const char *data, size_t sz, bool like_php) {
+            std::string ret;
+            if (0 == sz) {
+                return ret;
+            }
+
+            ret.resize(sz * 3);
+            ret.resize(_encode_uri_to(charset, data, sz, like_php, &ret[0]));
+            return ret;
+        }
+
+        static std::string _decode_uri(const char *data, size_t sz, bool like_php) {
+            std::string ret;
 
-                ++data;
+            sz = sz ? sz : strlen(data);
+            if (0 == sz) {
+                return ret;
             }
 
+            ret.resize(sz);
+            ret.resize(_decode_uri_to(data, sz, like_php, &ret[0]));
             return ret;
         }
 
+        static int _encode_uri(const uri_charset_t &charset, char *dst, size_t dlen, size_t *olen, const char *data, size_t sz,
+                               bool like_php) {
+            // 最坏情况下每个字节转义为3个字节，空间足够时不需要预先计算长度
+            size_t len;
+            if (NULL == dst || sz > dlen / 3) {
+                len = _encode_uri_length(charset, data, sz, like_php);
+                if (NULL != olen) {
+                    *olen = len;
+                }
+
+                if (NULL == dst || len > dlen) {
+                    return -1;
+                }
+            }
+
+            len = _encode_uri_to(charset, data, sz, like_php, dst);
+            if (NULL != olen) {
+                *olen = len;
+            }
+            return 0;
+        }
+
+        static int _decode_uri(char *dst, size_t dlen, size_t *olen, const char *data, size_t sz, bool like_php) {
+            size_t len;
+            if (NULL == dst || sz > dlen) {
+                len = _decode_uri_length(data, sz, like_php);
+                if (NULL != olen) {
+                    *olen = len;
+                }
+
+                if (NULL == dst || len > dlen) {
+                    return -1;
+                }
+            }
+
+            len = _decode_uri_to(data, sz, like_php, dst);
+            if (NULL != olen) {
+                *olen = len;
+            }
+            return 0;
+        }
 
         LIBATFRAME_UTILS_API std::string encode_uri(const char *content, size_t sz) {
-            _init_uri_map(g_uri_map);
             sz = sz ? sz : strlen(content);
 
-            return _encode_uri(g_uri_map, content, sz, false);
+            return _encode_uri(_get_uri_charset(), content, sz, false);
         }
 
         LIBATFRAME_UTILS_API std::string decode_uri(const char *uri, size_t sz) {
@@ -142,10 +537,9 @@ namespace util {
         }
 
         LIBATFRAME_UTILS_API std::string encode_uri_component(const char *content, size_t sz) {
-            _init_uri_component_map(g_uri_component_map);
             sz = sz ? sz : strlen(content);
 
-            return _encode_uri(g_uri_component_map, content, sz, false);
+            return _encode_uri(_get_uri_component_charset(), content, sz, false);
         }
 
         LIBATFRAME_UTILS_API std::string decode_uri_component(const char *uri, size_t sz) {
@@ -155,10 +549,9 @@ namespace util {
 
         // ==== RFC 3986 ====
         LIBATFRAME_UTILS_API std::string raw_encode_url(const char *content, size_t sz) {
-            _init_raw_url_map(g_raw_url_map);
             sz = sz ? sz : strlen(content);
 
-            return _encode_uri(g_raw_url_map, content, sz, false);
+            return _encode_uri(_get_raw_url_charset(), content, sz, false);
         }
 
         LIBATFRAME_UTILS_API std::string raw_decode_url(const char *uri, size_t sz) {
@@ -168,16 +561,56 @@ namespace util {
 
         // ==== application/x-www-form-urlencoded ====
         LIBATFRAME_UTILS_API std::string encode_url(const char *content, size_t sz) {
-            _init_raw_url_map(g_raw_url_map);
             sz = sz ? sz : strlen(content);
 
-            return _encode_uri(g_raw_url_map, content, sz, true);
+            return _encode_uri(_get_raw_url_charset(), content, sz, true);
         }
 
         LIBATFRAME_UTILS_API std::string decode_url(const char *uri, size_t sz) {
             sz = sz ? sz : strlen(uri);
             return _decode_uri(uri, sz, true);
         }
+
+        // ==== 输出到调用者的缓冲区 ====
+        LIBATFRAME_UTILS_API int encode_uri(char *dst, size_t dlen, size_t *olen, const char *content, size_t sz) {
+            sz = sz ? sz : strlen(content);
+            return _encode_uri(_get_uri_charset(), dst, dlen, olen, content, sz, false);
+        }
+
+        LIBATFRAME_UTILS_API int decode_uri(char *dst, size_t dlen, size_t *olen, const char *uri, size_t sz) {
+            sz = sz ? sz : strlen(uri);
+            return _decode_uri(dst, dlen, olen, uri, sz, false);
+        }
+
+        LIBATFRAME_UTILS_API int encode_uri_component(char *dst, size_t dlen, size_t *olen, const char *content, size_t sz) {
+            sz = sz ? sz : strlen(content);
+            return _encode_uri(_get_uri_component_charset(), dst, dlen, olen, content, sz, false);
+        }
+
+        LIBATFRAME_UTILS_API int decode_uri_component(char *dst, size_t dlen, size_t *olen, const char *uri, size_t sz) {
+            sz = sz ? sz : strlen(uri);
+            return _decode_uri(dst, dlen, olen, uri, sz, false);
+        }
+
+        LIBATFRAME_UTILS_API int raw_encode_url(char *dst, size_t dlen, size_t *olen, const char *content, size_t sz) {
+            sz = sz ? sz : strlen(content);
+            return _encode_uri(_get_raw_url_charset(), dst, dlen, olen, content, sz, false);
+        }
+
+        LIBATFRAME_UTILS_API int raw_decode_url(char *dst, size_t dlen, size_t *olen, const char *uri, size_t sz) {
+            sz = sz ? sz : strlen(uri);
+            return _decode_uri(dst, dlen, olen, uri, sz, false);
+        }
+
+        LIBATFRAME_UTILS_API int encode_url(char *dst, size_t dlen, size_t *olen, const char *content, size_t sz) {
+            sz = sz ? sz : strlen(content);
+            return _encode_uri(_get_raw_url_charset(), dst, dlen, olen, content, sz, true);
+        }
+
+        LIBATFRAME_UTILS_API int decode_url(char *dst, size_t dlen, size_t *olen, const char *uri, size_t sz) {
+            sz = sz ? sz : strlen(uri);
+            return _decode_uri(dst, dlen, olen, uri, sz, true);
+        }
     } // namespace uri
 
     namespace types {
@@ -544,4 +977,398 @@ namespace util {
     LIBATFRAME_UTILS_API types::item_array::ptr_type tquerystring::create_array() { return types::item_array::create(); };
 
     LIBATFRAME_UTILS_API types::item_object::ptr_type tquerystring::create_object() { return types::item_object::create(); };
+
+    // ==================== 零拷贝解析器 ====================
+    static const uint32_t g_tquerystring_view_npos = 0xFFFFFFFFU;
+
+    static uint32_t _tquerystring_view_hash(uint32_t parent, const char *key, size_t sz) {
+        // FNV-1a
+        uint32_t ret = 2166136261U ^ parent;
+        for (size_t i = 0; i < sz; ++i) {
+            ret ^= static_cast<unsigned char>(key[i]);
+            ret *= 16777619U;
+        }
+        return ret;
+    }
+
+    static int _tquerystring_view_compare(const char *l, size_t lsz, const char *r, size_t rsz) {
+        int ret = memcmp(l, r, lsz < rsz ? lsz : rsz);
+        if (0 != ret) {
+            return ret;
+        }
+
+        return lsz < rsz ? -1 : (lsz > rsz ? 1 : 0);
+    }
+
+    struct _tquerystring_view_entry_less {
+        bool operator()(const tquerystring_view::entry_t &l, const tquerystring_view::entry_t &r) const {
+            return _tquerystring_view_compare(l.key.data, l.key.size, r.key.data, r.key.size) < 0;
+        }
+    };
+
+    LIBATFRAME_UTILS_API tquerystring_view::tquerystring_view() { set_spliter("?#&"); }
+
+    LIBATFRAME_UTILS_API tquerystring_view::tquerystring_view(const std::string &spliter) { set_spliter(spliter); }
+
+    LIBATFRAME_UTILS_API bool tquerystring_view::decode(const char *content, size_t sz) {
+        clear();
+
+        // 根节点
+        node_t root;
+        root.type           = types::ITEM_TYPE_OBJECT;
+        root.value.data     = NULL;
+        root.value.size     = 0;
+        root.children_begin = 0;
+        root.children_size  = 0;
+        nodes_.push_back(root);
+
+        build_node_t root_build;
+        root_build.first_child = root_build.last_child = root_build.next_sibling = g_tquerystring_view_npos;
+        root_build.key_segment = root_build.parent = g_tquerystring_view_npos;
+        build_nodes_.push_back(root_build);
+
+        if (NULL == content) {
+            return true;
+        }
+
+        sz = sz ? sz : strlen(content);
+        if (sz >= g_tquerystring_view_npos) {
+            return false;
+        }
+
+        // 解码后的数据不会比原始数据长，预留后解码过程中不会重新分配，引用保持有效
+        if (buffer_.capacity() < sz) {
+            buffer_.reserve(sz);
+        }
+
+        // 第一遍: 切分记录和key
+        while (sz) {
+            size_t len = 0, is_decl = 0;
+            for (; len < sz; ++len) {
+                if (spliter_map_[static_cast<unsigned char>(content[len])]) {
+                    is_decl = 1;
+                    break;
+                }
+            }
+
+            if (len > 0) {
+                decode_record(content, len);
+            }
+
+            content += len + is_decl;
+            sz -= len + is_decl;
+        }
+
+        // 第二遍: 建立节点，哈希表负载不超过0.5
+        size_t lookup_size = 16;
+        while (lookup_size < (segments_.size() + 1) * 2) {
+            lookup_size <<= 1;
+        }
+        lookup_.assign(lookup_size, g_tquerystring_view_npos);
+        nodes_.reserve(segments_.size() + 1);
+        build_nodes_.reserve(segments_.size() + 1);
+
+        bool ret = true;
+        for (size_t i = 0; i < records_.size(); ++i) {
+            ret = build_record(records_[i]) && ret;
+        }
+
+        finish();
+        return ret;
+    }
+
+    LIBATFRAME_UTILS_API void tquerystring_view::clear() {
+        nodes_.clear();
+        entries_.clear();
+        buffer_.clear();
+        segments_.clear();
+        records_.clear();
+        build_nodes_.clear();
+    }
+
+    LIBATFRAME_UTILS_API void tquerystring_view::set_spliter(const std::string &spliter) {
+        memset(spliter_map_, 0, sizeof(spliter_map_));
+        for (size_t i = 0; i < spliter.size(); ++i) {
+            spliter_map_[static_cast<unsigned char>(spliter[i])] = true;
+        }
+    }
+
+    LIBATFRAME_UTILS_API bool tquerystring_view::empty() const { return 0 == size(); }
+
+    LIBATFRAME_UTILS_API size_t tquerystring_view::size() const { return nodes_.empty() ? 0 : nodes_[0].children_size; }
+
+    LIBATFRAME_UTILS_API const tquerystring_view::node_t *tquerystring_view::root() const { return nodes_.empty() ? NULL : &nodes_[0]; }
+
+    LIBATFRAME_UTILS_API const tquerystring_view::node_t *tquerystring_view::get(const std::string &key) const {
+        return get(root(), key.data(), key.size());
+    }
+
+    LIBATFRAME_UTILS_API const tquerystring_view::node_t *tquerystring_view::get(const node_t *parent, const char *key, size_t key_sz) const {
+        if (NULL == parent || types::ITEM_TYPE_OBJECT != parent->type) {
+            return NULL;
+        }
+
+        // 二分查找
+        size_t begin = parent->children_begin;
+        size_t end   = begin + parent->children_size;
+        while (begin < end) {
+            size_t         mid   = begin + (end - begin) / 2;
+            const entry_t &entry = entries_[mid];
+            int            res   = _tquerystring_view_compare(entry.key.data, entry.key.size, key, key_sz);
+            if (0 == res) {
+                return &nodes_[entry.node];
+            } else if (res < 0) {
+                begin = mid + 1;
+            } else {
+                end = mid;
+            }
+        }
+
+        return NULL;
+    }
+
+    LIBATFRAME_UTILS_API const tquerystring_view::node_t *tquerystring_view::at(const node_t *parent, size_t index) const {
+        const entry_t *entry = child(parent, index);
+        return NULL == entry ? NULL : &nodes_[entry->node];
+    }
+
+    LIBATFRAME_UTILS_API const tquerystring_view::entry_t *tquerystring_view::child(const node_t *parent, size_t index) const {
+        if (NULL == parent || index >= parent->children_size) {
+            return NULL;
+        }
+
+        return &entries_[parent->children_begin + index];
+    }
+
+    LIBATFRAME_UTILS_API std::string tquerystring_view::get_string(const std::string &key) const {
+        const node_t *node = get(key);
+        return NULL == node ? "" : to_string(node);
+    }
+
+    LIBATFRAME_UTILS_API bool tquerystring_view::get_string(const std::string &key, string_ref &out) const {
+        const node_t *node = get(key);
+        if (NULL == node || types::ITEM_TYPE_STRING != node->type) {
+            return false;
+        }
+
+        out = node->value;
+        return true;
+    }
+
+    LIBATFRAME_UTILS_API std::string tquerystring_view::to_string(const node_t *node) const {
+        std::string ret;
+        if (NULL != node) {
+            append_to_string(ret, *node);
+        }
+        return ret;
+    }
+
+    tquerystring_view::string_ref tquerystring_view::decode_component(const char *content, size_t sz) {
+        string_ref ret;
+        ret.data = content;
+        ret.size = sz;
+
+        // 没有转义字符时直接引用输入
+        if (0 == sz || NULL == memchr(content, '%', sz)) {
+            return ret;
+        }
+
+        size_t start = buffer_.size();
+        buffer_.resize(start + sz);
+        buffer_.resize(start + uri::_decode_uri_to(content, sz, false, &buffer_[start]));
+
+        ret.data = &buffer_[start];
+        ret.size = buffer_.size() - start;
+        return ret;
+    }
+
+    void tquerystring_view::decode_record(const char *content, size_t sz) {
+        record_t record;
+
+        // 计算值
+        size_t key_sz = sz;
+        while (key_sz > 0 && content[key_sz - 1] != '=') {
+            --key_sz;
+        }
+
+        if (key_sz > 0) {
+            record.value = decode_component(content + key_sz, sz - key_sz);
+            --key_sz;
+        } else {
+            record.value.data = content + sz;
+            record.value.size = 0;
+            key_sz            = sz;
+        }
+
+        string_ref key = decode_component(content, key_sz);
+
+        // 计算key列表: key[seg1][seg2]...
+        record.segment_begin = static_cast<uint32_t>(segments_.size());
+
+        string_ref seg;
+        size_t     pos = 0;
+        while (pos < key.size && key.data[pos] != '[') {
+            ++pos;
+        }
+        seg.data = key.data;
+        seg.size = pos;
+        segments_.push_back(seg);
+
+        while (pos < key.size) {
+            size_t start = pos + 1;
+            for (pos = start; pos < key.size && key.data[pos] != ']'; ++pos)
+                ;
+
+            seg.data = key.data + start;
+            seg.size = pos - start;
+            segments_.push_back(seg);
+
+            while (pos < key.size && key.data[pos] != '[') {
+                ++pos;
+            }
+        }
+
+        record.segment_size = static_cast<uint32_t>(segments_.size()) - record.segment_begin;
+        records_.push_back(record);
+    }
+
+    uint32_t tquerystring_view::find_or_create(uint32_t parent, uint32_t segment, types::ITEM_TYPE type) {
+        const string_ref &key  = segments_[segment];
+        size_t            mask = lookup_.size() - 1;
+        size_t            slot = _tquerystring_view_hash(parent, key.data, key.size) & mask;
+        while (g_tquerystring_view_npos != lookup_[slot]) {
+            const build_node_t &build = build_nodes_[lookup_[slot]];
+            const string_ref &  other = segments_[build.key_segment];
+            if (build.parent == parent && 0 == _tquerystring_view_compare(other.data, other.size, key.data, key.size)) {
+                return lookup_[slot];
+            }
+
+            slot = (slot + 1) & mask;
+        }
+
+        uint32_t ret  = append_child(parent, segment, type);
+        lookup_[slot] = ret;
+        return ret;
+    }
+
+    uint32_t tquerystring_view::append_child(uint32_t parent, uint32_t segment, types::ITEM_TYPE type) {
+        uint32_t ret = static_cast<uint32_t>(nodes_.size());
+
+        node_t node;
+        node.type           = type;
+        node.value.data     = NULL;
+        node.value.size     = 0;
+        node.children_begin = 0;
+        node.children_size  = 0;
+        nodes_.push_back(node);
+
+        build_node_t build;
+        build.first_child = build.last_child = build.next_sibling = g_tquerystring_view_npos;
+        build.key_segment                                         = segment;
+        build.parent                                              = parent;
+        build_nodes_.push_back(build);
+
+        build_node_t &parent_build = build_nodes_[parent];
+        if (g_tquerystring_view_npos == parent_build.last_child) {
+            parent_build.first_child = ret;
+        } else {
+            build_nodes_[parent_build.last_child].next_sibling = ret;
+        }
+        parent_build.last_child = ret;
+        ++nodes_[parent].children_size;
+
+        return ret;
+    }
+
+    bool tquerystring_view::build_record(const record_t &record) {
+        uint32_t parent = 0;
+        uint32_t last   = record.segment_begin + record.segment_size - 1;
+        for (uint32_t seg = record.segment_begin; seg <= last; ++seg) {
+            types::ITEM_TYPE parent_type = nodes_[parent].type;
+
+            // 数组只能在最后一级为[]时追加
+            if (types::ITEM_TYPE_ARRAY == parent_type) {
+                if (seg != last || !segments_[seg].empty()) {
+                    return false;
+                }
+
+                nodes_[append_child(parent, seg, types::ITEM_TYPE_STRING)].value = record.value;
+                return true;
+            }
+
+            if (types::ITEM_TYPE_OBJECT != parent_type) {
+                return false;
+            }
+
+            types::ITEM_TYPE type;
+            if (seg == last) {
+                type = types::ITEM_TYPE_STRING;
+            } else if (seg + 1 == last && segments_[last].empty()) {
+                type = types::ITEM_TYPE_ARRAY;
+            } else {
+                type = types::ITEM_TYPE_OBJECT;
+            }
+
+            parent = find_or_create(parent, seg, type);
+        }
+
+        if (types::ITEM_TYPE_STRING != nodes_[parent].type) {
+            return false;
+        }
+
+        nodes_[parent].value = record.value;
+        return true;
+    }
+
+    void tquerystring_view::finish() {
+        // 除根节点外每个节点都是且仅是一个节点的子节点
+        entries_.resize(nodes_.size() - 1);
+
+        uint32_t cursor = 0;
+        for (size_t i = 0; i < nodes_.size(); ++i) {
+            node_t &node        = nodes_[i];
+            node.children_begin = cursor;
+            for (uint32_t child = build_nodes_[i].first_child; g_tquerystring_view_npos != child; child = build_nodes_[child].next_sibling) {
+                entry_t &entry = entries_[cursor++];
+                entry.key      = segments_[build_nodes_[child].key_segment];
+                entry.node     = child;
+            }
+
+            if (types::ITEM_TYPE_OBJECT == node.type && node.children_size > 1) {
+                std::sort(entries_.begin() + node.children_begin, entries_.begin() + cursor, _tquerystring_view_entry_less());
+            }
+        }
+    }
+
+    void tquerystring_view::append_to_string(std::string &out, const node_t &node) const {
+        if (types::ITEM_TYPE_STRING == node.type) {
+            out.append(node.value.data, node.value.size);
+            return;
+        }
+
+        bool is_array = types::ITEM_TYPE_ARRAY == node.type;
+        out += is_array ? '[' : '{';
+        for (uint32_t i = 0; i < node.children_size; ++i) {
+            if (i) {
+                out += ", ";
+            }
+
+            const entry_t &entry = entries_[node.children_begin + i];
+            if (!is_array) {
+                out += '\"';
+                out.append(entry.key.data, entry.key.size);
+                out += "\": ";
+            }
+
+            const node_t &child_node = nodes_[entry.node];
+            if (types::ITEM_TYPE_STRING == child_node.type) {
+                out += '\"';
+                append_to_string(out, child_node);
+                out += '\"';
+            } else {
+                append_to_string(out, child_node);
+            }
+        }
+        out += is_array ? ']' : '}';
+    }
 } // namespace util
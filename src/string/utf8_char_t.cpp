@@ -0,0 +1,775 @@
+﻿#include <algorithm>
+#include <cstring>
+
+#include <string/utf8_char_t.h>
+
+// UTF-8校验、统计和转码的SIMD实现: x86使用SSSE3/AVX2(运行时检测)，aarch64使用NEON
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define UTIL_STRING_UTF8_SSSE3 1
+#define UTIL_STRING_UTF8_SSSE3_TARGET __attribute__((target("ssse3")))
+#define UTIL_STRING_UTF8_AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#define UTIL_STRING_UTF8_SSSE3 1
+#define UTIL_STRING_UTF8_SSSE3_TARGET
+#define UTIL_STRING_UTF8_AVX2_TARGET
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define UTIL_STRING_UTF8_NEON 1
+#endif
+
+namespace util {
+    namespace string {
+        namespace {
+            // Keiser-Lemire 算法的错误标记，每个标记表示一类非法的相邻两字节组合
+            // 参见: John Keiser, Daniel Lemire. Validating UTF-8 In Less Than One Instruction Per Byte
+            enum {
+                UTF8_TOO_SHORT      = 1 << 0, // 首字节后面不是后续字节
+                UTF8_TOO_LONG       = 1 << 1, // ASCII后面是后续字节
+                UTF8_OVERLONG_3     = 1 << 2, // 11100000 100xxxxx
+                UTF8_TOO_LARGE      = 1 << 3, // 11110100 1001xxxx 或 11110101+ 10xxxxxx
+                UTF8_SURROGATE      = 1 << 4, // 11101101 101xxxxx
+                UTF8_OVERLONG_2     = 1 << 5, // 1100000x 10xxxxxx
+                UTF8_TOO_LARGE_1000 = 1 << 6, // 11110101+ 1000xxxx
+                UTF8_OVERLONG_4     = 1 << 6, // 11110000 1000xxxx
+                UTF8_TWO_CONTS      = 1 << 7, // 两个连续的后续字节，需要再检查前面的首字节
+                UTF8_CARRY          = UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS,
+            };
+
+            // 前一个字节的高4位
+            static const unsigned char g_utf8_byte_1_high[16] = {
+                UTF8_TOO_LONG,
+                UTF8_TOO_LONG,
+                UTF8_TOO_LONG,
+                UTF8_TOO_LONG,
+                UTF8_TOO_LONG,
+                UTF8_TOO_LONG,
+                UTF8_TOO_LONG,
+                UTF8_TOO_LONG,
+                UTF8_TWO_CONTS,
+                UTF8_TWO_CONTS,
+                UTF8_TWO_CONTS,
+                UTF8_TWO_CONTS,
+                UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+                UTF8_TOO_SHORT,
+                UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+                UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+            };
+
+            // 前一个字节的低4位
+            static const unsigned char g_utf8_byte_1_low[16] = {
+                UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+                UTF8_CARRY | UTF8_OVERLONG_2,
+                UTF8_CARRY,
+                UTF8_CARRY,
+                UTF8_CARRY | UTF8_TOO_LARGE,
+                UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+                UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+                UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+                UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+                UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+                UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+                UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+                UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+                UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+                UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+                UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+            };
+
+            // 当前字节的高4位
+            static const unsigned char g_utf8_byte_2_high[16] = {
+                UTF8_TOO_SHORT,
+                UTF8_TOO_SHORT,
+                UTF8_TOO_SHORT,
+                UTF8_TOO_SHORT,
+                UTF8_TOO_SHORT,
+                UTF8_TOO_SHORT,
+                UTF8_TOO_SHORT,
+                UTF8_TOO_SHORT,
+                UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+                UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+                UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+                UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+                UTF8_TOO_SHORT,
+                UTF8_TOO_SHORT,
+                UTF8_TOO_SHORT,
+                UTF8_TOO_SHORT,
+            };
+
+            // 块的最后3个字节如果是还没结束的多字节字符的首字节，减去这个值后不为0
+            static const unsigned char g_utf8_incomplete_max[32] = {
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF,
+            };
+
+            static inline bool utf8_is_continuation(unsigned char c) { return 0x80 == (c & 0xC0); }
+
+            // 解码一个字符，返回使用的字节数，非法或不完整返回0
+            static inline size_t utf8_decode_one(const unsigned char *p, size_t remain, uint32_t &cp) {
+                unsigned char c = p[0];
+                if (c < 0x80) {
+                    cp = c;
+                    return 1;
+                }
+
+                if (c < 0xC2) {
+                    return 0;
+                }
+
+                if (c < 0xE0) {
+                    if (remain < 2 || !utf8_is_continuation(p[1])) {
+                        return 0;
+                    }
+                    cp = (static_cast<uint32_t>(c & 0x1F) << 6) | (p[1] & 0x3F);
+                    return 2;
+                }
+
+                if (c < 0xF0) {
+                    if (remain < 3 || !utf8_is_continuation(p[1]) || !utf8_is_continuation(p[2])) {
+                        return 0;
+                    }
+                    cp = (static_cast<uint32_t>(c & 0x0F) << 12) | (static_cast<uint32_t>(p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+                    if (cp < 0x800 || (cp >= 0xD800 && cp <= 0xDFFF)) {
+                        return 0;
+                    }
+                    return 3;
+                }
+
+                if (c < 0xF5) {
+                    if (remain < 4 || !utf8_is_continuation(p[1]) || !utf8_is_continuation(p[2]) || !utf8_is_continuation(p[3])) {
+                        return 0;
+                    }
+                    cp = (static_cast<uint32_t>(c & 0x07) << 18) | (static_cast<uint32_t>(p[1] & 0x3F) << 12) |
+                         (static_cast<uint32_t>(p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+                    if (cp < 0x10000 || cp > 0x10FFFF) {
+                        return 0;
+                    }
+                    return 4;
+                }
+
+                return 0;
+            }
+
+            // 回退到pos前面最后一个字符的起始位置(最多回退3个字节)，用于SIMD检查过的前缀交给标量代码继续
+            static inline size_t utf8_back_to_boundary(const unsigned char *src, size_t pos) {
+                for (size_t k = 1; k <= 3 && k <= pos; ++k) {
+                    unsigned char c = src[pos - k];
+                    if (!utf8_is_continuation(c)) {
+                        return c >= 0xC0 ? pos - k : pos;
+                    }
+                }
+                return pos;
+            }
+
+            // ==================== scalar ====================
+            // 返回已经确认合法并且在字符边界上的前缀长度，剩下的部分由调用方逐字符检查
+            static size_t utf8_validate_scalar(const unsigned char *, size_t) { return 0; }
+
+            static size_t utf8_count_scalar(const unsigned char *src, size_t sz) {
+                size_t ret = 0;
+                for (size_t i = 0; i < sz; ++i) {
+                    ret += utf8_is_continuation(src[i]) ? 0 : 1;
+                }
+                return ret;
+            }
+
+            // 转换开头连续的ASCII字符，最多转换sz个，返回转换的个数
+            static size_t utf8_ascii_to_utf16_scalar(const unsigned char *src, size_t sz, uint16_t *dst) {
+                size_t i = 0;
+                for (; i < sz && src[i] < 0x80; ++i) {
+                    dst[i] = src[i];
+                }
+                return i;
+            }
+
+            static size_t utf8_ascii_to_utf32_scalar(const unsigned char *src, size_t sz, uint32_t *dst) {
+                size_t i = 0;
+                for (; i < sz && src[i] < 0x80; ++i) {
+                    dst[i] = src[i];
+                }
+                return i;
+            }
+
+#if defined(UTIL_STRING_UTF8_SSSE3)
+            // ==================== SSSE3 ====================
+            UTIL_STRING_UTF8_SSSE3_TARGET static inline __m128i utf8_check_block_ssse3(__m128i input, __m128i prev_input) {
+                const __m128i nibble      = _mm_set1_epi8(0x0F);
+                const __m128i byte_1_high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(g_utf8_byte_1_high));
+                const __m128i byte_1_low  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(g_utf8_byte_1_low));
+                const __m128i byte_2_high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(g_utf8_byte_2_high));
+
+                __m128i prev1 = _mm_alignr_epi8(input, prev_input, 15);
+                __m128i sc    = _mm_and_si128(_mm_and_si128(_mm_shuffle_epi8(byte_1_high, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+                                                            _mm_shuffle_epi8(byte_1_low, _mm_and_si128(prev1, nibble))),
+                                              _mm_shuffle_epi8(byte_2_high, _mm_and_si128(_mm_srli_epi16(input, 4), nibble)));
+
+                // 3字节和4字节字符的第3、4个字节必须是后续字节，这时sc里正好是 UTF8_TWO_CONTS
+                __m128i prev2  = _mm_alignr_epi8(input, prev_input, 14);
+                __m128i prev3  = _mm_alignr_epi8(input, prev_input, 13);
+                __m128i must23 = _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80))),
+                                              _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80))));
+                return _mm_xor_si128(_mm_and_si128(must23, _mm_set1_epi8(static_cast<char>(0x80))), sc);
+            }
+
+            UTIL_STRING_UTF8_SSSE3_TARGET static size_t utf8_validate_ssse3(const unsigned char *src, size_t sz) {
+                const __m128i incomplete = _mm_loadu_si128(reinterpret_cast<const __m128i *>(g_utf8_incomplete_max + 16));
+                const __m128i zero       = _mm_setzero_si128();
+
+                __m128i prev = zero;
+                size_t  i    = 0;
+                for (; i + 64 <= sz; i += 64) {
+                    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+                    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 16));
+                    __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 32));
+                    __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 48));
+
+                    __m128i error;
+                    if (0 == _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)))) {
+                        // 全是ASCII，只需要检查上一块末尾是否有没结束的字符
+                        error = _mm_subs_epu8(prev, incomplete);
+                    } else {
+                        error = _mm_or_si128(_mm_or_si128(utf8_check_block_ssse3(a, prev), utf8_check_block_ssse3(b, a)),
+                                             _mm_or_si128(utf8_check_block_ssse3(c, b), utf8_check_block_ssse3(d, c)));
+                    }
+
+                    if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(error, zero))) {
+                        break;
+                    }
+                    prev = d;
+                }
+
+                return utf8_back_to_boundary(src, i);
+            }
+
+            UTIL_STRING_UTF8_SSSE3_TARGET static size_t utf8_count_ssse3(const unsigned char *src, size_t sz) {
+                // 有符号比较，大于0xBF(-65)的就不是后续字节
+                const __m128i threshold = _mm_set1_epi8(-65);
+                const __m128i zero      = _mm_setzero_si128();
+
+                size_t ret = 0;
+                size_t i   = 0;
+                while (i + 16 <= sz) {
+                    // 每个字节的计数器最多累加255次
+                    size_t  blocks = (std::min)(static_cast<size_t>(255), (sz - i) >> 4);
+                    __m128i acc    = zero;
+                    for (size_t k = 0; k < blocks; ++k, i += 16) {
+                        acc = _mm_sub_epi8(acc, _mm_cmpgt_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i)), threshold));
+                    }
+
+                    __m128i sum = _mm_sad_epu8(acc, zero);
+                    ret += static_cast<size_t>(_mm_cvtsi128_si32(sum)) + static_cast<size_t>(_mm_extract_epi16(sum, 4));
+                }
+
+                return ret + utf8_count_scalar(src + i, sz - i);
+            }
+
+            UTIL_STRING_UTF8_SSSE3_TARGET static size_t utf8_ascii_to_utf16_ssse3(const unsigned char *src, size_t sz, uint16_t *dst) {
+                const __m128i zero = _mm_setzero_si128();
+
+                size_t i = 0;
+                for (; i + 16 <= sz; i += 16) {
+                    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+                    if (0 != _mm_movemask_epi8(v)) {
+                        break;
+                    }
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_unpacklo_epi8(v, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 8), _mm_unpackhi_epi8(v, zero));
+                }
+
+                return i + utf8_ascii_to_utf16_scalar(src + i, sz - i, dst + i);
+            }
+
+            UTIL_STRING_UTF8_SSSE3_TARGET static size_t utf8_ascii_to_utf32_ssse3(const unsigned char *src, size_t sz, uint32_t *dst) {
+                const __m128i zero = _mm_setzero_si128();
+
+                size_t i = 0;
+                for (; i + 16 <= sz; i += 16) {
+                    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+                    if (0 != _mm_movemask_epi8(v)) {
+                        break;
+                    }
+                    __m128i lo = _mm_unpacklo_epi8(v, zero);
+                    __m128i hi = _mm_unpackhi_epi8(v, zero);
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_unpacklo_epi16(lo, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 4), _mm_unpackhi_epi16(lo, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 8), _mm_unpacklo_epi16(hi, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 12), _mm_unpackhi_epi16(hi, zero));
+                }
+
+                return i + utf8_ascii_to_utf32_scalar(src + i, sz - i, dst + i);
+            }
+
+            // ==================== AVX2 ====================
+            // 跨128位通道取每个字节前面第n个字节
+#define UTIL_STRING_UTF8_PREV_AVX2(input, prev_input, n) \
+    _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev_input, input, 0x21), 16 - (n))
+
+            UTIL_STRING_UTF8_AVX2_TARGET static inline __m256i utf8_check_block_avx2(__m256i input, __m256i prev_input) {
+                const __m256i nibble      = _mm256_set1_epi8(0x0F);
+                const __m256i byte_1_high = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(g_utf8_byte_1_high)));
+                const __m256i byte_1_low  = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(g_utf8_byte_1_low)));
+                const __m256i byte_2_high = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(g_utf8_byte_2_high)));
+
+                __m256i prev1 = UTIL_STRING_UTF8_PREV_AVX2(input, prev_input, 1);
+                __m256i sc =
+                    _mm256_and_si256(_mm256_and_si256(_mm256_shuffle_epi8(byte_1_high, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+                                                      _mm256_shuffle_epi8(byte_1_low, _mm256_and_si256(prev1, nibble))),
+                                     _mm256_shuffle_epi8(byte_2_high, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble)));
+
+                __m256i prev2  = UTIL_STRING_UTF8_PREV_AVX2(input, prev_input, 2);
+                __m256i prev3  = UTIL_STRING_UTF8_PREV_AVX2(input, prev_input, 3);
+                __m256i must23 = _mm256_or_si256(_mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80))),
+                                                 _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80))));
+                return _mm256_xor_si256(_mm256_and_si256(must23, _mm256_set1_epi8(static_cast<char>(0x80))), sc);
+            }
+
+#undef UTIL_STRING_UTF8_PREV_AVX2
+
+            UTIL_STRING_UTF8_AVX2_TARGET static size_t utf8_validate_avx2(const unsigned char *src, size_t sz) {
+                const __m256i incomplete = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(g_utf8_incomplete_max));
+
+                __m256i prev = _mm256_setzero_si256();
+                size_t  i    = 0;
+                for (; i + 64 <= sz; i += 64) {
+                    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+                    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i + 32));
+
+                    __m256i error;
+                    if (0 == _mm256_movemask_epi8(_mm256_or_si256(a, b))) {
+                        error = _mm256_subs_epu8(prev, incomplete);
+                    } else {
+                        error = _mm256_or_si256(utf8_check_block_avx2(a, prev), utf8_check_block_avx2(b, a));
+                    }
+
+                    if (!_mm256_testz_si256(error, error)) {
+                        break;
+                    }
+                    prev = b;
+                }
+
+                return utf8_back_to_boundary(src, i);
+            }
+
+            UTIL_STRING_UTF8_AVX2_TARGET static size_t utf8_count_avx2(const unsigned char *src, size_t sz) {
+                const __m256i threshold = _mm256_set1_epi8(-65);
+                const __m256i zero      = _mm256_setzero_si256();
+
+                size_t ret = 0;
+                size_t i   = 0;
+                while (i + 32 <= sz) {
+                    size_t  blocks = (std::min)(static_cast<size_t>(255), (sz - i) >> 5);
+                    __m256i acc    = zero;
+                    for (size_t k = 0; k < blocks; ++k, i += 32) {
+                        acc = _mm256_sub_epi8(acc, _mm256_cmpgt_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i)), threshold));
+                    }
+
+                    __m256i sum = _mm256_sad_epu8(acc, zero);
+                    __m128i s2  = _mm_add_epi64(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+                    ret += static_cast<size_t>(_mm_cvtsi128_si32(s2)) + static_cast<size_t>(_mm_extract_epi16(s2, 4));
+                }
+
+                return ret + utf8_count_ssse3(src + i, sz - i);
+            }
+
+            UTIL_STRING_UTF8_AVX2_TARGET static size_t utf8_ascii_to_utf16_avx2(const unsigned char *src, size_t sz, uint16_t *dst) {
+                size_t i = 0;
+                for (; i + 32 <= sz; i += 32) {
+                    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+                    if (0 != _mm256_movemask_epi8(v)) {
+                        break;
+                    }
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+                }
+
+                return i + utf8_ascii_to_utf16_ssse3(src + i, sz - i, dst + i);
+            }
+
+            UTIL_STRING_UTF8_AVX2_TARGET static size_t utf8_ascii_to_utf32_avx2(const unsigned char *src, size_t sz, uint32_t *dst) {
+                size_t i = 0;
+                for (; i + 16 <= sz; i += 16) {
+                    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+                    if (0 != _mm_movemask_epi8(v)) {
+                        break;
+                    }
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_cvtepu8_epi32(v));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(v, 8)));
+                }
+
+                return i + utf8_ascii_to_utf32_scalar(src + i, sz - i, dst + i);
+            }
+
+            static int utf8_detect_simd() {
+#if defined(_MSC_VER) && !defined(__clang__)
+                int cpu_info[4] = {0};
+                __cpuid(cpu_info, 0);
+                int max_leaf = cpu_info[0];
+
+                __cpuid(cpu_info, 1);
+                bool ssse3   = 0 != (cpu_info[2] & (1 << 9));
+                bool osxsave = 0 != (cpu_info[2] & (1 << 27));
+                bool avx     = 0 != (cpu_info[2] & (1 << 28));
+                if (!ssse3) {
+                    return 0;
+                }
+
+                if (max_leaf >= 7 && osxsave && avx && 6 == (_xgetbv(0) & 6)) {
+                    __cpuidex(cpu_info, 7, 0);
+                    if (0 != (cpu_info[1] & (1 << 5))) {
+                        return 2;
+                    }
+                }
+                return 1;
+#else
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx2")) {
+                    return 2;
+                }
+                return __builtin_cpu_supports("ssse3") ? 1 : 0;
+#endif
+            }
+#endif
+
+#if defined(UTIL_STRING_UTF8_NEON)
+            // ==================== NEON ====================
+            static inline uint8x16_t utf8_check_block_neon(uint8x16_t input, uint8x16_t prev_input) {
+                const uint8x16_t nibble      = vdupq_n_u8(0x0F);
+                const uint8x16_t byte_1_high = vld1q_u8(g_utf8_byte_1_high);
+                const uint8x16_t byte_1_low  = vld1q_u8(g_utf8_byte_1_low);
+                const uint8x16_t byte_2_high = vld1q_u8(g_utf8_byte_2_high);
+
+                uint8x16_t prev1 = vextq_u8(prev_input, input, 15);
+                uint8x16_t sc    = vandq_u8(vandq_u8(vqtbl1q_u8(byte_1_high, vshrq_n_u8(prev1, 4)), vqtbl1q_u8(byte_1_low, vandq_u8(prev1, nibble))),
+                                         vqtbl1q_u8(byte_2_high, vshrq_n_u8(input, 4)));
+
+                uint8x16_t prev2  = vextq_u8(prev_input, input, 14);
+                uint8x16_t prev3  = vextq_u8(prev_input, input, 13);
+                uint8x16_t must23 = vorrq_u8(vqsubq_u8(prev2, vdupq_n_u8(0xE0 - 0x80)), vqsubq_u8(prev3, vdupq_n_u8(0xF0 - 0x80)));
+                return veorq_u8(vandq_u8(must23, vdupq_n_u8(0x80)), sc);
+            }
+
+            static size_t utf8_validate_neon(const unsigned char *src, size_t sz) {
+                const uint8x16_t incomplete = vld1q_u8(g_utf8_incomplete_max + 16);
+
+                uint8x16_t prev = vdupq_n_u8(0);
+                size_t     i    = 0;
+                for (; i + 64 <= sz; i += 64) {
+                    uint8x16_t a = vld1q_u8(src + i);
+                    uint8x16_t b = vld1q_u8(src + i + 16);
+                    uint8x16_t c = vld1q_u8(src + i + 32);
+                    uint8x16_t d = vld1q_u8(src + i + 48);
+
+                    uint8x16_t error;
+                    if (vmaxvq_u8(vorrq_u8(vorrq_u8(a, b), vorrq_u8(c, d))) < 0x80) {
+                        error = vqsubq_u8(prev, incomplete);
+                    } else {
+                        error = vorrq_u8(vorrq_u8(utf8_check_block_neon(a, prev), utf8_check_block_neon(b, a)),
+                                         vorrq_u8(utf8_check_block_neon(c, b), utf8_check_block_neon(d, c)));
+                    }
+
+                    if (0 != vmaxvq_u8(error)) {
+                        break;
+                    }
+                    prev = d;
+                }
+
+                return utf8_back_to_boundary(src, i);
+            }
+
+            static size_t utf8_count_neon(const unsigned char *src, size_t sz) {
+                const int8x16_t threshold = vdupq_n_s8(-65);
+
+                size_t ret = 0;
+                size_t i   = 0;
+                while (i + 16 <= sz) {
+                    size_t     blocks = (std::min)(static_cast<size_t>(255), (sz - i) >> 4);
+                    uint8x16_t acc    = vdupq_n_u8(0);
+                    for (size_t k = 0; k < blocks; ++k, i += 16) {
+                        acc = vsubq_u8(acc, vcgtq_s8(vreinterpretq_s8_u8(vld1q_u8(src + i)), threshold));
+                    }
+                    ret += vaddlvq_u8(acc);
+                }
+
+                return ret + utf8_count_scalar(src + i, sz - i);
+            }
+
+            static size_t utf8_ascii_to_utf16_neon(const unsigned char *src, size_t sz, uint16_t *dst) {
+                size_t i = 0;
+                for (; i + 16 <= sz; i += 16) {
+                    uint8x16_t v = vld1q_u8(src + i);
+                    if (vmaxvq_u8(v) >= 0x80) {
+                        break;
+                    }
+                    vst1q_u16(dst + i, vmovl_u8(vget_low_u8(v)));
+                    vst1q_u16(dst + i + 8, vmovl_u8(vget_high_u8(v)));
+                }
+
+                return i + utf8_ascii_to_utf16_scalar(src + i, sz - i, dst + i);
+            }
+
+            static size_t utf8_ascii_to_utf32_neon(const unsigned char *src, size_t sz, uint32_t *dst) {
+                size_t i = 0;
+                for (; i + 16 <= sz; i += 16) {
+                    uint8x16_t v = vld1q_u8(src + i);
+                    if (vmaxvq_u8(v) >= 0x80) {
+                        break;
+                    }
+                    uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+                    uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+                    vst1q_u32(dst + i, vmovl_u16(vget_low_u16(lo)));
+                    vst1q_u32(dst + i + 4, vmovl_u16(vget_high_u16(lo)));
+                    vst1q_u32(dst + i + 8, vmovl_u16(vget_low_u16(hi)));
+                    vst1q_u32(dst + i + 12, vmovl_u16(vget_high_u16(hi)));
+                }
+
+                return i + utf8_ascii_to_utf32_scalar(src + i, sz - i, dst + i);
+            }
+#endif
+
+            typedef size_t (*utf8_validate_fn_t)(const unsigned char *, size_t);
+            typedef size_t (*utf8_count_fn_t)(const unsigned char *, size_t);
+            typedef size_t (*utf8_ascii_to_utf16_fn_t)(const unsigned char *, size_t, uint16_t *);
+            typedef size_t (*utf8_ascii_to_utf32_fn_t)(const unsigned char *, size_t, uint32_t *);
+
+            struct utf8_dispatch_t {
+                utf8_validate_fn_t       validate;
+                utf8_count_fn_t          count;
+                utf8_ascii_to_utf16_fn_t ascii_to_utf16;
+                utf8_ascii_to_utf32_fn_t ascii_to_utf32;
+
+                utf8_dispatch_t()
+                    : validate(utf8_validate_scalar), count(utf8_count_scalar), ascii_to_utf16(utf8_ascii_to_utf16_scalar),
+                      ascii_to_utf32(utf8_ascii_to_utf32_scalar) {
+#if defined(UTIL_STRING_UTF8_SSSE3)
+                    int level = utf8_detect_simd();
+                    if (level >= 2) {
+                        validate       = utf8_validate_avx2;
+                        count          = utf8_count_avx2;
+                        ascii_to_utf16 = utf8_ascii_to_utf16_avx2;
+                        ascii_to_utf32 = utf8_ascii_to_utf32_avx2;
+                    } else if (level >= 1) {
+                        validate       = utf8_validate_ssse3;
+                        count          = utf8_count_ssse3;
+                        ascii_to_utf16 = utf8_ascii_to_utf16_ssse3;
+                        ascii_to_utf32 = utf8_ascii_to_utf32_ssse3;
+                    }
+#elif defined(UTIL_STRING_UTF8_NEON)
+                    validate       = utf8_validate_neon;
+                    count          = utf8_count_neon;
+                    ascii_to_utf16 = utf8_ascii_to_utf16_neon;
+                    ascii_to_utf32 = utf8_ascii_to_utf32_neon;
+#endif
+                }
+            };
+
+            // 放在函数内，保证其他模块的静态初始化里也可以使用
+            static const utf8_dispatch_t &utf8_simd() {
+                static const utf8_dispatch_t ret;
+                return ret;
+            }
+
+            template <typename TCH>
+            struct utf8_transcode_traits;
+
+            template <>
+            struct utf8_transcode_traits<uint16_t> {
+                static inline size_t units(uint32_t cp) { return cp >= 0x10000 ? 2 : 1; }
+
+                static inline void write(uint16_t *dst, uint32_t cp) {
+                    if (cp >= 0x10000) {
+                        cp -= 0x10000;
+                        dst[0] = static_cast<uint16_t>(0xD800 + (cp >> 10));
+                        dst[1] = static_cast<uint16_t>(0xDC00 + (cp & 0x3FF));
+                    } else {
+                        dst[0] = static_cast<uint16_t>(cp);
+                    }
+                }
+
+                static inline size_t ascii(const unsigned char *src, size_t sz, uint16_t *dst) { return utf8_simd().ascii_to_utf16(src, sz, dst); }
+
+                // 已经确认合法的数据需要的输出长度，4字节的字符需要两个代理对
+                static size_t measure(const unsigned char *src, size_t sz) {
+                    size_t ret = utf8_simd().count(src, sz);
+                    for (size_t i = 0; i < sz; ++i) {
+                        ret += src[i] >= 0xF0 ? 1 : 0;
+                    }
+                    return ret;
+                }
+            };
+
+            template <>
+            struct utf8_transcode_traits<uint32_t> {
+                static inline size_t units(uint32_t) { return 1; }
+
+                static inline void write(uint32_t *dst, uint32_t cp) { dst[0] = cp; }
+
+                static inline size_t ascii(const unsigned char *src, size_t sz, uint32_t *dst) { return utf8_simd().ascii_to_utf32(src, sz, dst); }
+
+                static size_t measure(const unsigned char *src, size_t sz) { return utf8_simd().count(src, sz); }
+            };
+
+            template <typename TCH>
+            static int utf8_transcode(TCH *dst, size_t dlen, size_t *olen, const char *src, size_t slen) {
+                typedef utf8_transcode_traits<TCH> traits_t;
+
+                const unsigned char *in = reinterpret_cast<const unsigned char *>(src);
+                size_t               i  = 0;
+                size_t               o  = 0;
+                if (NULL == dst) {
+                    dlen = 0;
+                }
+
+                while (i < slen) {
+                    if (in[i] < 0x80) {
+                        if (o >= dlen) {
+                            break;
+                        }
+
+                        size_t limit = (std::min)(slen - i, dlen - o);
+                        size_t n;
+                        if (limit >= 16) {
+                            n = traits_t::ascii(in + i, limit, dst + o);
+                        } else {
+                            for (n = 0; n < limit && in[i + n] < 0x80; ++n) {
+                                dst[o + n] = in[i + n];
+                            }
+                        }
+
+                        i += n;
+                        o += n;
+                        continue;
+                    }
+
+                    uint32_t cp;
+                    size_t   len = utf8_decode_one(in + i, slen - i, cp);
+                    if (0 == len) {
+                        if (NULL != olen) {
+                            *olen = o;
+                        }
+                        return -2;
+                    }
+
+                    if (o + traits_t::units(cp) > dlen) {
+                        break;
+                    }
+
+                    traits_t::write(dst + o, cp);
+                    i += len;
+                    o += traits_t::units(cp);
+                }
+
+                if (i >= slen) {
+                    if (NULL != olen) {
+                        *olen = o;
+                    }
+                    return 0;
+                }
+
+                // 缓冲区不足，检查剩下的数据并计算需要的长度
+                if (!utf8_validate(src + i, slen - i)) {
+                    if (NULL != olen) {
+                        *olen = o;
+                    }
+                    return -2;
+                }
+
+                if (NULL != olen) {
+                    *olen = o + traits_t::measure(in + i, slen - i);
+                }
+                return -1;
+            }
+        } // namespace
+
+        LIBATFRAME_UTILS_API bool utf8_validate(const char *src, size_t sz, size_t *error_pos) {
+            if (NULL == src || 0 == sz) {
+                return true;
+            }
+
+            const unsigned char *in = reinterpret_cast<const unsigned char *>(src);
+            size_t               i  = utf8_simd().validate(in, sz);
+            while (i < sz) {
+                if (in[i] < 0x80) {
+                    ++i;
+                    continue;
+                }
+
+                uint32_t cp;
+                size_t   len = utf8_decode_one(in + i, sz - i, cp);
+                if (0 == len) {
+                    if (NULL != error_pos) {
+                        *error_pos = i;
+                    }
+                    return false;
+                }
+                i += len;
+            }
+
+            return true;
+        }
+
+        LIBATFRAME_UTILS_API size_t utf8_count(const char *src, size_t sz) {
+            if (NULL == src) {
+                return 0;
+            }
+
+            return utf8_simd().count(reinterpret_cast<const unsigned char *>(src), sz);
+        }
+
+        LIBATFRAME_UTILS_API int utf8_to_utf16(uint16_t *dst, size_t dlen, size_t *olen, const char *src, size_t slen) {
+            return utf8_transcode(dst, dlen, olen, src, NULL == src ? 0 : slen);
+        }
+
+        LIBATFRAME_UTILS_API int utf8_to_utf32(uint32_t *dst, size_t dlen, size_t *olen, const char *src, size_t slen) {
+            return utf8_transcode(dst, dlen, olen, src, NULL == src ? 0 : slen);
+        }
+
+        LIBATFRAME_UTILS_API size_t utf8_truncate(const char *src, size_t sz, size_t max_bytes) {
+            if (NULL == src || sz <= max_bytes) {
+                return NULL == src ? 0 : sz;
+            }
+
+            // src[max_bytes] 是后续字节说明截断位置在字符中间，最多回退3个字节
+            size_t ret = max_bytes;
+            for (int k = 0; k < 3 && ret > 0 && utf8_is_continuation(static_cast<unsigned char>(src[ret])); ++k) {
+                --ret;
+            }
+
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API size_t utf8_truncate_chars(const char *src, size_t sz, size_t max_chars) {
+            if (NULL == src) {
+                return 0;
+            }
+
+            const unsigned char *in = reinterpret_cast<const unsigned char *>(src);
+            size_t               i  = 0;
+
+            // 先按块跳过字符数不会超出限制的部分
+            const size_t block_size = 256;
+            while (sz - i >= block_size) {
+                size_t n = utf8_simd().count(in + i, block_size);
+                if (n > max_chars) {
+                    break;
+                }
+                max_chars -= n;
+                i += block_size;
+            }
+
+            for (; i < sz; ++i) {
+                if (utf8_is_continuation(in[i])) {
+                    continue;
+                }
+
+                if (0 == max_chars) {
+                    return i;
+                }
+                --max_chars;
+            }
+
+            return sz;
+        }
+    } // namespace string
+} // namespace util
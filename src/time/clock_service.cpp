@@ -0,0 +1,442 @@
+﻿#include <cstring>
+
+#include "lock/lock_holder.h"
+
+#include "time/clock_service.h"
+#include "time/time_utility.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#include <x86intrin.h>
+#define UTIL_TIME_CLOCK_SERVICE_TSC 1
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define UTIL_TIME_CLOCK_SERVICE_TSC 1
+#endif
+
+namespace util {
+    namespace time {
+        namespace detail {
+            // 两次校准的采样至少间隔这么久，减少读时钟的抖动带来的误差
+            static const int64_t CLOCK_SERVICE_CALIBRATE_NS = 100000000;
+            // 最多插值这么久，超过后直接读系统时钟
+            static const uint64_t CLOCK_SERVICE_INTERPOLATE_NS = 1000000000;
+
+            static inline int64_t clock_service_monotonic_ns() {
+                return static_cast<int64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+            }
+
+            static inline uint64_t clock_service_read_tsc() {
+#if defined(UTIL_TIME_CLOCK_SERVICE_TSC)
+                return static_cast<uint64_t>(__rdtsc());
+#else
+                return 0;
+#endif
+            }
+
+            static bool clock_service_detect_invariant_tsc() {
+#if defined(UTIL_TIME_CLOCK_SERVICE_TSC) && defined(_MSC_VER) && !defined(__clang__)
+                int cpu_info[4] = {0};
+                __cpuid(cpu_info, static_cast<int>(0x80000000));
+                if (static_cast<unsigned int>(cpu_info[0]) < 0x80000007) {
+                    return false;
+                }
+
+                __cpuid(cpu_info, static_cast<int>(0x80000007));
+                return 0 != (cpu_info[3] & (1 << 8));
+#elif defined(UTIL_TIME_CLOCK_SERVICE_TSC)
+                unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+                if (0 == __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) {
+                    return false;
+                }
+                return 0 != (edx & (1 << 8));
+#else
+                return false;
+#endif
+            }
+
+            static void clock_service_make_calendar(clock_calendar_t &out, time_t now, time_t zone_offset) {
+                // 向下取整，保证1970年以前的时间也正确
+                int64_t local = static_cast<int64_t>(now - zone_offset);
+                int64_t days  = local / time_utility::DAY_SECONDS;
+                if (local % time_utility::DAY_SECONDS < 0) {
+                    --days;
+                }
+
+                int      year;
+                unsigned month;
+                unsigned day;
+                time_utility::civil_from_days(days, year, month, day);
+
+                int64_t month_first = days - static_cast<int64_t>(day - 1);
+                int64_t year_first  = time_utility::days_from_civil(year, 1, 1);
+                int64_t next_month  = 12 == month ? time_utility::days_from_civil(year + 1, 1, 1)
+                                                 : time_utility::days_from_civil(year, month + 1, 1);
+
+                out.zone_offset = zone_offset;
+                out.year        = year;
+                out.month       = static_cast<int>(month);
+                out.month_day   = static_cast<int>(day);
+                out.year_day    = static_cast<int>(days - year_first);
+                out.week_day    = static_cast<int>(((days + 4) % 7 + 7) % 7); // 1970年1月1日是周四
+                out.day_start   = static_cast<time_t>(days * time_utility::DAY_SECONDS) + zone_offset;
+                out.day_end     = out.day_start + time_utility::DAY_SECONDS;
+                out.week_start  = out.day_start - out.week_day * time_utility::DAY_SECONDS;
+                out.month_start = static_cast<time_t>(month_first * time_utility::DAY_SECONDS) + zone_offset;
+                out.month_end   = static_cast<time_t>(next_month * time_utility::DAY_SECONDS) + zone_offset;
+                out.year_start  = static_cast<time_t>(year_first * time_utility::DAY_SECONDS) + zone_offset;
+                out.year_end    = static_cast<time_t>(time_utility::days_from_civil(year + 1, 1, 1) * time_utility::DAY_SECONDS) + zone_offset;
+            }
+        } // namespace detail
+
+        LIBATFRAME_UTILS_API clock_service::clock_service()
+            : offset_(std::chrono::system_clock::duration::zero()), last_tm_seconds_(0), last_tm_zone_offset_(0), calibrate_tsc_(0),
+              calibrate_monotonic_ns_(0) {
+            seq_.store(0);
+            data_.snapshot.monotonic_ns = 0;
+            data_.snapshot.unix_seconds = 0;
+            data_.snapshot.usec         = 0;
+            data_.tsc                   = 0;
+            data_.tsc_mult              = 0;
+            data_.tsc_limit             = 0;
+
+            // 保证未更新过时的描述也是有效的
+            data_.snapshot.gmt_tm   = time_utility::get_gmt_tm(0);
+            data_.snapshot.local_tm = data_.snapshot.gmt_tm;
+            memset(&data_.snapshot.calendar, 0, sizeof(data_.snapshot.calendar));
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            ticker_running_.store(0);
+#endif
+        }
+
+        LIBATFRAME_UTILS_API clock_service::~clock_service() { stop_ticker(); }
+
+        LIBATFRAME_UTILS_API clock_service &clock_service::global() {
+            // 不析构，保证其他模块在退出流程中也可以使用
+            static clock_service *ret = new clock_service();
+            return *ret;
+        }
+
+        inline uint32_t clock_service::read_begin() const {
+            while (true) {
+                uint32_t seq = seq_.load(::util::lock::memory_order_acquire);
+                if (0 == (seq & 1)) {
+                    return seq;
+                }
+
+                __UTIL_LOCK_SPIN_LOCK_PAUSE();
+            }
+        }
+
+        inline bool clock_service::read_retry(uint32_t seq) const {
+            UTIL_LOCK_ATOMIC_THREAD_FENCE(::util::lock::memory_order_acquire);
+            return seq != seq_.load(::util::lock::memory_order_relaxed);
+        }
+
+        LIBATFRAME_UTILS_API void clock_service::update(const raw_time_t *t) {
+            ::util::lock::lock_holder< ::util::lock::spin_lock> holder(write_lock_);
+
+            // 在锁内读时钟，保证多个写入方发布的时间不会回退
+            int64_t  monotonic_ns = detail::clock_service_monotonic_ns();
+            uint64_t tsc          = is_tsc_available() ? detail::clock_service_read_tsc() : 0;
+            if (NULL != t) {
+                publish(*t + offset_, monotonic_ns, tsc);
+            } else {
+                publish(std::chrono::system_clock::now() + offset_, monotonic_ns, tsc);
+            }
+        }
+
+        void clock_service::publish(const raw_time_t &system_time, int64_t monotonic_ns, uint64_t tsc) {
+            // 写入方已经互斥，这里读data_不需要重试
+            data_t next;
+            next.snapshot.system_time  = system_time;
+            next.snapshot.monotonic_ns = monotonic_ns;
+            next.snapshot.unix_seconds = std::chrono::system_clock::to_time_t(system_time);
+            next.snapshot.usec         = static_cast<time_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                                         system_time - std::chrono::system_clock::from_time_t(next.snapshot.unix_seconds))
+                                                         .count());
+            if (next.snapshot.usec < 0) {
+                next.snapshot.usec = 0;
+            }
+            if (next.snapshot.usec >= 1000000) {
+                next.snapshot.usec = 999999;
+            }
+
+            // 时间描述只在秒数或时区变化时重新计算
+            time_t zone_offset = time_utility::get_zone_offset();
+            if (next.snapshot.unix_seconds != last_tm_seconds_ || zone_offset != last_tm_zone_offset_ || 0 == data_.snapshot.calendar.day_end) {
+                next.snapshot.gmt_tm   = time_utility::get_gmt_tm(next.snapshot.unix_seconds);
+                next.snapshot.local_tm = time_utility::get_local_tm(next.snapshot.unix_seconds);
+                last_tm_seconds_       = next.snapshot.unix_seconds;
+                last_tm_zone_offset_   = zone_offset;
+            } else {
+                next.snapshot.gmt_tm   = data_.snapshot.gmt_tm;
+                next.snapshot.local_tm = data_.snapshot.local_tm;
+            }
+
+            // 日历只在跨天或时区变化时重新计算
+            const clock_calendar_t &prev_calendar = data_.snapshot.calendar;
+            if (0 == prev_calendar.day_end || zone_offset != prev_calendar.zone_offset || next.snapshot.unix_seconds < prev_calendar.day_start ||
+                next.snapshot.unix_seconds >= prev_calendar.day_end) {
+                detail::clock_service_make_calendar(next.snapshot.calendar, next.snapshot.unix_seconds, zone_offset);
+            } else {
+                next.snapshot.calendar = prev_calendar;
+            }
+
+            // 用两次采样之间的单调时钟校准TSC的频率
+            next.tsc       = tsc;
+            next.tsc_mult  = data_.tsc_mult;
+            next.tsc_limit = data_.tsc_limit;
+            if (0 != tsc) {
+                if (0 == calibrate_tsc_ || tsc <= calibrate_tsc_ || monotonic_ns < calibrate_monotonic_ns_) {
+                    calibrate_tsc_          = tsc;
+                    calibrate_monotonic_ns_ = monotonic_ns;
+                } else if (monotonic_ns - calibrate_monotonic_ns_ >= detail::CLOCK_SERVICE_CALIBRATE_NS) {
+                    double ns_per_tick =
+                        static_cast<double>(monotonic_ns - calibrate_monotonic_ns_) / static_cast<double>(tsc - calibrate_tsc_);
+                    next.tsc_mult = static_cast<uint64_t>(ns_per_tick * 4294967296.0);
+                    if (0 != next.tsc_mult) {
+                        next.tsc_limit = (detail::CLOCK_SERVICE_INTERPOLATE_NS << 32) / next.tsc_mult;
+                    }
+
+                    calibrate_tsc_          = tsc;
+                    calibrate_monotonic_ns_ = monotonic_ns;
+                }
+            }
+
+            // seqlock: 奇数表示正在写入，读取方看到奇数或前后不一致时重试
+            uint32_t seq = seq_.load(::util::lock::memory_order_relaxed);
+            seq_.store(seq + 1, ::util::lock::memory_order_relaxed);
+            UTIL_LOCK_ATOMIC_THREAD_FENCE(::util::lock::memory_order_release);
+            data_ = next;
+            seq_.store(seq + 2, ::util::lock::memory_order_release);
+        }
+
+        LIBATFRAME_UTILS_API void clock_service::refresh() {
+            ::util::lock::lock_holder< ::util::lock::spin_lock> holder(write_lock_);
+
+            // 时区变化时publish里会重新计算时间描述和日历
+            publish(data_.snapshot.system_time, data_.snapshot.monotonic_ns, data_.tsc);
+        }
+
+        LIBATFRAME_UTILS_API void clock_service::load(clock_snapshot_t &out) const {
+            uint32_t seq;
+            do {
+                seq = read_begin();
+                out = data_.snapshot;
+            } while (read_retry(seq));
+        }
+
+        LIBATFRAME_UTILS_API clock_service::raw_time_t clock_service::now() const {
+            raw_time_t ret;
+            uint32_t   seq;
+            do {
+                seq = read_begin();
+                ret = data_.snapshot.system_time;
+            } while (read_retry(seq));
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API time_t clock_service::get_now() const {
+            time_t   ret;
+            uint32_t seq;
+            do {
+                seq = read_begin();
+                ret = data_.snapshot.unix_seconds;
+            } while (read_retry(seq));
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API time_t clock_service::get_now_usec() const {
+            time_t   ret;
+            uint32_t seq;
+            do {
+                seq = read_begin();
+                ret = data_.snapshot.usec;
+            } while (read_retry(seq));
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API int64_t clock_service::get_monotonic_ns() const {
+            int64_t  ret;
+            uint32_t seq;
+            do {
+                seq = read_begin();
+                ret = data_.snapshot.monotonic_ns;
+            } while (read_retry(seq));
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API time_t clock_service::get_day_start() const {
+            time_t   ret;
+            uint32_t seq;
+            do {
+                seq = read_begin();
+                ret = data_.snapshot.calendar.day_start;
+            } while (read_retry(seq));
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API void clock_service::load_calendar(clock_calendar_t &out) const {
+            uint32_t seq;
+            do {
+                seq = read_begin();
+                out = data_.snapshot.calendar;
+            } while (read_retry(seq));
+        }
+
+        LIBATFRAME_UTILS_API int64_t clock_service::precise_monotonic_ns() const {
+            if (!is_tsc_available()) {
+                return detail::clock_service_monotonic_ns();
+            }
+
+            int64_t  base_ns;
+            uint64_t base_tsc;
+            uint64_t mult;
+            uint64_t limit;
+            uint32_t seq;
+            do {
+                seq      = read_begin();
+                base_ns  = data_.snapshot.monotonic_ns;
+                base_tsc = data_.tsc;
+                mult     = data_.tsc_mult;
+                limit    = data_.tsc_limit;
+            } while (read_retry(seq));
+
+            uint64_t tsc = detail::clock_service_read_tsc();
+            if (0 == mult || 0 == base_tsc) {
+                return detail::clock_service_monotonic_ns();
+            }
+
+            // 不同核心的TSC可能有很小的差异，不返回比快照更早的时间
+            if (tsc < base_tsc) {
+                return base_ns;
+            }
+            if (tsc - base_tsc > limit) {
+                return detail::clock_service_monotonic_ns();
+            }
+            return base_ns + static_cast<int64_t>(((tsc - base_tsc) * mult) >> 32);
+        }
+
+        LIBATFRAME_UTILS_API clock_service::raw_time_t clock_service::precise_now() const {
+            if (!is_tsc_available()) {
+                return std::chrono::system_clock::now() + get_offset();
+            }
+
+            raw_time_t base_time;
+            uint64_t   base_tsc;
+            uint64_t   mult;
+            uint64_t   limit;
+            uint32_t   seq;
+            do {
+                seq       = read_begin();
+                base_time = data_.snapshot.system_time;
+                base_tsc  = data_.tsc;
+                mult      = data_.tsc_mult;
+                limit     = data_.tsc_limit;
+            } while (read_retry(seq));
+
+            uint64_t tsc = detail::clock_service_read_tsc();
+            if (0 == mult || 0 == base_tsc) {
+                return std::chrono::system_clock::now() + get_offset();
+            }
+
+            if (tsc < base_tsc) {
+                return base_time;
+            }
+            if (tsc - base_tsc > limit) {
+                return std::chrono::system_clock::now() + get_offset();
+            }
+            std::chrono::nanoseconds delta(static_cast<int64_t>(((tsc - base_tsc) * mult) >> 32));
+            return base_time + std::chrono::duration_cast<std::chrono::system_clock::duration>(delta);
+        }
+
+        LIBATFRAME_UTILS_API void clock_service::set_offset(const std::chrono::system_clock::duration &offset) {
+            ::util::lock::lock_holder< ::util::lock::spin_lock> holder(write_lock_);
+
+            // 保持真实时间不变，只修改偏移
+            raw_time_t real_time = data_.snapshot.system_time - offset_;
+            offset_              = offset;
+            publish(real_time + offset_, detail::clock_service_monotonic_ns(), is_tsc_available() ? detail::clock_service_read_tsc() : 0);
+        }
+
+        LIBATFRAME_UTILS_API std::chrono::system_clock::duration clock_service::get_offset() const {
+            ::util::lock::lock_holder< ::util::lock::spin_lock> holder(const_cast< ::util::lock::spin_lock &>(write_lock_));
+            return offset_;
+        }
+
+        LIBATFRAME_UTILS_API bool clock_service::start_ticker(std::chrono::microseconds interval) {
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            std::lock_guard<std::mutex> guard(ticker_lock_);
+            if (0 != ticker_running_.load() || ticker_thread_.joinable()) {
+                return false;
+            }
+
+            ticker_running_.store(1);
+            ticker_thread_ = std::thread(&clock_service::ticker_main, this, interval);
+            return true;
+#else
+            COMPILER_UNUSED(interval);
+            return false;
+#endif
+        }
+
+        LIBATFRAME_UTILS_API void clock_service::stop_ticker() {
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            std::thread thd;
+            {
+                std::lock_guard<std::mutex> guard(ticker_lock_);
+                ticker_running_.store(0);
+                thd.swap(ticker_thread_);
+            }
+
+            ticker_cond_.notify_all();
+            if (thd.joinable()) {
+                thd.join();
+            }
+#endif
+        }
+
+        LIBATFRAME_UTILS_API bool clock_service::is_ticker_running() const {
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+            return 0 != ticker_running_.load();
+#else
+            return false;
+#endif
+        }
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+        void clock_service::ticker_main(std::chrono::microseconds interval) {
+            while (true) {
+                update();
+
+                std::unique_lock<std::mutex> guard(ticker_lock_);
+                if (0 == ticker_running_.load()) {
+                    break;
+                }
+                ticker_cond_.wait_for(guard, interval);
+                if (0 == ticker_running_.load()) {
+                    break;
+                }
+            }
+        }
+#endif
+
+        LIBATFRAME_UTILS_API bool clock_service::is_tsc_available() {
+            static bool ret = detail::clock_service_detect_invariant_tsc();
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API bool clock_service::is_tsc_calibrated() const {
+            uint64_t ret;
+            uint32_t seq;
+            do {
+                seq = read_begin();
+                ret = data_.tsc_mult;
+            } while (read_retry(seq));
+            return 0 != ret;
+        }
+    } // namespace time
+} // namespace util
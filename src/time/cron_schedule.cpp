@@ -0,0 +1,569 @@
+﻿#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+#include "time/cron_schedule.h"
+#include "time/time_utility.h"
+
+namespace util {
+    namespace time {
+        namespace detail {
+            static const uint64_t cron_all_seconds    = (static_cast<uint64_t>(1) << 60) - 1;
+            static const uint64_t cron_all_minutes    = (static_cast<uint64_t>(1) << 60) - 1;
+            static const uint64_t cron_all_hours      = (static_cast<uint64_t>(1) << 24) - 1;
+            static const uint64_t cron_all_month_days = ((static_cast<uint64_t>(1) << 32) - 1) & ~static_cast<uint64_t>(1);
+            static const uint64_t cron_all_months     = ((static_cast<uint64_t>(1) << 13) - 1) & ~static_cast<uint64_t>(1);
+            static const uint64_t cron_all_week_days  = (static_cast<uint64_t>(1) << 7) - 1;
+
+            static const char *cron_month_names[] = {"JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC"};
+            static const char *cron_week_names[]  = {"SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"};
+
+            struct cron_field_desc_t {
+                int          min_value;
+                int          max_value;
+                const char **names;
+                int          names_count;
+                int          names_base;
+            };
+
+            static inline bool cron_is_space(char c) { return ' ' == c || '\t' == c || '\r' == c || '\n' == c; }
+
+            static inline int64_t cron_floor_days(int64_t t) {
+                int64_t ret = t / time_utility::DAY_SECONDS;
+                if (t % time_utility::DAY_SECONDS < 0) {
+                    --ret;
+                }
+                return ret;
+            }
+
+            static inline int cron_week_day(int64_t days) {
+                // 1970年1月1日是周四
+                return static_cast<int>(((days + 4) % 7 + 7) % 7);
+            }
+
+            // mask中不小于from的最小的位，没有返回-1
+            static inline int cron_next_bit(uint64_t mask, int from) {
+                if (from >= 64) {
+                    return -1;
+                }
+
+                mask >>= from;
+                if (0 == mask) {
+                    return -1;
+                }
+
+                while (0 == (mask & 0xFF)) {
+                    mask >>= 8;
+                    from += 8;
+                }
+                while (0 == (mask & 1)) {
+                    mask >>= 1;
+                    ++from;
+                }
+                return from;
+            }
+
+            static bool cron_parse_value(const char *&s, const char *end, const cron_field_desc_t &desc, int &out) {
+                if (s < end && *s >= '0' && *s <= '9') {
+                    out = 0;
+                    while (s < end && *s >= '0' && *s <= '9') {
+                        out = out * 10 + (*s - '0');
+                        if (out > 10000) {
+                            return false;
+                        }
+                        ++s;
+                    }
+                    return true;
+                }
+
+                if (NULL == desc.names || end - s < 3) {
+                    return false;
+                }
+
+                for (int i = 0; i < desc.names_count; ++i) {
+                    bool same = true;
+                    for (int j = 0; j < 3 && same; ++j) {
+                        char c = s[j];
+                        if (c >= 'a' && c <= 'z') {
+                            c = static_cast<char>(c - 'a' + 'A');
+                        }
+                        same = c == desc.names[i][j];
+                    }
+
+                    if (same) {
+                        out = i + desc.names_base;
+                        s += 3;
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            static bool cron_parse_field(const char *s, const char *end, const cron_field_desc_t &desc, uint64_t &out, bool &any) {
+                out = 0;
+                any = s < end && ('*' == *s || '?' == *s);
+
+                while (s < end) {
+                    int  lo, hi;
+                    int  step     = 1;
+                    bool wildcard = false;
+                    if ('*' == *s || '?' == *s) {
+                        lo       = desc.min_value;
+                        hi       = desc.max_value;
+                        wildcard = true;
+                        ++s;
+                    } else {
+                        if (!cron_parse_value(s, end, desc, lo)) {
+                            return false;
+                        }
+
+                        hi = lo;
+                        if (s < end && '-' == *s) {
+                            ++s;
+                            if (!cron_parse_value(s, end, desc, hi)) {
+                                return false;
+                            }
+                        }
+                    }
+
+                    if (s < end && '/' == *s) {
+                        ++s;
+                        const char *step_begin = s;
+                        step                   = 0;
+                        while (s < end && *s >= '0' && *s <= '9' && step <= 10000) {
+                            step = step * 10 + (*s - '0');
+                            ++s;
+                        }
+                        if (s == step_begin || step <= 0 || step > 10000) {
+                            return false;
+                        }
+
+                        // a/n 表示从a开始到最大值
+                        if (!wildcard && lo == hi) {
+                            hi = desc.max_value;
+                        }
+                    }
+
+                    if (lo < desc.min_value || hi > desc.max_value || lo > hi) {
+                        return false;
+                    }
+
+                    for (int i = lo; i <= hi; i += step) {
+                        out |= static_cast<uint64_t>(1) << i;
+                    }
+
+                    if (s < end) {
+                        if (',' != *s) {
+                            return false;
+                        }
+                        ++s;
+                        if (s >= end) {
+                            return false;
+                        }
+                    }
+                }
+
+                return 0 != out;
+            }
+        } // namespace detail
+
+        LIBATFRAME_UTILS_API cron_rule::cron_rule()
+            : seconds_(0), minutes_(0), hours_(0), month_days_(0), months_(0), week_days_(0), any_month_day_(false), any_week_day_(false) {}
+
+        LIBATFRAME_UTILS_API int cron_rule::parse(const char *expr) {
+            *this = cron_rule();
+            if (NULL == expr) {
+                return error_type_t::EN_CRET_INVALID_PARAM;
+            }
+
+            while (detail::cron_is_space(*expr)) {
+                ++expr;
+            }
+
+            if ('@' == *expr) {
+                const char *end = expr;
+                while (*end && !detail::cron_is_space(*end)) {
+                    ++end;
+                }
+
+                std::string name(expr, end);
+                std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+                if ("@yearly" == name || "@annually" == name) {
+                    return parse("0 0 0 1 1 *");
+                } else if ("@monthly" == name) {
+                    return parse("0 0 0 1 * *");
+                } else if ("@weekly" == name) {
+                    return parse("0 0 0 * * 0");
+                } else if ("@daily" == name || "@midnight" == name) {
+                    return parse("0 0 0 * * *");
+                } else if ("@hourly" == name) {
+                    return parse("0 0 * * * *");
+                }
+
+                return error_type_t::EN_CRET_INVALID_VALUE;
+            }
+
+            const char *fields[7];
+            const char *field_ends[7];
+            int         field_count = 0;
+            while (*expr) {
+                if (field_count >= 6) {
+                    return error_type_t::EN_CRET_FIELD_COUNT;
+                }
+
+                fields[field_count] = expr;
+                while (*expr && !detail::cron_is_space(*expr)) {
+                    ++expr;
+                }
+                field_ends[field_count++] = expr;
+
+                while (detail::cron_is_space(*expr)) {
+                    ++expr;
+                }
+            }
+
+            if (5 != field_count && 6 != field_count) {
+                return error_type_t::EN_CRET_FIELD_COUNT;
+            }
+
+            static const detail::cron_field_desc_t descs[6] = {
+                {0, 59, NULL, 0, 0},                      // 秒
+                {0, 59, NULL, 0, 0},                      // 分
+                {0, 23, NULL, 0, 0},                      // 时
+                {1, 31, NULL, 0, 0},                      // 日
+                {1, 12, detail::cron_month_names, 12, 1}, // 月
+                {0, 7, detail::cron_week_names, 7, 0},    // 周
+            };
+
+            uint64_t masks[6];
+            bool     any[6];
+            int      desc_start = 6 - field_count;
+            masks[0]            = 1; // 5段时只在0秒触发
+            any[0]              = false;
+            for (int i = 0; i < field_count; ++i) {
+                if (!detail::cron_parse_field(fields[i], field_ends[i], descs[desc_start + i], masks[desc_start + i], any[desc_start + i])) {
+                    return error_type_t::EN_CRET_INVALID_VALUE;
+                }
+            }
+
+            // 周日可以是0或7
+            if (masks[5] & (static_cast<uint64_t>(1) << 7)) {
+                masks[5] = (masks[5] | 1) & detail::cron_all_week_days;
+            }
+
+            seconds_       = masks[0];
+            minutes_       = masks[1];
+            hours_         = static_cast<uint32_t>(masks[2]);
+            month_days_    = static_cast<uint32_t>(masks[3]);
+            months_        = static_cast<uint32_t>(masks[4]);
+            week_days_     = static_cast<uint32_t>(masks[5]);
+            any_month_day_ = any[3];
+            any_week_day_  = any[5];
+            return error_type_t::EN_CRET_SUCCESS;
+        }
+
+        LIBATFRAME_UTILS_API cron_rule cron_rule::daily(time_t offset) {
+            cron_rule ret;
+            offset %= time_utility::DAY_SECONDS;
+            if (offset < 0) {
+                offset += time_utility::DAY_SECONDS;
+            }
+
+            ret.seconds_       = static_cast<uint64_t>(1) << (offset % 60);
+            ret.minutes_       = static_cast<uint64_t>(1) << ((offset / 60) % 60);
+            ret.hours_         = static_cast<uint32_t>(1) << (offset / time_utility::HOUR_SECONDS);
+            ret.month_days_    = static_cast<uint32_t>(detail::cron_all_month_days);
+            ret.months_        = static_cast<uint32_t>(detail::cron_all_months);
+            ret.week_days_     = static_cast<uint32_t>(detail::cron_all_week_days);
+            ret.any_month_day_ = true;
+            ret.any_week_day_  = true;
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API cron_rule cron_rule::weekly(int week_day, time_t offset) {
+            cron_rule ret = daily(offset);
+            week_day %= 7;
+            if (week_day < 0) {
+                week_day += 7;
+            }
+
+            ret.week_days_    = static_cast<uint32_t>(1) << week_day;
+            ret.any_week_day_ = false;
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API cron_rule cron_rule::monthly(int month_day, time_t offset) {
+            if (month_day < 1 || month_day > 31) {
+                return cron_rule();
+            }
+
+            cron_rule ret      = daily(offset);
+            ret.month_days_    = static_cast<uint32_t>(1) << month_day;
+            ret.any_month_day_ = false;
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API bool cron_rule::match(time_t t, time_t zone_offset) const {
+            if (empty()) {
+                return false;
+            }
+
+            int64_t local = static_cast<int64_t>(t - zone_offset);
+            int64_t days  = detail::cron_floor_days(local);
+            int64_t sod   = local - days * time_utility::DAY_SECONDS;
+
+            int      year;
+            unsigned month;
+            unsigned day;
+            time_utility::civil_from_days(days, year, month, day);
+
+            return 0 != (months_ & (static_cast<uint32_t>(1) << month)) && match_day(days, day) &&
+                   0 != (hours_ & (static_cast<uint32_t>(1) << (sod / time_utility::HOUR_SECONDS))) &&
+                   0 != (minutes_ & (static_cast<uint64_t>(1) << ((sod / 60) % 60))) && 0 != (seconds_ & (static_cast<uint64_t>(1) << (sod % 60)));
+        }
+
+        LIBATFRAME_UTILS_API bool cron_rule::match(time_t t) const { return match(t, time_utility::get_zone_offset()); }
+
+        LIBATFRAME_UTILS_API time_t cron_rule::next(time_t after, time_t zone_offset) const {
+            if (empty()) {
+                return 0;
+            }
+
+            int64_t local    = static_cast<int64_t>(after - zone_offset) + 1;
+            int64_t days     = detail::cron_floor_days(local);
+            time_t  sod      = static_cast<time_t>(local - days * time_utility::DAY_SECONDS);
+            int64_t end_days = days + 146097; // 400年，一个完整的公历周期
+
+            while (days <= end_days) {
+                int      year;
+                unsigned month;
+                unsigned day;
+                time_utility::civil_from_days(days, year, month, day);
+
+                // 月份不满足时直接跳到下个月
+                if (0 == (months_ & (static_cast<uint32_t>(1) << month))) {
+                    days = 12 == month ? time_utility::days_from_civil(year + 1, 1, 1) : time_utility::days_from_civil(year, month + 1, 1);
+                    sod  = 0;
+                    continue;
+                }
+
+                time_t tod;
+                if (match_day(days, day) && find_in_day(sod, tod)) {
+                    return static_cast<time_t>(days * time_utility::DAY_SECONDS) + tod + zone_offset;
+                }
+
+                ++days;
+                sod = 0;
+            }
+
+            return 0;
+        }
+
+        LIBATFRAME_UTILS_API time_t cron_rule::next(time_t after) const { return next(after, time_utility::get_zone_offset()); }
+
+        bool cron_rule::match_day(int64_t days, unsigned month_day) const {
+            bool month_day_matched = 0 != (month_days_ & (static_cast<uint32_t>(1) << month_day));
+            bool week_day_matched  = 0 != (week_days_ & (static_cast<uint32_t>(1) << detail::cron_week_day(days)));
+
+            // 和Vixie cron一致，日和周都有限制时满足任意一个即可
+            if (any_month_day_) {
+                return week_day_matched;
+            }
+            if (any_week_day_) {
+                return month_day_matched;
+            }
+            return month_day_matched || week_day_matched;
+        }
+
+        bool cron_rule::find_in_day(time_t from, time_t &out) const {
+            int hour   = static_cast<int>(from / time_utility::HOUR_SECONDS);
+            int minute = static_cast<int>((from / 60) % 60);
+            int second = static_cast<int>(from % 60);
+
+            for (int h = detail::cron_next_bit(hours_, hour); h >= 0; h = detail::cron_next_bit(hours_, h + 1)) {
+                for (int m = detail::cron_next_bit(minutes_, h == hour ? minute : 0); m >= 0; m = detail::cron_next_bit(minutes_, m + 1)) {
+                    int s = detail::cron_next_bit(seconds_, (h == hour && m == minute) ? second : 0);
+                    if (s >= 0) {
+                        out = static_cast<time_t>(h * time_utility::HOUR_SECONDS + m * 60 + s);
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        LIBATFRAME_UTILS_API cron_scheduler::cron_scheduler() : id_alloc_(0), last_tick_(0), zone_offset_(time_utility::get_zone_offset()) {}
+
+        LIBATFRAME_UTILS_API cron_scheduler::~cron_scheduler() {}
+
+        LIBATFRAME_UTILS_API uint64_t cron_scheduler::add(const cron_rule &rule, const callback_fn_t &fn, time_t now) {
+            if (!fn || rule.empty()) {
+                return 0;
+            }
+
+            if (0 == now) {
+                now = time_utility::get_now();
+            }
+
+            time_t next_fire_time = rule.next(now, zone_offset_);
+            if (0 == next_fire_time) {
+                return 0;
+            }
+
+            uint64_t id          = ++id_alloc_;
+            entry_t &entry       = entries_[id];
+            entry.rule           = rule;
+            entry.fn             = fn;
+            entry.next_fire_time = next_fire_time;
+            push_heap(next_fire_time, id);
+            return id;
+        }
+
+        LIBATFRAME_UTILS_API uint64_t cron_scheduler::add(const char *expr, const callback_fn_t &fn, time_t now) {
+            cron_rule rule;
+            if (0 != rule.parse(expr)) {
+                return 0;
+            }
+
+            return add(rule, fn, now);
+        }
+
+        LIBATFRAME_UTILS_API bool cron_scheduler::remove(uint64_t id) {
+            if (0 == entries_.erase(id)) {
+                return false;
+            }
+
+            // 堆里积累太多无效节点时整理一次
+            if (heap_.size() > entries_.size() * 2 + 64) {
+                rebuild_heap();
+            } else {
+                pop_stale();
+            }
+            return true;
+        }
+
+        LIBATFRAME_UTILS_API void cron_scheduler::clear() {
+            entries_.clear();
+            heap_.clear();
+        }
+
+        LIBATFRAME_UTILS_API size_t cron_scheduler::tick(time_t now) {
+            if (0 == now) {
+                now = time_utility::get_now();
+            }
+
+            // 时间往回调整或者时区变化，重新计算所有日程
+            time_t zone_offset = time_utility::get_zone_offset();
+            if (now < last_tick_ || zone_offset != zone_offset_) {
+                zone_offset_ = zone_offset;
+                reset_all(now);
+            }
+            last_tick_ = now;
+
+            size_t ret = 0;
+            while (!heap_.empty() && heap_.front().next_fire_time <= now) {
+                heap_node_t node = heap_.front();
+                std::pop_heap(heap_.begin(), heap_.end(), heap_node_greater_t());
+                heap_.pop_back();
+
+                std::unordered_map<uint64_t, entry_t>::iterator iter = entries_.find(node.id);
+                if (iter == entries_.end() || iter->second.next_fire_time != node.next_fire_time) {
+                    continue;
+                }
+
+                // 先计算下一次触发时间，这样回调里可以查询、移除或者添加日程。错过的多次触发合并为一次
+                time_t next_fire_time       = iter->second.rule.next(now, zone_offset_);
+                iter->second.next_fire_time = next_fire_time;
+                if (0 != next_fire_time) {
+                    push_heap(next_fire_time, node.id);
+                }
+
+                // 回调里可能移除自己，复制一份
+                callback_fn_t fn = iter->second.fn;
+                fn(node.next_fire_time, node.id);
+                ++ret;
+
+                if (0 == next_fire_time) {
+                    entries_.erase(node.id);
+                }
+            }
+
+            pop_stale();
+            return ret;
+        }
+
+        LIBATFRAME_UTILS_API void cron_scheduler::reset(time_t now) {
+            if (0 == now) {
+                now = time_utility::get_now();
+            }
+
+            zone_offset_ = time_utility::get_zone_offset();
+            last_tick_   = now;
+            reset_all(now);
+        }
+
+        LIBATFRAME_UTILS_API time_t cron_scheduler::get_next_fire_time(uint64_t id) const {
+            std::unordered_map<uint64_t, entry_t>::const_iterator iter = entries_.find(id);
+            if (iter == entries_.end()) {
+                return 0;
+            }
+
+            return iter->second.next_fire_time;
+        }
+
+        LIBATFRAME_UTILS_API time_t cron_scheduler::get_next_fire_time() const {
+            if (heap_.empty()) {
+                return 0;
+            }
+
+            return heap_.front().next_fire_time;
+        }
+
+        void cron_scheduler::push_heap(time_t next_fire_time, uint64_t id) {
+            heap_node_t node;
+            node.next_fire_time = next_fire_time;
+            node.id             = id;
+            heap_.push_back(node);
+            std::push_heap(heap_.begin(), heap_.end(), heap_node_greater_t());
+        }
+
+        void cron_scheduler::pop_stale() {
+            while (!heap_.empty()) {
+                std::unordered_map<uint64_t, entry_t>::const_iterator iter = entries_.find(heap_.front().id);
+                if (iter != entries_.end() && iter->second.next_fire_time == heap_.front().next_fire_time) {
+                    break;
+                }
+
+                std::pop_heap(heap_.begin(), heap_.end(), heap_node_greater_t());
+                heap_.pop_back();
+            }
+        }
+
+        void cron_scheduler::rebuild_heap() {
+            heap_.clear();
+            heap_.reserve(entries_.size());
+            for (std::unordered_map<uint64_t, entry_t>::const_iterator iter = entries_.begin(); iter != entries_.end(); ++iter) {
+                heap_node_t node;
+                node.next_fire_time = iter->second.next_fire_time;
+                node.id             = iter->first;
+                heap_.push_back(node);
+            }
+            std::make_heap(heap_.begin(), heap_.end(), heap_node_greater_t());
+        }
+
+        void cron_scheduler::reset_all(time_t now) {
+            for (std::unordered_map<uint64_t, entry_t>::iterator iter = entries_.begin(); iter != entries_.end();) {
+                iter->second.next_fire_time = iter->second.rule.next(now, zone_offset_);
+                if (0 == iter->second.next_fire_time) {
+                    iter = entries_.erase(iter);
+                } else {
+                    ++iter;
+                }
+            }
+
+            rebuild_heap();
+        }
+    } // namespace time
+} // namespace util
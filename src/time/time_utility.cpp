@@ -1,63 +1,62 @@
 ﻿
+#include "time/clock_service.h"
 #include "time/time_utility.h"
 
 namespace util {
     namespace time {
-        LIBATFRAME_UTILS_API time_utility::raw_time_t time_utility::now_;
-        LIBATFRAME_UTILS_API time_t time_utility::now_unix_;
-        LIBATFRAME_UTILS_API time_t time_utility::now_usec_           = 0;
-        LIBATFRAME_UTILS_API time_t time_utility::custom_zone_offset_ = -time_utility::YEAR_SECONDS;
-        LIBATFRAME_UTILS_API std::chrono::system_clock::duration time_utility::global_now_offset_ =
-            std::chrono::system_clock::duration::zero();
+        namespace detail {
+            // 向下取整的天数，保证1970年以前的时间也正确
+            static inline int64_t time_utility_floor_days(int64_t t) {
+                int64_t ret = t / time_utility::DAY_SECONDS;
+                if (t % time_utility::DAY_SECONDS < 0) {
+                    --ret;
+                }
+                return ret;
+            }
 
-        time_utility::time_utility() {}
-        time_utility::~time_utility() {}
+            // 当前时区的日期
+            static inline int64_t time_utility_local_civil(time_t t, int &year, unsigned &month, unsigned &day) {
+                int64_t days = time_utility_floor_days(static_cast<int64_t>(t - time_utility::get_zone_offset()));
+                time_utility::civil_from_days(days, year, month, day);
+                return days;
+            }
 
-        LIBATFRAME_UTILS_API void time_utility::update(raw_time_t *t) {
-            // raw_time_t prev_tp = now_;
-            if (NULL != t) {
-                now_ = *t + global_now_offset_;
-            } else {
-                now_ = std::chrono::system_clock::now() + global_now_offset_;
+            // 只有日历是按当前时区计算的才能使用
+            static inline bool time_utility_load_calendar(clock_calendar_t &out) {
+                clock_service::global().load_calendar(out);
+                return 0 != out.day_end && out.zone_offset == time_utility::get_zone_offset();
             }
+        } // namespace detail
 
-            // reset unix timestamp
-            now_unix_ = std::chrono::system_clock::to_time_t(now_);
+        LIBATFRAME_UTILS_API time_t time_utility::custom_zone_offset_ = -time_utility::YEAR_SECONDS;
 
-            // reset usec
-            ::util::time::time_utility::raw_time_t padding_time = ::util::time::time_utility::raw_time_t::clock::from_time_t(now_unix_);
-            now_usec_                                           = static_cast<time_t>(
-                std::chrono::duration_cast<std::chrono::microseconds>(::util::time::time_utility::now() - padding_time).count());
-            if (now_usec_ < 0) {
-                now_usec_ = 0;
-            }
-            if (now_usec_ >= 1000000) {
-                now_usec_ = 999999;
-            }
-        }
+        time_utility::time_utility() {}
+        time_utility::~time_utility() {}
 
-        LIBATFRAME_UTILS_API time_utility::raw_time_t time_utility::now() { return now_; }
+        LIBATFRAME_UTILS_API void time_utility::update(raw_time_t *t) { clock_service::global().update(t); }
 
-        LIBATFRAME_UTILS_API time_t time_utility::get_now_usec() { return now_usec_; }
+        LIBATFRAME_UTILS_API time_utility::raw_time_t time_utility::now() { return clock_service::global().now(); }
 
-        LIBATFRAME_UTILS_API time_t time_utility::get_now() { return now_unix_; }
+        LIBATFRAME_UTILS_API time_t time_utility::get_now_usec() { return clock_service::global().get_now_usec(); }
 
-        LIBATFRAME_UTILS_API time_utility::raw_time_t time_utility::sys_now() { return now_ - global_now_offset_; }
+        LIBATFRAME_UTILS_API time_t time_utility::get_now() { return clock_service::global().get_now(); }
+
+        LIBATFRAME_UTILS_API time_utility::raw_time_t time_utility::sys_now() {
+            return clock_service::global().now() - clock_service::global().get_offset();
+        }
 
         LIBATFRAME_UTILS_API time_t time_utility::get_sys_now() { return std::chrono::system_clock::to_time_t(sys_now()); }
 
         LIBATFRAME_UTILS_API void time_utility::set_global_now_offset(const std::chrono::system_clock::duration &offset) {
-            raw_time_t old_now = now() - global_now_offset_;
-            global_now_offset_ = offset;
-            update(&old_now);
+            clock_service::global().set_offset(offset);
         }
 
-        LIBATFRAME_UTILS_API std::chrono::system_clock::duration time_utility::get_global_now_offset() { return global_now_offset_; }
+        LIBATFRAME_UTILS_API std::chrono::system_clock::duration time_utility::get_global_now_offset() {
+            return clock_service::global().get_offset();
+        }
 
         LIBATFRAME_UTILS_API void time_utility::reset_global_now_offset() {
-            raw_time_t old_now = now() - global_now_offset_;
-            global_now_offset_ = std::chrono::system_clock::duration::zero();
-            update(&old_now);
+            clock_service::global().set_offset(std::chrono::system_clock::duration::zero());
         }
 
         // ====================== 后面的函数都和时区相关 ======================
@@ -85,7 +84,10 @@ namespace util {
             return custom_zone_offset_;
         }
 
-        LIBATFRAME_UTILS_API void time_utility::set_zone_offset(time_t t) { custom_zone_offset_ = t; }
+        LIBATFRAME_UTILS_API void time_utility::set_zone_offset(time_t t) {
+            custom_zone_offset_ = t;
+            clock_service::global().refresh();
+        }
 
         LIBATFRAME_UTILS_API time_t time_utility::get_today_now_offset() {
             time_t curr_time = get_now();
@@ -140,8 +142,25 @@ namespace util {
         }
 
         LIBATFRAME_UTILS_API time_utility::raw_time_desc_t time_utility::get_gmt_tm(time_t t) {
+            // 纯整数计算，比gmtime快并且不会访问时区数据
+            int64_t days = detail::time_utility_floor_days(static_cast<int64_t>(t));
+            int64_t secs = static_cast<int64_t>(t) - days * DAY_SECONDS;
+
+            int      year;
+            unsigned month;
+            unsigned day;
+            civil_from_days(days, year, month, day);
+
             struct tm ttm;
-            UTIL_STRFUNC_GMTIME_S(&t, &ttm);
+            memset(&ttm, 0, sizeof(ttm));
+            ttm.tm_sec  = static_cast<int>(secs % 60);
+            ttm.tm_min  = static_cast<int>((secs / 60) % 60);
+            ttm.tm_hour = static_cast<int>(secs / HOUR_SECONDS);
+            ttm.tm_mday = static_cast<int>(day);
+            ttm.tm_mon  = static_cast<int>(month) - 1;
+            ttm.tm_year = year - 1900;
+            ttm.tm_wday = static_cast<int>(((days + 4) % 7 + 7) % 7); // 1970年1月1日是周四
+            ttm.tm_yday = static_cast<int>(days - days_from_civil(year, 1, 1));
             return ttm;
         }
 
@@ -153,28 +172,85 @@ namespace util {
             return year % 100 != 0 || (year % 400 == 0 && year % 3200 != 0) || year % 172800 == 0;
         }
 
+        // http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+        LIBATFRAME_UTILS_API int64_t time_utility::days_from_civil(int year, unsigned month, unsigned day) {
+            int64_t  y   = static_cast<int64_t>(year) - (month <= 2 ? 1 : 0);
+            int64_t  era = (y >= 0 ? y : y - 399) / 400;
+            unsigned yoe = static_cast<unsigned>(y - era * 400);                                 // [0, 399]
+            unsigned doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;        // [0, 365]
+            unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;                                // [0, 146096]
+            return era * 146097 + static_cast<int64_t>(doe) - 719468;
+        }
+
+        // http://howardhinnant.github.io/date_algorithms.html#civil_from_days
+        LIBATFRAME_UTILS_API void time_utility::civil_from_days(int64_t days, int &year, unsigned &month, unsigned &day) {
+            days += 719468;
+            int64_t  era = (days >= 0 ? days : days - 146096) / 146097;
+            unsigned doe = static_cast<unsigned>(days - era * 146097);                  // [0, 146096]
+            unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;       // [0, 399]
+            unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);                     // [0, 365]
+            unsigned mp  = (5 * doy + 2) / 153;                                         // [0, 11]
+            day          = doy - (153 * mp + 2) / 5 + 1;                                // [1, 31]
+            month        = mp < 10 ? mp + 3 : mp - 9;                                   // [1, 12]
+            year         = static_cast<int>(static_cast<int64_t>(yoe) + era * 400 + (month <= 2 ? 1 : 0));
+        }
+
         LIBATFRAME_UTILS_API bool time_utility::is_same_year(time_t left, time_t right) {
-            std::tm left_tm  = get_local_tm(left);
-            std::tm right_tm = get_local_tm(right);
+            clock_calendar_t cal;
+            if (detail::time_utility_load_calendar(cal)) {
+                bool left_in  = left >= cal.year_start && left < cal.year_end;
+                bool right_in = right >= cal.year_start && right < cal.year_end;
+                if (left_in || right_in) {
+                    return left_in == right_in;
+                }
+            }
 
-            return left_tm.tm_year == right_tm.tm_year;
+            int      left_year, right_year;
+            unsigned month, day;
+            detail::time_utility_local_civil(left, left_year, month, day);
+            detail::time_utility_local_civil(right, right_year, month, day);
+            return left_year == right_year;
         }
 
         LIBATFRAME_UTILS_API int time_utility::get_year_day(time_t t) {
-            std::tm ttm = get_local_tm(t);
-            return ttm.tm_yday;
+            clock_calendar_t cal;
+            if (detail::time_utility_load_calendar(cal) && t >= cal.year_start && t < cal.year_end) {
+                return static_cast<int>((t - cal.year_start) / DAY_SECONDS);
+            }
+
+            int      year;
+            unsigned month, day;
+            int64_t  days = detail::time_utility_local_civil(t, year, month, day);
+            return static_cast<int>(days - days_from_civil(year, 1, 1));
         }
 
         LIBATFRAME_UTILS_API bool time_utility::is_same_month(time_t left, time_t right) {
-            std::tm left_tm  = get_local_tm(left);
-            std::tm right_tm = get_local_tm(right);
+            clock_calendar_t cal;
+            if (detail::time_utility_load_calendar(cal)) {
+                bool left_in  = left >= cal.month_start && left < cal.month_end;
+                bool right_in = right >= cal.month_start && right < cal.month_end;
+                if (left_in || right_in) {
+                    return left_in == right_in;
+                }
+            }
 
-            return left_tm.tm_year == right_tm.tm_year && left_tm.tm_mon == right_tm.tm_mon;
+            int      left_year, right_year;
+            unsigned left_month, right_month, day;
+            detail::time_utility_local_civil(left, left_year, left_month, day);
+            detail::time_utility_local_civil(right, right_year, right_month, day);
+            return left_year == right_year && left_month == right_month;
         }
 
         LIBATFRAME_UTILS_API int time_utility::get_month_day(time_t t) {
-            std::tm ttm = get_local_tm(t);
-            return ttm.tm_mday;
+            clock_calendar_t cal;
+            if (detail::time_utility_load_calendar(cal) && t >= cal.month_start && t < cal.month_end) {
+                return static_cast<int>((t - cal.month_start) / DAY_SECONDS) + 1;
+            }
+
+            int      year;
+            unsigned month, day;
+            detail::time_utility_local_civil(t, year, month, day);
+            return static_cast<int>(day);
         }
 
         LIBATFRAME_UTILS_API bool time_utility::is_same_week(time_t left, time_t right, time_t week_first) {
@@ -204,7 +280,11 @@ namespace util {
 
         LIBATFRAME_UTILS_API time_t time_utility::get_day_start_time(time_t t) {
             if (0 == t) {
+                clock_calendar_t cal;
                 t = get_now();
+                if (detail::time_utility_load_calendar(cal) && t >= cal.day_start && t < cal.day_end) {
+                    return cal.day_start;
+                }
             }
 
             return get_any_day_offset(t, 0);
@@ -231,15 +311,15 @@ namespace util {
                 t = get_now();
             }
 
-            // Maybe we have change the default offset
-            time_t local_offset = get_zone_offset() - get_sys_zone_offset();
+            clock_calendar_t cal;
+            if (detail::time_utility_load_calendar(cal) && t >= cal.month_start && t < cal.month_end) {
+                return cal.month_start;
+            }
 
-            std::tm ttm = get_local_tm(t - local_offset);
-            ttm.tm_sec  = 0;
-            ttm.tm_min  = 0;
-            ttm.tm_hour = 0;
-            ttm.tm_mday = 1;
-            return mktime(&ttm) + local_offset;
+            int      year;
+            unsigned month, day;
+            int64_t  days = detail::time_utility_local_civil(t, year, month, day);
+            return static_cast<time_t>((days - static_cast<int64_t>(day - 1)) * DAY_SECONDS) + get_zone_offset();
         }
     } // namespace time
 } // namespace util
@@ -3,9 +3,13 @@
 #include <ctime>
 #include <sstream>
 #include <fstream>
+#include <thread>
+#include <vector>
 
 #include "frame/test_macros.h"
 #include "string/ac_automation.h"
+#include "string/ac_automation_batch.h"
+#include "string/ac_automation_generation.h"
 #include "common/file_system.h"
 
 #if defined(_MSC_VER) && _MSC_VER >= 1900
@@ -234,3 +238,447 @@ CASE_TEST(ac_automation, load_and_dump) {
     actree.dump(fos);
     actree.dump_dot(fdot, NULL, node_options, edge_options);
 }
+
+CASE_TEST(ac_automation, compiled_basic) {
+    util::string::ac_automation<> actree;
+
+    actree.insert_keyword("acd");
+    actree.insert_keyword("aceb");
+    actree.insert_keyword("bef");
+    actree.insert_keyword("cef");
+    actree.insert_keyword("ef");
+
+    util::string::ac_automation_compiled::ptr_t compiled = actree.compile();
+    CASE_EXPECT_TRUE(!!compiled);
+    if (!compiled) {
+        return;
+    }
+    CASE_EXPECT_EQ(5, compiled->keyword_size());
+
+    std::string                                      input = "acefcabefefefcevfefbc";
+    util::string::ac_automation<>::value_type        res   = actree.match(input);
+    util::string::ac_automation_compiled::value_type cres  = compiled->match(input);
+
+    CASE_EXPECT_EQ(res.size(), cres.size());
+    for (size_t i = 0; i < res.size() && i < cres.size(); ++i) {
+        CASE_EXPECT_EQ(res[i].start, cres[i].start);
+        CASE_EXPECT_EQ(res[i].length, cres[i].length);
+        CASE_EXPECT_EQ(*res[i].keyword, compiled->get_keyword(cres[i].keyword_index));
+    }
+
+    CASE_EXPECT_TRUE(compiled->contains(input.c_str(), input.size()));
+    CASE_EXPECT_FALSE(compiled->contains("lolololnmmnmuiyt", strlen("lolololnmmnmuiyt")));
+    CASE_EXPECT_EQ(0, compiled->match("").size());
+}
+
+CASE_TEST(ac_automation, compiled_skip_and_nocase) {
+    util::string::ac_automation<> actree;
+
+    actree.set_nocase(true);
+    actree.insert_keyword("Acd");
+    actree.insert_keyword("aceb");
+    actree.insert_keyword("bef");
+    actree.insert_keyword("cef");
+    actree.insert_keyword("EF");
+    actree.set_skip(' ');
+
+    util::string::ac_automation_compiled::ptr_t compiled = actree.compile();
+    CASE_EXPECT_TRUE(!!compiled);
+    if (!compiled) {
+        return;
+    }
+    CASE_EXPECT_TRUE(compiled->is_nocase());
+
+    util::string::ac_automation_compiled::value_type cres = compiled->match("AC  efca   B   e f efefcevfefbc");
+    CASE_EXPECT_EQ(5, cres.size());
+    if (cres.size() >= 2) {
+        CASE_EXPECT_EQ(1, cres[0].start);
+        CASE_EXPECT_EQ(5, cres[0].length);
+        CASE_EXPECT_EQ("cef", compiled->get_keyword(cres[0].keyword_index));
+
+        CASE_EXPECT_EQ(11, cres[1].start);
+        CASE_EXPECT_EQ(7, cres[1].length);
+        CASE_EXPECT_EQ("bef", compiled->get_keyword(cres[1].keyword_index));
+    }
+
+    // the trie walker reports only the path leaf, the compiled automaton reports a keyword as soon as it ends
+    util::string::ac_automation<> suffix_tree;
+    suffix_tree.insert_keyword("abcd");
+    suffix_tree.insert_keyword("bc");
+    compiled = suffix_tree.compile();
+    cres     = compiled->match("xabce");
+    CASE_EXPECT_EQ(1, cres.size());
+    if (!cres.empty()) {
+        CASE_EXPECT_EQ(2, cres[0].start);
+        CASE_EXPECT_EQ(2, cres[0].length);
+    }
+}
+
+CASE_TEST(ac_automation, compiled_utf8) {
+    util::string::ac_automation<util::string::utf8_char_t> actree;
+
+    actree.insert_keyword(U8_LITERALS("艹"));
+    actree.insert_keyword(U8_LITERALS("操你妈逼"));
+    actree.insert_keyword(U8_LITERALS("你妈逼"));
+    actree.insert_keyword(U8_LITERALS("艹你妈"));
+    actree.set_skip(' ');
+    actree.set_skip('\t');
+    actree.set_skip('\r');
+    actree.set_skip('\n');
+    actree.set_skip(util::string::utf8_char_t(U8_LITERALS("，")));
+
+    util::string::ac_automation_compiled::ptr_t compiled = actree.compile();
+    CASE_EXPECT_TRUE(!!compiled);
+    if (!compiled) {
+        return;
+    }
+    CASE_EXPECT_TRUE(compiled->is_utf8());
+
+    std::string input = U8_LITERALS("小册老艹，我干死你操  你妈操 ，你妈\r\n逼艹 你妈");
+    util::string::ac_automation<util::string::utf8_char_t>::value_type res  = actree.match(input);
+    util::string::ac_automation_compiled::value_type                   cres = compiled->match(input);
+
+    CASE_EXPECT_EQ(3, cres.size());
+    CASE_EXPECT_EQ(res.size(), cres.size());
+    for (size_t i = 0; i < res.size() && i < cres.size(); ++i) {
+        CASE_EXPECT_EQ(res[i].start, cres[i].start);
+        CASE_EXPECT_EQ(res[i].length, cres[i].length);
+        CASE_EXPECT_EQ(*res[i].keyword, compiled->get_keyword(cres[i].keyword_index));
+    }
+}
+
+CASE_TEST(ac_automation, compiled_random) {
+    util::string::ac_automation<> actree;
+    actree.set_skip(' ');
+
+    // 随机生成关键字和目标串，关键字较少命中，模拟聊天过滤
+    uint32_t seed = 2016;
+    for (int i = 0; i < 2000; ++i) {
+        std::string keyword;
+        size_t      len = 3 + (seed % 6);
+        for (size_t j = 0; j < len; ++j) {
+            seed = seed * 1103515245 + 12345;
+            keyword.push_back(static_cast<char>('a' + ((seed >> 16) % 26)));
+        }
+        actree.insert_keyword(keyword);
+    }
+
+    std::vector<std::string> contents;
+    for (int i = 0; i < 200; ++i) {
+        std::string content;
+        for (int j = 0; j < 128; ++j) {
+            seed = seed * 1103515245 + 12345;
+            content.push_back(0 == (seed >> 16) % 7 ? ' ' : static_cast<char>('a' + ((seed >> 16) % 26)));
+        }
+        contents.push_back(content);
+    }
+
+    util::string::ac_automation_compiled::ptr_t compiled = actree.compile();
+    CASE_EXPECT_TRUE(!!compiled);
+    if (!compiled) {
+        return;
+    }
+
+    // 每个命中的位置去掉可跳过字符后都应该等于对应的关键字
+    size_t                                           compiled_count = 0;
+    util::string::ac_automation_compiled::value_type cres;
+    for (size_t i = 0; i < contents.size(); ++i) {
+        cres.clear();
+        compiled_count += compiled->match(contents[i].c_str(), contents[i].size(), cres);
+        CASE_EXPECT_EQ(!cres.empty(), compiled->contains(contents[i].c_str(), contents[i].size()));
+
+        for (size_t j = 0; j < cres.size(); ++j) {
+            std::string hit = contents[i].substr(cres[j].start, cres[j].length);
+            hit.erase(std::remove(hit.begin(), hit.end(), ' '), hit.end());
+            CASE_EXPECT_EQ(compiled->get_keyword(cres[j].keyword_index), hit);
+        }
+    }
+    CASE_EXPECT_GT(compiled_count, 0);
+}
+
+CASE_TEST(ac_automation, compiled_image) {
+    util::string::ac_automation<util::string::utf8_char_t> actree;
+
+    actree.insert_keyword(U8_LITERALS("艹"));
+    actree.insert_keyword(U8_LITERALS("操你妈逼"));
+    actree.insert_keyword(U8_LITERALS("你妈逼"));
+    actree.insert_keyword(U8_LITERALS("艹你妈"));
+    actree.set_skip(' ');
+    actree.set_skip(util::string::utf8_char_t(U8_LITERALS("，")));
+
+    util::string::ac_automation_compiled::ptr_t compiled = actree.compile();
+    CASE_EXPECT_TRUE(!!compiled);
+    if (!compiled) {
+        return;
+    }
+
+    std::string input = U8_LITERALS("小册老艹，我干死你操 ，你妈逼艹 你妈");
+    util::string::ac_automation_compiled::value_type expect = compiled->match(input);
+    CASE_EXPECT_EQ(3, expect.size());
+
+    std::string image;
+    compiled->dump_image(image);
+    CASE_EXPECT_EQ(compiled->image_size(), image.size());
+
+    // 复制加载
+    util::string::ac_automation_compiled::ptr_t loaded = util::string::ac_automation_compiled::load_image(image.data(), image.size(), true, true);
+    CASE_EXPECT_TRUE(!!loaded);
+    if (loaded) {
+        CASE_EXPECT_TRUE(loaded->is_utf8());
+        CASE_EXPECT_FALSE(loaded->is_mapped());
+        CASE_EXPECT_EQ(compiled->keyword_size(), loaded->keyword_size());
+
+        util::string::ac_automation_compiled::value_type res = loaded->match(input);
+        CASE_EXPECT_EQ(expect.size(), res.size());
+        for (size_t i = 0; i < expect.size() && i < res.size(); ++i) {
+            CASE_EXPECT_EQ(expect[i].start, res[i].start);
+            CASE_EXPECT_EQ(expect[i].length, res[i].length);
+            CASE_EXPECT_EQ(compiled->get_keyword(expect[i].keyword_index), loaded->get_keyword(res[i].keyword_index));
+        }
+    }
+
+    // 校验失败
+    std::string broken = image;
+    broken[broken.size() / 2] = static_cast<char>(broken[broken.size() / 2] ^ 0x5A);
+    CASE_EXPECT_FALSE(!!util::string::ac_automation_compiled::load_image(broken.data(), broken.size(), true, true));
+    broken    = image;
+    broken[0] = 'X';
+    CASE_EXPECT_FALSE(!!util::string::ac_automation_compiled::load_image(broken.data(), broken.size(), true, false));
+    CASE_EXPECT_FALSE(!!util::string::ac_automation_compiled::load_image(image.data(), image.size() / 2, true, false));
+
+    // mmap加载
+    const char *file_path = "ac_automation.compiled.bin";
+    CASE_EXPECT_TRUE(compiled->save_image(file_path));
+    loaded = util::string::ac_automation_compiled::mmap_image(file_path, true);
+    CASE_EXPECT_TRUE(!!loaded);
+    if (loaded) {
+        util::string::ac_automation_compiled::value_type res = loaded->match(input);
+        CASE_EXPECT_EQ(expect.size(), res.size());
+        for (size_t i = 0; i < expect.size() && i < res.size(); ++i) {
+            CASE_EXPECT_EQ(expect[i].start, res[i].start);
+            CASE_EXPECT_EQ(expect[i].length, res[i].length);
+        }
+        loaded.reset();
+    }
+    util::file_system::remove(file_path);
+}
+
+static bool ac_automation_compiled_same_result(const util::string::ac_automation_compiled::value_type &l,
+                                               const util::string::ac_automation_compiled::value_type &r) {
+    if (l.size() != r.size()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < l.size(); ++i) {
+        if (l[i].start != r[i].start || l[i].length != r[i].length || l[i].keyword_index != r[i].keyword_index) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+CASE_TEST(ac_automation, compiled_prefilter) {
+    // 英文关键字 + 大部分是中文的聊天内容，前置过滤可以跳过大部分位置
+    std::vector<std::string> keywords;
+    uint32_t                 seed = 2017;
+    for (int i = 0; i < 5000; ++i) {
+        std::string keyword;
+        size_t      len = 1 + (seed % 8);
+        for (size_t j = 0; j < len; ++j) {
+            seed = seed * 1103515245 + 12345;
+            keyword.push_back(static_cast<char>('a' + ((seed >> 16) % 26)));
+        }
+        keywords.push_back(keyword);
+    }
+    keywords.push_back(U8_LITERALS("你妈逼"));
+
+    const char *cjk[] = {U8_LITERALS("你"), U8_LITERALS("好"), U8_LITERALS("我"), U8_LITERALS("们"), U8_LITERALS("妈"), U8_LITERALS("逼")};
+    std::vector<std::string> contents;
+    for (int i = 0; i < 2000; ++i) {
+        std::string content;
+        for (int j = 0; j < 64; ++j) {
+            seed = seed * 1103515245 + 12345;
+            if (0 == (seed >> 16) % 13) {
+                content.push_back(static_cast<char>('a' + ((seed >> 8) % 26)));
+            } else {
+                content += cjk[(seed >> 16) % (sizeof(cjk) / sizeof(cjk[0]))];
+            }
+        }
+        contents.push_back(content);
+    }
+
+    util::string::ac_automation_compiled::option_t opts;
+    util::string::ac_automation_compiled::ptr_t    with_prefilter = util::string::ac_automation_compiled::create(keywords, opts);
+    opts.prefilter                                                = false;
+    util::string::ac_automation_compiled::ptr_t without_prefilter = util::string::ac_automation_compiled::create(keywords, opts);
+    CASE_EXPECT_TRUE(!!with_prefilter);
+    CASE_EXPECT_TRUE(!!without_prefilter);
+    if (!with_prefilter || !without_prefilter) {
+        return;
+    }
+
+    util::string::ac_automation_compiled::value_type l, r;
+    for (size_t i = 0; i < contents.size(); ++i) {
+        l.clear();
+        r.clear();
+        with_prefilter->match(contents[i].c_str(), contents[i].size(), l);
+        without_prefilter->match(contents[i].c_str(), contents[i].size(), r);
+        CASE_EXPECT_TRUE(ac_automation_compiled_same_result(l, r));
+        CASE_EXPECT_EQ(with_prefilter->contains(contents[i].c_str(), contents[i].size()), !r.empty());
+    }
+
+    // 带可跳过字符时只使用起始字节过滤
+    opts.skip_chars.push_back(" ");
+    opts.prefilter                                                   = true;
+    util::string::ac_automation_compiled::ptr_t skip_with_prefilter = util::string::ac_automation_compiled::create(keywords, opts);
+    opts.prefilter                                                   = false;
+    util::string::ac_automation_compiled::ptr_t skip_without_prefilter = util::string::ac_automation_compiled::create(keywords, opts);
+    if (skip_with_prefilter && skip_without_prefilter) {
+        for (size_t i = 0; i < contents.size(); ++i) {
+            std::string content = contents[i];
+            std::replace(content.begin(), content.end(), 'q', ' ');
+            l.clear();
+            r.clear();
+            skip_with_prefilter->match(content.c_str(), content.size(), l);
+            skip_without_prefilter->match(content.c_str(), content.size(), r);
+            CASE_EXPECT_TRUE(ac_automation_compiled_same_result(l, r));
+        }
+    }
+}
+
+CASE_TEST(ac_automation, compiled_batch) {
+    util::string::ac_automation<> actree;
+    actree.insert_keyword("abc");
+    actree.insert_keyword("bcd");
+    actree.insert_keyword("xyz");
+    actree.insert_keyword("zz");
+    actree.set_skip(' ');
+
+    util::string::ac_automation_compiled::ptr_t compiled = actree.compile();
+    CASE_EXPECT_TRUE(!!compiled);
+    if (!compiled) {
+        return;
+    }
+
+    std::vector<std::string> contents;
+    uint32_t                 seed = 2018;
+    for (int i = 0; i < 1000; ++i) {
+        std::string content;
+        size_t      len = (seed >> 16) % 200;
+        for (size_t j = 0; j < len; ++j) {
+            seed = seed * 1103515245 + 12345;
+            content.push_back("abcdxyz "[(seed >> 16) % 8]);
+        }
+        contents.push_back(content);
+    }
+
+    util::string::ac_automation_batch_matcher         matcher(4, 16);
+    util::string::ac_automation_batch_matcher::result_t res;
+    CASE_EXPECT_EQ(4, matcher.thread_count());
+
+    // 多次执行，检查缓冲区复用
+    for (int loop = 0; loop < 3; ++loop) {
+        size_t total = matcher.match(*compiled, contents, res);
+        CASE_EXPECT_EQ(total, res.matches.size());
+        CASE_EXPECT_EQ(contents.size() + 1, res.offsets.size());
+
+        util::string::ac_automation_compiled::value_type expect;
+        for (size_t i = 0; i < contents.size(); ++i) {
+            expect.clear();
+            compiled->match(contents[i].c_str(), contents[i].size(), expect);
+
+            util::string::ac_automation_compiled::value_type real(res.matches.begin() + static_cast<ptrdiff_t>(res.offsets[i]),
+                                                                  res.matches.begin() + static_cast<ptrdiff_t>(res.offsets[i + 1]));
+            CASE_EXPECT_TRUE(ac_automation_compiled_same_result(expect, real));
+        }
+    }
+
+    std::vector<std::string> empty_contents;
+    CASE_EXPECT_EQ(0, matcher.match(*compiled, empty_contents, res));
+    CASE_EXPECT_EQ(1, res.offsets.size());
+}
+
+CASE_TEST(ac_automation, compiled_generation) {
+    util::string::ac_automation_compiled::option_t    opts;
+    util::string::ac_automation_generation_manager mgr(opts);
+
+    CASE_EXPECT_TRUE(!mgr.get());
+    CASE_EXPECT_TRUE(mgr.add_keyword("abc"));
+    CASE_EXPECT_FALSE(mgr.add_keyword("abc"));
+    CASE_EXPECT_TRUE(mgr.add_keyword("xyz"));
+    CASE_EXPECT_TRUE(mgr.get_stats().dirty);
+    CASE_EXPECT_TRUE(mgr.build());
+
+    util::string::ac_automation_generation_manager::generation_ptr_t gen1 = mgr.get();
+    CASE_EXPECT_TRUE(!!gen1);
+    if (!gen1) {
+        return;
+    }
+    CASE_EXPECT_EQ(1, gen1->id);
+    CASE_EXPECT_EQ(2, gen1->keyword_count);
+    CASE_EXPECT_EQ(2, gen1->automation->match("abc_xyz_bcd").size());
+
+    // 没有变化时不重新编译
+    CASE_EXPECT_TRUE(mgr.build());
+    CASE_EXPECT_EQ(1, mgr.get()->id);
+
+    std::vector<std::string> add_keywords, remove_keywords;
+    add_keywords.push_back("bcd");
+    remove_keywords.push_back("abc");
+    remove_keywords.push_back("not_exists");
+    CASE_EXPECT_EQ(2, mgr.update_keywords(add_keywords, remove_keywords));
+
+    // 后台编译期间旧版本仍然可用
+    mgr.build_async();
+    CASE_EXPECT_EQ(2, gen1->automation->match("abc_xyz_bcd").size());
+    mgr.wait_async();
+
+    util::string::ac_automation_generation_manager::generation_ptr_t gen2 = mgr.get();
+    CASE_EXPECT_TRUE(!!gen2);
+    if (!gen2) {
+        return;
+    }
+    CASE_EXPECT_EQ(2, gen2->id);
+    util::string::ac_automation_compiled::value_type res = gen2->automation->match("abc_xyz_bcd");
+    CASE_EXPECT_EQ(2, res.size());
+    if (2 == res.size()) {
+        CASE_EXPECT_EQ("xyz", gen2->automation->get_keyword(res[0].keyword_index));
+        CASE_EXPECT_EQ("bcd", gen2->automation->get_keyword(res[1].keyword_index));
+    }
+
+    // 读取线程在更新过程中持续匹配
+    std::thread reader([&mgr]() {
+        for (int i = 0; i < 2000; ++i) {
+            util::string::ac_automation_generation_manager::generation_ptr_t gen = mgr.get();
+            if (gen) {
+                gen->automation->contains("abc_xyz_bcd", 11);
+            }
+        }
+    });
+    for (int i = 0; i < 20; ++i) {
+        mgr.add_keyword(std::string("kw") + static_cast<char>('a' + i));
+        mgr.build_async();
+    }
+    reader.join();
+    mgr.wait_async();
+
+    util::string::ac_automation_generation_manager::stats_t stats = mgr.get_stats();
+    CASE_EXPECT_FALSE(stats.dirty);
+    CASE_EXPECT_EQ(22, stats.keyword_count);
+    CASE_EXPECT_EQ(22, stats.pending_keywords);
+    CASE_EXPECT_EQ(stats.generation, stats.build_count);
+    CASE_EXPECT_GT(stats.memory_usage, 0);
+    util::string::ac_automation_generation_manager::generation_ptr_t current = mgr.get();
+    CASE_EXPECT_EQ(current->automation->memory_usage() + sizeof(util::string::ac_automation_generation_manager::generation_t), current->memory_usage);
+    CASE_EXPECT_EQ(current->memory_usage, stats.memory_usage);
+    CASE_EXPECT_GE(stats.total_build_time_us, stats.max_build_time_us);
+    CASE_MSG_INFO() << "generation " << stats.generation << ", " << stats.keyword_count << " keywords, " << stats.memory_usage
+                    << " bytes, total build time " << stats.total_build_time_us << "us" << std::endl;
+
+    std::vector<std::string> empty_keywords;
+    mgr.reset_keywords(empty_keywords);
+    CASE_EXPECT_TRUE(mgr.build());
+    CASE_EXPECT_EQ(0, mgr.get()->keyword_count);
+    CASE_EXPECT_FALSE(mgr.get()->automation->contains("abc_xyz_bcd", 11));
+}
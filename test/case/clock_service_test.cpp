@@ -0,0 +1,208 @@
+﻿#include <cstring>
+#include <ctime>
+#include <vector>
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+#include <thread>
+#endif
+
+#include "frame/test_macros.h"
+#include "time/clock_service.h"
+#include "time/time_utility.h"
+
+CASE_TEST(clock_service, snapshot) {
+    util::time::clock_service clock;
+
+    // 2020-02-29 12:34:56.789 UTC
+    util::time::clock_service::raw_time_t t =
+        std::chrono::system_clock::from_time_t(1582979696) + std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::milliseconds(789));
+    clock.update(&t);
+
+    util::time::clock_snapshot_t snapshot;
+    clock.load(snapshot);
+    CASE_EXPECT_TRUE(t == snapshot.system_time);
+    CASE_EXPECT_EQ(1582979696, snapshot.unix_seconds);
+    CASE_EXPECT_EQ(789000, snapshot.usec);
+    CASE_EXPECT_EQ(120, snapshot.gmt_tm.tm_year);
+    CASE_EXPECT_EQ(1, snapshot.gmt_tm.tm_mon);
+    CASE_EXPECT_EQ(29, snapshot.gmt_tm.tm_mday);
+    CASE_EXPECT_EQ(12, snapshot.gmt_tm.tm_hour);
+    CASE_EXPECT_EQ(34, snapshot.gmt_tm.tm_min);
+    CASE_EXPECT_EQ(56, snapshot.gmt_tm.tm_sec);
+    CASE_EXPECT_EQ(util::time::time_utility::get_local_tm(1582979696).tm_hour, snapshot.local_tm.tm_hour);
+    CASE_EXPECT_EQ(util::time::time_utility::get_any_day_offset(1582979696, 0), snapshot.calendar.day_start);
+    CASE_EXPECT_EQ(snapshot.calendar.day_start, clock.get_day_start());
+    CASE_EXPECT_GT(snapshot.monotonic_ns, 0);
+
+    CASE_EXPECT_EQ(1582979696, clock.get_now());
+    CASE_EXPECT_EQ(789000, clock.get_now_usec());
+    CASE_EXPECT_EQ(snapshot.monotonic_ns, clock.get_monotonic_ns());
+
+    // 全局偏移保持真实时间不变
+    clock.set_offset(std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::seconds(3600)));
+    CASE_EXPECT_EQ(1582979696 + 3600, clock.get_now());
+    CASE_EXPECT_EQ(789000, clock.get_now_usec());
+    clock.load(snapshot);
+    CASE_EXPECT_EQ(13, snapshot.gmt_tm.tm_hour);
+    clock.update(&t);
+    CASE_EXPECT_EQ(1582979696 + 3600, clock.get_now());
+    clock.set_offset(std::chrono::system_clock::duration::zero());
+    CASE_EXPECT_EQ(1582979696, clock.get_now());
+
+    // 读取系统时间
+    clock.update();
+    time_t now = time(NULL);
+    CASE_EXPECT_LE(now - 1, clock.get_now());
+    CASE_EXPECT_GE(now + 1, clock.get_now());
+}
+
+CASE_TEST(clock_service, calendar) {
+    util::time::clock_service clock;
+    time_t                    zone_offset = util::time::time_utility::get_zone_offset();
+
+    // 2020-02-29 12:34:56 UTC，闰年的2月
+    util::time::clock_service::raw_time_t t = std::chrono::system_clock::from_time_t(1582979696);
+    clock.update(&t);
+    util::time::clock_calendar_t cal;
+    clock.load_calendar(cal);
+
+    util::time::time_utility::raw_time_desc_t local_tm = util::time::time_utility::get_local_tm(1582979696);
+    CASE_EXPECT_EQ(zone_offset, cal.zone_offset);
+    CASE_EXPECT_EQ(local_tm.tm_year + 1900, cal.year);
+    CASE_EXPECT_EQ(local_tm.tm_mon + 1, cal.month);
+    CASE_EXPECT_EQ(local_tm.tm_mday, cal.month_day);
+    CASE_EXPECT_EQ(local_tm.tm_yday, cal.year_day);
+    CASE_EXPECT_EQ(local_tm.tm_wday, cal.week_day);
+    CASE_EXPECT_EQ(cal.day_start + util::time::time_utility::DAY_SECONDS, cal.day_end);
+    CASE_EXPECT_EQ(util::time::time_utility::get_day_start_time(1582979696), cal.day_start);
+    CASE_EXPECT_EQ(util::time::time_utility::get_week_start_time(1582979696), cal.week_start);
+    CASE_EXPECT_EQ(util::time::time_utility::get_month_start_time(1582979696), cal.month_start);
+    CASE_EXPECT_EQ(util::time::time_utility::get_month_start_time(cal.month_end), cal.month_end);
+    CASE_EXPECT_EQ(util::time::time_utility::get_month_start_time(cal.month_end - 1), cal.month_start);
+    CASE_EXPECT_EQ(365 + 1, (cal.year_end - cal.year_start) / util::time::time_utility::DAY_SECONDS);
+    CASE_EXPECT_EQ(cal.year_day, (cal.day_start - cal.year_start) / util::time::time_utility::DAY_SECONDS);
+
+    // 同一天内不重新计算，跨天后重新计算
+    t = std::chrono::system_clock::from_time_t(cal.day_end - 1);
+    clock.update(&t);
+    util::time::clock_calendar_t same_day;
+    clock.load_calendar(same_day);
+    CASE_EXPECT_EQ(cal.day_start, same_day.day_start);
+
+    t = std::chrono::system_clock::from_time_t(cal.day_end);
+    clock.update(&t);
+    util::time::clock_calendar_t next_day;
+    clock.load_calendar(next_day);
+    CASE_EXPECT_EQ(cal.day_end, next_day.day_start);
+    CASE_EXPECT_EQ(cal.week_day == 6 ? 0 : cal.week_day + 1, next_day.week_day);
+
+    // 修改时区后刷新
+    util::time::time_utility::set_zone_offset(zone_offset - 5 * util::time::time_utility::HOUR_SECONDS);
+    clock.refresh();
+    clock.load_calendar(next_day);
+    CASE_EXPECT_EQ(zone_offset - 5 * util::time::time_utility::HOUR_SECONDS, next_day.zone_offset);
+    CASE_EXPECT_EQ(util::time::time_utility::get_day_start_time(cal.day_end), next_day.day_start);
+    util::time::time_utility::set_zone_offset(zone_offset);
+}
+
+CASE_TEST(clock_service, time_utility) {
+    // time_utility使用全局的时钟服务
+    util::time::time_utility::update();
+    CASE_EXPECT_EQ(util::time::clock_service::global().get_now(), util::time::time_utility::get_now());
+    CASE_EXPECT_EQ(util::time::clock_service::global().get_now_usec(), util::time::time_utility::get_now_usec());
+    CASE_EXPECT_TRUE(util::time::clock_service::global().now() == util::time::time_utility::now());
+}
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+CASE_TEST(clock_service, multi_thread) {
+    util::time::clock_service clock;
+    util::time::clock_service::raw_time_t base = std::chrono::system_clock::from_time_t(1600000000);
+    clock.update(&base);
+
+    // 写入方不断更新，读取方检查快照的各个字段是否一致
+    util::lock::atomic_int_type<int> running;
+    std::vector<size_t>              torn_count(4, 0);
+    std::vector<size_t>              read_count(4, 0);
+    std::vector<std::thread *>       readers;
+    running.store(1);
+    for (size_t i = 0; i < torn_count.size(); ++i) {
+        readers.push_back(new std::thread([&clock, &running, &torn_count, &read_count, i]() {
+            util::time::clock_snapshot_t snapshot;
+            while (0 != running.load()) {
+                clock.load(snapshot);
+                ++read_count[i];
+                if (snapshot.unix_seconds != std::chrono::system_clock::to_time_t(snapshot.system_time) ||
+                    snapshot.gmt_tm.tm_sec != static_cast<int>(snapshot.unix_seconds % 60) ||
+                    snapshot.usec != static_cast<time_t>((snapshot.unix_seconds % 1000) * 1000)) {
+                    ++torn_count[i];
+                }
+            }
+        }));
+    }
+
+    for (int i = 1; i <= 200000; ++i) {
+        util::time::clock_service::raw_time_t t =
+            base + std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::seconds(i)) +
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::milliseconds((1600000000 + i) % 1000));
+        clock.update(&t);
+    }
+    running.store(0);
+
+    size_t total_read = 0;
+    for (size_t i = 0; i < readers.size(); ++i) {
+        readers[i]->join();
+        delete readers[i];
+        CASE_EXPECT_EQ(0, torn_count[i]);
+        total_read += read_count[i];
+    }
+    CASE_EXPECT_EQ(1600200000, clock.get_now());
+    CASE_MSG_INFO() << "readers loaded " << total_read << " coherent snapshots" << std::endl;
+}
+
+CASE_TEST(clock_service, ticker) {
+    util::time::clock_service clock;
+    CASE_EXPECT_FALSE(clock.is_ticker_running());
+    CASE_EXPECT_TRUE(clock.start_ticker(std::chrono::microseconds(1000)));
+    CASE_EXPECT_FALSE(clock.start_ticker(std::chrono::microseconds(1000)));
+    CASE_EXPECT_TRUE(clock.is_ticker_running());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    int64_t first = clock.get_monotonic_ns();
+    CASE_EXPECT_GT(first, 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    CASE_EXPECT_GT(clock.get_monotonic_ns(), first);
+
+    // 后台线程更新期间TSC完成校准
+    if (util::time::clock_service::is_tsc_available()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(250));
+        CASE_EXPECT_TRUE(clock.is_tsc_calibrated());
+
+        int64_t prev = clock.precise_monotonic_ns();
+        for (int i = 0; i < 100000; ++i) {
+            int64_t curr = clock.precise_monotonic_ns();
+            CASE_EXPECT_GE(curr + 1000, prev);
+            if (curr + 1000 < prev) {
+                break;
+            }
+            prev = curr;
+        }
+
+        int64_t real = static_cast<int64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+        int64_t precise = clock.precise_monotonic_ns();
+        CASE_EXPECT_LT(precise - real, 1000000);
+        CASE_EXPECT_LT(real - precise, 1000000);
+
+        int64_t diff_us = static_cast<int64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(clock.precise_now() - std::chrono::system_clock::now()).count());
+        CASE_EXPECT_LT(diff_us, 1000);
+        CASE_EXPECT_GT(diff_us, -1000);
+    }
+
+    clock.stop_ticker();
+    CASE_EXPECT_FALSE(clock.is_ticker_running());
+    int64_t stopped = clock.get_monotonic_ns();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    CASE_EXPECT_EQ(stopped, clock.get_monotonic_ns());
+}
+#endif
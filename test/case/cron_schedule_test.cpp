@@ -0,0 +1,248 @@
+﻿#include <cstring>
+#include <ctime>
+#include <vector>
+
+#include "frame/test_macros.h"
+#include "time/cron_schedule.h"
+#include "time/time_utility.h"
+
+// 2020-02-28 23:59:30 UTC，周五
+static const time_t cron_test_base_time = 1582934370;
+
+CASE_TEST(cron_schedule, parse) {
+    util::time::cron_rule rule;
+    CASE_EXPECT_TRUE(rule.empty());
+    CASE_EXPECT_EQ(0, rule.next(cron_test_base_time, 0));
+
+    CASE_EXPECT_EQ(0, rule.parse("0 5 * * *"));
+    CASE_EXPECT_FALSE(rule.empty());
+    CASE_EXPECT_EQ(0, rule.parse(" 0 0 5 * * * "));
+    CASE_EXPECT_EQ(0, rule.parse("*/15 0-10/5,30 1,3,5 ? JAN-mar,dec Mon-FRI"));
+    CASE_EXPECT_EQ(0, rule.parse("0 0 * * 7"));
+    CASE_EXPECT_EQ(0, rule.parse("@daily"));
+    CASE_EXPECT_EQ(0, rule.parse("@Weekly"));
+
+    CASE_EXPECT_EQ(util::time::cron_rule::error_type_t::EN_CRET_INVALID_PARAM, rule.parse(NULL));
+    CASE_EXPECT_TRUE(rule.empty());
+    CASE_EXPECT_EQ(util::time::cron_rule::error_type_t::EN_CRET_FIELD_COUNT, rule.parse("* * * *"));
+    CASE_EXPECT_EQ(util::time::cron_rule::error_type_t::EN_CRET_FIELD_COUNT, rule.parse("* * * * * * *"));
+    CASE_EXPECT_EQ(util::time::cron_rule::error_type_t::EN_CRET_INVALID_VALUE, rule.parse("60 * * * *"));
+    CASE_EXPECT_EQ(util::time::cron_rule::error_type_t::EN_CRET_INVALID_VALUE, rule.parse("* 24 * * *"));
+    CASE_EXPECT_EQ(util::time::cron_rule::error_type_t::EN_CRET_INVALID_VALUE, rule.parse("* * 0 * *"));
+    CASE_EXPECT_EQ(util::time::cron_rule::error_type_t::EN_CRET_INVALID_VALUE, rule.parse("* * * 13 *"));
+    CASE_EXPECT_EQ(util::time::cron_rule::error_type_t::EN_CRET_INVALID_VALUE, rule.parse("* * * * 8"));
+    CASE_EXPECT_EQ(util::time::cron_rule::error_type_t::EN_CRET_INVALID_VALUE, rule.parse("5-1 * * * *"));
+    CASE_EXPECT_EQ(util::time::cron_rule::error_type_t::EN_CRET_INVALID_VALUE, rule.parse("*/0 * * * *"));
+    CASE_EXPECT_EQ(util::time::cron_rule::error_type_t::EN_CRET_INVALID_VALUE, rule.parse("1, * * * *"));
+    CASE_EXPECT_EQ(util::time::cron_rule::error_type_t::EN_CRET_INVALID_VALUE, rule.parse("* * * FOO *"));
+    CASE_EXPECT_EQ(util::time::cron_rule::error_type_t::EN_CRET_INVALID_VALUE, rule.parse("@never"));
+    CASE_EXPECT_TRUE(rule.empty());
+}
+
+CASE_TEST(cron_schedule, next) {
+    util::time::cron_rule rule;
+
+    // 每天5点，UTC
+    rule.parse("0 5 * * *");
+    CASE_EXPECT_EQ(1582952400, rule.next(cron_test_base_time, 0)); // 2020-02-29 05:00:00
+    CASE_EXPECT_EQ(1583038800, rule.next(1582952400, 0));          // 2020-03-01 05:00:00
+    CASE_EXPECT_TRUE(rule.match(1582952400, 0));
+    CASE_EXPECT_FALSE(rule.match(1582952401, 0));
+
+    // 东八区已经是2020-02-29 07:59:30，下一次是2020-03-01 05:00:00(UTC 2020-02-29 21:00:00)
+    CASE_EXPECT_EQ(1582952400 + 16 * util::time::time_utility::HOUR_SECONDS,
+                   rule.next(cron_test_base_time, -8 * util::time::time_utility::HOUR_SECONDS));
+
+    // 每分钟的第0秒
+    rule.parse("* * * * *");
+    CASE_EXPECT_EQ(cron_test_base_time + 30, rule.next(cron_test_base_time, 0));
+
+    // 闰日
+    rule.parse("0 0 0 29 2 *");
+    CASE_EXPECT_EQ(1582934400, rule.next(cron_test_base_time, 0)); // 2020-02-29
+    CASE_EXPECT_EQ(1709164800, rule.next(1582934400, 0));          // 2024-02-29
+
+    // 2100年不是闰年
+    CASE_EXPECT_EQ(4233686400LL, rule.next(3981312000LL, 0)); // 2096-02-29 => 2104-02-29
+
+    // 永远不会触发
+    rule.parse("0 0 0 31 2 *");
+    CASE_EXPECT_EQ(0, rule.next(cron_test_base_time, 0));
+
+    // 日和周都有限制时满足任意一个
+    rule.parse("0 0 0 1 * MON");
+    CASE_EXPECT_EQ(1582934400 + util::time::time_utility::DAY_SECONDS, rule.next(cron_test_base_time, 0)); // 2020-03-01(周日)
+    CASE_EXPECT_EQ(1582934400 + 2 * util::time::time_utility::DAY_SECONDS,
+                   rule.next(1582934400 + util::time::time_utility::DAY_SECONDS, 0)); // 2020-03-02(周一)
+
+    // 周日可以是0或7
+    util::time::cron_rule sunday;
+    sunday.parse("0 0 * * 7");
+    rule.parse("0 0 * * 0");
+    CASE_EXPECT_EQ(rule.next(cron_test_base_time, 0), sunday.next(cron_test_base_time, 0));
+    CASE_EXPECT_EQ(0, util::time::time_utility::get_gmt_tm(sunday.next(cron_test_base_time, 0)).tm_wday);
+
+    // 和逐秒检查的结果对比
+    const char *exprs[] = {"*/7 */13 1-23/3 * * *", "0 30 9 ? * MON-FRI", "15,45 * 22-23 28-31 * *", "0 0 12 1 1,7 SAT"};
+    for (size_t i = 0; i < sizeof(exprs) / sizeof(exprs[0]); ++i) {
+        if (0 != rule.parse(exprs[i])) {
+            continue;
+        }
+
+        time_t next = rule.next(cron_test_base_time, 0);
+        time_t t    = cron_test_base_time + 1;
+        while (t < next && !rule.match(t, 0)) {
+            ++t;
+        }
+        CASE_EXPECT_EQ(next, t);
+        CASE_EXPECT_TRUE(rule.match(next, 0));
+    }
+
+    // 1970年以前
+    rule.parse("0 0 0 1 1 *");
+    CASE_EXPECT_EQ(-31536000, rule.next(-31536001, 0));
+}
+
+CASE_TEST(cron_schedule, helpers) {
+    time_t zone = -8 * util::time::time_utility::HOUR_SECONDS;
+
+    util::time::cron_rule rule = util::time::cron_rule::daily(5 * util::time::time_utility::HOUR_SECONDS + 30);
+    time_t                next = rule.next(cron_test_base_time, zone);
+    CASE_EXPECT_EQ(5 * util::time::time_utility::HOUR_SECONDS + 30, (next - zone) % util::time::time_utility::DAY_SECONDS);
+    CASE_EXPECT_LE(next - cron_test_base_time, util::time::time_utility::DAY_SECONDS);
+
+    rule = util::time::cron_rule::weekly(1, 21 * util::time::time_utility::HOUR_SECONDS);
+    next = rule.next(cron_test_base_time, zone);
+    CASE_EXPECT_EQ(1, util::time::time_utility::get_gmt_tm(next - zone).tm_wday);
+    CASE_EXPECT_EQ(21, util::time::time_utility::get_gmt_tm(next - zone).tm_hour);
+
+    rule = util::time::cron_rule::monthly(31, 0);
+    next = rule.next(cron_test_base_time, 0);
+    CASE_EXPECT_EQ(1585612800, next); // 2020-03-31
+
+    CASE_EXPECT_TRUE(util::time::cron_rule::monthly(32, 0).empty());
+}
+
+CASE_TEST(cron_schedule, scheduler) {
+    util::time::cron_scheduler scheduler;
+    std::vector<time_t>        fired;
+    std::vector<uint64_t>      fired_ids;
+
+    util::time::cron_scheduler::callback_fn_t fn = [&fired, &fired_ids](time_t fire_time, uint64_t id) {
+        fired.push_back(fire_time);
+        fired_ids.push_back(id);
+    };
+
+    // 固定时区，保证每天5点不会落在测试的时间窗口里
+    time_t old_zone = util::time::time_utility::get_zone_offset();
+    time_t zone     = 0;
+    util::time::time_utility::set_zone_offset(zone);
+    scheduler.reset(cron_test_base_time);
+
+    time_t   now    = cron_test_base_time;
+    uint64_t minute = scheduler.add("0 * * * * *", fn, now);
+    uint64_t daily  = scheduler.add(util::time::cron_rule::daily(5 * util::time::time_utility::HOUR_SECONDS), fn, now);
+    CASE_EXPECT_NE(0, minute);
+    CASE_EXPECT_NE(0, daily);
+    CASE_EXPECT_EQ(0, scheduler.add("bad expr", fn, now));
+    CASE_EXPECT_EQ(0, scheduler.add("0 0 0 31 2 *", fn, now));
+    CASE_EXPECT_EQ(2, scheduler.size());
+
+    CASE_EXPECT_EQ(now + 30, scheduler.get_next_fire_time(minute));
+    CASE_EXPECT_EQ(now + 30, scheduler.get_next_fire_time());
+    CASE_EXPECT_EQ(util::time::cron_rule::daily(5 * util::time::time_utility::HOUR_SECONDS).next(now, zone), scheduler.get_next_fire_time(daily));
+
+    CASE_EXPECT_EQ(0, scheduler.tick(now + 29));
+    CASE_EXPECT_EQ(1, scheduler.tick(now + 30));
+    CASE_EXPECT_EQ(1, fired.size());
+    CASE_EXPECT_EQ(0, scheduler.tick(now + 30));
+
+    // 跳过很多分钟时只触发一次
+    fired.clear();
+    CASE_EXPECT_EQ(1, scheduler.tick(now + 30 + 600));
+    CASE_EXPECT_EQ(1, fired.size());
+    CASE_EXPECT_EQ(now + 90, fired[0]);
+    CASE_EXPECT_EQ(now + 30 + 660, scheduler.get_next_fire_time(minute));
+
+    // 跨过一整天，每个日程各触发一次
+    fired.clear();
+    fired_ids.clear();
+    now += util::time::time_utility::DAY_SECONDS + 30;
+    CASE_EXPECT_EQ(2, scheduler.tick(now));
+    CASE_EXPECT_EQ(2, fired_ids.size());
+
+    // 时间往回调整时重新计算，不会触发
+    fired.clear();
+    now -= util::time::time_utility::DAY_SECONDS;
+    CASE_EXPECT_EQ(0, scheduler.tick(now));
+    CASE_EXPECT_EQ(now + 60, scheduler.get_next_fire_time(minute));
+
+    // 回调中移除自己和添加新的日程
+    uint64_t added = 0;
+    uint64_t once  = scheduler.add(
+        "0 * * * * *",
+        [&scheduler, &added, &fn, now](time_t, uint64_t id) {
+            scheduler.remove(id);
+            added = scheduler.add("30 * * * * *", fn, now + 60);
+        },
+        now);
+    CASE_EXPECT_EQ(2, scheduler.tick(now + 60));
+    CASE_EXPECT_EQ(now + 90, scheduler.get_next_fire_time(added));
+    CASE_EXPECT_EQ(0, scheduler.get_next_fire_time(once));
+    CASE_EXPECT_NE(0, added);
+    CASE_EXPECT_EQ(3, scheduler.size());
+
+    CASE_EXPECT_TRUE(scheduler.remove(minute));
+    CASE_EXPECT_FALSE(scheduler.remove(minute));
+    CASE_EXPECT_EQ(2, scheduler.size());
+
+    scheduler.clear();
+    CASE_EXPECT_TRUE(scheduler.empty());
+    CASE_EXPECT_EQ(0, scheduler.get_next_fire_time());
+
+    util::time::time_utility::set_zone_offset(old_zone);
+}
+
+CASE_TEST(cron_schedule, zone_offset) {
+    util::time::cron_scheduler scheduler;
+    time_t                     old_zone = util::time::time_utility::get_zone_offset();
+    int                        count    = 0;
+
+    util::time::time_utility::set_zone_offset(0);
+    scheduler.reset(cron_test_base_time);
+    uint64_t id = scheduler.add(
+        util::time::cron_rule::daily(5 * util::time::time_utility::HOUR_SECONDS), [&count](time_t, uint64_t) { ++count; }, cron_test_base_time);
+    CASE_EXPECT_EQ(1582952400, scheduler.get_next_fire_time(id));
+
+    // 修改时区后下一次tick会重新计算
+    util::time::time_utility::set_zone_offset(-8 * util::time::time_utility::HOUR_SECONDS);
+    CASE_EXPECT_EQ(0, scheduler.tick(cron_test_base_time + 1));
+    CASE_EXPECT_EQ(1582952400 + 16 * util::time::time_utility::HOUR_SECONDS, scheduler.get_next_fire_time(id));
+    CASE_EXPECT_EQ(0, scheduler.tick(1582952400));
+    CASE_EXPECT_EQ(1, scheduler.tick(1582952400 + 16 * util::time::time_utility::HOUR_SECONDS));
+    CASE_EXPECT_EQ(1, count);
+
+    util::time::time_utility::set_zone_offset(old_zone);
+}
+
+CASE_TEST(cron_schedule, many_rules) {
+    util::time::cron_scheduler scheduler;
+    int                        count = 0;
+
+    // 大量日程，每次tick只处理到期的，一天内每个日程恰好触发一次
+    const int rule_count = 1000;
+    for (int i = 0; i < rule_count; ++i) {
+        scheduler.add(
+            util::time::cron_rule::daily(static_cast<time_t>(i) * 8), [&count](time_t, uint64_t) { ++count; }, cron_test_base_time);
+    }
+
+    size_t fired = 0;
+    for (time_t t = cron_test_base_time; t < cron_test_base_time + util::time::time_utility::DAY_SECONDS; t += 600) {
+        fired += scheduler.tick(t);
+    }
+    fired += scheduler.tick(cron_test_base_time + util::time::time_utility::DAY_SECONDS - 1);
+
+    CASE_EXPECT_EQ(rule_count, fired);
+    CASE_EXPECT_EQ(rule_count, count);
+    CASE_EXPECT_GE(scheduler.get_next_fire_time(), cron_test_base_time + util::time::time_utility::DAY_SECONDS);
+}
@@ -0,0 +1,144 @@
+﻿#include <cstring>
+#include <string>
+#include <vector>
+
+#include "frame/test_macros.h"
+
+#include "data_structure/dense_state_machine.h"
+#include "data_structure/finite_state_machine.h"
+
+namespace {
+    enum dense_test_state_t {
+        EN_DTS_IDLE = 0,
+        EN_DTS_MOVE,
+        EN_DTS_ATTACK,
+        EN_DTS_DEAD,
+        EN_DTS_MAX,
+    };
+
+    typedef util::ds::dense_state_machine_definition<dense_test_state_t, EN_DTS_MAX, int> dense_test_def_t;
+    typedef util::ds::dense_state_machine<dense_test_state_t, EN_DTS_MAX, int>            dense_test_fsm_t;
+
+    UTIL_CONFIG_CONSTEXPR dense_test_def_t::transition_t dense_test_transitions[] = {
+        {EN_DTS_IDLE, EN_DTS_MOVE},   {EN_DTS_MOVE, EN_DTS_IDLE},   {EN_DTS_IDLE, EN_DTS_ATTACK},
+        {EN_DTS_ATTACK, EN_DTS_IDLE}, {EN_DTS_MOVE, EN_DTS_ATTACK}, {EN_DTS_ATTACK, EN_DTS_DEAD},
+    };
+
+#if defined(UTIL_CONFIG_COMPILER_CXX_CONSTEXPR) && UTIL_CONFIG_COMPILER_CXX_CONSTEXPR
+    UTIL_CONFIG_STATIC_ASSERT(dense_test_def_t::validate_transitions(dense_test_transitions));
+#endif
+} // namespace
+
+CASE_TEST(dense_state_machine, basic) {
+    dense_test_def_t def;
+    CASE_EXPECT_TRUE(def.empty());
+    CASE_EXPECT_EQ(6, def.add_transitions(dense_test_transitions));
+    CASE_EXPECT_FALSE(def.add_transition(EN_DTS_IDLE, EN_DTS_MAX));
+    CASE_EXPECT_FALSE(def.add_enter_listener(EN_DTS_MAX, [](dense_test_state_t, dense_test_state_t, int) {}));
+
+    std::vector<std::string> records;
+    def.add_leave_listener(EN_DTS_IDLE, [&records](dense_test_state_t, dense_test_state_t, int v) { records.push_back("leave idle " + std::to_string(v)); });
+    def.add_enter_listener(EN_DTS_ATTACK, [&records](dense_test_state_t, dense_test_state_t, int) { records.push_back("enter attack"); });
+    def.add_listener(EN_DTS_IDLE, EN_DTS_ATTACK, [&records](dense_test_state_t from, dense_test_state_t to, int) {
+        CASE_EXPECT_EQ(EN_DTS_IDLE, from);
+        CASE_EXPECT_EQ(EN_DTS_ATTACK, to);
+        records.push_back("idle to attack");
+    });
+    def.add_enter_listener(EN_DTS_ATTACK, [&records](dense_test_state_t, dense_test_state_t, int) { records.push_back("enter attack 2"); });
+    def.add_leave_listener(EN_DTS_ATTACK, [&records](dense_test_state_t, dense_test_state_t, int) { records.push_back("leave attack"); });
+    CASE_EXPECT_EQ(5, def.get_listener_count());
+
+    dense_test_fsm_t fsm;
+    CASE_EXPECT_EQ(EN_DTS_IDLE, fsm.get_state());
+    CASE_EXPECT_TRUE(fsm.test(def, EN_DTS_ATTACK));
+    CASE_EXPECT_FALSE(fsm.test(def, EN_DTS_DEAD));
+    CASE_EXPECT_FALSE(fsm.set_state(def, EN_DTS_DEAD, 0));
+    CASE_EXPECT_EQ(EN_DTS_IDLE, fsm.get_state());
+
+    // 离开、进入、转移的顺序和finite_state_machine一致，同一个槽内按添加顺序
+    CASE_EXPECT_TRUE(fsm.set_state(def, EN_DTS_ATTACK, 7));
+    CASE_EXPECT_EQ(EN_DTS_ATTACK, fsm.get_state());
+    CASE_EXPECT_EQ(4, records.size());
+    if (4 == records.size()) {
+        CASE_EXPECT_EQ(std::string("leave idle 7"), records[0]);
+        CASE_EXPECT_EQ(std::string("enter attack"), records[1]);
+        CASE_EXPECT_EQ(std::string("enter attack 2"), records[2]);
+        CASE_EXPECT_EQ(std::string("idle to attack"), records[3]);
+    }
+
+    records.clear();
+    CASE_EXPECT_TRUE(fsm.set_state(def, EN_DTS_DEAD, 0));
+    CASE_EXPECT_EQ(1, records.size());
+    CASE_EXPECT_FALSE(fsm.set_state(def, EN_DTS_IDLE, 0));
+
+    // 状态超出范围
+    fsm.reset_state(static_cast<dense_test_state_t>(EN_DTS_MAX + 1));
+    CASE_EXPECT_FALSE(fsm.test(def, EN_DTS_IDLE));
+    fsm.reset_state(EN_DTS_IDLE);
+    CASE_EXPECT_TRUE(fsm.test(def, EN_DTS_MOVE));
+}
+
+CASE_TEST(dense_state_machine, shared_definition) {
+    dense_test_def_t::ptr_t def = std::make_shared<dense_test_def_t>();
+    def->add_transitions(dense_test_transitions);
+
+    int enter_count = 0;
+    def->add_enter_listener(EN_DTS_MOVE, [&enter_count](dense_test_state_t, dense_test_state_t, int v) { enter_count += v; });
+
+    dense_test_def_t::const_ptr_t shared = def;
+    std::vector<dense_test_fsm_t> fsms(1000);
+    for (size_t i = 0; i < fsms.size(); ++i) {
+        CASE_EXPECT_TRUE(fsms[i].set_state(*shared, EN_DTS_MOVE, 1));
+    }
+
+    CASE_EXPECT_EQ(1000, enter_count);
+    CASE_EXPECT_EQ(sizeof(dense_test_state_t), sizeof(dense_test_fsm_t));
+    CASE_MSG_INFO() << "sizeof(dense_state_machine) = " << sizeof(dense_test_fsm_t) << ", sizeof(finite_state_machine) = "
+                    << sizeof(util::ds::finite_state_machine<dense_test_state_t, int>) << std::endl;
+}
+
+CASE_TEST(dense_state_machine, same_as_finite_state_machine) {
+    std::vector<std::string> dense_records;
+    std::vector<std::string> map_records;
+
+    dense_test_def_t dense_def;
+    dense_def.add_transitions(dense_test_transitions);
+    dense_def.add_transition(EN_DTS_DEAD, EN_DTS_IDLE);
+    dense_def.add_enter_listener(EN_DTS_MOVE, [&dense_records](dense_test_state_t from, dense_test_state_t, int v) {
+        dense_records.push_back("enter move " + std::to_string(from) + " " + std::to_string(v));
+    });
+    dense_def.add_leave_listener(EN_DTS_ATTACK, [&dense_records](dense_test_state_t, dense_test_state_t to, int v) {
+        dense_records.push_back("leave attack " + std::to_string(to) + " " + std::to_string(v));
+    });
+    dense_def.add_listener(EN_DTS_MOVE, EN_DTS_IDLE, [&dense_records](dense_test_state_t, dense_test_state_t, int v) {
+        dense_records.push_back("move to idle " + std::to_string(v));
+    });
+
+    util::ds::finite_state_machine<dense_test_state_t, int> map_fsm;
+    for (size_t i = 0; i < sizeof(dense_test_transitions) / sizeof(dense_test_transitions[0]); ++i) {
+        map_fsm.add_listener(dense_test_transitions[i].from, dense_test_transitions[i].to, NULL);
+    }
+    map_fsm.add_listener(EN_DTS_DEAD, EN_DTS_IDLE, NULL);
+    map_fsm.add_enter_listener(EN_DTS_MOVE, [&map_records](dense_test_state_t from, dense_test_state_t, int v) {
+        map_records.push_back("enter move " + std::to_string(from) + " " + std::to_string(v));
+    });
+    map_fsm.add_leave_listener(EN_DTS_ATTACK, [&map_records](dense_test_state_t, dense_test_state_t to, int v) {
+        map_records.push_back("leave attack " + std::to_string(to) + " " + std::to_string(v));
+    });
+    map_fsm.add_listener(EN_DTS_MOVE, EN_DTS_IDLE, [&map_records](dense_test_state_t, dense_test_state_t, int v) {
+        map_records.push_back("move to idle " + std::to_string(v));
+    });
+
+    // 同样的切换序列，结果、状态和回调顺序都和finite_state_machine一致
+    dense_test_fsm_t dense_fsm;
+    uint32_t         seed = 2017;
+    for (int i = 0; i < 256; ++i) {
+        seed                      = seed * 1103515245 + 12345;
+        dense_test_state_t target = static_cast<dense_test_state_t>((seed >> 16) % EN_DTS_MAX);
+        CASE_EXPECT_EQ(map_fsm.set_state(target, i), dense_fsm.set_state(dense_def, target, i));
+        CASE_EXPECT_EQ(map_fsm.get_state(), dense_fsm.get_state());
+    }
+
+    CASE_EXPECT_GT(dense_records.size(), 0);
+    CASE_EXPECT_TRUE(map_records == dense_records);
+}
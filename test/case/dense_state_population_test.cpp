@@ -0,0 +1,230 @@
+﻿#include <cstring>
+#include <vector>
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+#include <thread>
+#endif
+
+#include "frame/test_macros.h"
+
+#include "data_structure/dense_state_machine.h"
+#include "data_structure/dense_state_population.h"
+
+namespace {
+    enum population_test_state_t {
+        EN_PTS_IDLE = 0,
+        EN_PTS_MOVE,
+        EN_PTS_ATTACK,
+        EN_PTS_DEAD,
+        EN_PTS_MAX,
+    };
+
+    typedef util::ds::dense_state_population<population_test_state_t, EN_PTS_MAX, int> population_t;
+    typedef population_t::definition_type                                                population_def_t;
+
+    struct population_test_record_t {
+        population_test_state_t from;
+        population_test_state_t to;
+        std::vector<size_t>     indexes;
+    };
+
+    static population_def_t::ptr_t population_test_make_def(std::vector<population_test_record_t> &records) {
+        population_def_t::ptr_t def = std::make_shared<population_def_t>();
+        def->add_transition(EN_PTS_IDLE, EN_PTS_MOVE);
+        def->add_transition(EN_PTS_MOVE, EN_PTS_IDLE);
+        def->add_transition(EN_PTS_MOVE, EN_PTS_ATTACK);
+        def->add_transition(EN_PTS_ATTACK, EN_PTS_DEAD);
+        def->add_listener(EN_PTS_IDLE, EN_PTS_ATTACK,
+                          [&records](population_test_state_t from, population_test_state_t to, const size_t *indexes, size_t count, int) {
+                              population_test_record_t record;
+                              record.from = from;
+                              record.to   = to;
+                              record.indexes.assign(indexes, indexes + count);
+                              records.push_back(record);
+                          });
+        def->add_enter_listener(EN_PTS_MOVE,
+                                [&records](population_test_state_t from, population_test_state_t to, const size_t *indexes, size_t count, int) {
+                                    population_test_record_t record;
+                                    record.from = from;
+                                    record.to   = to;
+                                    record.indexes.assign(indexes, indexes + count);
+                                    records.push_back(record);
+                                });
+        return def;
+    }
+} // namespace
+
+CASE_TEST(dense_state_population, basic) {
+    std::vector<population_test_record_t> records;
+    population_t                          population(population_test_make_def(records));
+    CASE_EXPECT_EQ(1, sizeof(population_t::state_type));
+
+    population.resize(10);
+    CASE_EXPECT_EQ(10, population.size());
+    CASE_EXPECT_EQ(10, population.add(EN_PTS_MOVE));
+    CASE_EXPECT_EQ(10, population.count(EN_PTS_IDLE));
+    CASE_EXPECT_EQ(1, population.count(EN_PTS_MOVE));
+
+    // 单个切换
+    CASE_EXPECT_TRUE(population.set_state(3, EN_PTS_MOVE, 0));
+    CASE_EXPECT_FALSE(population.set_state(3, EN_PTS_DEAD, 0));
+    CASE_EXPECT_FALSE(population.set_state(100, EN_PTS_MOVE, 0));
+    CASE_EXPECT_EQ(EN_PTS_MOVE, population.get_state(3));
+    CASE_EXPECT_EQ(1, records.size());
+    if (1 == records.size()) {
+        CASE_EXPECT_EQ(1, records[0].indexes.size());
+        CASE_EXPECT_EQ(3, records[0].indexes[0]);
+    }
+
+    // 按下标批量切换，不允许的被跳过，同一组的回调只触发一次，下标和传入的顺序一致
+    records.clear();
+    size_t indexes[] = {7, 3, 1, 10, 5, 200};
+    CASE_EXPECT_EQ(3, population.apply(indexes, sizeof(indexes) / sizeof(indexes[0]), EN_PTS_MOVE, 0));
+    CASE_EXPECT_EQ(1, records.size());
+    if (1 == records.size()) {
+        CASE_EXPECT_EQ(EN_PTS_IDLE, records[0].from);
+        CASE_EXPECT_EQ(EN_PTS_MOVE, records[0].to);
+        CASE_EXPECT_EQ(3, records[0].indexes.size());
+        if (3 == records[0].indexes.size()) {
+            CASE_EXPECT_EQ(7, records[0].indexes[0]);
+            CASE_EXPECT_EQ(1, records[0].indexes[1]);
+            CASE_EXPECT_EQ(5, records[0].indexes[2]);
+        }
+    }
+    CASE_EXPECT_EQ(5, population.count(EN_PTS_MOVE));
+
+    // 所有处于某个状态的实体
+    CASE_EXPECT_EQ(5, population.transit_all(EN_PTS_MOVE, EN_PTS_ATTACK, 0));
+    CASE_EXPECT_EQ(5, population.count(EN_PTS_ATTACK));
+    CASE_EXPECT_EQ(0, population.transit_all(EN_PTS_IDLE, EN_PTS_DEAD, 0));
+
+    // 每个实体有自己的目标状态，按(from, to)分组
+    records.clear();
+    std::vector<population_t::state_type> next(population.data(), population.data() + population.size());
+    next[0] = EN_PTS_MOVE;   // idle => move
+    next[2] = EN_PTS_MOVE;   // idle => move
+    next[3] = EN_PTS_DEAD;   // attack => dead
+    next[4] = EN_PTS_DEAD;   // idle => dead，不允许
+    CASE_EXPECT_EQ(3, population.step(&next[0], 0));
+    CASE_EXPECT_EQ(EN_PTS_MOVE, population.get_state(0));
+    CASE_EXPECT_EQ(EN_PTS_MOVE, population.get_state(2));
+    CASE_EXPECT_EQ(EN_PTS_DEAD, population.get_state(3));
+    CASE_EXPECT_EQ(EN_PTS_IDLE, population.get_state(4));
+    CASE_EXPECT_EQ(1, records.size());
+    if (1 == records.size()) {
+        CASE_EXPECT_EQ(2, records[0].indexes.size());
+    }
+}
+
+CASE_TEST(dense_state_population, listener_state) {
+    // 回调触发时这一组实体还是原来的状态
+    population_def_t::ptr_t def = std::make_shared<population_def_t>();
+    population_t           *population_ptr = NULL;
+    size_t                  checked        = 0;
+    def->add_listener(EN_PTS_IDLE, EN_PTS_MOVE,
+                      [&population_ptr, &checked](population_test_state_t from, population_test_state_t, const size_t *indexes, size_t count, int) {
+                          for (size_t i = 0; i < count; ++i) {
+                              CASE_EXPECT_EQ(from, population_ptr->get_state(indexes[i]));
+                              ++checked;
+                          }
+                      });
+
+    population_t population(def);
+    population_ptr = &population;
+    population.resize(100);
+    CASE_EXPECT_EQ(100, population.transit_all(EN_PTS_IDLE, EN_PTS_MOVE, 0));
+    CASE_EXPECT_EQ(100, checked);
+    CASE_EXPECT_EQ(100, population.count(EN_PTS_MOVE));
+}
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+CASE_TEST(dense_state_population, parallel) {
+    std::vector<population_test_record_t> serial_records;
+    std::vector<population_test_record_t> parallel_records;
+    population_t                          serial(population_test_make_def(serial_records));
+    population_t                          parallel(population_test_make_def(parallel_records));
+
+    size_t executed = 0;
+    parallel.set_executor(
+        [&executed](size_t partition_count, const std::function<void(size_t)> &fn) {
+            std::vector<std::thread> threads;
+            for (size_t i = 1; i < partition_count; ++i) {
+                threads.push_back(std::thread(fn, i));
+            }
+            fn(0);
+            for (size_t i = 0; i < threads.size(); ++i) {
+                threads[i].join();
+            }
+            executed += partition_count;
+        },
+        4);
+
+    const size_t entity_count = 10007;
+    serial.resize(entity_count);
+    parallel.resize(entity_count);
+
+    std::vector<population_t::state_type> next(entity_count);
+    for (int round = 0; round < 4; ++round) {
+        for (size_t i = 0; i < entity_count; ++i) {
+            next[i] = static_cast<population_t::state_type>((i * 7 + static_cast<size_t>(round) * 13) % EN_PTS_MAX);
+        }
+
+        CASE_EXPECT_EQ(serial.step(&next[0], round), parallel.step(&next[0], round));
+    }
+    CASE_EXPECT_EQ(16, executed);
+
+    CASE_EXPECT_EQ(0, memcmp(serial.data(), parallel.data(), entity_count));
+    CASE_EXPECT_EQ(serial_records.size(), parallel_records.size());
+    for (size_t i = 0; i < serial_records.size() && i < parallel_records.size(); ++i) {
+        CASE_EXPECT_TRUE(serial_records[i].indexes == parallel_records[i].indexes);
+    }
+}
+#endif
+
+CASE_TEST(dense_state_population, same_as_single_machines) {
+    typedef util::ds::dense_state_machine_definition<population_test_state_t, EN_PTS_MAX, size_t> single_def_t;
+    typedef util::ds::dense_state_machine<population_test_state_t, EN_PTS_MAX, size_t>            single_fsm_t;
+
+    // 不是8的整数倍，覆盖按块跳过之后的尾部
+    const size_t entity_count = 1001;
+    size_t       sum1         = 0;
+    size_t       sum2         = 0;
+
+    single_def_t single_def;
+    single_def.add_transition(EN_PTS_IDLE, EN_PTS_MOVE);
+    single_def.add_listener(EN_PTS_MOVE, EN_PTS_IDLE, [&sum1](population_test_state_t, population_test_state_t, size_t idx) { sum1 += idx; });
+    std::vector<single_fsm_t> singles(entity_count, single_fsm_t(EN_PTS_MOVE));
+
+    population_def_t::ptr_t population_def = std::make_shared<population_def_t>();
+    population_def->add_transition(EN_PTS_IDLE, EN_PTS_MOVE);
+    population_def->add_listener(EN_PTS_MOVE, EN_PTS_IDLE,
+                                 [&sum2](population_test_state_t, population_test_state_t, const size_t *indexes, size_t count, int) {
+                                     for (size_t i = 0; i < count; ++i) {
+                                         sum2 += indexes[i];
+                                     }
+                                 });
+    population_t population(population_def);
+    population.resize(entity_count, EN_PTS_MOVE);
+
+    // 每轮每32个实体有一个需要切换，在move和idle之间来回切换，结果和逐个切换单独的状态机一致
+    std::vector<population_t::state_type> next(population.data(), population.data() + population.size());
+    for (int round = 0; round < 4; ++round) {
+        for (size_t i = 0; i < entity_count; i += 32) {
+            next[i] = static_cast<population_t::state_type>((round & 1) ? EN_PTS_MOVE : EN_PTS_IDLE);
+        }
+
+        for (size_t i = 0; i < entity_count; ++i) {
+            if (next[i] != static_cast<population_t::state_type>(singles[i].get_state())) {
+                singles[i].set_state(single_def, static_cast<population_test_state_t>(next[i]), i);
+            }
+        }
+        CASE_EXPECT_EQ((entity_count + 31) / 32, population.step(&next[0], 0));
+
+        for (size_t i = 0; i < entity_count; ++i) {
+            CASE_EXPECT_EQ(static_cast<population_t::state_type>(singles[i].get_state()), population.data()[i]);
+        }
+    }
+
+    CASE_EXPECT_GT(sum2, 0);
+    CASE_EXPECT_EQ(sum1, sum2);
+}
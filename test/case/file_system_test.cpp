@@ -1,4 +1,14 @@
-﻿#include "common/file_system.h"
+﻿#include <algorithm>
+#include <cstring>
+#include <set>
+#include <string>
+#include <vector>
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+#include <mutex>
+#endif
+
+#include "common/file_system.h"
 #include "frame/test_macros.h"
 
 CASE_TEST(file_system, dirname) {
@@ -30,6 +40,118 @@ CASE_TEST(file_system, scan_dir) {
     }
 }
 
+CASE_TEST(file_system, dir_iterator) {
+    std::string dir;
+    CASE_EXPECT_TRUE(util::file_system::dirname(__FILE__, 0, dir));
+
+    util::file_system::dir_iterator iter;
+    CASE_EXPECT_EQ(0, iter.open(dir.c_str()));
+
+    std::set<std::string>         names;
+    util::file_system::dir_entry_t entry;
+    while (iter.next(entry)) {
+        CASE_EXPECT_EQ(strlen(entry.name), entry.name_len);
+        names.insert(entry.name);
+        if (0 == strcmp("file_system_test.cpp", entry.name)) {
+            CASE_EXPECT_EQ(util::file_system::dir_opt_t::EN_DOT_TREG, entry.type);
+        } else if (0 == strcmp(".", entry.name)) {
+            CASE_EXPECT_EQ(util::file_system::dir_opt_t::EN_DOT_TDIR, entry.type);
+        }
+    }
+    CASE_EXPECT_EQ(0, iter.get_error());
+    CASE_EXPECT_TRUE(names.end() != names.find("file_system_test.cpp"));
+    CASE_EXPECT_TRUE(names.end() != names.find("."));
+    CASE_EXPECT_TRUE(names.end() != names.find(".."));
+
+    CASE_EXPECT_NE(0, iter.open("not-exists-dir-for-dir-iterator"));
+    CASE_EXPECT_FALSE(iter.next(entry));
+}
+
+CASE_TEST(file_system, walk_dir) {
+    // 生成一个多层的目录
+    std::string root = "test-file-system-walk";
+    std::set<std::string> expect_files;
+    for (int i = 0; i < 8; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            char dir_path[128];
+            sprintf(dir_path, "%s/d%d/s%d", root.c_str(), i, j);
+            CASE_EXPECT_TRUE(util::file_system::mkdir(dir_path, true));
+
+            for (int k = 0; k < 10; ++k) {
+                char file_path[160];
+                sprintf(file_path, "%s/f%d.txt", dir_path, k);
+                FILE *f = NULL;
+                UTIL_FS_OPEN(res, f, file_path, "wb");
+                if (NULL != f) {
+                    UTIL_FS_CLOSE(f);
+                }
+                expect_files.insert(file_path);
+            }
+        }
+    }
+
+    int options = util::file_system::dir_opt_t::EN_DOT_DAFAULT | util::file_system::dir_opt_t::EN_DOT_RECU;
+
+    std::list<std::string> scan_out;
+    CASE_EXPECT_EQ(0, util::file_system::scan_dir(root.c_str(), scan_out, options));
+    std::set<std::string> scan_files;
+    for (std::list<std::string>::iterator iter = scan_out.begin(); iter != scan_out.end(); ++iter) {
+        std::string path = *iter;
+        std::replace(path.begin(), path.end(), '\\', '/');
+        scan_files.insert(path);
+    }
+    CASE_EXPECT_TRUE(expect_files == scan_files);
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+    // 多线程并行扫描
+    std::mutex            lock;
+    std::set<std::string> walk_files;
+    CASE_EXPECT_EQ(0, util::file_system::walk_dir(
+                          root.c_str(),
+                          [&lock, &walk_files](const std::string &path, int type) {
+                              CASE_EXPECT_EQ(util::file_system::dir_opt_t::EN_DOT_TREG, type);
+                              std::string unix_path = path;
+                              std::replace(unix_path.begin(), unix_path.end(), '\\', '/');
+                              std::lock_guard<std::mutex> guard(lock);
+                              walk_files.insert(unix_path);
+                          },
+                          options, 4));
+    CASE_EXPECT_TRUE(expect_files == walk_files);
+#endif
+
+    // 过滤掉d0目录和f0.txt
+    size_t filtered_count = 0;
+    CASE_EXPECT_EQ(0, util::file_system::walk_dir(
+                          root.c_str(), [&filtered_count](const std::string &, int) { ++filtered_count; }, options, 1,
+                          [](const std::string &, const util::file_system::dir_entry_t &entry) {
+                              return 0 != strcmp("d0", entry.name) && 0 != strcmp("f0.txt", entry.name);
+                          }));
+    CASE_EXPECT_EQ(7 * 4 * 9, filtered_count);
+
+    // 只列出目录，不递归
+    std::list<std::string> dirs;
+    CASE_EXPECT_EQ(0, util::file_system::scan_dir(root.c_str(), dirs, util::file_system::dir_opt_t::EN_DOT_TDIR));
+    CASE_EXPECT_EQ(8, dirs.size());
+
+    CASE_EXPECT_NE(0, util::file_system::walk_dir("not-exists-dir-for-walk-dir", [](const std::string &, int) {}, options, 4));
+
+    // 清理
+    for (std::set<std::string>::iterator iter = expect_files.begin(); iter != expect_files.end(); ++iter) {
+        util::file_system::remove(iter->c_str());
+    }
+    for (int i = 0; i < 8; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            char dir_path[128];
+            sprintf(dir_path, "%s/d%d/s%d", root.c_str(), i, j);
+            util::file_system::remove(dir_path);
+        }
+        char dir_path[128];
+        sprintf(dir_path, "%s/d%d", root.c_str(), i);
+        util::file_system::remove(dir_path);
+    }
+    util::file_system::remove(root.c_str());
+}
+
 CASE_TEST(file_system, get_cwd) {
     std::string dir;
     CASE_MSG_INFO() << "Working dir: " << util::file_system::get_cwd() << std::endl;
@@ -79,3 +201,168 @@ CASE_TEST(file_system, file_size) {
     CASE_EXPECT_TRUE(util::file_system::file_size(__FILE__, sz));
     CASE_EXPECT_GT(sz, 0);
 }
+
+CASE_TEST(file_system, mapped_file) {
+    std::string content;
+    CASE_EXPECT_TRUE(util::file_system::get_file_content(content, __FILE__, true));
+
+    {
+        util::file_system::mapped_file view;
+        CASE_EXPECT_EQ(0, view.open(__FILE__, util::file_system::mmap_opt_t::EN_MOT_SEQUENTIAL));
+        CASE_EXPECT_TRUE(view.is_mapped());
+        CASE_EXPECT_EQ(content, view.to_string());
+
+        // 修改访问模式
+        view.advise(util::file_system::mmap_opt_t::EN_MOT_RANDOM | util::file_system::mmap_opt_t::EN_MOT_WILLNEED, 10, 100);
+
+        // 不按页对齐的偏移
+        CASE_EXPECT_EQ(0, view.open(__FILE__, util::file_system::mmap_opt_t::EN_MOT_RANDOM, 7, 33));
+        CASE_EXPECT_EQ(content.substr(7, 33), view.to_string());
+
+        CASE_EXPECT_EQ(0, view.open(__FILE__, util::file_system::mmap_opt_t::EN_MOT_NORMAL, 100, content.size()));
+        CASE_EXPECT_EQ(content.substr(100), view.to_string());
+
+#if defined(UTIL_CONFIG_COMPILER_CXX_RVALUE_REFERENCES) && UTIL_CONFIG_COMPILER_CXX_RVALUE_REFERENCES
+        util::file_system::mapped_file moved(std::move(view));
+        CASE_EXPECT_FALSE(view.is_mapped());
+        CASE_EXPECT_TRUE(NULL == view.data());
+        CASE_EXPECT_EQ(content.substr(100), moved.to_string());
+#endif
+
+        view.close();
+        CASE_EXPECT_TRUE(view.empty());
+        CASE_EXPECT_NE(0, view.open("not-exists-file-for-mapped-file.txt"));
+    }
+
+    // 空文件
+    std::string empty_file = "test-file-system-empty.txt";
+    FILE *      f          = NULL;
+    UTIL_FS_OPEN(res, f, empty_file.c_str(), "wb");
+    CASE_EXPECT_TRUE(NULL != f);
+    if (NULL != f) {
+        UTIL_FS_CLOSE(f);
+    }
+    {
+        util::file_system::mapped_file view;
+        CASE_EXPECT_EQ(0, view.open(empty_file.c_str()));
+        CASE_EXPECT_TRUE(view.empty());
+        CASE_EXPECT_FALSE(view.is_mapped());
+        CASE_EXPECT_TRUE(util::file_system::get_file_content(view, empty_file.c_str()));
+        CASE_EXPECT_TRUE(view.empty());
+        CASE_EXPECT_EQ(0, view.data()[0]);
+    }
+    util::file_system::remove(empty_file.c_str());
+}
+
+CASE_TEST(file_system, mapped_file_large) {
+    // 超过2MB时尝试使用大页
+    std::string file_path = "test-file-system-large.bin";
+    std::string content;
+    content.reserve(5 * 1024 * 1024);
+    for (size_t i = 0; content.size() < 5 * 1024 * 1024; ++i) {
+        content.push_back(static_cast<char>(i * 131 + (i >> 8)));
+    }
+
+    FILE *f = NULL;
+    UTIL_FS_OPEN(res, f, file_path.c_str(), "wb");
+    CASE_EXPECT_TRUE(NULL != f);
+    if (NULL == f) {
+        return;
+    }
+    fwrite(content.data(), 1, content.size(), f);
+    UTIL_FS_CLOSE(f);
+
+    {
+        util::file_system::mapped_file view;
+        CASE_EXPECT_EQ(0, view.open(file_path.c_str(), util::file_system::mmap_opt_t::EN_MOT_HUGEPAGE |
+                                                           util::file_system::mmap_opt_t::EN_MOT_SEQUENTIAL));
+        CASE_EXPECT_EQ(content.size(), view.size());
+        CASE_EXPECT_TRUE(0 == memcmp(content.data(), view.data(), content.size()));
+
+        CASE_EXPECT_EQ(0, view.open(file_path.c_str(), util::file_system::mmap_opt_t::EN_MOT_HUGEPAGE, 3 * 1024 * 1024 + 5));
+        CASE_EXPECT_EQ(content.size() - 3 * 1024 * 1024 - 5, view.size());
+        CASE_EXPECT_TRUE(0 == memcmp(content.data() + 3 * 1024 * 1024 + 5, view.data(), view.size()));
+    }
+
+    // 分块读取
+    std::string chunks;
+    size_t      chunk_count = 0;
+    CASE_EXPECT_TRUE(util::file_system::read_file_chunks(
+        file_path.c_str(),
+        [&chunks, &chunk_count](const char *data, size_t sz) {
+            chunks.append(data, sz);
+            ++chunk_count;
+            return true;
+        },
+        1000000));
+    CASE_EXPECT_EQ(6, chunk_count);
+    CASE_EXPECT_TRUE(chunks == content);
+
+    // 中途停止
+    chunk_count = 0;
+    CASE_EXPECT_TRUE(util::file_system::read_file_chunks(file_path.c_str(), [&chunk_count](const char *, size_t) { return ++chunk_count < 2; }));
+    CASE_EXPECT_EQ(2, chunk_count);
+    CASE_EXPECT_FALSE(util::file_system::read_file_chunks("not-exists-file-for-chunks.txt", [](const char *, size_t) { return true; }));
+
+    // 复制文件
+    std::string copy_path = "test-file-system-large.copy.bin";
+    CASE_EXPECT_EQ(0, util::file_system::copy_file(file_path.c_str(), copy_path.c_str()));
+    {
+        util::file_system::mapped_file view;
+        CASE_EXPECT_TRUE(util::file_system::get_file_content(view, copy_path.c_str()));
+        CASE_EXPECT_EQ(content.size(), view.size());
+        CASE_EXPECT_TRUE(view.size() == content.size() && 0 == memcmp(content.data(), view.data(), content.size()));
+    }
+    CASE_EXPECT_NE(0, util::file_system::copy_file("not-exists-file-for-copy.txt", copy_path.c_str()));
+
+    util::file_system::remove(copy_path.c_str());
+    util::file_system::remove(file_path.c_str());
+}
+
+#if defined(__linux__)
+CASE_TEST(file_system, virtual_file) {
+    // /proc下的文件长度是0，不能映射，需要按流来读
+    util::file_system::mapped_file view;
+    CASE_EXPECT_TRUE(util::file_system::get_file_content(view, "/proc/self/status"));
+    CASE_EXPECT_FALSE(view.is_mapped());
+    CASE_EXPECT_GT(view.size(), 0);
+    CASE_EXPECT_TRUE(std::string::npos != view.to_string().find("Name:"));
+
+    std::string copy_path = "test-file-system-status.txt";
+    CASE_EXPECT_EQ(0, util::file_system::copy_file("/proc/self/status", copy_path.c_str()));
+    std::string content;
+    CASE_EXPECT_TRUE(util::file_system::get_file_content(content, copy_path.c_str()));
+    CASE_EXPECT_TRUE(std::string::npos != content.find("Name:"));
+    util::file_system::remove(copy_path.c_str());
+}
+#endif
+
+#ifdef UTIL_FS_POSIX_API
+CASE_TEST(file_system, send_file) {
+    std::string content;
+    CASE_EXPECT_TRUE(util::file_system::get_file_content(content, __FILE__, true));
+
+    int fds[2];
+    CASE_EXPECT_EQ(0, pipe(fds));
+
+    // 管道的缓冲区足够放下一小段
+    size_t sent = 0;
+    CASE_EXPECT_EQ(0, util::file_system::send_file(fds[1], __FILE__, 16, 1000, sent));
+    CASE_EXPECT_EQ(1000, sent);
+    close(fds[1]);
+
+    std::string received;
+    char        buffer[256];
+    while (true) {
+        ssize_t res = read(fds[0], buffer, sizeof(buffer));
+        if (res <= 0) {
+            break;
+        }
+        received.append(buffer, static_cast<size_t>(res));
+    }
+    close(fds[0]);
+
+    CASE_EXPECT_EQ(content.substr(16, 1000), received);
+    CASE_EXPECT_NE(0, util::file_system::send_file(fds[1], "not-exists-file-for-send.txt", 0, 0, sent));
+}
+#endif
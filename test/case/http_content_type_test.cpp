@@ -0,0 +1,138 @@
+﻿#include <cstring>
+#include <string>
+#include <vector>
+
+#include "network/http_content_type.h"
+
+#include "frame/test_macros.h"
+
+CASE_TEST(http_content_type, extension_table) {
+    size_t                                                       sz    = 0;
+    const util::network::http_content_type::extension_entry_t *table = util::network::http_content_type::get_extension_table(sz);
+    CASE_EXPECT_GT(sz, 100);
+
+    // 二分查找要求严格有序
+    for (size_t i = 0; i < sz; ++i) {
+        CASE_EXPECT_EQ(strlen(table[i].extension), table[i].extension_len);
+        CASE_EXPECT_TRUE(NULL != table[i].mime_type);
+        if (i > 0) {
+            CASE_EXPECT_LT(strcmp(table[i - 1].extension, table[i].extension), 0);
+        }
+
+        // 表中的每一项都能查到
+        CASE_EXPECT_EQ(table[i].mime_type, util::network::http_content_type::get_mime_type_by_extension(table[i].extension));
+    }
+}
+
+CASE_TEST(http_content_type, mime_type_by_extension) {
+    using namespace util::network::http_content_type;
+
+    CASE_EXPECT_EQ(std::string("text/html"), std::string(get_mime_type_by_extension("html")));
+    CASE_EXPECT_EQ(std::string("text/html"), std::string(get_mime_type_by_extension(".HTML")));
+    CASE_EXPECT_EQ(std::string("image/png"), std::string(get_mime_type_by_extension("PnG")));
+    CASE_EXPECT_EQ(std::string("application/json"), std::string(get_mime_type_by_extension("json")));
+    CASE_EXPECT_EQ(std::string("image/jpeg"), std::string(get_mime_type_by_extension("jpg")));
+    CASE_EXPECT_EQ(std::string("text/css"), std::string(get_mime_type_by_extension("css.bak", 3)));
+
+    CASE_EXPECT_TRUE(NULL == get_mime_type_by_extension("not-exists-ext"));
+    CASE_EXPECT_TRUE(NULL == get_mime_type_by_extension(""));
+    CASE_EXPECT_TRUE(NULL == get_mime_type_by_extension("."));
+    CASE_EXPECT_TRUE(NULL == get_mime_type_by_extension(NULL));
+
+    // 超过缓冲区长度的扩展名
+    std::string long_ext(200, 'a');
+    CASE_EXPECT_TRUE(NULL == get_mime_type_by_extension(long_ext.c_str()));
+}
+
+CASE_TEST(http_content_type, mime_type_by_path) {
+    using namespace util::network::http_content_type;
+
+    CASE_EXPECT_EQ(std::string("text/html"), std::string(get_mime_type_by_path("/var/www/index.html")));
+    CASE_EXPECT_EQ(std::string("text/css"), std::string(get_mime_type_by_path("static/css/site.min.CSS?v=123#top")));
+    CASE_EXPECT_EQ(std::string("image/png"), std::string(get_mime_type_by_path("C:\\data\\logo.png")));
+    CASE_EXPECT_EQ(std::string("application/gzip"), std::string(get_mime_type_by_path("backup.tar.gz")));
+
+    // 没有扩展名或目录名中的'.'
+    CASE_EXPECT_EQ(std::string("application/octet-stream"), std::string(get_mime_type_by_path("/usr/bin/env")));
+    CASE_EXPECT_EQ(std::string("application/octet-stream"), std::string(get_mime_type_by_path("/etc.d/config")));
+    CASE_EXPECT_EQ(std::string("application/octet-stream"), std::string(get_mime_type_by_path("/path/file.")));
+    CASE_EXPECT_EQ(std::string("text/plain"), std::string(get_mime_type_by_path("/path/unknown.notexists", 0, "text/plain")));
+    CASE_EXPECT_TRUE(NULL == get_mime_type_by_path("README", 0, NULL));
+}
+
+CASE_TEST(http_content_type, extension_by_mime_type) {
+    using namespace util::network::http_content_type;
+
+    CASE_EXPECT_EQ(std::string("html"), std::string(get_extension_by_mime_type("text/html")));
+    CASE_EXPECT_EQ(std::string("html"), std::string(get_extension_by_mime_type(" Text/HTML; charset=utf-8")));
+    CASE_EXPECT_EQ(std::string("jpg"), std::string(get_extension_by_mime_type("image/jpeg")));
+    CASE_EXPECT_EQ(std::string("txt"), std::string(get_extension_by_mime_type("text/plain")));
+    CASE_EXPECT_EQ(std::string("json"), std::string(get_extension_by_mime_type("application/json")));
+    CASE_EXPECT_TRUE(NULL == get_extension_by_mime_type("application/not-exists"));
+    CASE_EXPECT_TRUE(NULL == get_extension_by_mime_type(""));
+    CASE_EXPECT_TRUE(NULL == get_extension_by_mime_type(NULL));
+}
+
+CASE_TEST(http_content_type, text_mime_type) {
+    using namespace util::network::http_content_type;
+
+    CASE_EXPECT_TRUE(is_text_mime_type("text/plain"));
+    CASE_EXPECT_TRUE(is_text_mime_type("TEXT/HTML; charset=gbk"));
+    CASE_EXPECT_TRUE(is_text_mime_type("application/json"));
+    CASE_EXPECT_TRUE(is_text_mime_type("application/problem+json"));
+    CASE_EXPECT_TRUE(is_text_mime_type("image/svg+xml"));
+    CASE_EXPECT_TRUE(is_text_mime_type("application/javascript"));
+
+    CASE_EXPECT_FALSE(is_text_mime_type("image/png"));
+    CASE_EXPECT_FALSE(is_text_mime_type("application/octet-stream"));
+    CASE_EXPECT_FALSE(is_text_mime_type("application/jsonx"));
+    CASE_EXPECT_FALSE(is_text_mime_type(""));
+    CASE_EXPECT_FALSE(is_text_mime_type(NULL));
+}
+
+CASE_TEST(http_content_type, sniff_charset) {
+    using namespace util::network::http_content_type;
+
+    CASE_EXPECT_EQ(std::string("us-ascii"), std::string(sniff_charset("hello world\r\n\t", 14)));
+    CASE_EXPECT_EQ(std::string("utf-8"), std::string(sniff_charset("\xEF\xBB\xBFhello", 8)));
+    CASE_EXPECT_EQ(std::string("utf-16le"), std::string(sniff_charset("\xFF\xFEh\0", 4)));
+    CASE_EXPECT_EQ(std::string("utf-16be"), std::string(sniff_charset("\xFE\xFF\0h", 4)));
+    CASE_EXPECT_EQ(std::string("utf-32le"), std::string(sniff_charset("\xFF\xFE\0\0", 4)));
+    CASE_EXPECT_EQ(std::string("utf-32be"), std::string(sniff_charset("\0\0\xFE\xFF", 4)));
+
+    // 中文的UTF-8编码，末尾截断的字符也可以识别
+    const char *utf8_text = "\xE4\xB8\xAD\xE6\x96\x87 text";
+    CASE_EXPECT_EQ(std::string("utf-8"), std::string(sniff_charset(utf8_text, strlen(utf8_text))));
+    CASE_EXPECT_EQ(std::string("utf-8"), std::string(sniff_charset(utf8_text, 5)));
+    CASE_EXPECT_EQ(std::string("utf-8"), std::string(sniff_charset("a\xF0\x9F\x98", 4)));
+    CASE_EXPECT_TRUE(NULL == sniff_charset("a\xC1", 2));
+    CASE_EXPECT_TRUE(NULL == sniff_charset("\xC0\xAF\xE4\xB8", 4));
+
+    // 非法的UTF-8和二进制数据
+    CASE_EXPECT_TRUE(NULL == sniff_charset("\xC0\xAF", 2));
+    CASE_EXPECT_TRUE(NULL == sniff_charset("\xED\xA0\x80", 3));
+    CASE_EXPECT_TRUE(NULL == sniff_charset("\xD6\xD0\xCE\xC4", 4));
+    CASE_EXPECT_TRUE(NULL == sniff_charset("\x89PNG\r\n\x1A\n\0\0", 10));
+    CASE_EXPECT_TRUE(NULL == sniff_charset(NULL, 0));
+}
+
+CASE_TEST(http_content_type, common_paths) {
+    using namespace util::network::http_content_type;
+
+    // 静态文件服务常见的路径，传入长度时不需要以\0结尾
+    const char *cases[][2] = {
+        {"/static/index.html", "text/html"},
+        {"/static/js/app.min.js", "text/javascript"},
+        {"/static/css/site.css", "text/css"},
+        {"/images/logo.PNG", "image/png"},
+        {"/download/archive.tar.gz", "application/gzip"},
+        {"/api/data.json?page=1", "application/json"},
+        {"/fonts/font.woff2", "font/woff2"},
+        {"/unknown/file.notexists", "application/octet-stream"},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i) {
+        std::string path = std::string(cases[i][0]) + "x";
+        CASE_EXPECT_EQ(std::string(cases[i][1]), std::string(get_mime_type_by_path(path.c_str(), strlen(cases[i][0]))));
+    }
+}
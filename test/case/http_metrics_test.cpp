@@ -0,0 +1,242 @@
+﻿#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+#include <thread>
+#endif
+
+#include "common/file_system.h"
+#include "network/http_metrics.h"
+#include "network/http_request.h"
+
+#include "frame/test_macros.h"
+
+CASE_TEST(http_metrics, histogram_bucket) {
+    // 小于SUB_BUCKET_COUNT*2的值是精确的
+    for (uint64_t i = 0; i < util::network::http_histogram::SUB_BUCKET_COUNT * 2; ++i) {
+        size_t idx = util::network::http_histogram::get_bucket_index(i);
+        CASE_EXPECT_EQ(i, util::network::http_histogram::get_bucket_lowest_value(idx));
+        CASE_EXPECT_EQ(i, util::network::http_histogram::get_bucket_highest_value(idx));
+    }
+
+    // 更大的值相对误差不超过 1/SUB_BUCKET_COUNT
+    uint64_t values[] = {100, 1000, 12345, 999999, 60000000, 1ULL << 35};
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i) {
+        size_t   idx  = util::network::http_histogram::get_bucket_index(values[i]);
+        uint64_t low  = util::network::http_histogram::get_bucket_lowest_value(idx);
+        uint64_t high = util::network::http_histogram::get_bucket_highest_value(idx);
+        CASE_EXPECT_LE(low, values[i]);
+        CASE_EXPECT_GE(high, values[i]);
+        CASE_EXPECT_LE(high - low, values[i] / util::network::http_histogram::SUB_BUCKET_COUNT);
+        CASE_EXPECT_EQ(idx + 1, util::network::http_histogram::get_bucket_index(high + 1));
+    }
+
+    // 超出范围的值放在最后一个桶
+    CASE_EXPECT_EQ(util::network::http_histogram::BUCKET_COUNT - 1, util::network::http_histogram::get_bucket_index(UINT64_MAX));
+}
+
+CASE_TEST(http_metrics, histogram_percentile) {
+    util::network::http_histogram histogram;
+    util::network::http_histogram::snapshot_t snapshot;
+    histogram.snapshot(snapshot);
+    CASE_EXPECT_EQ(0, snapshot.count);
+    CASE_EXPECT_EQ(0, snapshot.percentile(0.5));
+
+    for (uint64_t i = 1; i <= 10000; ++i) {
+        histogram.record(i);
+    }
+    histogram.snapshot(snapshot);
+
+    CASE_EXPECT_EQ(10000, snapshot.count);
+    CASE_EXPECT_EQ(1, snapshot.min);
+    CASE_EXPECT_EQ(10000, snapshot.max);
+    CASE_EXPECT_EQ(50005000, snapshot.sum);
+    CASE_EXPECT_EQ(5000, static_cast<int>(snapshot.mean()));
+
+    uint64_t p50 = snapshot.percentile(0.5);
+    uint64_t p99 = snapshot.percentile(0.99);
+    CASE_EXPECT_GE(p50, 5000);
+    CASE_EXPECT_LE(p50, 5000 + 5000 / util::network::http_histogram::SUB_BUCKET_COUNT);
+    CASE_EXPECT_GE(p99, 9900);
+    CASE_EXPECT_LE(p99, 10000);
+    CASE_EXPECT_EQ(10000, snapshot.percentile(1.0));
+    CASE_EXPECT_EQ(1, snapshot.percentile(0.0));
+
+    util::network::http_histogram other;
+    other.record(100000);
+    util::network::http_histogram::snapshot_t other_snapshot;
+    other.snapshot(other_snapshot);
+    snapshot.merge(other_snapshot);
+    CASE_EXPECT_EQ(10001, snapshot.count);
+    CASE_EXPECT_EQ(100000, snapshot.max);
+    CASE_EXPECT_EQ(100000, snapshot.percentile(1.0));
+}
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+CASE_TEST(http_metrics, multi_thread) {
+    util::network::http_metrics metrics;
+
+    const int                  thread_count = 8;
+    const int                  loop_count   = 5000;
+    std::vector<std::thread *> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.push_back(new std::thread([&metrics, t, loop_count]() {
+            util::network::http_request_timing_t timing;
+            memset(&timing, 0, sizeof(timing));
+            for (int i = 0; i < loop_count; ++i) {
+                timing.new_connection = 0 == i % 10;
+                timing.dns_us         = 100;
+                timing.connect_us     = 200;
+                timing.ttfb_us        = static_cast<uint64_t>(1000 + i);
+                timing.total_us       = static_cast<uint64_t>(2000 + i);
+                timing.download_bytes = 10;
+                timing.response_code  = (0 == i % 5) ? 500 : 200;
+                metrics.record((t & 1) ? "a.example.com" : "b.example.com:8080", timing);
+            }
+        }));
+    }
+
+    for (size_t i = 0; i < threads.size(); ++i) {
+        threads[i]->join();
+        delete threads[i];
+    }
+
+    util::network::http_metrics::snapshot_t snapshot;
+    metrics.snapshot(snapshot);
+    CASE_EXPECT_EQ(4, snapshot.size());
+
+    uint64_t request_count = 0;
+    uint64_t error_count   = 0;
+    uint64_t dns_count     = 0;
+    uint64_t tls_count     = 0;
+    uint64_t bytes         = 0;
+    for (size_t i = 0; i < snapshot.size(); ++i) {
+        const util::network::http_metrics::snapshot_entry_t &entry = snapshot[i];
+        CASE_EXPECT_TRUE(2 == entry.status_group || 5 == entry.status_group);
+        CASE_EXPECT_EQ(entry.request_count, entry.phases[util::network::http_metrics::phase_t::EN_HMP_TOTAL].count);
+        request_count += entry.request_count;
+        error_count += entry.error_count;
+        dns_count += entry.phases[util::network::http_metrics::phase_t::EN_HMP_DNS].count;
+        tls_count += entry.phases[util::network::http_metrics::phase_t::EN_HMP_TLS].count;
+        bytes += entry.download_bytes;
+    }
+
+    CASE_EXPECT_EQ(thread_count * loop_count, request_count);
+    CASE_EXPECT_EQ(0, error_count);
+    // 复用的连接和没有TLS的请求不记录连接阶段
+    CASE_EXPECT_EQ(thread_count * loop_count / 10, dns_count);
+    CASE_EXPECT_EQ(0, tls_count);
+    CASE_EXPECT_EQ(thread_count * loop_count * 10, bytes);
+}
+#endif
+
+CASE_TEST(http_metrics, dump_to_log) {
+    util::network::http_metrics metrics;
+
+    util::network::http_request_timing_t timing;
+    memset(&timing, 0, sizeof(timing));
+    timing.total_us      = 1500;
+    timing.response_code = 404;
+    metrics.record("127.0.0.1:80", timing);
+    timing.response_code = 0;
+    timing.error_code    = 7;
+    metrics.record("127.0.0.1:80", timing);
+
+    std::vector<std::string>               lines;
+    util::log::log_wrapper::ptr_t          logger = util::log::log_wrapper::create_user_logger();
+    logger->init(util::log::log_wrapper::level_t::LOG_LW_INFO);
+    logger->add_sink([&lines](const util::log::log_wrapper::caller_info_t &, const char *content, size_t content_size) {
+        lines.push_back(std::string(content, content_size));
+    });
+
+    metrics.dump_to_log(*logger);
+    CASE_EXPECT_EQ(2, lines.size());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        CASE_EXPECT_NE(std::string::npos, lines[i].find("127.0.0.1:80"));
+        CASE_EXPECT_NE(std::string::npos, lines[i].find(util::network::http_metrics::get_phase_name(util::network::http_metrics::phase_t::EN_HMP_TOTAL)));
+    }
+
+    // 级别不够时不输出
+    lines.clear();
+    metrics.dump_to_log(*logger, util::log::log_wrapper::level_t::LOG_LW_DEBUG);
+    CASE_EXPECT_EQ(0, lines.size());
+}
+
+CASE_TEST(http_metrics, status_group) {
+    util::network::http_metrics metrics;
+
+    util::network::http_request_timing_t timing;
+    memset(&timing, 0, sizeof(timing));
+    // 超出1XX-5XX的状态码和没有响应的请求一起记录在0组
+    int codes[] = {0, 204, 503, 600, 99};
+    for (size_t i = 0; i < sizeof(codes) / sizeof(codes[0]); ++i) {
+        timing.response_code = codes[i];
+        metrics.record("127.0.0.1:80", timing);
+    }
+
+    util::network::http_metrics::snapshot_t snapshot;
+    metrics.snapshot(snapshot);
+    CASE_EXPECT_EQ(3, snapshot.size());
+    for (size_t i = 0; i < snapshot.size(); ++i) {
+        if (0 == snapshot[i].status_group) {
+            CASE_EXPECT_EQ(3, snapshot[i].request_count);
+        } else {
+            CASE_EXPECT_TRUE(2 == snapshot[i].status_group || 5 == snapshot[i].status_group);
+            CASE_EXPECT_EQ(1, snapshot[i].request_count);
+        }
+    }
+}
+
+#if defined(NETWORK_EVPOLL_ENABLE_LIBUV) && defined(NETWORK_ENABLE_CURL)
+#if NETWORK_ENABLE_CURL && NETWORK_EVPOLL_ENABLE_LIBUV
+
+CASE_TEST(http_metrics, request_timing) {
+    std::string file_path = util::file_system::get_cwd() + "/test-http-metrics.txt";
+    {
+        FILE *f = fopen(file_path.c_str(), "wb");
+        CASE_EXPECT_TRUE(NULL != f);
+        if (NULL == f) {
+            return;
+        }
+        std::string data(10000, 'm');
+        fwrite(data.data(), 1, data.size(), f);
+        fclose(f);
+    }
+
+    util::network::http_request::curl_m_bind_ptr_t multi;
+    CASE_EXPECT_EQ(0, util::network::http_request::create_curl_multi(uv_default_loop(), multi));
+    if (!multi) {
+        return;
+    }
+
+    util::network::http_metrics::ptr_t metrics = std::make_shared<util::network::http_metrics>();
+    util::network::http_request::set_curl_multi_metrics(multi.get(), metrics);
+
+    for (int i = 0; i < 3; ++i) {
+        util::network::http_request::ptr_t req = util::network::http_request::create(multi.get(), "file://" + file_path);
+        CASE_EXPECT_EQ(0, req->start(util::network::http_request::method_t::EN_MT_GET, true));
+
+        const util::network::http_request_timing_t &timing = req->get_timing();
+        CASE_EXPECT_EQ(10000, timing.download_bytes);
+        CASE_EXPECT_EQ(0, timing.error_code);
+        CASE_EXPECT_GE(timing.total_us, timing.ttfb_us);
+    }
+
+    util::network::http_metrics::snapshot_t snapshot;
+    metrics->snapshot(snapshot);
+    CASE_EXPECT_EQ(1, snapshot.size());
+    if (!snapshot.empty()) {
+        CASE_EXPECT_EQ(3, snapshot[0].request_count);
+        CASE_EXPECT_EQ(30000, snapshot[0].download_bytes);
+        CASE_EXPECT_EQ(3, snapshot[0].phases[util::network::http_metrics::phase_t::EN_HMP_TOTAL].count);
+    }
+
+    util::network::http_request::destroy_curl_multi(multi);
+    uv_run(uv_default_loop(), UV_RUN_DEFAULT);
+    util::file_system::remove(file_path.c_str());
+}
+
+#endif
+#endif
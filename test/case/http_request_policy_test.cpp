@@ -0,0 +1,333 @@
+﻿#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+
+#include "network/http_request_policy.h"
+
+#include "frame/test_macros.h"
+
+#if defined(NETWORK_EVPOLL_ENABLE_LIBUV) && defined(NETWORK_ENABLE_CURL)
+#if NETWORK_ENABLE_CURL && NETWORK_EVPOLL_ENABLE_LIBUV
+
+namespace {
+    // a tiny loopback HTTP server, response status and delay are decided by the path and how many times it's requested
+    struct test_policy_server;
+
+    struct test_policy_conn {
+        uv_tcp_t            tcp;
+        uv_timer_t          timer;
+        uv_write_t          write_req;
+        std::string         buffer;
+        std::string         response;
+        test_policy_server *server;
+        int                 close_pending;
+    };
+
+    struct test_policy_server {
+        typedef std::function<void(const std::string &path, int hit, int &status, int &delay_ms)> handler_t;
+
+        uv_loop_t *                  loop;
+        uv_tcp_t                     tcp;
+        int                          port;
+        std::map<std::string, int>   hits;
+        std::set<test_policy_conn *> conns;
+        handler_t                    handler;
+    };
+
+    static void test_policy_on_conn_closed(uv_handle_t *handle) {
+        test_policy_conn *conn = reinterpret_cast<test_policy_conn *>(handle->data);
+        if (0 == --conn->close_pending) {
+            delete conn;
+        }
+    }
+
+    static void test_policy_close_conn(test_policy_conn *conn) {
+        if (0 != conn->close_pending) {
+            return;
+        }
+
+        conn->server->conns.erase(conn);
+        conn->close_pending = 2;
+        uv_timer_stop(&conn->timer);
+        uv_close(reinterpret_cast<uv_handle_t *>(&conn->timer), test_policy_on_conn_closed);
+        uv_close(reinterpret_cast<uv_handle_t *>(&conn->tcp), test_policy_on_conn_closed);
+    }
+
+    static void test_policy_on_written(uv_write_t *req, int) {
+        test_policy_close_conn(reinterpret_cast<test_policy_conn *>(req->data));
+    }
+
+    static void test_policy_send(test_policy_conn *conn) {
+        uv_buf_t buf           = uv_buf_init(const_cast<char *>(conn->response.data()), static_cast<unsigned int>(conn->response.size()));
+        conn->write_req.data = conn;
+        uv_write(&conn->write_req, reinterpret_cast<uv_stream_t *>(&conn->tcp), &buf, 1, test_policy_on_written);
+    }
+
+    static void test_policy_on_delay(uv_timer_t *handle) { test_policy_send(reinterpret_cast<test_policy_conn *>(handle->data)); }
+
+    static void test_policy_on_alloc(uv_handle_t *, size_t suggested_size, uv_buf_t *buf) {
+        buf->base = new char[suggested_size];
+        buf->len  = suggested_size;
+    }
+
+    static void test_policy_on_read(uv_stream_t *stream, ssize_t nread, const uv_buf_t *buf) {
+        test_policy_conn *conn = reinterpret_cast<test_policy_conn *>(stream->data);
+        if (nread < 0) {
+            delete[] buf->base;
+            test_policy_close_conn(conn);
+            return;
+        }
+
+        conn->buffer.append(buf->base, static_cast<size_t>(nread));
+        delete[] buf->base;
+        if (!conn->response.empty() || std::string::npos == conn->buffer.find("\r\n\r\n")) {
+            return;
+        }
+
+        size_t      path_begin = conn->buffer.find(' ') + 1;
+        std::string path       = conn->buffer.substr(path_begin, conn->buffer.find(' ', path_begin) - path_begin);
+        int         status     = 200;
+        int         delay_ms   = 0;
+        int         hit        = ++conn->server->hits[path];
+        if (conn->server->handler) {
+            conn->server->handler(path, hit, status, delay_ms);
+        }
+
+        char header[128];
+        sprintf(header, "HTTP/1.1 %d TEST\r\nContent-Length: 2\r\nConnection: close\r\n\r\nok", status);
+        conn->response = header;
+        if (delay_ms > 0) {
+            uv_timer_start(&conn->timer, test_policy_on_delay, static_cast<uint64_t>(delay_ms), 0);
+        } else {
+            test_policy_send(conn);
+        }
+    }
+
+    static void test_policy_on_connection(uv_stream_t *stream, int status) {
+        if (0 != status) {
+            return;
+        }
+
+        test_policy_server *server = reinterpret_cast<test_policy_server *>(stream->data);
+        test_policy_conn *  conn   = new test_policy_conn();
+        conn->server               = server;
+        conn->close_pending        = 0;
+        uv_tcp_init(server->loop, &conn->tcp);
+        uv_timer_init(server->loop, &conn->timer);
+        conn->tcp.data   = conn;
+        conn->timer.data = conn;
+        server->conns.insert(conn);
+
+        uv_accept(stream, reinterpret_cast<uv_stream_t *>(&conn->tcp));
+        uv_read_start(reinterpret_cast<uv_stream_t *>(&conn->tcp), test_policy_on_alloc, test_policy_on_read);
+    }
+
+    struct test_policy_env {
+        uv_loop_t                                      loop;
+        util::network::http_request::curl_m_bind_ptr_t multi;
+        test_policy_server                             server;
+
+        test_policy_env() {
+            uv_loop_init(&loop);
+            util::network::http_request::create_curl_multi(&loop, multi);
+
+            server.loop = &loop;
+            uv_tcp_init(&loop, &server.tcp);
+            server.tcp.data = &server;
+
+            sockaddr_in addr;
+            uv_ip4_addr("127.0.0.1", 0, &addr);
+            uv_tcp_bind(&server.tcp, reinterpret_cast<const sockaddr *>(&addr), 0);
+            uv_listen(reinterpret_cast<uv_stream_t *>(&server.tcp), 128, test_policy_on_connection);
+
+            sockaddr_in bound;
+            int         len = sizeof(bound);
+            uv_tcp_getsockname(&server.tcp, reinterpret_cast<sockaddr *>(&bound), &len);
+            server.port = ntohs(bound.sin_port);
+        }
+
+        ~test_policy_env() {
+            while (!server.conns.empty()) {
+                test_policy_close_conn(*server.conns.begin());
+            }
+            uv_close(reinterpret_cast<uv_handle_t *>(&server.tcp), NULL);
+            util::network::http_request::destroy_curl_multi(multi);
+            uv_run(&loop, UV_RUN_DEFAULT);
+            uv_loop_close(&loop);
+        }
+
+        std::string url(const char *path) const {
+            char ret[64];
+            sprintf(ret, "http://127.0.0.1:%d%s", server.port, path);
+            return ret;
+        }
+
+        std::string host() const {
+            char ret[64];
+            sprintf(ret, "127.0.0.1:%d", server.port);
+            return ret;
+        }
+
+        // run until done or timeout
+        void run(const bool &done, uint64_t timeout_ms = 5000) {
+            uint64_t end = uv_now(&loop) + timeout_ms;
+            while (!done && uv_now(&loop) < end) {
+                uv_run(&loop, UV_RUN_ONCE);
+            }
+        }
+    };
+
+    struct test_policy_result {
+        bool done;
+        int  complete_count;
+        int  error_count;
+        int  response_code;
+
+        test_policy_result() : done(false), complete_count(0), error_count(0), response_code(0) {}
+
+        util::network::http_request_policy::setup_fn_t setup() {
+            return [this](util::network::http_request &req) {
+                req.set_opt_timeout(3000);
+                req.set_on_error([this](util::network::http_request &) {
+                    ++error_count;
+                    return 0;
+                });
+                req.set_on_complete([this](util::network::http_request &r) {
+                    ++complete_count;
+                    response_code = r.get_response_code();
+                    done          = true;
+                    return 0;
+                });
+            };
+        }
+    };
+} // namespace
+
+CASE_TEST(http_request_policy, retry) {
+    test_policy_env env;
+    env.server.handler = [](const std::string &, int hit, int &status, int &) { status = hit <= 2 ? 503 : 200; };
+
+    util::network::http_request_policy::options_t options;
+    options.retry_base_delay_ms = 10;
+    util::network::http_request_policy policy(env.multi.get(), options);
+
+    test_policy_result result;
+    CASE_EXPECT_EQ(0, policy.start_request(env.url("/flaky"), util::network::http_request::method_t::EN_MT_GET, result.setup()));
+    CASE_EXPECT_EQ(1, policy.get_running_count());
+    env.run(result.done);
+
+    // user callbacks are called once with the final attempt
+    CASE_EXPECT_EQ(1, result.complete_count);
+    CASE_EXPECT_EQ(0, result.error_count);
+    CASE_EXPECT_EQ(200, result.response_code);
+    CASE_EXPECT_EQ(3, env.server.hits["/flaky"]);
+    CASE_EXPECT_EQ(1, policy.get_stats().request_count);
+    CASE_EXPECT_EQ(3, policy.get_stats().attempt_count);
+    CASE_EXPECT_EQ(2, policy.get_stats().retry_count);
+    CASE_EXPECT_EQ(1, policy.get_stats().success_count);
+    CASE_EXPECT_EQ(0, policy.get_running_count());
+    CASE_EXPECT_GE(policy.get_latency_percentile(env.host(), 0.95), 0);
+
+    // POST is not retried when there is a response
+    test_policy_result post_result;
+    CASE_EXPECT_EQ(0, policy.start_request(env.url("/post"), util::network::http_request::method_t::EN_MT_POST,
+                                           [&post_result](util::network::http_request &req) {
+                                               req.post_data() = "a=b";
+                                               post_result.setup()(req);
+                                           }));
+    env.server.handler = [](const std::string &, int, int &status, int &) { status = 503; };
+    env.run(post_result.done);
+    CASE_EXPECT_EQ(503, post_result.response_code);
+    CASE_EXPECT_EQ(1, env.server.hits["/post"]);
+}
+
+CASE_TEST(http_request_policy, circuit_breaker) {
+    test_policy_env env;
+    env.server.handler = [](const std::string &, int, int &status, int &) { status = 503; };
+
+    util::network::http_request_policy::options_t options;
+    options.max_retries               = 1;
+    options.retry_base_delay_ms       = 1;
+    options.breaker_failure_threshold = 3;
+    options.breaker_open_ms           = 100000;
+    util::network::http_request_policy policy(env.multi.get(), options);
+
+    test_policy_result result1;
+    CASE_EXPECT_EQ(0, policy.start_request(env.url("/fail"), util::network::http_request::method_t::EN_MT_GET, result1.setup()));
+    env.run(result1.done);
+    CASE_EXPECT_EQ(503, result1.response_code);
+    CASE_EXPECT_EQ(2, env.server.hits["/fail"]);
+    CASE_EXPECT_EQ(util::network::http_request_policy::circuit_state_t::EN_CS_CLOSED, policy.get_circuit_state(env.host()));
+
+    // the third failure opens the circuit, so it's not retried
+    test_policy_result result2;
+    CASE_EXPECT_EQ(0, policy.start_request(env.url("/fail"), util::network::http_request::method_t::EN_MT_GET, result2.setup()));
+    env.run(result2.done);
+    CASE_EXPECT_EQ(3, env.server.hits["/fail"]);
+    CASE_EXPECT_EQ(util::network::http_request_policy::circuit_state_t::EN_CS_OPEN, policy.get_circuit_state(env.host()));
+    CASE_EXPECT_EQ(1, policy.get_stats().circuit_open_count);
+    CASE_EXPECT_EQ(2, policy.get_stats().failure_count);
+
+    test_policy_result result3;
+    CASE_EXPECT_EQ(util::network::http_request_policy::error_code_t::EN_ERR_CIRCUIT_OPEN,
+                   policy.start_request(env.url("/fail"), util::network::http_request::method_t::EN_MT_GET, result3.setup()));
+    CASE_EXPECT_EQ(1, policy.get_stats().circuit_rejected_count);
+    CASE_EXPECT_EQ(0, result3.complete_count);
+}
+
+CASE_TEST(http_request_policy, hedge) {
+    test_policy_env env;
+    // only the first request is slow
+    env.server.handler = [](const std::string &, int hit, int &, int &delay_ms) { delay_ms = 1 == hit ? 3000 : 0; };
+
+    util::network::http_request_policy::options_t options;
+    options.enable_hedge           = true;
+    options.hedge_default_delay_ms = 20;
+    std::shared_ptr<util::network::http_request_policy> policy =
+        std::make_shared<util::network::http_request_policy>(env.multi.get(), options);
+
+    test_policy_result result;
+    uint64_t           begin = uv_now(&env.loop);
+    CASE_EXPECT_EQ(0, policy->start_request(env.url("/slow"), util::network::http_request::method_t::EN_MT_GET, result.setup()));
+    env.run(result.done);
+    uint64_t cost = uv_now(&env.loop) - begin;
+
+    CASE_EXPECT_EQ(1, result.complete_count);
+    CASE_EXPECT_EQ(200, result.response_code);
+    CASE_EXPECT_LT(cost, 2000);
+    CASE_EXPECT_EQ(2, env.server.hits["/slow"]);
+    CASE_EXPECT_EQ(1, policy->get_stats().hedge_count);
+    CASE_EXPECT_EQ(1, policy->get_stats().hedge_win_count);
+    CASE_MSG_INFO() << "hedged request finished in " << cost << "ms, the slow one takes 3000ms" << std::endl;
+
+    // the loser is removed with the policy
+    policy.reset();
+}
+
+CASE_TEST(http_request_policy, budget) {
+    test_policy_env env;
+    env.server.handler = [](const std::string &, int, int &status, int &) { status = 503; };
+
+    util::network::http_request_policy::options_t options;
+    options.retry_base_delay_ms = 1;
+    options.budget_ratio        = 0;
+    options.budget_max_tokens   = 0;
+    util::network::http_request_policy policy(env.multi.get(), options);
+
+    test_policy_result result;
+    CASE_EXPECT_EQ(0, policy.start_request(env.url("/budget"), util::network::http_request::method_t::EN_MT_GET, result.setup()));
+    env.run(result.done);
+
+    // HTTP errors are delivered by on_success, the same as http_request
+    CASE_EXPECT_EQ(503, result.response_code);
+    CASE_EXPECT_EQ(0, result.error_count);
+    CASE_EXPECT_EQ(1, env.server.hits["/budget"]);
+    CASE_EXPECT_EQ(0, policy.get_stats().retry_count);
+    CASE_EXPECT_EQ(1, policy.get_stats().budget_exhausted_count);
+}
+
+#endif
+#endif
@@ -0,0 +1,227 @@
+﻿#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "common/file_system.h"
+#include "network/http_request.h"
+#include "network/http_request_source.h"
+
+#include "frame/test_macros.h"
+
+namespace {
+    static std::string test_source_read_all(util::network::http_request_source &source, size_t block_size) {
+        std::string       ret;
+        std::vector<char> buffer(block_size);
+        while (true) {
+            size_t res = source.read(&buffer[0], buffer.size());
+            if (0 == res || util::network::http_request_source::read_result_t::EN_RR_ABORT == res) {
+                break;
+            }
+            if (util::network::http_request_source::read_result_t::EN_RR_PAUSE == res) {
+                continue;
+            }
+            ret.append(&buffer[0], res);
+        }
+        return ret;
+    }
+
+    static std::string test_source_make_data(size_t sz) {
+        std::string ret;
+        ret.reserve(sz);
+        char line[32];
+        while (ret.size() < sz) {
+            int len = sprintf(line, "line %d\n", static_cast<int>(ret.size()));
+            ret.append(line, static_cast<size_t>(len));
+        }
+        ret.resize(sz);
+        return ret;
+    }
+
+#if defined(NETWORK_ENABLE_ZLIB) && NETWORK_ENABLE_ZLIB
+    static std::string test_source_gunzip(const std::string &in) {
+        std::string ret;
+        z_stream    stream;
+        memset(&stream, 0, sizeof(stream));
+        if (Z_OK != inflateInit2(&stream, MAX_WBITS + 32)) {
+            return ret;
+        }
+
+        char buffer[4096];
+        stream.next_in  = reinterpret_cast<Bytef *>(const_cast<char *>(in.data()));
+        stream.avail_in = static_cast<uInt>(in.size());
+        int res         = Z_OK;
+        while (Z_OK == res) {
+            stream.next_out  = reinterpret_cast<Bytef *>(buffer);
+            stream.avail_out = sizeof(buffer);
+            res              = inflate(&stream, Z_NO_FLUSH);
+            ret.append(buffer, sizeof(buffer) - stream.avail_out);
+        }
+        inflateEnd(&stream);
+        return ret;
+    }
+#endif
+} // namespace
+
+CASE_TEST(http_request_source, file_source) {
+    std::string file_path = "test-http-request-source.txt";
+    std::string data      = test_source_make_data(100000);
+    {
+        FILE *f = fopen(file_path.c_str(), "wb");
+        CASE_EXPECT_TRUE(NULL != f);
+        if (NULL == f) {
+            return;
+        }
+        fwrite(data.data(), 1, data.size(), f);
+        fclose(f);
+    }
+
+    for (int use_mmap = 0; use_mmap < 2; ++use_mmap) {
+        util::network::http_file_source source;
+        CASE_EXPECT_FALSE(source.is_open());
+        CASE_EXPECT_EQ(-1, source.size());
+        CASE_EXPECT_EQ(util::network::http_request_source::read_result_t::EN_RR_ABORT, source.read(NULL, 0));
+
+        CASE_EXPECT_EQ(0, source.open(file_path.c_str(), 0 != use_mmap));
+        CASE_EXPECT_TRUE(source.is_open());
+        CASE_EXPECT_EQ(data.size(), source.size());
+        CASE_EXPECT_TRUE(NULL == source.content_encoding());
+
+        CASE_EXPECT_EQ(data, test_source_read_all(source, 3000));
+        // 重发时从头开始
+        CASE_EXPECT_TRUE(source.rewind());
+        CASE_EXPECT_EQ(data, test_source_read_all(source, 16384));
+    }
+
+    util::network::http_file_source source;
+    CASE_EXPECT_NE(0, source.open("not-exists-http-request-source.txt"));
+    CASE_EXPECT_FALSE(source.is_open());
+
+    util::file_system::remove(file_path.c_str());
+}
+
+CASE_TEST(http_request_source, generator_source) {
+    int                                   index = 0;
+    util::network::http_generator_source source([&index](char *buffer, size_t sz) -> size_t {
+        if (index >= 5) {
+            return 0;
+        }
+
+        // 模拟暂时没有数据
+        if (1 == index++) {
+            return util::network::http_request_source::read_result_t::EN_RR_PAUSE;
+        }
+        return static_cast<size_t>(sprintf(buffer, "%d,", index)) > sz ? 0 : strlen(buffer);
+    });
+
+    CASE_EXPECT_EQ(-1, source.size());
+    CASE_EXPECT_FALSE(source.rewind());
+    CASE_EXPECT_EQ(std::string("1,3,4,5,"), test_source_read_all(source, 64));
+}
+
+#if defined(NETWORK_ENABLE_ZLIB) && NETWORK_ENABLE_ZLIB
+CASE_TEST(http_request_source, compress_source) {
+    std::string data   = test_source_make_data(1000000);
+    size_t      offset = 0;
+    int         pauses = 0;
+
+    util::network::http_generator_source::ptr_t upstream = std::make_shared<util::network::http_generator_source>(
+        [&data, &offset, &pauses](char *buffer, size_t sz) -> size_t {
+            // 每次都先暂停一下，测试背压
+            if (0 == (pauses++ & 1)) {
+                return util::network::http_request_source::read_result_t::EN_RR_PAUSE;
+            }
+
+            if (sz > data.size() - offset) {
+                sz = data.size() - offset;
+            }
+            memcpy(buffer, data.data() + offset, sz);
+            offset += sz;
+            return sz;
+        },
+        static_cast<int64_t>(data.size()),
+        [&offset]() {
+            offset = 0;
+            return true;
+        });
+
+    for (int codec = 0; codec < 2; ++codec) {
+        offset = 0;
+        util::network::http_compress_source source(upstream, static_cast<util::network::http_compress_source::codec_t::type>(codec));
+        CASE_EXPECT_EQ(-1, source.size());
+        CASE_EXPECT_EQ(std::string(0 == codec ? "gzip" : "deflate"), std::string(source.content_encoding()));
+
+        std::string compressed = test_source_read_all(source, 1000);
+        CASE_EXPECT_LT(compressed.size(), data.size() / 4);
+        CASE_EXPECT_EQ(data.size(), source.get_input_size());
+        CASE_EXPECT_EQ(compressed.size(), source.get_output_size());
+        CASE_EXPECT_EQ(data, test_source_gunzip(compressed));
+
+        // 重新压缩的结果一样
+        CASE_EXPECT_TRUE(source.rewind());
+        CASE_EXPECT_EQ(compressed, test_source_read_all(source, 16384));
+    }
+}
+#endif
+
+#if defined(NETWORK_EVPOLL_ENABLE_LIBUV) && defined(NETWORK_ENABLE_CURL)
+#if NETWORK_ENABLE_CURL && NETWORK_EVPOLL_ENABLE_LIBUV
+
+CASE_TEST(http_request_source, upload) {
+    std::string src_path = util::file_system::get_cwd() + "/test-http-request-source-src.txt";
+    std::string dst_path = util::file_system::get_cwd() + "/test-http-request-source-dst.txt";
+    std::string data     = test_source_make_data(300000);
+    {
+        FILE *f = fopen(src_path.c_str(), "wb");
+        CASE_EXPECT_TRUE(NULL != f);
+        if (NULL == f) {
+            return;
+        }
+        fwrite(data.data(), 1, data.size(), f);
+        fclose(f);
+    }
+
+    util::network::http_request::curl_m_bind_ptr_t multi;
+    CASE_EXPECT_EQ(0, util::network::http_request::create_curl_multi(uv_default_loop(), multi));
+    if (!multi) {
+        return;
+    }
+
+    // file:// 上传会把数据写入目标文件
+    {
+        util::network::http_file_source::ptr_t source = std::make_shared<util::network::http_file_source>();
+        CASE_EXPECT_EQ(0, source->open(src_path.c_str(), true));
+
+        util::network::http_request::ptr_t req = util::network::http_request::create(multi.get(), "file://" + dst_path);
+        req->set_request_source(source);
+        CASE_EXPECT_EQ(0, req->start(util::network::http_request::method_t::EN_MT_PUT, true));
+        CASE_EXPECT_EQ(data.size(), req->get_timing().upload_bytes);
+
+        std::string content;
+        CASE_EXPECT_TRUE(util::file_system::get_file_content(content, dst_path.c_str(), true));
+        CASE_EXPECT_EQ(data, content);
+    }
+
+#if defined(NETWORK_ENABLE_ZLIB) && NETWORK_ENABLE_ZLIB
+    {
+        util::network::http_file_source::ptr_t source = std::make_shared<util::network::http_file_source>();
+        CASE_EXPECT_EQ(0, source->open(src_path.c_str()));
+
+        util::network::http_request::ptr_t req = util::network::http_request::create(multi.get(), "file://" + dst_path);
+        req->set_request_source(std::make_shared<util::network::http_compress_source>(source));
+        CASE_EXPECT_EQ(0, req->start(util::network::http_request::method_t::EN_MT_PUT, true));
+
+        std::string content;
+        CASE_EXPECT_TRUE(util::file_system::get_file_content(content, dst_path.c_str(), true));
+        CASE_EXPECT_EQ(data, test_source_gunzip(content));
+    }
+#endif
+
+    util::network::http_request::destroy_curl_multi(multi);
+    uv_run(uv_default_loop(), UV_RUN_DEFAULT);
+    util::file_system::remove(src_path.c_str());
+    util::file_system::remove(dst_path.c_str());
+}
+
+#endif
+#endif
@@ -0,0 +1,207 @@
+﻿#include <cstring>
+#include <string>
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+#include <thread>
+#endif
+
+#include "network/http_client.h"
+#include "network/http_request.h"
+#include "network/http_server.h"
+
+#include "frame/test_macros.h"
+
+#if defined(NETWORK_EVPOLL_ENABLE_LIBUV) && defined(NETWORK_ENABLE_CURL)
+#if NETWORK_ENABLE_CURL && NETWORK_EVPOLL_ENABLE_LIBUV
+
+CASE_TEST(http_request, handle_pool) {
+    util::network::http_request::curl_m_bind_ptr_t multi;
+    CASE_EXPECT_EQ(0, util::network::http_request::create_curl_multi(uv_default_loop(), multi));
+    if (!multi) {
+        return;
+    }
+
+    CASE_EXPECT_EQ(0, util::network::http_request::set_curl_multi_connection_limit(multi.get(), 4, 64));
+
+    const util::network::http_request::curl_handle_stats_t *stats = util::network::http_request::get_curl_multi_stats(multi.get());
+    CASE_EXPECT_TRUE(NULL != stats);
+    if (NULL == stats) {
+        return;
+    }
+
+    {
+        util::network::http_request::ptr_t req = util::network::http_request::create(multi.get(), "http://127.0.0.1:1/");
+        CASE_EXPECT_TRUE(!!req);
+        req->set_opt_timeout(1000);
+        // nothing listens here, so it fails fast
+        CASE_EXPECT_NE(0, req->start(util::network::http_request::method_t::EN_MT_GET, true));
+        CASE_EXPECT_NE(0, req->get_error_code());
+    }
+    CASE_EXPECT_EQ(1, stats->created_count);
+    CASE_EXPECT_EQ(0, stats->reused_count);
+    CASE_EXPECT_EQ(1, stats->request_count);
+
+    // the released handle is reused
+    {
+        util::network::http_request::ptr_t req1 = util::network::http_request::create(multi.get(), "http://127.0.0.1:1/");
+        util::network::http_request::ptr_t req2 = util::network::http_request::create(multi.get(), "http://127.0.0.1:1/");
+        CASE_EXPECT_EQ(2, stats->created_count);
+        CASE_EXPECT_EQ(1, stats->reused_count);
+    }
+
+    util::network::http_request::set_curl_multi_max_free_handles(multi.get(), 1);
+    {
+        util::network::http_request::ptr_t req = util::network::http_request::create(multi.get(), "http://127.0.0.1:1/");
+        CASE_EXPECT_EQ(2, stats->reused_count);
+
+        // the request can be released after the manager is destroyed
+        util::network::http_request::destroy_curl_multi(multi);
+        uv_run(uv_default_loop(), UV_RUN_DEFAULT);
+    }
+}
+
+CASE_TEST(http_request, plain_http_stats) {
+    uv_loop_t loop;
+    uv_loop_init(&loop);
+
+    util::network::http_server server;
+    server.set_route("/health", [](const util::network::http_server_request &, util::network::http_server_response &rsp) { rsp.body = "ok"; });
+    CASE_EXPECT_EQ(0, server.listen(&loop, "127.0.0.1", 0));
+
+    util::network::http_request::curl_m_bind_ptr_t multi;
+    CASE_EXPECT_EQ(0, util::network::http_request::create_curl_multi(&loop, multi));
+    if (!multi) {
+        server.close();
+        uv_run(&loop, UV_RUN_DEFAULT);
+        uv_loop_close(&loop);
+        return;
+    }
+    const util::network::http_request::curl_handle_stats_t *stats = util::network::http_request::get_curl_multi_stats(multi.get());
+
+    char url[64];
+    sprintf(url, "http://127.0.0.1:%d/health", server.get_port());
+    {
+        bool                               done = false;
+        util::network::http_request::ptr_t req  = util::network::http_request::create(multi.get(), url);
+        req->set_opt_timeout(5000);
+        req->set_on_complete([&done](util::network::http_request &) {
+            done = true;
+            return 0;
+        });
+        CASE_EXPECT_EQ(0, req->start(util::network::http_request::method_t::EN_MT_GET, false));
+
+        uint64_t end = uv_now(&loop) + 5000;
+        while (!done && uv_now(&loop) < end) {
+            uv_run(&loop, UV_RUN_ONCE);
+        }
+        CASE_EXPECT_TRUE(done);
+        CASE_EXPECT_EQ(200, req->get_response_code());
+        CASE_EXPECT_TRUE(req->get_timing().new_connection);
+        CASE_EXPECT_EQ(0, req->get_timing().tls_us);
+    }
+
+    // 没有TLS握手的连接不计入appconnect_time_us
+    CASE_EXPECT_EQ(1, stats->request_count);
+    CASE_EXPECT_EQ(1, stats->new_connection_count);
+    CASE_EXPECT_EQ(0, stats->appconnect_time_us);
+
+    util::network::http_request::destroy_curl_multi(multi);
+    server.close();
+    uv_run(&loop, UV_RUN_DEFAULT);
+    CASE_EXPECT_EQ(0, uv_loop_close(&loop));
+}
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+CASE_TEST(http_request, client_dispatch) {
+    uv_loop_t loop;
+    uv_loop_init(&loop);
+
+    util::network::http_client::options_t options;
+    options.thread_count = 4;
+
+    util::network::http_client client;
+    CASE_EXPECT_EQ(0, client.init(&loop, options));
+    CASE_EXPECT_EQ(4, client.get_worker_count());
+
+    // the same host always uses the same worker
+    size_t idx = client.select_worker("http://user@example.com:8080/a?b=c");
+    CASE_EXPECT_EQ(idx, client.select_worker("https://example.com:8080/other/path"));
+    CASE_EXPECT_EQ(idx, client.select_worker("example.com:8080"));
+
+    const int       request_count = 16;
+    int             error_count   = 0;
+    int             complete_count = 0;
+    int             wrong_thread  = 0;
+    std::thread::id caller_id     = std::this_thread::get_id();
+    for (int i = 0; i < request_count; ++i) {
+        char url[64];
+        sprintf(url, "http://127.0.0.%d:1/", i % 4 + 1);
+        CASE_EXPECT_EQ(0, client.start_request(url, util::network::http_request::method_t::EN_MT_GET,
+                                               [&](util::network::http_request &req) {
+                                                   req.set_opt_timeout(1000);
+                                                   req.set_on_error([&](util::network::http_request &) {
+                                                       ++error_count;
+                                                       return 0;
+                                                   });
+                                                   req.set_on_complete([&](util::network::http_request &) {
+                                                       ++complete_count;
+                                                       if (std::this_thread::get_id() != caller_id) {
+                                                           ++wrong_thread;
+                                                       }
+                                                       return 0;
+                                                   });
+                                               }));
+    }
+    CASE_EXPECT_EQ(request_count, client.get_running_count());
+
+    // returns after all results are delivered
+    uv_run(&loop, UV_RUN_DEFAULT);
+    CASE_EXPECT_EQ(request_count, error_count);
+    CASE_EXPECT_EQ(request_count, complete_count);
+    CASE_EXPECT_EQ(0, wrong_thread);
+    CASE_EXPECT_EQ(0, client.get_running_count());
+    for (size_t i = 0; i < client.get_worker_count(); ++i) {
+        CASE_EXPECT_EQ(0, client.get_worker_pending_count(i));
+    }
+
+    client.close();
+    uv_run(&loop, UV_RUN_DEFAULT);
+    CASE_EXPECT_EQ(0, uv_loop_close(&loop));
+}
+
+CASE_TEST(http_request, client_close) {
+    uv_loop_t loop;
+    uv_loop_init(&loop);
+
+    util::network::http_client::options_t options;
+    options.thread_count  = 2;
+    options.dispatch_mode = util::network::http_client::dispatch_mode_t::EN_DM_LEAST_LOADED;
+
+    util::network::http_client client;
+    CASE_EXPECT_EQ(0, client.init(&loop, options));
+
+    int complete_count = 0;
+    for (int i = 0; i < 8; ++i) {
+        client.start_request("http://127.0.0.1:1/", util::network::http_request::method_t::EN_MT_GET,
+                             [&complete_count](util::network::http_request &req) {
+                                 req.set_on_complete([&complete_count](util::network::http_request &) {
+                                     ++complete_count;
+                                     return 0;
+                                 });
+                             });
+    }
+
+    // requests started are delivered or dropped when closing
+    client.close();
+    CASE_EXPECT_LE(complete_count, 8);
+    CASE_EXPECT_EQ(0, client.get_running_count());
+    CASE_EXPECT_EQ(-1, client.start_request("http://127.0.0.1:1/", util::network::http_request::method_t::EN_MT_GET,
+                                            util::network::http_client::setup_fn_t()));
+
+    uv_run(&loop, UV_RUN_DEFAULT);
+    CASE_EXPECT_EQ(0, uv_loop_close(&loop));
+}
+#endif
+
+#endif
+#endif
@@ -0,0 +1,141 @@
+﻿#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "common/file_system.h"
+#include "network/http_response_sink.h"
+
+#include "frame/test_macros.h"
+
+CASE_TEST(http_response_sink, buffer_chain) {
+    util::network::http_buffer_chain buffer;
+    CASE_EXPECT_TRUE(buffer.empty());
+    CASE_EXPECT_EQ(0, buffer.segment_count());
+
+    std::string expect;
+    for (int i = 0; i < 3000; ++i) {
+        char line[32];
+        int  len = sprintf(line, "line %d\n", i);
+        CASE_EXPECT_EQ(static_cast<size_t>(len), buffer.write(line, static_cast<size_t>(len)));
+        expect.append(line, static_cast<size_t>(len));
+    }
+
+    // 一次写入超过一段的数据
+    std::string large(util::network::http_buffer_chain::SEGMENT_SIZE * 2 + 100, 'z');
+    buffer.write(large.data(), large.size());
+    expect += large;
+
+    CASE_EXPECT_EQ(expect.size(), buffer.size());
+    CASE_EXPECT_GT(buffer.segment_count(), 2);
+    CASE_EXPECT_EQ(expect, buffer.to_string());
+
+    // 分段读取
+    std::string by_segment;
+    for (size_t i = 0; i < buffer.segment_count(); ++i) {
+        util::network::http_buffer_chain::span_t seg = buffer.segment(i);
+        CASE_EXPECT_LE(seg.size, static_cast<size_t>(util::network::http_buffer_chain::SEGMENT_SIZE));
+        by_segment.append(seg.data, seg.size);
+    }
+    CASE_EXPECT_EQ(expect, by_segment);
+    CASE_EXPECT_TRUE(NULL == buffer.segment(buffer.segment_count()).data);
+
+    // 跨段复制
+    char   part[100];
+    size_t offset = util::network::http_buffer_chain::SEGMENT_SIZE - 50;
+    CASE_EXPECT_EQ(sizeof(part), buffer.copy_to(part, sizeof(part), offset));
+    CASE_EXPECT_EQ(expect.substr(offset, sizeof(part)), std::string(part, sizeof(part)));
+    CASE_EXPECT_EQ(10, buffer.copy_to(part, sizeof(part), expect.size() - 10));
+    CASE_EXPECT_EQ(0, buffer.copy_to(part, sizeof(part), expect.size() + 10));
+
+    util::network::http_buffer_chain::span_t all = buffer.linearize();
+    CASE_EXPECT_EQ(1, buffer.segment_count());
+    CASE_EXPECT_EQ(expect.size(), all.size);
+    CASE_EXPECT_EQ(expect, std::string(all.data, all.size));
+
+    buffer.clear();
+    CASE_EXPECT_TRUE(buffer.empty());
+    CASE_EXPECT_EQ(0, buffer.segment_count());
+    CASE_EXPECT_EQ(std::string(), buffer.to_string());
+}
+
+CASE_TEST(http_response_sink, buffer_chain_reserve) {
+    util::network::http_buffer_chain buffer;
+
+    // 按Content-Length预先分配后只有一段，linearize不需要复制
+    const size_t total = 100000;
+    buffer.reserve(total);
+    CASE_EXPECT_EQ(1, buffer.segment_count());
+
+    std::string expect;
+    while (expect.size() < total) {
+        std::string chunk(1000, static_cast<char>('a' + expect.size() % 26));
+        buffer.write(chunk.data(), chunk.size());
+        expect += chunk;
+    }
+
+    CASE_EXPECT_EQ(1, buffer.segment_count());
+    util::network::http_buffer_chain::span_t seg = buffer.segment(0);
+    util::network::http_buffer_chain::span_t all = buffer.linearize();
+    CASE_EXPECT_TRUE(seg.data == all.data);
+    CASE_EXPECT_EQ(expect, std::string(all.data, all.size));
+
+    // 已经足够时不会再分配
+    buffer.reserve(10);
+    CASE_EXPECT_EQ(1, buffer.segment_count());
+}
+
+CASE_TEST(http_response_sink, segment_pool) {
+    util::network::http_buffer_chain::set_pool_max_cached_count(8);
+    util::network::http_buffer_chain::set_pool_max_cached_count(0);
+    CASE_EXPECT_EQ(0, util::network::http_buffer_chain::get_pool_cached_count());
+
+    util::network::http_buffer_chain::set_pool_max_cached_count(4);
+    {
+        util::network::http_buffer_chain buffer;
+        std::string                      data(util::network::http_buffer_chain::SEGMENT_SIZE * 6, 'x');
+        buffer.write(data.data(), data.size());
+        CASE_EXPECT_EQ(6, buffer.segment_count());
+    }
+    // 释放后最多缓存4段
+    CASE_EXPECT_EQ(4, util::network::http_buffer_chain::get_pool_cached_count());
+
+    {
+        util::network::http_buffer_chain buffer;
+        buffer.write("hello", 5);
+        CASE_EXPECT_EQ(3, util::network::http_buffer_chain::get_pool_cached_count());
+    }
+    CASE_EXPECT_EQ(4, util::network::http_buffer_chain::get_pool_cached_count());
+
+    util::network::http_buffer_chain::set_pool_max_cached_count(256);
+}
+
+CASE_TEST(http_response_sink, file_sink) {
+    std::string file_path = "test-http-response-sink.txt";
+
+    {
+        util::network::http_file_sink sink;
+        CASE_EXPECT_FALSE(sink.is_open());
+        CASE_EXPECT_EQ(0, sink.write("abc", 3));
+
+        CASE_EXPECT_EQ(0, sink.open(file_path.c_str()));
+        CASE_EXPECT_TRUE(sink.is_open());
+        CASE_EXPECT_EQ(6, sink.write("hello ", 6));
+        CASE_EXPECT_EQ(5, sink.write("world", 5));
+        sink.finish();
+        CASE_EXPECT_EQ(11, sink.size());
+    }
+
+    std::string content;
+    CASE_EXPECT_TRUE(util::file_system::get_file_content(content, file_path.c_str()));
+    CASE_EXPECT_EQ(std::string("hello world"), content);
+
+    {
+        util::network::http_file_sink sink;
+        CASE_EXPECT_EQ(0, sink.open(file_path.c_str(), true));
+        sink.write("!", 1);
+    }
+    CASE_EXPECT_TRUE(util::file_system::get_file_content(content, file_path.c_str()));
+    CASE_EXPECT_EQ(std::string("hello world!"), content);
+
+    util::file_system::remove(file_path.c_str());
+}
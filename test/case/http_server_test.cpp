@@ -0,0 +1,348 @@
+﻿#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "cli/cmd_option.h"
+#include "network/http_server.h"
+
+#include "frame/test_macros.h"
+
+CASE_TEST(http_server, parser) {
+    util::network::http_server_parser parser;
+    const char request[] = "POST /api/%E4%BD%A0%E5%A5%BD?a=1&b=2 HTTP/1.1\r\n"
+                           "Host: localhost\r\n"
+                           "X-Test:   value with space  \r\n"
+                           "Content-Length: 11\r\n"
+                           "\r\n"
+                           "hello worldGET / HTTP/1.0\r\n\r\n";
+
+    // 一个字节一个字节地解析，结果和一次解析完一样
+    size_t offset = 0;
+    while (offset < sizeof(request) - 1 && !parser.is_done()) {
+        offset += parser.parse(request + offset, 1);
+    }
+
+    CASE_EXPECT_TRUE(parser.is_done());
+    const util::network::http_server_request &req = parser.get_request();
+    CASE_EXPECT_EQ(std::string("POST"), req.method);
+    CASE_EXPECT_EQ(std::string("/api/\xE4\xBD\xA0\xE5\xA5\xBD"), req.path);
+    CASE_EXPECT_EQ(std::string("a=1&b=2"), req.query);
+    CASE_EXPECT_EQ(1, req.version_minor);
+    CASE_EXPECT_TRUE(req.keep_alive);
+    CASE_EXPECT_EQ(std::string("hello world"), req.body);
+    CASE_EXPECT_TRUE(NULL != req.get_header("host"));
+    CASE_EXPECT_TRUE(NULL == req.get_header("not-exists"));
+    if (NULL != req.get_header("x-test")) {
+        CASE_EXPECT_EQ(std::string("value with space"), *req.get_header("x-test"));
+    }
+
+    // 流水线的下一个请求
+    parser.reset();
+    offset += parser.parse(request + offset, sizeof(request) - 1 - offset);
+    CASE_EXPECT_EQ(sizeof(request) - 1, offset);
+    CASE_EXPECT_TRUE(parser.is_done());
+    CASE_EXPECT_EQ(std::string("GET"), parser.get_request().method);
+    CASE_EXPECT_EQ(std::string("/"), parser.get_request().path);
+    CASE_EXPECT_FALSE(parser.get_request().keep_alive);
+}
+
+CASE_TEST(http_server, parser_error) {
+    struct test_case_t {
+        const char *data;
+        int         status;
+    };
+    test_case_t cases[] = {
+        {"GET /\r\n\r\n", 400},
+        {"GET / HTTP/2.0\r\n\r\n", 505},
+        {"GET / HTTP/1.1\r\nBad Header\r\n\r\n", 400},
+        {"GET / HTTP/1.1\r\n folded: header\r\n\r\n", 400},
+        {"POST / HTTP/1.1\r\nContent-Length: abc\r\n\r\n", 400},
+        {"POST / HTTP/1.1\r\nContent-Length: 2000\r\n\r\n", 413},
+        {"POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n", 501},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i) {
+        util::network::http_server_parser parser(256, 1024);
+        parser.parse(cases[i].data, strlen(cases[i].data));
+        CASE_EXPECT_TRUE(parser.has_error());
+        CASE_EXPECT_EQ(cases[i].status, parser.get_error_status());
+    }
+
+    util::network::http_server_parser parser(256, 1024);
+    std::string                       large = "GET / HTTP/1.1\r\nX-Large: " + std::string(300, 'x');
+    parser.parse(large.data(), large.size());
+    CASE_EXPECT_TRUE(parser.has_error());
+    CASE_EXPECT_EQ(431, parser.get_error_status());
+
+    // Connection头
+    parser.reset();
+    const char close_req[] = "GET / HTTP/1.1\r\nConnection: Upgrade, close\r\n\r\n";
+    parser.parse(close_req, sizeof(close_req) - 1);
+    CASE_EXPECT_TRUE(parser.is_done());
+    CASE_EXPECT_FALSE(parser.get_request().keep_alive);
+
+    parser.reset();
+    const char keep_alive_req[] = "\r\nGET / HTTP/1.0\nConnection: Keep-Alive\n\n";
+    parser.parse(keep_alive_req, sizeof(keep_alive_req) - 1);
+    CASE_EXPECT_TRUE(parser.is_done());
+    CASE_EXPECT_TRUE(parser.get_request().keep_alive);
+}
+
+#if defined(NETWORK_EVPOLL_ENABLE_LIBUV) && NETWORK_EVPOLL_ENABLE_LIBUV
+
+namespace {
+    // 直接用原始的TCP连接测试，可以控制发送的内容
+    struct test_server_client {
+        uv_tcp_t     tcp;
+        uv_connect_t connect_req;
+        uv_write_t   write_req;
+        std::string  request;
+        std::string  response;
+        bool         closed;
+        char         buffer[4096];
+
+        test_server_client() : closed(false) {}
+    };
+
+    static void test_server_client_on_closed(uv_handle_t *handle) {
+        test_server_client *client = reinterpret_cast<test_server_client *>(handle->data);
+        client->closed             = true;
+    }
+
+    static void test_server_client_on_alloc(uv_handle_t *handle, size_t, uv_buf_t *buf) {
+        test_server_client *client = reinterpret_cast<test_server_client *>(handle->data);
+        buf->base                  = client->buffer;
+        buf->len                   = sizeof(client->buffer);
+    }
+
+    static void test_server_client_on_read(uv_stream_t *stream, ssize_t nread, const uv_buf_t *buf) {
+        test_server_client *client = reinterpret_cast<test_server_client *>(stream->data);
+        if (nread < 0) {
+            uv_close(reinterpret_cast<uv_handle_t *>(&client->tcp), test_server_client_on_closed);
+            return;
+        }
+        client->response.append(buf->base, static_cast<size_t>(nread));
+    }
+
+    static void test_server_client_on_written(uv_write_t *, int) {}
+
+    static void test_server_client_on_connected(uv_connect_t *req, int status) {
+        test_server_client *client = reinterpret_cast<test_server_client *>(req->data);
+        if (0 != status) {
+            uv_close(reinterpret_cast<uv_handle_t *>(&client->tcp), test_server_client_on_closed);
+            return;
+        }
+
+        uv_read_start(reinterpret_cast<uv_stream_t *>(&client->tcp), test_server_client_on_alloc, test_server_client_on_read);
+        uv_buf_t buf = uv_buf_init(&client->request[0], static_cast<unsigned int>(client->request.size()));
+        uv_write(&client->write_req, reinterpret_cast<uv_stream_t *>(&client->tcp), &buf, 1, test_server_client_on_written);
+    }
+
+    static void test_server_client_start(uv_loop_t *loop, test_server_client &client, int port, const std::string &request) {
+        client.request = request;
+        uv_tcp_init(loop, &client.tcp);
+        client.tcp.data         = &client;
+        client.connect_req.data = &client;
+
+        sockaddr_in addr;
+        uv_ip4_addr("127.0.0.1", port, &addr);
+        uv_tcp_connect(&client.connect_req, &client.tcp, reinterpret_cast<const sockaddr *>(&addr), test_server_client_on_connected);
+    }
+
+    static void test_server_run(uv_loop_t *loop, const bool &done, uint64_t timeout_ms = 5000) {
+        uint64_t end = uv_now(loop) + timeout_ms;
+        while (!done && uv_now(loop) < end) {
+            uv_run(loop, UV_RUN_ONCE);
+        }
+    }
+
+    static size_t test_server_count(const std::string &data, const char *sub) {
+        size_t ret = 0;
+        for (size_t pos = data.find(sub); std::string::npos != pos; pos = data.find(sub, pos + 1)) {
+            ++ret;
+        }
+        return ret;
+    }
+} // namespace
+
+CASE_TEST(http_server, keep_alive_and_pipeline) {
+    uv_loop_t loop;
+    uv_loop_init(&loop);
+
+    util::network::http_server server;
+    server.set_route("/health", [](const util::network::http_server_request &, util::network::http_server_response &rsp) { rsp.body = "ok"; });
+    server.set_route("/echo/", [](const util::network::http_server_request &req, util::network::http_server_response &rsp) {
+        rsp.content_type = "application/octet-stream";
+        rsp.headers.push_back(std::make_pair(std::string("X-Path"), req.path));
+        rsp.body = req.body;
+    });
+    server.set_route("/echo/deep/", [](const util::network::http_server_request &, util::network::http_server_response &rsp) { rsp.body = "deep"; });
+
+    CASE_EXPECT_EQ(0, server.listen(&loop, "127.0.0.1", 0));
+    CASE_EXPECT_GT(server.get_port(), 0);
+
+    // 同一个连接上的多个请求，包括流水线
+    test_server_client client;
+    test_server_client_start(&loop, client, server.get_port(),
+                             "GET /health HTTP/1.1\r\nHost: a\r\n\r\n"
+                             "POST /echo/x HTTP/1.1\r\nContent-Length: 5\r\n\r\nhello"
+                             "HEAD /health HTTP/1.1\r\n\r\n"
+                             "GET /echo/deep/1 HTTP/1.1\r\n\r\n"
+                             "GET /not-found HTTP/1.1\r\nConnection: close\r\n\r\n");
+    test_server_run(&loop, client.closed);
+
+    CASE_EXPECT_TRUE(client.closed);
+    CASE_EXPECT_EQ(5, test_server_count(client.response, "HTTP/1.1 "));
+    CASE_EXPECT_EQ(2, test_server_count(client.response, "HTTP/1.1 200 OK\r\nContent-Type: text/plain; charset=utf-8\r\nContent-Length: 2\r\n"));
+    CASE_EXPECT_EQ(1, test_server_count(client.response, "X-Path: /echo/x\r\nContent-Length: 5\r\nConnection: keep-alive\r\n\r\nhello"));
+    CASE_EXPECT_EQ(1, test_server_count(client.response, "\r\n\r\nokHTTP/1.1 200 OK"));
+    CASE_EXPECT_EQ(1, test_server_count(client.response, "\r\n\r\ndeep"));
+    CASE_EXPECT_EQ(1, test_server_count(client.response, "HTTP/1.1 404 Not Found"));
+    CASE_EXPECT_EQ(1, test_server_count(client.response, "Connection: close\r\n"));
+
+    CASE_EXPECT_EQ(1, server.get_stats().accepted_count);
+    CASE_EXPECT_EQ(5, server.get_stats().request_count);
+
+    // 错误的请求返回错误码后关闭连接
+    test_server_client bad_client;
+    test_server_client_start(&loop, bad_client, server.get_port(), "BAD\r\n\r\n");
+    test_server_run(&loop, bad_client.closed);
+    CASE_EXPECT_EQ(0, bad_client.response.find("HTTP/1.1 400 Bad Request\r\n"));
+    CASE_EXPECT_EQ(1, server.get_stats().error_count);
+
+    server.close();
+    test_server_run(&loop, server.is_closed());
+    CASE_EXPECT_TRUE(server.is_closed());
+    CASE_EXPECT_EQ(-1, server.get_port());
+
+    uv_run(&loop, UV_RUN_DEFAULT);
+    uv_loop_close(&loop);
+}
+
+CASE_TEST(http_server, connection_pool) {
+    uv_loop_t loop;
+    uv_loop_init(&loop);
+
+    util::network::http_server::options_t options;
+    options.max_connections       = 2;
+    options.keep_alive_timeout_ms = 100;
+
+    util::network::http_server server;
+    CASE_EXPECT_EQ(0, server.listen(&loop, "127.0.0.1", 0, options));
+
+    // 没有发送完的请求，占住连接
+    test_server_client clients[3];
+    for (int i = 0; i < 3; ++i) {
+        test_server_client_start(&loop, clients[i], server.get_port(), "GET / HTTP/1.1\r\n");
+    }
+
+    // 超出连接池的连接被立刻关闭，剩下的空闲超时后关闭
+    bool all_closed = false;
+    uint64_t end    = uv_now(&loop) + 5000;
+    while (!all_closed && uv_now(&loop) < end) {
+        uv_run(&loop, UV_RUN_ONCE);
+        all_closed = clients[0].closed && clients[1].closed && clients[2].closed;
+    }
+    CASE_EXPECT_TRUE(all_closed);
+    CASE_EXPECT_EQ(2, server.get_stats().accepted_count);
+    CASE_EXPECT_EQ(1, server.get_stats().rejected_count);
+    CASE_EXPECT_EQ(0, server.get_stats().active_connections);
+
+    // 连接释放后可以复用
+    test_server_client client;
+    test_server_client_start(&loop, client, server.get_port(), "GET / HTTP/1.0\r\n\r\n");
+    test_server_run(&loop, client.closed);
+    CASE_EXPECT_EQ(0, client.response.find("HTTP/1.1 404 Not Found\r\n"));
+    CASE_EXPECT_EQ(3, server.get_stats().accepted_count);
+
+    server.close();
+    test_server_run(&loop, server.is_closed());
+    uv_run(&loop, UV_RUN_DEFAULT);
+    uv_loop_close(&loop);
+}
+
+namespace {
+    static void test_server_on_status(util::cli::callback_param params) {
+        util::network::http_server::command_context_t *ctx = util::network::http_server::get_command_context(params);
+        if (NULL == ctx) {
+            return;
+        }
+
+        ctx->response->body = "status";
+        for (size_t i = 0; i < params.get_params_number(); ++i) {
+            ctx->response->body += " ";
+            ctx->response->body += params[i]->to_cpp_string();
+        }
+    }
+
+    // 没有调用get_command_context()的指令当作没有处理
+    static void test_server_on_ignored(util::cli::callback_param) {}
+} // namespace
+
+CASE_TEST(http_server, command_route) {
+    uv_loop_t loop;
+    uv_loop_init(&loop);
+
+    util::cli::cmd_option::ptr_type cmds = util::cli::cmd_option::create();
+    cmds->bind_cmd("status", test_server_on_status);
+    cmds->bind_cmd("ignored", test_server_on_ignored);
+
+    util::network::http_server server;
+    server.set_command_route("/admin", cmds);
+    server.set_default_handler([](const util::network::http_server_request &, util::network::http_server_response &rsp) {
+        rsp.status = 403;
+        rsp.body   = "forbidden";
+    });
+    CASE_EXPECT_EQ(0, server.listen(&loop, "127.0.0.1", 0));
+
+    test_server_client client;
+    test_server_client_start(&loop, client, server.get_port(),
+                             "GET /admin/status/a/b%20c HTTP/1.1\r\n\r\n"
+                             "GET /admin/unknown HTTP/1.1\r\n\r\n"
+                             "GET /admin/ignored HTTP/1.1\r\n\r\n"
+                             "GET /other HTTP/1.1\r\nConnection: close\r\n\r\n");
+    test_server_run(&loop, client.closed);
+
+    CASE_EXPECT_EQ(1, test_server_count(client.response, "\r\n\r\nstatus a b c"));
+    CASE_EXPECT_EQ(2, test_server_count(client.response, "HTTP/1.1 404 Not Found"));
+    CASE_EXPECT_EQ(1, test_server_count(client.response, "HTTP/1.1 403 Forbidden"));
+
+    server.close();
+    test_server_run(&loop, server.is_closed());
+    uv_run(&loop, UV_RUN_DEFAULT);
+    uv_loop_close(&loop);
+}
+
+CASE_TEST(http_server, pipeline_many) {
+    uv_loop_t loop;
+    uv_loop_init(&loop);
+
+    util::network::http_server server;
+    server.set_route("/metrics", [](const util::network::http_server_request &, util::network::http_server_response &rsp) {
+        rsp.body = "requests_total 1\n";
+    });
+    CASE_EXPECT_EQ(0, server.listen(&loop, "127.0.0.1", 0));
+
+    // 请求和响应都超过一次读取的大小
+    const int   request_count = 200;
+    std::string requests;
+    for (int i = 1; i < request_count; ++i) {
+        requests += "GET /metrics HTTP/1.1\r\n\r\n";
+    }
+    requests += "GET /metrics HTTP/1.1\r\nConnection: close\r\n\r\n";
+
+    test_server_client client;
+    test_server_client_start(&loop, client, server.get_port(), requests);
+    test_server_run(&loop, client.closed);
+
+    CASE_EXPECT_EQ(request_count, test_server_count(client.response, "requests_total 1\n"));
+    CASE_EXPECT_EQ(request_count, server.get_stats().request_count);
+
+    server.close();
+    test_server_run(&loop, server.is_closed());
+    uv_run(&loop, UV_RUN_DEFAULT);
+    uv_loop_close(&loop);
+}
+
+#endif
@@ -0,0 +1,313 @@
+﻿#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include "cli/cmd_option_value.h"
+#include "string/number_conv.h"
+#include "string/tquerystring.h"
+
+#include "frame/test_macros.h"
+
+namespace {
+    struct number_conv_test_random {
+        uint64_t state;
+        explicit number_conv_test_random(uint64_t seed) : state(seed) {}
+
+        uint64_t next() {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return state;
+        }
+    };
+
+    static double number_conv_test_from_bits(uint64_t bits) {
+        double ret;
+        memcpy(&ret, &bits, sizeof(ret));
+        return ret;
+    }
+
+    static uint64_t number_conv_test_to_bits(double in) {
+        uint64_t ret;
+        memcpy(&ret, &in, sizeof(ret));
+        return ret;
+    }
+
+    static std::string number_conv_test_double2str(double in) {
+        char buffer[util::string::NUMBER_CONV_DOUBLE_BUFFER_SIZE];
+        return std::string(buffer, util::string::double2str(buffer, sizeof(buffer), in));
+    }
+} // namespace
+
+CASE_TEST(number_conv, int2str_edge) {
+    char buffer[util::string::NUMBER_CONV_INT_BUFFER_SIZE];
+
+    CASE_EXPECT_EQ(1, util::string::int2str(buffer, sizeof(buffer), 0));
+    CASE_EXPECT_EQ("0", buffer);
+
+    CASE_EXPECT_EQ(20, util::string::int2str(buffer, sizeof(buffer), std::numeric_limits<int64_t>::min()));
+    CASE_EXPECT_EQ("-9223372036854775808", buffer);
+
+    CASE_EXPECT_EQ(20, util::string::int2str(buffer, sizeof(buffer), std::numeric_limits<uint64_t>::max()));
+    CASE_EXPECT_EQ("18446744073709551615", buffer);
+
+    CASE_EXPECT_EQ(4, util::string::int2str(buffer, sizeof(buffer), static_cast<int8_t>(-128)));
+    CASE_EXPECT_EQ("-128", buffer);
+
+    CASE_EXPECT_EQ(10, util::string::int2str(buffer, sizeof(buffer), 1000000000U));
+    CASE_EXPECT_EQ("1000000000", buffer);
+
+    // 和stringstream的结果对比
+    number_conv_test_random rnd(0x123456789ABCDEFULL);
+    for (int i = 0; i < 10000; ++i) {
+        int64_t           val = static_cast<int64_t>(rnd.next()) >> (rnd.next() % 64);
+        std::stringstream ss;
+        ss << val;
+        util::string::int2str(buffer, sizeof(buffer), val);
+        CASE_EXPECT_EQ(ss.str(), buffer);
+    }
+
+    CASE_EXPECT_EQ(1, util::string::count_digits(9));
+    CASE_EXPECT_EQ(2, util::string::count_digits(10));
+    CASE_EXPECT_EQ(19, util::string::count_digits(9999999999999999999ULL));
+    CASE_EXPECT_EQ(20, util::string::count_digits(10000000000000000000ULL));
+}
+
+CASE_TEST(number_conv, parse_int) {
+    int32_t i32  = 0;
+    size_t  used = 0;
+
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_SUCCESS, util::string::parse_int(i32, "-2147483648", 11, &used));
+    CASE_EXPECT_EQ(std::numeric_limits<int32_t>::min(), i32);
+    CASE_EXPECT_EQ(11, used);
+
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_OUT_OF_RANGE, util::string::parse_int(i32, "2147483648", 10));
+    CASE_EXPECT_EQ(std::numeric_limits<int32_t>::min(), i32);
+
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_SUCCESS, util::string::parse_int(i32, "+00000000000000000123abc", 24, &used));
+    CASE_EXPECT_EQ(123, i32);
+    CASE_EXPECT_EQ(21, used);
+
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_INVALID, util::string::parse_int(i32, "-abc", 4, &used));
+    CASE_EXPECT_EQ(0, used);
+
+    uint64_t u64 = 0;
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_SUCCESS, util::string::parse_int(u64, "18446744073709551615", 20));
+    CASE_EXPECT_EQ(std::numeric_limits<uint64_t>::max(), u64);
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_OUT_OF_RANGE, util::string::parse_int(u64, "18446744073709551616", 20));
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_OUT_OF_RANGE, util::string::parse_int(u64, "36893488147419103232", 20));
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_OUT_OF_RANGE, util::string::parse_int(u64, "100000000000000000000", 21));
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_OUT_OF_RANGE, util::string::parse_int(u64, "-1", 2));
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_SUCCESS, util::string::parse_int(u64, "-0", 2));
+    CASE_EXPECT_EQ(0, u64);
+
+    // 不要求以\0结尾
+    int16_t i16 = 0;
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_SUCCESS, util::string::parse_int(i16, "1234567", 3));
+    CASE_EXPECT_EQ(123, i16);
+
+    number_conv_test_random rnd(0xFEDCBA9876543210ULL);
+    for (int i = 0; i < 10000; ++i) {
+        int64_t val = static_cast<int64_t>(rnd.next()) >> (rnd.next() % 64);
+        char    buffer[util::string::NUMBER_CONV_INT_BUFFER_SIZE];
+        size_t  len   = util::string::int2str(buffer, sizeof(buffer), val);
+        int64_t check = 0;
+        CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_SUCCESS, util::string::parse_int(check, buffer, len));
+        CASE_EXPECT_EQ(val, check);
+        CASE_EXPECT_EQ(val, util::string::to_int<int64_t>(buffer));
+    }
+}
+
+CASE_TEST(number_conv, double2str) {
+    CASE_EXPECT_EQ("0", number_conv_test_double2str(0.0));
+    CASE_EXPECT_EQ("-0", number_conv_test_double2str(-0.0));
+    CASE_EXPECT_EQ("0.1", number_conv_test_double2str(0.1));
+    CASE_EXPECT_EQ("0.30000000000000004", number_conv_test_double2str(0.1 + 0.2));
+    CASE_EXPECT_EQ("123", number_conv_test_double2str(123.0));
+    CASE_EXPECT_EQ("-1.5", number_conv_test_double2str(-1.5));
+    CASE_EXPECT_EQ("100000000000000000000", number_conv_test_double2str(1e20));
+    CASE_EXPECT_EQ("1e+21", number_conv_test_double2str(1e21));
+    CASE_EXPECT_EQ("0.000001", number_conv_test_double2str(1e-6));
+    CASE_EXPECT_EQ("1e-7", number_conv_test_double2str(1e-7));
+    CASE_EXPECT_EQ("1.7976931348623157e+308", number_conv_test_double2str(std::numeric_limits<double>::max()));
+    CASE_EXPECT_EQ("5e-324", number_conv_test_double2str(std::numeric_limits<double>::denorm_min()));
+    CASE_EXPECT_EQ("inf", number_conv_test_double2str(std::numeric_limits<double>::infinity()));
+    CASE_EXPECT_EQ("-inf", number_conv_test_double2str(-std::numeric_limits<double>::infinity()));
+    CASE_EXPECT_EQ("nan", number_conv_test_double2str(std::numeric_limits<double>::quiet_NaN()));
+
+    char buffer[util::string::NUMBER_CONV_DOUBLE_BUFFER_SIZE];
+    CASE_EXPECT_EQ(0, util::string::double2str(buffer, 3, 0.125));
+    CASE_EXPECT_EQ(5, util::string::double2str(buffer, 5, 0.125));
+
+    CASE_EXPECT_EQ(3, util::string::float2str(buffer, sizeof(buffer), 0.1f));
+    CASE_EXPECT_EQ("0.1", buffer);
+    CASE_EXPECT_EQ(13, util::string::float2str(buffer, sizeof(buffer), std::numeric_limits<float>::max()));
+    CASE_EXPECT_EQ("3.4028235e+38", std::string(buffer));
+
+    // 随机数据必须可以被strtod精确还原
+    number_conv_test_random rnd(0x0123456789ABCDEFULL);
+    size_t                  failed = 0;
+    for (int i = 0; i < 100000; ++i) {
+        double val = number_conv_test_from_bits(rnd.next());
+        if (val != val || std::isinf(val)) {
+            continue;
+        }
+
+        size_t len = util::string::double2str(buffer, sizeof(buffer), val);
+        if (0 == len || number_conv_test_to_bits(strtod(buffer, NULL)) != number_conv_test_to_bits(val)) {
+            ++failed;
+        }
+
+        float fval = static_cast<float>(val);
+        if (std::isinf(fval)) {
+            continue;
+        }
+        len = util::string::float2str(buffer, sizeof(buffer), fval);
+        if (0 == len || strtof(buffer, NULL) != fval) {
+            ++failed;
+        }
+    }
+    CASE_EXPECT_EQ(0, failed);
+}
+
+CASE_TEST(number_conv, parse_double) {
+    double val  = 0;
+    size_t used = 0;
+
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_SUCCESS, util::string::parse_double(val, "3.25e2xyz", 9, &used));
+    CASE_EXPECT_EQ(325.0, val);
+    CASE_EXPECT_EQ(6, used);
+
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_SUCCESS, util::string::parse_double(val, "-.5e", 4, &used));
+    CASE_EXPECT_EQ(-0.5, val);
+    CASE_EXPECT_EQ(3, used);
+
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_SUCCESS, util::string::parse_double(val, "-Infinity", 9, &used));
+    CASE_EXPECT_TRUE(std::isinf(val) && val < 0);
+    CASE_EXPECT_EQ(9, used);
+
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_SUCCESS, util::string::parse_double(val, "NaN", 3));
+    CASE_EXPECT_TRUE(val != val);
+
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_INVALID, util::string::parse_double(val, ".e1", 3));
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_INVALID, util::string::parse_double(val, "", 0));
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_OUT_OF_RANGE, util::string::parse_double(val, "1e400", 5));
+    CASE_EXPECT_TRUE(std::isinf(val));
+
+    CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_SUCCESS, util::string::parse_double(val, "1e-400", 6));
+    CASE_EXPECT_EQ(0.0, val);
+
+    const char *samples[] = {"0.1",
+                             "2.2250738585072011e-308",
+                             "2.2250738585072014e-308",
+                             "4.9406564584124654e-324",
+                             "1.7976931348623157e308",
+                             "9007199254740993",
+                             "0.000000000000000000000000000000000000000000000000000000000000000000001",
+                             "123456789012345678901234567890",
+                             "2.47032822920623272088284396434110686182529901307162382212792841250337753635104375932649918180817996189"
+                             "898282347722858865463328355177969898199387398005390939063150356595155702263922908583924491051844359318"
+                             "028499365361525003193704576782492193656236698636584807570015857692699037063119282795585513329278343384"
+                             "093519780155312465972635795746227664652728272200563740064854999770965994704540208281662262378573934507"
+                             "363390079677619305775067401763246736009689513405355374585166611342237666786041621596804619144672918403"
+                             "005300575308490487653917113865916462395249126236538818796362393732804238910186723484976682350898633885"
+                             "879256283027559956575244555072551893136908362547791869486679949683240497058210285131854513962138377228"
+                             "261454376934125320985913276672363281255e-324",
+                             "1.00000000000000011102230246251565404236316680908203125",
+                             "1.00000000000000011102230246251565404236316680908203124",
+                             "1.00000000000000011102230246251565404236316680908203126"};
+    for (size_t i = 0; i < sizeof(samples) / sizeof(samples[0]); ++i) {
+        val = 0;
+        CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_SUCCESS, util::string::parse_double(val, samples[i], strlen(samples[i]), &used));
+        CASE_EXPECT_EQ(number_conv_test_to_bits(strtod(samples[i], NULL)), number_conv_test_to_bits(val));
+        CASE_EXPECT_EQ(strlen(samples[i]), used);
+    }
+
+    // 随机数据和strtod/strtof对比
+    number_conv_test_random rnd(0x13579BDF2468ACE0ULL);
+    size_t                  failed = 0;
+    for (int i = 0; i < 100000; ++i) {
+        char   buffer[64];
+        int    len;
+        double origin = number_conv_test_from_bits(rnd.next());
+        if (origin != origin || std::isinf(origin)) {
+            continue;
+        }
+
+        switch (i % 3) {
+        case 0:
+            len = UTIL_STRFUNC_SNPRINTF(buffer, sizeof(buffer), "%.17g", origin);
+            break;
+        case 1:
+            len = UTIL_STRFUNC_SNPRINTF(buffer, sizeof(buffer), "%.*g", static_cast<int>(rnd.next() % 17) + 1, origin);
+            break;
+        default:
+            len = UTIL_STRFUNC_SNPRINTF(buffer, sizeof(buffer), "%llu.%llue%d", static_cast<unsigned long long>(rnd.next()),
+                                        static_cast<unsigned long long>(rnd.next()), static_cast<int>(rnd.next() % 700) - 350);
+            break;
+        }
+
+        if (util::string::EN_NUMBER_CONV_INVALID == util::string::parse_double(val, buffer, static_cast<size_t>(len)) ||
+            number_conv_test_to_bits(strtod(buffer, NULL)) != number_conv_test_to_bits(val)) {
+            ++failed;
+        }
+
+        float fval = 0;
+        if (util::string::EN_NUMBER_CONV_INVALID == util::string::parse_float(fval, buffer, static_cast<size_t>(len)) ||
+            strtof(buffer, NULL) != fval) {
+            ++failed;
+        }
+    }
+    CASE_EXPECT_EQ(0, failed);
+}
+
+CASE_TEST(number_conv, integration) {
+    CASE_EXPECT_EQ("-123", util::uri::any_to_query_string(-123));
+    CASE_EXPECT_EQ("18446744073709551615", util::uri::any_to_query_string(std::numeric_limits<uint64_t>::max()));
+    CASE_EXPECT_EQ("3.141592653589793", util::uri::any_to_query_string(3.141592653589793));
+    CASE_EXPECT_EQ("0.1", util::uri::any_to_query_string(0.1f));
+    CASE_EXPECT_EQ("a", util::uri::any_to_query_string('a'));
+
+    CASE_EXPECT_EQ(-123, util::uri::query_string_to_any<int>(" -123"));
+    CASE_EXPECT_EQ(std::numeric_limits<int16_t>::max(), util::uri::query_string_to_any<int16_t>("99999"));
+    CASE_EXPECT_EQ(std::numeric_limits<int16_t>::min(), util::uri::query_string_to_any<int16_t>("-99999"));
+    CASE_EXPECT_EQ(0.1, util::uri::query_string_to_any<double>("0.1"));
+    CASE_EXPECT_EQ(0.1f, util::uri::query_string_to_any<float>("0.1"));
+    CASE_EXPECT_EQ('x', util::uri::query_string_to_any<char>("xyz"));
+
+    util::cli::cmd_option_value val1(" 2.5e3");
+    CASE_EXPECT_EQ(2500.0, val1.to_double());
+    CASE_EXPECT_EQ(2500.0f, val1.to_float());
+
+    util::cli::cmd_option_value val2("65535");
+    CASE_EXPECT_EQ(65535, val2.to<uint16_t>());
+    CASE_EXPECT_EQ(65535, val2.to<unsigned long long>());
+    CASE_EXPECT_EQ('6', val2.to<char>());
+}
+
+CASE_TEST(number_conv, compare_with_libc) {
+    std::string samples[64];
+    std::string int_samples[64];
+
+    number_conv_test_random rnd(0x2468ACE013579BDFULL);
+    for (size_t i = 0; i < 64; ++i) {
+        samples[i]     = number_conv_test_double2str(static_cast<double>(rnd.next() % 1000000000) / 1000.0 * (i % 2 ? 1 : -1));
+        int_samples[i] = samples[i].substr(0, samples[i].find('.'));
+    }
+
+    // 和strtod/strtoll的结果一致，输出的字符串可以还原出相同的值
+    for (size_t i = 0; i < 64; ++i) {
+        double val = 0;
+        CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_SUCCESS, util::string::parse_double(val, samples[i].c_str(), samples[i].size()));
+        CASE_EXPECT_EQ(number_conv_test_to_bits(strtod(samples[i].c_str(), NULL)), number_conv_test_to_bits(val));
+        CASE_EXPECT_EQ(samples[i], number_conv_test_double2str(val));
+
+        int64_t ival = 0;
+        CASE_EXPECT_EQ(util::string::EN_NUMBER_CONV_SUCCESS, util::string::parse_int(ival, int_samples[i].c_str(), int_samples[i].size()));
+        CASE_EXPECT_EQ(static_cast<int64_t>(strtoll(int_samples[i].c_str(), NULL, 10)), ival);
+    }
+}
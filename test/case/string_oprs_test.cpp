@@ -1,4 +1,6 @@
-﻿#include <map>
+﻿#include <cstring>
+#include <map>
+#include <sstream>
 #include <vector>
 
 #include "common/string_oprs.h"
@@ -81,6 +83,183 @@ CASE_TEST(tquerystring, encode_uri_utf8) {
     CASE_EXPECT_EQ("\xe4\xbd\xa0\xe5\xa5\xbd", util::uri::decode_uri_component("%E4%BD%A0%E5%A5%BD"));
 }
 
+// 逐字节处理的参考实现
+static std::string tquerystring_naive_encode(const char *safe_chars, const std::string &in, bool like_php) {
+    static const char hex_char_map[] = "0123456789ABCDEF";
+    std::string       ret;
+    for (size_t i = 0; i < in.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(in[i]);
+        if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || (0 != c && NULL != strchr(safe_chars, c))) {
+            ret += in[i];
+        } else if (like_php && ' ' == c) {
+            ret += '+';
+        } else {
+            ret += '%';
+            ret += hex_char_map[c >> 4];
+            ret += hex_char_map[c & 0x0F];
+        }
+    }
+    return ret;
+}
+
+static std::string tquerystring_naive_decode(const std::string &in, bool like_php) {
+    std::string ret;
+    for (size_t i = 0; i < in.size(); ++i) {
+        if (like_php && '+' == in[i]) {
+            ret += ' ';
+        } else if ('%' != in[i] || i + 2 >= in.size()) {
+            ret += in[i];
+        } else {
+            // 和原始实现一样，非法的16进制字符当作0
+            int val = 0;
+            for (size_t j = i + 1; j <= i + 2; ++j) {
+                char c = in[j];
+                val    = val * 16 + ((c >= '0' && c <= '9') ? c - '0' : ((c >= 'a' && c <= 'f') ? c - 'a' + 10 : ((c >= 'A' && c <= 'F') ? c - 'A' + 10 : 0)));
+            }
+            ret += static_cast<char>(val);
+            i += 2;
+        }
+    }
+    return ret;
+}
+
+CASE_TEST(tquerystring, encode_decode_buffer) {
+    // 随机内容，覆盖SIMD块边界、末尾不完整的转义和非ASCII字节
+    uint32_t seed = 2019;
+    for (int loop = 0; loop < 200; ++loop) {
+        std::string in;
+        size_t      len = loop % 100;
+        for (size_t i = 0; i < len; ++i) {
+            seed = seed * 1103515245 + 12345;
+            in.push_back(static_cast<char>("aZ9-_.!~*'();/?:@&=+$,# %\xe4\xbd\xa0"[(seed >> 16) % 28]));
+        }
+
+        CASE_EXPECT_EQ(tquerystring_naive_encode("-_.", in, false), util::uri::raw_encode_url(in.c_str(), in.size()));
+        CASE_EXPECT_EQ(tquerystring_naive_encode("-_.", in, true), util::uri::encode_url(in.c_str(), in.size()));
+        CASE_EXPECT_EQ(tquerystring_naive_encode("-_.!~*'()", in, false), util::uri::encode_uri_component(in.c_str(), in.size()));
+        CASE_EXPECT_EQ(tquerystring_naive_encode("-_.!~*'();/?:@&=+$,#", in, false), util::uri::encode_uri(in.c_str(), in.size()));
+        CASE_EXPECT_EQ(tquerystring_naive_decode(in, false), util::uri::decode_uri_component(in.c_str(), in.size()));
+        CASE_EXPECT_EQ(tquerystring_naive_decode(in, true), util::uri::decode_url(in.c_str(), in.size()));
+
+        std::string encoded = util::uri::encode_url(in.c_str(), in.size());
+        CASE_EXPECT_EQ(in, util::uri::decode_url(encoded.c_str(), encoded.size()));
+    }
+
+    // 输出到缓冲区
+    const char *in = "a b&c=\xe4\xbd\xa0";
+    char        buffer[64];
+    size_t      olen = 0;
+    CASE_EXPECT_EQ(-1, util::uri::encode_url(NULL, 0, &olen, in, strlen(in)));
+    CASE_EXPECT_EQ(19, olen);
+    CASE_EXPECT_EQ(-1, util::uri::encode_url(buffer, 18, &olen, in, strlen(in)));
+    CASE_EXPECT_EQ(19, olen);
+    CASE_EXPECT_EQ(0, util::uri::encode_url(buffer, 19, &olen, in, strlen(in)));
+    CASE_EXPECT_EQ("a+b%26c%3D%E4%BD%A0", std::string(buffer, olen));
+    CASE_EXPECT_EQ(0, util::uri::encode_url(buffer, sizeof(buffer), &olen, in, strlen(in)));
+    CASE_EXPECT_EQ(19, olen);
+
+    const char *encoded = "a+b%26c%3D%E4%BD%A0";
+    CASE_EXPECT_EQ(-1, util::uri::decode_url(buffer, 8, &olen, encoded, strlen(encoded)));
+    CASE_EXPECT_EQ(strlen(in), olen);
+    CASE_EXPECT_EQ(0, util::uri::decode_url(buffer, sizeof(buffer), &olen, encoded, strlen(encoded)));
+    CASE_EXPECT_EQ(in, std::string(buffer, olen));
+}
+
+CASE_TEST(tquerystring, encode_decode_payload) {
+    // 典型的URL和表单内容，覆盖SIMD整块复制和逐字节处理的分支
+    std::string url = "https://www.example.com/api/v1/user/profile?uid=1234567890&token=abcdef0123456789abcdef0123456789"
+                      "&redirect=https%3A%2F%2Fwww.example.com%2Fhome%3Ffrom%3Dlogin&lang=zh-CN&ts=1508214659";
+    std::string form;
+    for (int i = 0; i < 16; ++i) {
+        form += "nickname=\xe5\xb0\x8f\xe5\x86\x8c&message=Hello world, this is a test message!&avatar=https://cdn.example.com/a.png&";
+    }
+
+    std::string payloads[] = {url, form};
+    for (size_t i = 0; i < sizeof(payloads) / sizeof(payloads[0]); ++i) {
+        std::vector<char> buffer(payloads[i].size() * 3);
+        size_t            olen = 0;
+
+        CASE_EXPECT_EQ(0, util::uri::encode_url(&buffer[0], buffer.size(), &olen, payloads[i].c_str(), payloads[i].size()));
+        std::string encoded(&buffer[0], olen);
+        CASE_EXPECT_EQ(tquerystring_naive_encode("-_.", payloads[i], true), encoded);
+
+        // sz为0时和返回std::string的版本一样当作字符串
+        CASE_EXPECT_EQ(0, util::uri::encode_url(&buffer[0], buffer.size(), &olen, payloads[i].c_str(), 0));
+        CASE_EXPECT_EQ(encoded, std::string(&buffer[0], olen));
+
+        CASE_EXPECT_EQ(0, util::uri::decode_url(&buffer[0], buffer.size(), &olen, encoded.c_str(), encoded.size()));
+        CASE_EXPECT_EQ(tquerystring_naive_decode(encoded, true), std::string(&buffer[0], olen));
+        CASE_EXPECT_EQ(payloads[i], std::string(&buffer[0], olen));
+
+        CASE_EXPECT_EQ(0, util::uri::decode_url(&buffer[0], buffer.size(), &olen, encoded.c_str(), 0));
+        CASE_EXPECT_EQ(payloads[i], std::string(&buffer[0], olen));
+    }
+}
+
+CASE_TEST(tquerystring, view_decode) {
+    util::tquerystring_view qs;
+    std::string             input = "?a=wulala&page=ok!&c[]=x&c[]=y%20z&d[k2]=v2&d[k1]=v1&%E4%BD%A0=%E5%A5%BD&e[f][]=1&flag#hash=h";
+
+    CASE_EXPECT_TRUE(qs.decode(input.c_str(), input.size()));
+    CASE_EXPECT_EQ(8, qs.size());
+
+    // 没有转义的值直接引用输入
+    util::tquerystring_view::string_ref val;
+    CASE_EXPECT_TRUE(qs.get_string("a", val));
+    CASE_EXPECT_EQ("wulala", val.str());
+    CASE_EXPECT_TRUE(val.data >= input.data() && val.data < input.data() + input.size());
+    CASE_EXPECT_EQ("ok!", qs.get_string("page"));
+    CASE_EXPECT_EQ("\xe5\xa5\xbd", qs.get_string("\xe4\xbd\xa0"));
+    CASE_EXPECT_EQ("", qs.get_string("flag"));
+    CASE_EXPECT_EQ("h", qs.get_string("hash"));
+    CASE_EXPECT_EQ("", qs.get_string("not_exists"));
+    CASE_EXPECT_FALSE(qs.get_string("c", val));
+
+    const util::tquerystring_view::node_t *arr = qs.get("c");
+    CASE_EXPECT_TRUE(NULL != arr);
+    if (NULL != arr) {
+        CASE_EXPECT_EQ(util::types::ITEM_TYPE_ARRAY, arr->type);
+        CASE_EXPECT_EQ(2, arr->children_size);
+        CASE_EXPECT_EQ("x", qs.to_string(qs.at(arr, 0)));
+        CASE_EXPECT_EQ("y z", qs.to_string(qs.at(arr, 1)));
+        CASE_EXPECT_TRUE(NULL == qs.at(arr, 2));
+    }
+    CASE_EXPECT_EQ("[\"x\", \"y z\"]", qs.get_string("c"));
+
+    // Object按key排序
+    const util::tquerystring_view::node_t *obj = qs.get("d");
+    CASE_EXPECT_TRUE(NULL != obj);
+    if (NULL != obj) {
+        CASE_EXPECT_EQ(util::types::ITEM_TYPE_OBJECT, obj->type);
+        CASE_EXPECT_EQ("k1", qs.child(obj, 0)->key.str());
+        CASE_EXPECT_EQ("v2", qs.to_string(qs.get(obj, "k2", 2)));
+    }
+    CASE_EXPECT_EQ("{\"k1\": \"v1\", \"k2\": \"v2\"}", qs.get_string("d"));
+    CASE_EXPECT_EQ("{\"f\": [\"1\"]}", qs.get_string("e"));
+
+    // 和tquerystring的结果一致
+    util::tquerystring origin;
+    origin.decode(input.c_str() + 1, input.size() - 1);
+    CASE_EXPECT_EQ(origin.get_string("a"), qs.get_string("a"));
+    CASE_EXPECT_EQ(origin.get_string("d"), qs.get_string("d"));
+    CASE_EXPECT_EQ(origin.get_string("\xe4\xbd\xa0"), qs.get_string("\xe4\xbd\xa0"));
+
+    // 结构冲突的记录解析失败，其他记录不受影响
+    CASE_EXPECT_FALSE(qs.decode("a=1&a[b]=2&c[x]=3&c=4&d=5"));
+    CASE_EXPECT_EQ("1", qs.get_string("a"));
+    CASE_EXPECT_EQ("{\"x\": \"3\"}", qs.get_string("c"));
+    CASE_EXPECT_EQ("5", qs.get_string("d"));
+
+    // 重复赋值以最后一个为准
+    CASE_EXPECT_TRUE(qs.decode("a=1&a=2"));
+    CASE_EXPECT_EQ(1, qs.size());
+    CASE_EXPECT_EQ("2", qs.get_string("a"));
+
+    qs.clear();
+    CASE_EXPECT_TRUE(qs.empty());
+    CASE_EXPECT_TRUE(NULL == qs.get("a"));
+}
+
 
 CASE_TEST(string_oprs, trim) {
     const char *test_origin           = "  \t \n \rtrim done\t\n";
@@ -138,3 +317,148 @@ CASE_TEST(string_oprs, int2str) {
     CASE_EXPECT_EQ(0, util::string::int2str(buffer, 0, 123456789U));
     CASE_EXPECT_EQ(0, util::string::int2str(buffer, 8, 123456789U));
 }
+
+CASE_TEST(string_oprs, dumphex_simd) {
+    // 覆盖SIMD块和尾部的各种长度
+    std::string bin;
+    for (int i = 0; i < 300; ++i) {
+        bin.push_back(static_cast<char>((i * 37 + 11) & 0xFF));
+    }
+
+    for (size_t len = 0; len <= bin.size(); len += (len < 70 ? 1 : 23)) {
+        for (int upper = 0; upper < 2; ++upper) {
+            std::vector<char> expect(len * 2 + 1, 0), real(len * 2 + 1, 0);
+            util::string::dumphex<char>(bin.data(), len, &expect[0], 0 != upper);
+            util::string::dumphex(bin.data(), len, &real[0], 0 != upper);
+            CASE_EXPECT_EQ(std::string(&expect[0]), std::string(&real[0]));
+
+            std::stringstream ss;
+            util::string::dumphex(bin.data(), len, ss, 0 != upper);
+            CASE_EXPECT_EQ(std::string(&expect[0]), ss.str());
+
+            std::vector<unsigned char> decoded(len + 1);
+            size_t                     olen = 0;
+            CASE_EXPECT_EQ(0, util::string::hex_decode(&decoded[0], len, &olen, &real[0], len * 2));
+            CASE_EXPECT_EQ(len, olen);
+            CASE_EXPECT_EQ(0, len > 0 ? memcmp(&decoded[0], bin.data(), len) : 0);
+        }
+    }
+
+    // 非法字符在SIMD块中间或尾部
+    std::vector<char> hex_str(bin.size() * 2);
+    util::string::dumphex(bin.data(), bin.size(), &hex_str[0]);
+    std::vector<unsigned char> decoded(bin.size());
+    const char                 bad_chars[] = {'g', 'G', '/', ':', '@', '`', ' ', '\xff'};
+    for (size_t pos = 0; pos < hex_str.size(); pos += 13) {
+        for (size_t k = 0; k < sizeof(bad_chars); ++k) {
+            std::vector<char> bad = hex_str;
+            bad[pos]              = bad_chars[k];
+            size_t olen           = 0;
+            CASE_EXPECT_EQ(-2, util::string::hex_decode(&decoded[0], decoded.size(), &olen, &bad[0], bad.size()));
+            CASE_EXPECT_EQ(pos / 2, olen);
+        }
+    }
+
+    size_t olen = 0;
+    CASE_EXPECT_EQ(-2, util::string::hex_decode(&decoded[0], decoded.size(), &olen, "abc", 3));
+    CASE_EXPECT_EQ(-1, util::string::hex_decode(&decoded[0], 1, &olen, "AbCd", 4));
+    CASE_EXPECT_EQ(2, olen);
+    CASE_EXPECT_EQ(0, util::string::hex_decode(&decoded[0], 2, &olen, "AbCd", 4));
+    CASE_EXPECT_EQ(0xAB, decoded[0]);
+    CASE_EXPECT_EQ(0xCD, decoded[1]);
+}
+
+CASE_TEST(string_oprs, serialization_simd) {
+    std::string bin;
+    for (int i = 0; i < 200; ++i) {
+        bin.push_back(static_cast<char>(i % 7 == 0 ? (i & 0xFF) : ('a' + i % 26)));
+    }
+
+    // 用unsigned char的模板版本作为参照(char是有符号类型时，模板版本输出的大于0x7F的字节的8进制表示不正确)
+    std::string full_expect;
+    for (size_t os_limit = 0; os_limit < 1000; os_limit += 7) {
+        std::vector<unsigned char> expect(os_limit + 1, 0);
+        std::vector<char>          real(os_limit + 1, 0);
+        size_t                     expect_len = os_limit, real_len = os_limit;
+        util::string::serialization<unsigned char>(bin.data(), bin.size(), &expect[0], expect_len);
+        util::string::serialization(bin.data(), bin.size(), &real[0], real_len);
+        CASE_EXPECT_EQ(expect_len, real_len);
+        CASE_EXPECT_EQ(std::string(reinterpret_cast<const char *>(&expect[0]), expect_len), std::string(&real[0], real_len));
+        full_expect.assign(reinterpret_cast<const char *>(&expect[0]), expect_len);
+    }
+
+    std::stringstream real;
+    util::string::serialization(bin.data(), bin.size(), real);
+    CASE_EXPECT_EQ(full_expect, real.str());
+    CASE_EXPECT_EQ("\\214", std::string(real.str(), real.str().find("\\214"), 4));
+}
+
+CASE_TEST(string_oprs, case_simd) {
+    std::string origin;
+    for (int i = 0; i < 300; ++i) {
+        origin.push_back(static_cast<char>((i * 73 + 5) & 0xFF));
+    }
+
+    for (size_t len = 0; len <= origin.size(); len += (len < 70 ? 1 : 17)) {
+        std::string lower(len, 0), upper(len, 0), expect_lower(origin, 0, len), expect_upper(origin, 0, len);
+        for (size_t i = 0; i < len; ++i) {
+            expect_lower[i] = util::string::tolower(expect_lower[i]);
+            expect_upper[i] = util::string::toupper(expect_upper[i]);
+        }
+
+        if (len > 0) {
+            util::string::tolower(&lower[0], origin.data(), len);
+            util::string::toupper(&upper[0], origin.data(), len);
+        }
+        CASE_EXPECT_EQ(expect_lower, lower);
+        CASE_EXPECT_EQ(expect_upper, upper);
+
+        CASE_EXPECT_TRUE(util::string::case_equal(lower.data(), len, upper.data(), len));
+        CASE_EXPECT_EQ(0, util::string::case_compare(lower.data(), upper.data(), len));
+
+        // 每个位置改一个字节
+        if (len > 0) {
+            std::string diff = upper;
+            size_t      pos  = len * 7 / 11;
+            diff[pos]        = static_cast<char>(diff[pos] == '~' ? '}' : '~');
+            int expect       = static_cast<int>(static_cast<unsigned char>(util::string::tolower(lower[pos]))) - static_cast<int>('~');
+            if (diff[pos] == '}') {
+                expect = static_cast<int>('~') - static_cast<int>('}');
+            }
+            CASE_EXPECT_FALSE(util::string::case_equal(lower.data(), len, diff.data(), len));
+            int res = util::string::case_compare(lower.data(), diff.data(), len);
+            CASE_EXPECT_EQ(expect < 0, res < 0);
+            CASE_EXPECT_EQ(expect > 0, res > 0);
+        }
+    }
+
+    // 原地转换
+    std::string inplace = "Content-Type: APPLICATION/JSON; charset=UTF-8";
+    util::string::tolower(&inplace[0], inplace.data(), inplace.size());
+    CASE_EXPECT_EQ("content-type: application/json; charset=utf-8", inplace);
+
+    CASE_EXPECT_LT(util::string::case_compare("abc", 3, "ABCD", 4), 0);
+    CASE_EXPECT_GT(util::string::case_compare("abd", 3, "ABCD", 4), 0);
+    CASE_EXPECT_EQ(0, util::string::case_compare("Host", 4, "hOST", 4));
+    CASE_EXPECT_FALSE(util::string::case_equal("[", 1, "{", 1));
+}
+
+CASE_TEST(string_oprs, simd_large_block) {
+    std::string payload;
+    for (int i = 0; i < 4096; ++i) {
+        payload.push_back(static_cast<char>((i * 131 + 7) & 0xFF));
+    }
+
+    // 大块数据走完整的SIMD循环，结果和逐字节的版本一致
+    std::vector<char> expect_hex(payload.size() * 2), real_hex(payload.size() * 2);
+    util::string::dumphex<char>(payload.data(), payload.size(), &expect_hex[0]);
+    util::string::dumphex(payload.data(), payload.size(), &real_hex[0]);
+    CASE_EXPECT_TRUE(expect_hex == real_hex);
+
+    std::string expect_lower(payload.size(), 0), real_lower(payload.size(), 0);
+    for (size_t i = 0; i < payload.size(); ++i) {
+        expect_lower[i] = util::string::tolower(payload[i]);
+    }
+    util::string::tolower(&real_lower[0], payload.data(), payload.size());
+    CASE_EXPECT_EQ(expect_lower, real_lower);
+}
@@ -0,0 +1,189 @@
+﻿#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+#include <thread>
+#endif
+
+#include "frame/test_macros.h"
+
+#ifdef max
+#undef max
+#endif
+
+#include "mem_pool/lru_map.h"
+#include "string/string_pool.h"
+
+CASE_TEST(string_pool, basic) {
+    util::string::string_pool pool;
+
+    util::string::interned_string empty = pool.intern("");
+    CASE_EXPECT_TRUE(empty.empty());
+    CASE_EXPECT_EQ(0, empty.id());
+    CASE_EXPECT_EQ(0, empty.size());
+    CASE_EXPECT_EQ(std::string(""), std::string(empty.c_str()));
+    CASE_EXPECT_TRUE(empty == util::string::interned_string());
+
+    util::string::interned_string a1 = pool.intern("hello");
+    std::string                   hello = "hello";
+    util::string::interned_string a2 = pool.intern(hello);
+    util::string::interned_string b  = pool.intern("world", 5);
+
+    CASE_EXPECT_TRUE(a1 == a2);
+    CASE_EXPECT_TRUE(a1.c_str() == a2.c_str());
+    CASE_EXPECT_TRUE(a1 != b);
+    CASE_EXPECT_EQ(5, a1.size());
+    CASE_EXPECT_EQ(hello, a1.to_string());
+    CASE_EXPECT_EQ(0, a1.c_str()[a1.size()]);
+    CASE_EXPECT_NE(a1.id(), b.id());
+    CASE_EXPECT_NE(0, a1.id());
+    CASE_EXPECT_TRUE(a1 < b || b < a1);
+
+    // 包含\0的数据和前缀不会混淆
+    util::string::interned_string with_zero = pool.intern("hel\0lo", 6);
+    util::string::interned_string prefix    = pool.intern("hel", 3);
+    CASE_EXPECT_EQ(6, with_zero.size());
+    CASE_EXPECT_TRUE(with_zero != prefix);
+    CASE_EXPECT_TRUE(with_zero == pool.intern(std::string("hel\0lo", 6)));
+
+    CASE_EXPECT_TRUE(pool.find("hello", 5) == a1);
+    CASE_EXPECT_TRUE(pool.find("not exists", 10).empty());
+    CASE_EXPECT_TRUE(pool.get(a1.id()) == a1);
+    CASE_EXPECT_TRUE(pool.get(b.id()) == b);
+    CASE_EXPECT_TRUE(pool.get(0).empty());
+    CASE_EXPECT_TRUE(pool.get(0x7FFFFFF0).empty());
+
+    std::stringstream ss;
+    ss << a1 << ' ' << b;
+    CASE_EXPECT_EQ(std::string("hello world"), ss.str());
+
+    util::string::string_pool::stats_t stats = pool.get_stats();
+    CASE_EXPECT_EQ(4, stats.count);
+    CASE_EXPECT_EQ(5 + 5 + 6 + 3, stats.data_bytes);
+    CASE_EXPECT_GT(stats.memory_usage, stats.data_bytes);
+
+    // 不同的池之间相互独立
+    CASE_EXPECT_TRUE(util::string::string_pool::instance().intern("hello") != a1);
+}
+
+CASE_TEST(string_pool, many) {
+    util::string::string_pool                  pool;
+    std::vector<util::string::interned_string> handles;
+
+    char buffer[64];
+    for (int i = 0; i < 50000; ++i) {
+        int len = sprintf(buffer, "key_%d", i);
+        handles.push_back(pool.intern(buffer, static_cast<size_t>(len)));
+    }
+
+    // 长字符串单独分配
+    std::string long_str(20000, 'x');
+    util::string::interned_string long_handle = pool.intern(long_str);
+    CASE_EXPECT_EQ(long_str, long_handle.to_string());
+    CASE_EXPECT_TRUE(long_handle == pool.intern(long_str));
+
+    for (int i = 0; i < 50000; ++i) {
+        int len = sprintf(buffer, "key_%d", i);
+        util::string::interned_string h = pool.find(buffer, static_cast<size_t>(len));
+        CASE_EXPECT_TRUE(h == handles[static_cast<size_t>(i)]);
+        CASE_EXPECT_TRUE(pool.get(h.id()) == h);
+        if (h != handles[static_cast<size_t>(i)]) {
+            break;
+        }
+    }
+
+    CASE_EXPECT_EQ(50001, pool.get_stats().count);
+}
+
+CASE_TEST(string_pool, as_key) {
+    util::string::string_pool &pool = util::string::string_pool::instance();
+
+    std::unordered_map<util::string::interned_string, int> hash_map;
+    hash_map[pool.intern("name")] = 1;
+    hash_map[pool.intern("level")] = 2;
+    CASE_EXPECT_EQ(1, hash_map[pool.intern(std::string("name"))]);
+    CASE_EXPECT_EQ(2, hash_map[pool.intern(std::string("level"))]);
+    CASE_EXPECT_EQ(2, hash_map.size());
+
+    typedef util::mempool::lru_map<util::string::interned_string, int> lru_t;
+    lru_t lru;
+    lru.insert_key_value(pool.intern("a"), 1);
+    lru.insert_key_value(pool.intern("b"), 2);
+    CASE_EXPECT_FALSE(lru.insert_key_value(pool.intern(std::string("a")), 3).second);
+    CASE_EXPECT_EQ(2, lru.size());
+    lru_t::iterator iter = lru.find(pool.intern("a"));
+    CASE_EXPECT_TRUE(iter != lru.end());
+    if (iter != lru.end()) {
+        CASE_EXPECT_EQ(1, *iter->second);
+    }
+}
+
+#if !(defined(LOCK_DISABLE_MT) && LOCK_DISABLE_MT)
+CASE_TEST(string_pool, multi_thread) {
+    util::string::string_pool pool;
+
+    const int                                               thread_count = 8;
+    const int                                               key_count    = 5000;
+    std::vector<std::vector<util::string::interned_string> > results(thread_count);
+    std::vector<std::thread *>                              threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.push_back(new std::thread([&pool, &results, t, key_count]() {
+            char buffer[64];
+            for (int i = 0; i < key_count; ++i) {
+                // 每个线程用不同的顺序插入相同的字符串
+                int k   = (i * 7 + t * 131) % key_count;
+                int len = sprintf(buffer, "thread_key_%d", k);
+                results[static_cast<size_t>(t)].push_back(pool.intern(buffer, static_cast<size_t>(len)));
+            }
+        }));
+    }
+
+    for (size_t i = 0; i < threads.size(); ++i) {
+        threads[i]->join();
+        delete threads[i];
+    }
+
+    CASE_EXPECT_EQ(key_count, pool.get_stats().count);
+
+    char buffer[64];
+    for (int t = 0; t < thread_count; ++t) {
+        for (int i = 0; i < key_count; i += 97) {
+            int k   = (i * 7 + t * 131) % key_count;
+            int len = sprintf(buffer, "thread_key_%d", k);
+            CASE_EXPECT_TRUE(pool.find(buffer, static_cast<size_t>(len)) == results[static_cast<size_t>(t)][static_cast<size_t>(i)]);
+        }
+    }
+}
+#endif
+
+CASE_TEST(string_pool, hash_map_key) {
+    util::string::string_pool pool;
+
+    std::vector<std::string> keys;
+    char                     buffer[64];
+    for (int i = 0; i < 256; ++i) {
+        int len = sprintf(buffer, "category.module_%d", i);
+        keys.push_back(std::string(buffer, static_cast<size_t>(len)));
+    }
+
+    std::unordered_map<std::string, int>                   string_map;
+    std::unordered_map<util::string::interned_string, int> interned_map;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        string_map[keys[i]]                = static_cast<int>(i);
+        interned_map[pool.intern(keys[i])] = static_cast<int>(i);
+    }
+    CASE_EXPECT_EQ(string_map.size(), interned_map.size());
+
+    // 再次intern得到的是同一个字符串，查找结果和std::string作为key时一致
+    for (size_t i = 0; i < keys.size(); ++i) {
+        std::unordered_map<util::string::interned_string, int>::iterator iter = interned_map.find(pool.intern(keys[i]));
+        CASE_EXPECT_TRUE(iter != interned_map.end());
+        if (iter != interned_map.end()) {
+            CASE_EXPECT_EQ(string_map[keys[i]], iter->second);
+        }
+    }
+}
@@ -359,6 +359,112 @@ CASE_TEST(time_test, get_month_start_time) {
     CASE_EXPECT_TRUE(::util::time::time_utility::is_same_month(lt, rt - 1));
 }
 
+CASE_TEST(time_test, civil_days) {
+    CASE_EXPECT_EQ(0, util::time::time_utility::days_from_civil(1970, 1, 1));
+    CASE_EXPECT_EQ(-1, util::time::time_utility::days_from_civil(1969, 12, 31));
+    CASE_EXPECT_EQ(18321, util::time::time_utility::days_from_civil(2020, 2, 29));
+    CASE_EXPECT_EQ(-719468, util::time::time_utility::days_from_civil(0, 3, 1));
+
+    int      year  = 0;
+    unsigned month = 0;
+    unsigned day   = 0;
+    int64_t  prev  = util::time::time_utility::days_from_civil(1600, 1, 1) - 1;
+    for (int y = 1600; y <= 2400; ++y) {
+        for (unsigned m = 1; m <= 12; ++m) {
+            unsigned month_days = 31;
+            if (4 == m || 6 == m || 9 == m || 11 == m) {
+                month_days = 30;
+            } else if (2 == m) {
+                month_days = (0 == y % 4 && (0 != y % 100 || 0 == y % 400)) ? 29 : 28;
+            }
+
+            for (unsigned d = 1; d <= month_days; ++d) {
+                int64_t days = util::time::time_utility::days_from_civil(y, m, d);
+                util::time::time_utility::civil_from_days(days, year, month, day);
+                if (days != prev + 1 || year != y || month != m || day != d) {
+                    CASE_EXPECT_EQ(prev + 1, days);
+                    CASE_EXPECT_EQ(y, year);
+                    CASE_EXPECT_EQ(m, month);
+                    CASE_EXPECT_EQ(d, day);
+                    return;
+                }
+                prev = days;
+            }
+        }
+    }
+}
+
+CASE_TEST(time_test, get_gmt_tm) {
+    // 和libc的gmtime对比，包括1970年以前的时间
+    for (time_t t = -2208988800LL; t < 4102444800LL; t += 86399 * 7 + 3601) {
+        struct tm expect;
+        UTIL_STRFUNC_GMTIME_S(&t, &expect);
+        util::time::time_utility::raw_time_desc_t real = util::time::time_utility::get_gmt_tm(t);
+
+        if (expect.tm_year != real.tm_year || expect.tm_mon != real.tm_mon || expect.tm_mday != real.tm_mday || expect.tm_hour != real.tm_hour ||
+            expect.tm_min != real.tm_min || expect.tm_sec != real.tm_sec || expect.tm_wday != real.tm_wday || expect.tm_yday != real.tm_yday) {
+            CASE_MSG_INFO() << "get_gmt_tm mismatch at " << t << std::endl;
+            CASE_EXPECT_EQ(expect.tm_year, real.tm_year);
+            CASE_EXPECT_EQ(expect.tm_mon, real.tm_mon);
+            CASE_EXPECT_EQ(expect.tm_mday, real.tm_mday);
+            CASE_EXPECT_EQ(expect.tm_hour, real.tm_hour);
+            CASE_EXPECT_EQ(expect.tm_min, real.tm_min);
+            CASE_EXPECT_EQ(expect.tm_sec, real.tm_sec);
+            CASE_EXPECT_EQ(expect.tm_wday, real.tm_wday);
+            CASE_EXPECT_EQ(expect.tm_yday, real.tm_yday);
+            break;
+        }
+    }
+}
+
+CASE_TEST(time_test, calendar_cache) {
+    util::time::time_utility::update();
+    time_t old_zone = util::time::time_utility::get_zone_offset();
+    time_t tnow     = util::time::time_utility::get_now();
+
+    // 缓存命中和不命中的结果必须一致
+    for (int i = 0; i < 3; ++i) {
+        time_t zone = old_zone + i * 7 * util::time::time_utility::HOUR_SECONDS;
+        util::time::time_utility::set_zone_offset(zone);
+
+        util::time::time_utility::raw_time_desc_t now_tm = util::time::time_utility::get_local_tm(tnow);
+        CASE_EXPECT_EQ(now_tm.tm_mday, util::time::time_utility::get_month_day(tnow));
+        CASE_EXPECT_EQ(now_tm.tm_yday, util::time::time_utility::get_year_day(tnow));
+
+        time_t month_start = util::time::time_utility::get_month_start_time(tnow);
+        time_t prev_month  = util::time::time_utility::get_month_start_time(month_start - 1);
+        CASE_EXPECT_EQ(1, util::time::time_utility::get_local_tm(month_start).tm_mday);
+        CASE_EXPECT_EQ(0, util::time::time_utility::get_local_tm(month_start).tm_hour);
+        CASE_EXPECT_EQ(1, util::time::time_utility::get_local_tm(prev_month).tm_mday);
+        CASE_EXPECT_EQ(util::time::time_utility::get_day_start_time(month_start), month_start);
+        CASE_EXPECT_EQ(util::time::time_utility::get_any_day_offset(tnow), util::time::time_utility::get_day_start_time());
+
+        CASE_EXPECT_TRUE(util::time::time_utility::is_same_month(month_start, tnow));
+        CASE_EXPECT_FALSE(util::time::time_utility::is_same_month(month_start - 1, tnow));
+        CASE_EXPECT_TRUE(util::time::time_utility::is_same_month(month_start - 1, prev_month));
+        CASE_EXPECT_FALSE(util::time::time_utility::is_same_year(tnow, tnow + util::time::time_utility::YEAR_SECONDS + 1));
+        CASE_EXPECT_TRUE(util::time::time_utility::is_same_year(tnow - 1, tnow));
+        CASE_EXPECT_EQ(now_tm.tm_mday, util::time::time_utility::get_month_day(tnow));
+    }
+
+    util::time::time_utility::set_zone_offset(old_zone);
+}
+
+CASE_TEST(time_test, calendar_month_day) {
+    util::time::time_utility::update();
+    time_t tnow = util::time::time_utility::get_now();
+
+    // 每3小时取一次，覆盖一个多月，缓存命中和跨天跨月重新计算的结果都和gmtime一致
+    for (int i = 0; i < 256; ++i) {
+        time_t    t       = tnow + i * 3 * util::time::time_utility::HOUR_SECONDS;
+        time_t    local_t = t - util::time::time_utility::get_zone_offset();
+        struct tm ttm;
+        UTIL_STRFUNC_GMTIME_S(&local_t, &ttm);
+        CASE_EXPECT_EQ(ttm.tm_mday, util::time::time_utility::get_month_day(t));
+        CASE_EXPECT_EQ(ttm.tm_yday, util::time::time_utility::get_year_day(t));
+    }
+}
+
 typedef util::time::jiffies_timer<6, 3, 4> short_timer_t;
 struct jiffies_timer_fn {
     void *check_priv_data;
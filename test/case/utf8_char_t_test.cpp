@@ -0,0 +1,322 @@
+﻿#include <cstring>
+#include <string>
+#include <vector>
+
+#include "string/utf8_char_t.h"
+
+#include "frame/test_macros.h"
+
+#if defined(_MSC_VER) && _MSC_VER >= 1900
+#define U8_LITERALS(x) (u8 ## x)
+#elif defined(__clang__)
+// apple clang
+#if defined(__apple_build_version__)
+#if ((__clang_major__ * 100) + __clang_minor__) >= 600
+#define U8_LITERALS(x) (u8 ## x)
+#endif
+#else
+// clang
+#if ((__clang_major__ * 100) + __clang_minor__) >= 306
+#define U8_LITERALS(x) (u8 ## x)
+#endif
+#endif
+#elif defined(__GNUC__) && (__GNUC__ * 100 + __GNUC_MINOR__) >= 600
+#define U8_LITERALS(x) (u8 ## x)
+#endif
+
+#ifndef U8_LITERALS
+#define U8_LITERALS(x) x
+#endif
+
+namespace {
+    struct utf8_test_random {
+        uint64_t state;
+        explicit utf8_test_random(uint64_t seed) : state(seed) {}
+
+        uint32_t next() {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return static_cast<uint32_t>(state >> 16);
+        }
+    };
+
+    static void utf8_test_append(std::string &out, uint32_t cp) {
+        if (cp < 0x80) {
+            out.push_back(static_cast<char>(cp));
+        } else if (cp < 0x800) {
+            out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        } else if (cp < 0x10000) {
+            out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        } else {
+            out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+    }
+
+    // 按长度分布随机生成码点(不含代理区)
+    static uint32_t utf8_test_random_cp(utf8_test_random &rnd) {
+        switch (rnd.next() % 4) {
+            case 0:
+                return rnd.next() % 0x80;
+            case 1:
+                return 0x80 + rnd.next() % (0x800 - 0x80);
+            case 2: {
+                uint32_t ret = 0x800 + rnd.next() % (0x10000 - 0x800 - 0x800);
+                return ret >= 0xD800 ? ret + 0x800 : ret;
+            }
+            default:
+                return 0x10000 + rnd.next() % (0x110000 - 0x10000);
+        }
+    }
+
+    // 逐字节的参考实现，返回第一个非法字符的位置，合法返回sz
+    static size_t utf8_test_reference(const std::string &in, std::vector<uint32_t> *out) {
+        const unsigned char *s = reinterpret_cast<const unsigned char *>(in.data());
+        size_t               i = 0;
+        while (i < in.size()) {
+            unsigned char c   = s[i];
+            size_t        len = c < 0x80 ? 1 : (c >= 0xC2 && c < 0xE0) ? 2 : (c >= 0xE0 && c < 0xF0) ? 3 : (c >= 0xF0 && c < 0xF5) ? 4 : 0;
+            if (0 == len || i + len > in.size()) {
+                return i;
+            }
+
+            uint32_t cp = 1 == len ? c : (c & (0x7F >> len));
+            for (size_t k = 1; k < len; ++k) {
+                if ((s[i + k] & 0xC0) != 0x80) {
+                    return i;
+                }
+                cp = (cp << 6) | (s[i + k] & 0x3F);
+            }
+
+            static const uint32_t min_cp[5] = {0, 0, 0x80, 0x800, 0x10000};
+            if (cp < min_cp[len] || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+                return i;
+            }
+
+            if (NULL != out) {
+                out->push_back(cp);
+            }
+            i += len;
+        }
+
+        return i;
+    }
+} // namespace
+
+CASE_TEST(utf8_char_t, validate) {
+    CASE_EXPECT_TRUE(util::string::utf8_validate(NULL, 0));
+    CASE_EXPECT_TRUE(util::string::utf8_validate("", 0));
+    CASE_EXPECT_TRUE(util::string::utf8_validate("hello", 5));
+
+    std::string cjk = U8_LITERALS("你好，世界！");
+    CASE_EXPECT_TRUE(util::string::utf8_validate(cjk.data(), cjk.size()));
+
+    // 各类非法序列，前后填充到不同位置以覆盖SIMD的块边界
+    const char *bad_cases[] = {
+        "\x80",             // 单独的后续字节
+        "\xC0\x80",         // 超长编码
+        "\xC1\xBF",         // 超长编码
+        "\xE0\x80\x80",     // 超长编码
+        "\xE0\x9F\xBF",     // 超长编码
+        "\xED\xA0\x80",     // 代理区
+        "\xED\xBF\xBF",     // 代理区
+        "\xF0\x80\x80\x80", // 超长编码
+        "\xF0\x8F\xBF\xBF", // 超长编码
+        "\xF4\x90\x80\x80", // 超过 U+10FFFF
+        "\xF5\x80\x80\x80", // 超过 U+10FFFF
+        "\xFF",             // 非法字节
+        "\xC2",             // 不完整
+        "\xE4\xBD",         // 不完整
+        "\xF0\x9F\x98",     // 不完整
+        "\xC2\x41",         // 首字节后面不是后续字节
+        "\xE4\xBD\xA0\xA0", // 多余的后续字节
+    };
+
+    for (size_t i = 0; i < sizeof(bad_cases) / sizeof(bad_cases[0]); ++i) {
+        for (size_t prefix = 0; prefix < 140; prefix += 7) {
+            for (size_t suffix = 0; suffix < 70; suffix += 23) {
+                std::string input(prefix, 'a');
+                for (size_t k = 0; k + 3 <= prefix; k += 9) {
+                    input[k]     = '\xE4';
+                    input[k + 1] = '\xBD';
+                    input[k + 2] = '\xA0';
+                }
+                input += bad_cases[i];
+                input += std::string(suffix, 'b');
+
+                size_t error_pos = 0;
+                CASE_EXPECT_FALSE(util::string::utf8_validate(input.data(), input.size(), &error_pos));
+                CASE_EXPECT_EQ(utf8_test_reference(input, NULL), error_pos);
+            }
+        }
+    }
+
+    // 合法的边界值
+    std::string good;
+    utf8_test_append(good, 0x7F);
+    utf8_test_append(good, 0x80);
+    utf8_test_append(good, 0x7FF);
+    utf8_test_append(good, 0x800);
+    utf8_test_append(good, 0xD7FF);
+    utf8_test_append(good, 0xE000);
+    utf8_test_append(good, 0xFFFF);
+    utf8_test_append(good, 0x10000);
+    utf8_test_append(good, 0x10FFFF);
+    for (size_t prefix = 0; prefix < 70; ++prefix) {
+        std::string input = std::string(prefix, 'x') + good + good + good + good;
+        CASE_EXPECT_TRUE(util::string::utf8_validate(input.data(), input.size()));
+    }
+}
+
+CASE_TEST(utf8_char_t, validate_random) {
+    utf8_test_random rnd(0x9E3779B97F4A7C15ULL);
+    for (int loop = 0; loop < 2000; ++loop) {
+        std::string input;
+        size_t      chars = rnd.next() % 200;
+        bool        ascii = 0 == rnd.next() % 3;
+        for (size_t i = 0; i < chars; ++i) {
+            utf8_test_append(input, ascii ? rnd.next() % 0x80 : utf8_test_random_cp(rnd));
+        }
+
+        CASE_EXPECT_TRUE(util::string::utf8_validate(input.data(), input.size()));
+        CASE_EXPECT_EQ(chars, util::string::utf8_count(input.data(), input.size()));
+
+        // 随机改一个字节
+        if (!input.empty()) {
+            input[rnd.next() % input.size()] = static_cast<char>(rnd.next() & 0xFF);
+        }
+
+        size_t expect    = utf8_test_reference(input, NULL);
+        size_t error_pos = input.size();
+        CASE_EXPECT_EQ(expect == input.size(), util::string::utf8_validate(input.data(), input.size(), &error_pos));
+        CASE_EXPECT_EQ(expect, error_pos);
+    }
+}
+
+CASE_TEST(utf8_char_t, count) {
+    CASE_EXPECT_EQ(0, util::string::utf8_count(NULL, 0));
+    CASE_EXPECT_EQ(5, util::string::utf8_count("hello", 5));
+
+    std::string cjk = U8_LITERALS("你好，世界！");
+    CASE_EXPECT_EQ(6, util::string::utf8_count(cjk.data(), cjk.size()));
+
+    // 超过计数器的累加上限
+    std::string large;
+    for (int i = 0; i < 5000; ++i) {
+        large += cjk;
+        large += "a";
+    }
+    CASE_EXPECT_EQ(5000 * 7, util::string::utf8_count(large.data(), large.size()));
+}
+
+CASE_TEST(utf8_char_t, transcode) {
+    utf8_test_random rnd(20261017);
+    for (int loop = 0; loop < 500; ++loop) {
+        std::string input;
+        size_t      chars = rnd.next() % 300;
+        bool        ascii = 0 == rnd.next() % 2;
+        for (size_t i = 0; i < chars; ++i) {
+            utf8_test_append(input, (ascii && 0 != rnd.next() % 64) ? rnd.next() % 0x80 : utf8_test_random_cp(rnd));
+        }
+
+        std::vector<uint32_t> expect;
+        utf8_test_reference(input, &expect);
+
+        std::vector<uint16_t> expect16;
+        for (size_t i = 0; i < expect.size(); ++i) {
+            if (expect[i] >= 0x10000) {
+                expect16.push_back(static_cast<uint16_t>(0xD800 + ((expect[i] - 0x10000) >> 10)));
+                expect16.push_back(static_cast<uint16_t>(0xDC00 + ((expect[i] - 0x10000) & 0x3FF)));
+            } else {
+                expect16.push_back(static_cast<uint16_t>(expect[i]));
+            }
+        }
+
+        // 先获取长度
+        size_t olen = 0;
+        CASE_EXPECT_EQ(expect.empty() ? 0 : -1, util::string::utf8_to_utf32(NULL, 0, &olen, input.data(), input.size()));
+        CASE_EXPECT_EQ(expect.size(), olen);
+        CASE_EXPECT_EQ(expect16.empty() ? 0 : -1, util::string::utf8_to_utf16(NULL, 0, &olen, input.data(), input.size()));
+        CASE_EXPECT_EQ(expect16.size(), olen);
+
+        std::vector<uint32_t> out32(expect.size() + 1, 0);
+        CASE_EXPECT_EQ(0, util::string::utf8_to_utf32(&out32[0], out32.size(), &olen, input.data(), input.size()));
+        CASE_EXPECT_EQ(expect.size(), olen);
+        CASE_EXPECT_TRUE(0 == olen || 0 == memcmp(&expect[0], &out32[0], olen * sizeof(uint32_t)));
+
+        std::vector<uint16_t> out16(expect16.size() + 1, 0);
+        CASE_EXPECT_EQ(0, util::string::utf8_to_utf16(&out16[0], out16.size(), &olen, input.data(), input.size()));
+        CASE_EXPECT_EQ(expect16.size(), olen);
+        CASE_EXPECT_TRUE(0 == olen || 0 == memcmp(&expect16[0], &out16[0], olen * sizeof(uint16_t)));
+
+        // 缓冲区不足
+        if (expect16.size() > 1) {
+            CASE_EXPECT_EQ(-1, util::string::utf8_to_utf16(&out16[0], expect16.size() / 2, &olen, input.data(), input.size()));
+            CASE_EXPECT_EQ(expect16.size(), olen);
+        }
+    }
+
+    // 非法字符
+    std::string bad = std::string(40, 'a') + U8_LITERALS("你好") + "\xED\xA0\x80" + std::string(40, 'b');
+    uint32_t    out[128];
+    size_t      olen = 0;
+    CASE_EXPECT_EQ(-2, util::string::utf8_to_utf32(out, 128, &olen, bad.data(), bad.size()));
+    CASE_EXPECT_EQ(42, olen);
+    CASE_EXPECT_EQ(-2, util::string::utf8_to_utf32(out, 8, &olen, bad.data(), bad.size()));
+    CASE_EXPECT_EQ(8, olen);
+}
+
+CASE_TEST(utf8_char_t, truncate) {
+    std::string cjk = U8_LITERALS("a你好，世界！");
+    CASE_EXPECT_EQ(cjk.size(), util::string::utf8_truncate(cjk.data(), cjk.size(), 100));
+    CASE_EXPECT_EQ(1, util::string::utf8_truncate(cjk.data(), cjk.size(), 1));
+    CASE_EXPECT_EQ(1, util::string::utf8_truncate(cjk.data(), cjk.size(), 2));
+    CASE_EXPECT_EQ(1, util::string::utf8_truncate(cjk.data(), cjk.size(), 3));
+    CASE_EXPECT_EQ(4, util::string::utf8_truncate(cjk.data(), cjk.size(), 4));
+    CASE_EXPECT_EQ(4, util::string::utf8_truncate(cjk.data(), cjk.size(), 6));
+    CASE_EXPECT_EQ(0, util::string::utf8_truncate(cjk.data(), cjk.size(), 0));
+
+    CASE_EXPECT_EQ(0, util::string::utf8_truncate_chars(cjk.data(), cjk.size(), 0));
+    CASE_EXPECT_EQ(1, util::string::utf8_truncate_chars(cjk.data(), cjk.size(), 1));
+    CASE_EXPECT_EQ(7, util::string::utf8_truncate_chars(cjk.data(), cjk.size(), 3));
+    CASE_EXPECT_EQ(cjk.size(), util::string::utf8_truncate_chars(cjk.data(), cjk.size(), 7));
+    CASE_EXPECT_EQ(cjk.size(), util::string::utf8_truncate_chars(cjk.data(), cjk.size(), 100));
+
+    // 长文本，跨过按块统计的部分
+    std::string large;
+    for (int i = 0; i < 1000; ++i) {
+        large += cjk;
+    }
+    for (size_t chars = 0; chars <= 7000; chars += 333) {
+        size_t len = util::string::utf8_truncate_chars(large.data(), large.size(), chars);
+        CASE_EXPECT_EQ((chars / 7) * cjk.size() + ((chars % 7) > 0 ? 1 + (chars % 7 - 1) * 3 : 0), len);
+        CASE_EXPECT_EQ(chars, util::string::utf8_count(large.data(), len));
+    }
+}
+
+CASE_TEST(utf8_char_t, large_message) {
+    std::string message;
+    while (message.size() < 64 * 1024) {
+        message += U8_LITERALS("你好，世界！Hello world. 这是一条用来测试的聊天消息。");
+    }
+
+    // 长消息走完整的SIMD循环，结果和逐字节的实现一致
+    size_t error_pos = 0;
+    CASE_EXPECT_TRUE(util::string::utf8_validate(message.data(), message.size(), &error_pos));
+    CASE_EXPECT_EQ(message.size(), utf8_test_reference(message, NULL));
+
+    std::vector<uint32_t> code_points;
+    utf8_test_reference(message, &code_points);
+    CASE_EXPECT_EQ(code_points.size(), util::string::utf8_count(message.data(), message.size()));
+
+    // 在中间放一个非法字节
+    message[message.size() / 2 + 1] = static_cast<char>(0xFF);
+    CASE_EXPECT_FALSE(util::string::utf8_validate(message.data(), message.size(), &error_pos));
+    CASE_EXPECT_EQ(utf8_test_reference(message, NULL), error_pos);
+}
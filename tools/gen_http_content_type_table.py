@@ -0,0 +1,102 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import sys
+
+""" generate src/network/http_content_type_table.h from a mime.types file (/etc/mime.types of debian, derived from IANA) """
+
+# types used by browsers and CDN which are different from or missing in mime.types
+OVERRIDE_EXTENSIONS = {
+    'ico': 'image/x-icon',
+    'ts': 'video/mp2t',
+    'map': 'application/json',
+    'yaml': 'application/yaml',
+    'yml': 'application/yaml',
+    'toml': 'application/toml',
+    'mjs': 'text/javascript',
+    'js': 'text/javascript',
+    'webmanifest': 'application/manifest+json',
+}
+
+# preferred extension of types which have many extensions
+PREFERRED_EXTENSIONS = {
+    'image/jpeg': 'jpg',
+    'text/plain': 'txt',
+    'text/html': 'html',
+    'audio/mpeg': 'mp3',
+    'video/mpeg': 'mpeg',
+    'application/octet-stream': 'bin',
+    'text/javascript': 'js',
+    'application/yaml': 'yaml',
+}
+
+
+def main(mime_types_path, output_path):
+    ext_map = {}
+    type_exts = {}
+    with open(mime_types_path, 'r') as f:
+        for line in f:
+            fields = line.split('#')[0].split()
+            if len(fields) < 2:
+                continue
+            mime = fields[0]
+            for ext in fields[1:]:
+                ext = ext.lower()
+                type_exts.setdefault(mime.lower(), (mime, []))[1].append(ext)
+                # the first type wins
+                if ext not in ext_map:
+                    ext_map[ext] = mime
+
+    for ext, mime in OVERRIDE_EXTENSIONS.items():
+        ext_map[ext] = mime
+        entry = type_exts.setdefault(mime.lower(), (mime, []))
+        if ext not in entry[1]:
+            entry[1].append(ext)
+
+    for mime, ext in PREFERRED_EXTENSIONS.items():
+        entry = type_exts.get(mime)
+        if entry is not None and ext in entry[1]:
+            entry[1].remove(ext)
+            entry[1].insert(0, ext)
+
+    lines = []
+    lines.append('// This file is generated by tools/gen_http_content_type_table.py, please don\'t edit it')
+    lines.append('')
+    lines.append('#ifndef UTILS_NETWORK_HTTP_CONTENT_TYPE_TABLE_H')
+    lines.append('#define UTILS_NETWORK_HTTP_CONTENT_TYPE_TABLE_H')
+    lines.append('')
+    lines.append('#pragma once')
+    lines.append('')
+    lines.append('namespace util {')
+    lines.append('    namespace network {')
+    lines.append('        namespace http_content_type {')
+    lines.append('            namespace detail {')
+    lines.append('                // sorted by extension(lower case), for binary search')
+    lines.append('                static const extension_entry_t extension_table[] = {')
+    for ext in sorted(ext_map.keys()):
+        lines.append('                    {"{0}", {1}, "{2}"},'.replace('{0}', ext).replace('{1}', str(len(ext))).replace('{2}', ext_map[ext]))
+    lines.append('                };')
+    lines.append('')
+    lines.append('                // sorted by type(lower case) with the preferred extension, for binary search')
+    lines.append('                static const extension_entry_t type_table[] = {')
+    for mime in sorted(type_exts.keys()):
+        origin, exts = type_exts[mime]
+        lines.append('                    {"{0}", {1}, "{2}"},'.replace('{0}', exts[0]).replace('{1}', str(len(exts[0]))).replace('{2}', origin))
+    lines.append('                };')
+    lines.append('            } // namespace detail')
+    lines.append('        }     // namespace http_content_type')
+    lines.append('    }         // namespace network')
+    lines.append('} // namespace util')
+    lines.append('')
+    lines.append('#endif')
+    lines.append('')
+
+    with open(output_path, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 3:
+        print('usage: ' + sys.argv[0] + ' <mime.types> <output file>')
+        sys.exit(1)
+    main(sys.argv[1], sys.argv[2])